@@ -0,0 +1,633 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <grpcpp/alarm.h>
+#include <grpcpp/completion_queue.h>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/async_stream.h>
+#include <grpcpp/support/async_unary_call.h>
+
+#include "log.h"
+
+namespace mavsdk {
+namespace backend {
+
+/*
+ * Everything handed to the server completion queue as tag. The worker threads
+ * running the queue call `proceed` with the result of the operation.
+ */
+class AsyncTag {
+public:
+    virtual ~AsyncTag() = default;
+    virtual void proceed(bool ok) = 0;
+};
+
+// Returns the number sent by the client under `key`. Anything that isn't a plain
+// number counts as 0, i.e. not set.
+inline unsigned metadata_value(const grpc::ServerContext& context, const char* key)
+{
+    const auto& metadata = context.client_metadata();
+    auto it = metadata.find(key);
+    if (it == metadata.end()) {
+        return 0;
+    }
+
+    const std::string value(it->second.data(), it->second.size());
+    char* end = nullptr;
+    const unsigned long result = std::strtoul(value.c_str(), &end, 10);
+    if (value.empty() || *end != '\0' || value[0] == '-') {
+        return 0;
+    }
+    return static_cast<unsigned>(result);
+}
+
+/*
+ * How a stream holds back writes to send them together.
+ *
+ * Sending every update on its own costs a flush, and usually a syscall, per
+ * message. With batching, messages are collected for up to `max_delay` or until
+ * `max_messages` are waiting, whichever comes first, and then written in one go
+ * with only the last write flushing the transport.
+ *
+ * Clients opt in per call by adding the metadata keys below, e.g.
+ * `mavsdk-batch-max-delay-ms: 50` and `mavsdk-batch-max-messages: 20`.
+ */
+struct BatchOptions {
+    static constexpr const char* max_delay_key = "mavsdk-batch-max-delay-ms";
+    static constexpr const char* max_messages_key = "mavsdk-batch-max-messages";
+
+    std::chrono::milliseconds max_delay{0};
+    unsigned max_messages{0};
+
+    // Batching needs a delay to wait for more messages. Without a limit on the
+    // number of messages, the delay alone decides.
+    bool enabled() const { return max_delay.count() > 0 && max_messages != 1; }
+
+    static BatchOptions from_metadata(const grpc::ServerContext& context)
+    {
+        BatchOptions options;
+        options.max_delay = std::chrono::milliseconds(metadata_value(context, max_delay_key));
+        options.max_messages = metadata_value(context, max_messages_key);
+        return options;
+    }
+};
+
+/*
+ * How many messages a stream keeps for a client which reads slower than updates
+ * come in. Once more are waiting, the oldest waiting message is dropped, so with
+ * a limit of 1 the client only ever gets the latest value. Messages held back for
+ * a batch count as waiting too.
+ *
+ * Without a limit, a slow client would make the queue grow without bounds. The
+ * writes never block, so the threads delivering the updates are not held up
+ * either way.
+ *
+ * Clients can set their own limit with the metadata key below, e.g.
+ * `mavsdk-max-waiting-messages: 1`.
+ */
+struct QueueOptions {
+    static constexpr const char* max_waiting_key = "mavsdk-max-waiting-messages";
+    // Sent as trailing metadata when the stream is finished, if any were dropped.
+    static constexpr const char* dropped_key = "mavsdk-dropped-messages";
+    static constexpr unsigned default_max_waiting = 100;
+
+    unsigned max_waiting{default_max_waiting};
+
+    static QueueOptions from_metadata(const grpc::ServerContext& context)
+    {
+        QueueOptions options;
+        const unsigned max_waiting = metadata_value(context, max_waiting_key);
+        if (max_waiting > 0) {
+            options.max_waiting = max_waiting;
+        }
+        return options;
+    }
+};
+
+class AsyncStream {
+public:
+    virtual ~AsyncStream() = default;
+
+    // Ends the stream once everything queued is written.
+    virtual void finish() = 0;
+
+    // Messages dropped because the client did not keep up, see QueueOptions.
+    virtual uint64_t dropped_messages() const = 0;
+};
+
+/*
+ * One call of a server streaming method served through the completion queue.
+ *
+ * Instead of blocking a thread for the duration of the stream, writes are queued
+ * from any thread and sent one after the other as the previous one completes.
+ * The stream keeps itself alive while it is running and goes away once the call
+ * is done and no more operations are pending.
+ *
+ * If the client asked for it (see BatchOptions), queued messages are held back and
+ * released in batches. How many messages can wait is limited (see QueueOptions).
+ */
+template<class Request, class Response>
+class AsyncServerStream : public AsyncStream {
+public:
+    typedef std::function<void(
+        grpc::ServerContext* context,
+        Request* request,
+        grpc::ServerAsyncWriter<Response>* writer,
+        void* tag)>
+        request_function_t;
+    typedef std::function<void(const std::shared_ptr<AsyncServerStream>& stream)>
+        stream_callback_t;
+
+    // `on_started` is called when a client calls the method, `on_done` when the
+    // stream ended, either because the client went away or it was finished. The
+    // queue is needed to time batches, without it writes are never batched.
+    static std::shared_ptr<AsyncServerStream> create(
+        stream_callback_t on_started,
+        stream_callback_t on_done,
+        grpc::CompletionQueue* queue = nullptr)
+    {
+        std::shared_ptr<AsyncServerStream> stream(
+            new AsyncServerStream(on_started, on_done, queue));
+        stream->_weak_self = stream;
+        return stream;
+    }
+
+    ~AsyncServerStream() = default;
+
+    // Waits for the next call of the method. Until the call started, the stream
+    // needs to be kept alive by the owner.
+    void request(const request_function_t& request_function)
+    {
+        _context.AsyncNotifyWhenDone(&_done_tag);
+        request_function(&_context, &_request, &_writer, &_started_tag);
+    }
+
+    const Request& request_message() const { return _request; }
+
+    const grpc::ServerContext& context() const { return _context; }
+
+    const BatchOptions& batch_options() const { return _batch_options; }
+
+    uint64_t dropped_messages() const override
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _dropped;
+    }
+
+    void write(const Response& response)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (!_started || _done || _finishing) {
+            return;
+        }
+
+        auto message = take_spare_locked();
+        *message = response;
+        queue_locked(std::move(message));
+    }
+
+    // Like write, but takes the contents of `response` instead of copying them. In
+    // return, `response` gets a message written before, so its nested messages can
+    // be reused by the caller without allocating new ones.
+    void write_swapped(Response& response)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (!_started || _done || _finishing) {
+            return;
+        }
+
+        auto message = take_spare_locked();
+        message->Swap(&response);
+        queue_locked(std::move(message));
+    }
+
+    void finish() override { finish(grpc::Status::OK); }
+
+    // Ends the stream with `status` once everything queued is written, e.g. with an
+    // error if the request can't be served.
+    void finish(const grpc::Status& status)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (!_started || _done || _finishing) {
+            return;
+        }
+
+        _finishing = true;
+        _finish_status = status;
+        release_locked();
+        if (!_write_in_flight) {
+            start_finish_locked();
+        }
+    }
+
+    // Non-copyable
+    AsyncServerStream(const AsyncServerStream&) = delete;
+    const AsyncServerStream& operator=(const AsyncServerStream&) = delete;
+
+private:
+    AsyncServerStream(
+        stream_callback_t on_started, stream_callback_t on_done, grpc::CompletionQueue* queue) :
+        _on_started(on_started),
+        _on_done(on_done),
+        _completion_queue(queue)
+    {}
+
+    class Tag : public AsyncTag {
+    public:
+        Tag(AsyncServerStream& stream, void (AsyncServerStream::*handler)(bool)) :
+            _stream(stream),
+            _handler(handler)
+        {}
+
+        void proceed(bool ok) override { (_stream.*_handler)(ok); }
+
+    private:
+        AsyncServerStream& _stream;
+        void (AsyncServerStream::*_handler)(bool);
+    };
+
+    void on_started(bool ok)
+    {
+        if (!ok) {
+            // The server is shutting down, the call never started.
+            return;
+        }
+
+        std::shared_ptr<AsyncServerStream> self = _weak_self.lock();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _started = true;
+            _self = self;
+            _queue_options = QueueOptions::from_metadata(_context);
+            if (_completion_queue != nullptr) {
+                _batch_options = BatchOptions::from_metadata(_context);
+            }
+        }
+
+        if (_on_started) {
+            _on_started(self);
+        }
+
+        // The events can be handled by different threads, so the client might have
+        // gone away before or while `_on_started` ran. Either way `_on_done` only
+        // follows now, so it can undo everything `_on_started` did.
+        bool done_already = false;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _start_handled = true;
+            done_already = _done_before_start;
+        }
+
+        if (done_already) {
+            on_done(true);
+        }
+    }
+
+    void on_write_done(bool ok)
+    {
+        std::shared_ptr<AsyncServerStream> released;
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _write_in_flight = false;
+        recycle_locked(std::move(_queue.front()));
+        _queue.pop_front();
+        --_released;
+
+        if (!ok || _done) {
+            // The stream is broken or gone, the done notification follows or was there.
+            _queue.clear();
+            _released = 0;
+        } else if (_released > 0) {
+            start_write_locked();
+        } else if (_finishing && !_done) {
+            start_finish_locked();
+        }
+
+        released = release_if_idle_locked();
+    }
+
+    void on_alarm(bool ok)
+    {
+        std::shared_ptr<AsyncServerStream> released;
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _alarm_set = false;
+        // Not ok means the alarm was cancelled because the stream is done.
+        if (ok && !_done) {
+            release_locked();
+        }
+
+        released = release_if_idle_locked();
+    }
+
+    void on_finish_done(bool /* ok */)
+    {
+        std::shared_ptr<AsyncServerStream> released;
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _finish_in_flight = false;
+        released = release_if_idle_locked();
+    }
+
+    void on_done(bool /* ok */)
+    {
+        std::shared_ptr<AsyncServerStream> self;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_start_handled) {
+                _done_before_start = true;
+                return;
+            }
+            _done = true;
+            // The message being written needs to stay until the write completed.
+            _queue.erase(_write_in_flight ? _queue.begin() + 1 : _queue.begin(), _queue.end());
+            _released = _queue.size();
+            if (_alarm_set) {
+                _alarm.Cancel();
+            }
+            self = _self;
+        }
+
+        if (_on_done) {
+            _on_done(self);
+        }
+
+        std::shared_ptr<AsyncServerStream> released;
+        std::lock_guard<std::mutex> lock(_mutex);
+        released = release_if_idle_locked();
+    }
+
+    std::unique_ptr<Response> take_spare_locked()
+    {
+        if (_spare.empty()) {
+            return std::unique_ptr<Response>(new Response());
+        }
+
+        auto message = std::move(_spare.back());
+        _spare.pop_back();
+        return message;
+    }
+
+    void recycle_locked(std::unique_ptr<Response> message)
+    {
+        if (_spare.size() < _max_spare) {
+            _spare.push_back(std::move(message));
+        }
+    }
+
+    void queue_locked(std::unique_ptr<Response> message)
+    {
+        _queue.push_back(std::move(message));
+
+        const size_t in_flight = _write_in_flight ? 1 : 0;
+        if (_queue.size() - in_flight > _queue_options.max_waiting) {
+            drop_oldest_waiting_locked(in_flight);
+        }
+
+        if (!_batch_options.enabled()) {
+            release_locked();
+        } else if (
+            _batch_options.max_messages > 0 &&
+            _queue.size() - _released >= _batch_options.max_messages) {
+            release_locked();
+        } else if (!_alarm_set) {
+            _alarm_set = true;
+            _alarm.Set(
+                _completion_queue,
+                std::chrono::system_clock::now() + _batch_options.max_delay,
+                &_alarm_tag);
+        }
+    }
+
+    // The message being written is at the front, so the oldest waiting one follows.
+    void drop_oldest_waiting_locked(size_t oldest)
+    {
+        recycle_locked(std::move(_queue[oldest]));
+        _queue.erase(_queue.begin() + oldest);
+        if (oldest < _released) {
+            --_released;
+        }
+
+        if (_dropped++ == 0) {
+            LogWarn() << "Client reads too slowly, dropping messages";
+        }
+    }
+
+    // Lets everything queued so far be written. A batch timer still running then
+    // releases the next batch a bit early, which is cheaper than cancelling it.
+    void release_locked()
+    {
+        _released = _queue.size();
+        if (_released > 0 && !_write_in_flight) {
+            start_write_locked();
+        }
+    }
+
+    void start_write_locked()
+    {
+        _write_in_flight = true;
+
+        // More released messages follow right away, so this one doesn't need to be
+        // flushed on its own.
+        grpc::WriteOptions options;
+        if (_released > 1) {
+            options.set_buffer_hint();
+        }
+        _writer.Write(*_queue.front(), options, &_write_tag);
+    }
+
+    void start_finish_locked()
+    {
+        if (_dropped > 0) {
+            _context.AddTrailingMetadata(QueueOptions::dropped_key, std::to_string(_dropped));
+        }
+
+        _finish_in_flight = true;
+        _writer.Finish(_finish_status, &_finish_tag);
+    }
+
+    // The returned pointer needs to outlive the lock, so we are not destroyed
+    // while still holding our own mutex.
+    std::shared_ptr<AsyncServerStream> release_if_idle_locked()
+    {
+        std::shared_ptr<AsyncServerStream> released;
+        if (_done && !_write_in_flight && !_finish_in_flight && !_alarm_set) {
+            released.swap(_self);
+        }
+        return released;
+    }
+
+    stream_callback_t _on_started;
+    stream_callback_t _on_done;
+    grpc::CompletionQueue* _completion_queue;
+
+    grpc::ServerContext _context{};
+    Request _request{};
+    grpc::ServerAsyncWriter<Response> _writer{&_context};
+
+    Tag _started_tag{*this, &AsyncServerStream::on_started};
+    Tag _write_tag{*this, &AsyncServerStream::on_write_done};
+    Tag _finish_tag{*this, &AsyncServerStream::on_finish_done};
+    Tag _done_tag{*this, &AsyncServerStream::on_done};
+    Tag _alarm_tag{*this, &AsyncServerStream::on_alarm};
+
+    BatchOptions _batch_options{};
+    QueueOptions _queue_options{};
+    grpc::Alarm _alarm{};
+
+    mutable std::mutex _mutex{};
+    std::deque<std::unique_ptr<Response>> _queue{};
+    // Number of messages at the front of the queue which can be written, the
+    // others wait for their batch to be complete.
+    size_t _released{0};
+    uint64_t _dropped{0};
+    // Messages already written, kept to be filled again.
+    std::vector<std::unique_ptr<Response>> _spare{};
+    static constexpr size_t _max_spare = 4;
+    bool _started{false};
+    // Set once `_on_started` returned, `_on_done` is held back until then.
+    bool _start_handled{false};
+    bool _write_in_flight{false};
+    bool _alarm_set{false};
+    bool _finishing{false};
+    grpc::Status _finish_status{};
+    bool _finish_in_flight{false};
+    bool _done{false};
+    bool _done_before_start{false};
+    std::weak_ptr<AsyncServerStream> _weak_self{};
+    std::shared_ptr<AsyncServerStream> _self{};
+};
+
+/*
+ * One call of a unary method served through the completion queue.
+ *
+ * The response is sent with respond(), usually right from `on_started`. The call
+ * keeps itself alive from the moment it started until the response is sent.
+ */
+template<class Request, class Response>
+class AsyncUnaryCall {
+public:
+    typedef std::function<void(
+        grpc::ServerContext* context,
+        Request* request,
+        grpc::ServerAsyncResponseWriter<Response>* responder,
+        void* tag)>
+        request_function_t;
+    typedef std::function<void(const std::shared_ptr<AsyncUnaryCall>& call)> call_callback_t;
+
+    // `on_started` is called when a client calls the method.
+    static std::shared_ptr<AsyncUnaryCall> create(call_callback_t on_started)
+    {
+        std::shared_ptr<AsyncUnaryCall> call(new AsyncUnaryCall(on_started));
+        call->_weak_self = call;
+        return call;
+    }
+
+    ~AsyncUnaryCall() = default;
+
+    // Waits for the next call of the method. Until the call started, it needs to
+    // be kept alive by the owner.
+    void request(const request_function_t& request_function)
+    {
+        request_function(&_context, &_request, &_responder, &_started_tag);
+    }
+
+    const Request& request_message() const { return _request; }
+
+    const grpc::ServerContext& context() const { return _context; }
+
+    // Sends `response`, or only `status` if it is an error. Only the first response
+    // of a call is sent.
+    void respond(const Response& response, const grpc::Status& status = grpc::Status::OK)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (!_started || _responded) {
+            return;
+        }
+
+        _responded = true;
+        if (status.ok()) {
+            _responder.Finish(response, status, &_finish_tag);
+        } else {
+            _responder.FinishWithError(status, &_finish_tag);
+        }
+    }
+
+    // Non-copyable
+    AsyncUnaryCall(const AsyncUnaryCall&) = delete;
+    const AsyncUnaryCall& operator=(const AsyncUnaryCall&) = delete;
+
+private:
+    explicit AsyncUnaryCall(call_callback_t on_started) : _on_started(on_started) {}
+
+    class Tag : public AsyncTag {
+    public:
+        Tag(AsyncUnaryCall& call, void (AsyncUnaryCall::*handler)(bool)) :
+            _call(call),
+            _handler(handler)
+        {}
+
+        void proceed(bool ok) override { (_call.*_handler)(ok); }
+
+    private:
+        AsyncUnaryCall& _call;
+        void (AsyncUnaryCall::*_handler)(bool);
+    };
+
+    void on_started(bool ok)
+    {
+        if (!ok) {
+            // The server is shutting down, the call never started.
+            return;
+        }
+
+        std::shared_ptr<AsyncUnaryCall> self = _weak_self.lock();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _started = true;
+            _self = self;
+        }
+
+        if (_on_started) {
+            _on_started(self);
+        }
+    }
+
+    void on_finish_done(bool /* ok */)
+    {
+        // Released outside of the lock, so we are not destroyed while holding it.
+        std::shared_ptr<AsyncUnaryCall> released;
+        std::lock_guard<std::mutex> lock(_mutex);
+        released.swap(_self);
+    }
+
+    call_callback_t _on_started;
+
+    grpc::ServerContext _context{};
+    Request _request{};
+    grpc::ServerAsyncResponseWriter<Response> _responder{&_context};
+
+    Tag _started_tag{*this, &AsyncUnaryCall::on_started};
+    Tag _finish_tag{*this, &AsyncUnaryCall::on_finish_done};
+
+    std::mutex _mutex{};
+    bool _started{false};
+    bool _responded{false};
+    std::weak_ptr<AsyncUnaryCall> _weak_self{};
+    std::shared_ptr<AsyncUnaryCall> _self{};
+};
+
+} // namespace backend
+} // namespace mavsdk
@@ -27,6 +27,13 @@ public:
         return _server->run();
     }
 
+    int startGRPCServer(const std::string& address)
+    {
+        _server = std::unique_ptr<GRPCServer>(new GRPCServer(_dc));
+        _server->set_address(address);
+        return _server->run();
+    }
+
     void wait() { _server->wait(); }
 
 private:
@@ -42,6 +49,10 @@ int MavsdkBackend::startGRPCServer(const int port)
 {
     return _impl->startGRPCServer(port);
 }
+int MavsdkBackend::startGRPCServer(const std::string& address)
+{
+    return _impl->startGRPCServer(address);
+}
 void MavsdkBackend::connect(const std::string& connection_url)
 {
     return _impl->connect(connection_url);
@@ -14,6 +14,7 @@ public:
     MavsdkBackend& operator=(MavsdkBackend&&) = delete;
 
     int startGRPCServer(int port);
+    int startGRPCServer(const std::string& address);
     void connect(const std::string& connection_url = "udp://");
     void wait();
 
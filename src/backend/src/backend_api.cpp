@@ -2,15 +2,13 @@
 #include "backend.h"
 #include <string>
 
-void runBackend(
+static void runStartedBackend(
+    mavsdk::backend::MavsdkBackend& backend,
+    int grpc_port,
     const char* connection_url,
-    const int mavsdk_server_port,
     void (*onServerStarted)(void*),
     void* context)
 {
-    mavsdk::backend::MavsdkBackend backend;
-
-    auto grpc_port = backend.startGRPCServer(mavsdk_server_port);
     if (grpc_port == 0) {
         // Server failed to start
         return;
@@ -24,3 +22,27 @@ void runBackend(
 
     backend.wait();
 }
+
+void runBackend(
+    const char* connection_url,
+    const int mavsdk_server_port,
+    void (*onServerStarted)(void*),
+    void* context)
+{
+    mavsdk::backend::MavsdkBackend backend;
+
+    auto grpc_port = backend.startGRPCServer(mavsdk_server_port);
+    runStartedBackend(backend, grpc_port, connection_url, onServerStarted, context);
+}
+
+void runBackendOnAddress(
+    const char* connection_url,
+    const char* mavsdk_server_address,
+    void (*onServerStarted)(void*),
+    void* context)
+{
+    mavsdk::backend::MavsdkBackend backend;
+
+    auto grpc_port = backend.startGRPCServer(std::string(mavsdk_server_address));
+    runStartedBackend(backend, grpc_port, connection_url, onServerStarted, context);
+}
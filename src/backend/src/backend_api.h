@@ -16,6 +16,14 @@ DLLExport void runBackend(
     void (*onServerStarted)(void*),
     void* context);
 
+// Same as runBackend, but serves on the given gRPC address, e.g. a Unix domain
+// socket with "unix:///run/mavsdk.sock".
+DLLExport void runBackendOnAddress(
+    const char* system_address,
+    const char* mavsdk_server_address,
+    void (*onServerStarted)(void*),
+    void* context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -43,6 +43,8 @@ static const char* TelemetryService_method_names[] = {
   "/mavsdk.rpc.telemetry.TelemetryService/SubscribeActuatorControlTarget",
   "/mavsdk.rpc.telemetry.TelemetryService/SubscribeActuatorOutputStatus",
   "/mavsdk.rpc.telemetry.TelemetryService/SubscribeOdometry",
+  "/mavsdk.rpc.telemetry.TelemetryService/GetTelemetrySnapshot",
+  "/mavsdk.rpc.telemetry.TelemetryService/SubscribeTelemetrySnapshot",
 };
 
 std::unique_ptr< TelemetryService::Stub> TelemetryService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -72,6 +74,8 @@ TelemetryService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& c
   , rpcmethod_SubscribeActuatorControlTarget_(TelemetryService_method_names[17], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   , rpcmethod_SubscribeActuatorOutputStatus_(TelemetryService_method_names[18], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   , rpcmethod_SubscribeOdometry_(TelemetryService_method_names[19], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_GetTelemetrySnapshot_(TelemetryService_method_names[20], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SubscribeTelemetrySnapshot_(TelemetryService_method_names[21], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   {}
 
 ::grpc::ClientReader< ::mavsdk::rpc::telemetry::PositionResponse>* TelemetryService::Stub::SubscribePositionRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribePositionRequest& request) {
@@ -394,6 +398,50 @@ void TelemetryService::Stub::experimental_async::SubscribeOdometry(::grpc::Clien
   return ::grpc_impl::internal::ClientAsyncReaderFactory< ::mavsdk::rpc::telemetry::OdometryResponse>::Create(channel_.get(), cq, rpcmethod_SubscribeOdometry_, context, request, false, nullptr);
 }
 
+::grpc::Status TelemetryService::Stub::GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetTelemetrySnapshot_, context, request, response);
+}
+
+void TelemetryService::Stub::experimental_async::GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetTelemetrySnapshot_, context, request, response, std::move(f));
+}
+
+void TelemetryService::Stub::experimental_async::GetTelemetrySnapshot(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetTelemetrySnapshot_, context, request, response, std::move(f));
+}
+
+void TelemetryService::Stub::experimental_async::GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_GetTelemetrySnapshot_, context, request, response, reactor);
+}
+
+void TelemetryService::Stub::experimental_async::GetTelemetrySnapshot(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_GetTelemetrySnapshot_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* TelemetryService::Stub::AsyncGetTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>::Create(channel_.get(), cq, rpcmethod_GetTelemetrySnapshot_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* TelemetryService::Stub::PrepareAsyncGetTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>::Create(channel_.get(), cq, rpcmethod_GetTelemetrySnapshot_, context, request, false);
+}
+
+::grpc::ClientReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* TelemetryService::Stub::SubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request) {
+  return ::grpc_impl::internal::ClientReaderFactory< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>::Create(channel_.get(), rpcmethod_SubscribeTelemetrySnapshot_, context, request);
+}
+
+void TelemetryService::Stub::experimental_async::SubscribeTelemetrySnapshot(::grpc::ClientContext* context, ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* request, ::grpc::experimental::ClientReadReactor< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* reactor) {
+  ::grpc_impl::internal::ClientCallbackReaderFactory< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_SubscribeTelemetrySnapshot_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* TelemetryService::Stub::AsyncSubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>::Create(channel_.get(), cq, rpcmethod_SubscribeTelemetrySnapshot_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* TelemetryService::Stub::PrepareAsyncSubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>::Create(channel_.get(), cq, rpcmethod_SubscribeTelemetrySnapshot_, context, request, false, nullptr);
+}
+
 TelemetryService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       TelemetryService_method_names[0],
@@ -495,6 +543,16 @@ TelemetryService::Service::Service() {
       ::grpc::internal::RpcMethod::SERVER_STREAMING,
       new ::grpc::internal::ServerStreamingHandler< TelemetryService::Service, ::mavsdk::rpc::telemetry::SubscribeOdometryRequest, ::mavsdk::rpc::telemetry::OdometryResponse>(
           std::mem_fn(&TelemetryService::Service::SubscribeOdometry), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      TelemetryService_method_names[20],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< TelemetryService::Service, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>(
+          std::mem_fn(&TelemetryService::Service::GetTelemetrySnapshot), this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      TelemetryService_method_names[21],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< TelemetryService::Service, ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest, ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>(
+          std::mem_fn(&TelemetryService::Service::SubscribeTelemetrySnapshot), this)));
 }
 
 TelemetryService::Service::~Service() {
@@ -640,6 +698,20 @@ TelemetryService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status TelemetryService::Service::GetTelemetrySnapshot(::grpc::ServerContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status TelemetryService::Service::SubscribeTelemetrySnapshot(::grpc::ServerContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* request, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace mavsdk
 }  // namespace rpc
@@ -252,6 +252,24 @@ class TelemetryService final {
     std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::OdometryResponse>> PrepareAsyncSubscribeOdometry(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::OdometryResponse>>(PrepareAsyncSubscribeOdometryRaw(context, request, cq));
     }
+    // Get the selected telemetry fields in a single response.
+    virtual ::grpc::Status GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>> AsyncGetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>>(AsyncGetTelemetrySnapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>> PrepareAsyncGetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>>(PrepareAsyncGetTelemetrySnapshotRaw(context, request, cq));
+    }
+    // Subscribe to snapshots of the selected telemetry fields at a fixed rate.
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>> SubscribeTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>>(SubscribeTelemetrySnapshotRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>> AsyncSubscribeTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>>(AsyncSubscribeTelemetrySnapshotRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>> PrepareAsyncSubscribeTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>>(PrepareAsyncSubscribeTelemetrySnapshotRaw(context, request, cq));
+    }
     class experimental_async_interface {
      public:
       virtual ~experimental_async_interface() {}
@@ -295,6 +313,13 @@ class TelemetryService final {
       virtual void SubscribeActuatorOutputStatus(::grpc::ClientContext* context, ::mavsdk::rpc::telemetry::SubscribeActuatorOutputStatusRequest* request, ::grpc::experimental::ClientReadReactor< ::mavsdk::rpc::telemetry::ActuatorOutputStatusResponse>* reactor) = 0;
       // Subscribe to 'odometry' updates.
       virtual void SubscribeOdometry(::grpc::ClientContext* context, ::mavsdk::rpc::telemetry::SubscribeOdometryRequest* request, ::grpc::experimental::ClientReadReactor< ::mavsdk::rpc::telemetry::OdometryResponse>* reactor) = 0;
+      // Get the selected telemetry fields in a single response.
+      virtual void GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetTelemetrySnapshot(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      virtual void GetTelemetrySnapshot(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      // Subscribe to snapshots of the selected telemetry fields at a fixed rate.
+      virtual void SubscribeTelemetrySnapshot(::grpc::ClientContext* context, ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* request, ::grpc::experimental::ClientReadReactor< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* reactor) = 0;
     };
     virtual class experimental_async_interface* experimental_async() { return nullptr; }
   private:
@@ -358,6 +383,11 @@ class TelemetryService final {
     virtual ::grpc::ClientReaderInterface< ::mavsdk::rpc::telemetry::OdometryResponse>* SubscribeOdometryRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest& request) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::OdometryResponse>* AsyncSubscribeOdometryRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
     virtual ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::OdometryResponse>* PrepareAsyncSubscribeOdometryRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* AsyncGetTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* PrepareAsyncGetTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* SubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* AsyncSubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* PrepareAsyncSubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -542,6 +572,22 @@ class TelemetryService final {
     std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::OdometryResponse>> PrepareAsyncSubscribeOdometry(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::OdometryResponse>>(PrepareAsyncSubscribeOdometryRaw(context, request, cq));
     }
+    ::grpc::Status GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>> AsyncGetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>>(AsyncGetTelemetrySnapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>> PrepareAsyncGetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>>(PrepareAsyncGetTelemetrySnapshotRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>> SubscribeTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>>(SubscribeTelemetrySnapshotRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>> AsyncSubscribeTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>>(AsyncSubscribeTelemetrySnapshotRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>> PrepareAsyncSubscribeTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>>(PrepareAsyncSubscribeTelemetrySnapshotRaw(context, request, cq));
+    }
     class experimental_async final :
       public StubInterface::experimental_async_interface {
      public:
@@ -565,6 +611,11 @@ class TelemetryService final {
       void SubscribeActuatorControlTarget(::grpc::ClientContext* context, ::mavsdk::rpc::telemetry::SubscribeActuatorControlTargetRequest* request, ::grpc::experimental::ClientReadReactor< ::mavsdk::rpc::telemetry::ActuatorControlTargetResponse>* reactor) override;
       void SubscribeActuatorOutputStatus(::grpc::ClientContext* context, ::mavsdk::rpc::telemetry::SubscribeActuatorOutputStatusRequest* request, ::grpc::experimental::ClientReadReactor< ::mavsdk::rpc::telemetry::ActuatorOutputStatusResponse>* reactor) override;
       void SubscribeOdometry(::grpc::ClientContext* context, ::mavsdk::rpc::telemetry::SubscribeOdometryRequest* request, ::grpc::experimental::ClientReadReactor< ::mavsdk::rpc::telemetry::OdometryResponse>* reactor) override;
+      void GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetTelemetrySnapshot(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetTelemetrySnapshot(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      void GetTelemetrySnapshot(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      void SubscribeTelemetrySnapshot(::grpc::ClientContext* context, ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* request, ::grpc::experimental::ClientReadReactor< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* reactor) override;
      private:
       friend class Stub;
       explicit experimental_async(Stub* stub): stub_(stub) { }
@@ -636,6 +687,11 @@ class TelemetryService final {
     ::grpc::ClientReader< ::mavsdk::rpc::telemetry::OdometryResponse>* SubscribeOdometryRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest& request) override;
     ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::OdometryResponse>* AsyncSubscribeOdometryRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
     ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::OdometryResponse>* PrepareAsyncSubscribeOdometryRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* AsyncGetTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* PrepareAsyncGetTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* SubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request) override;
+    ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* AsyncSubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* PrepareAsyncSubscribeTelemetrySnapshotRaw(::grpc::ClientContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_SubscribePosition_;
     const ::grpc::internal::RpcMethod rpcmethod_SubscribeHome_;
     const ::grpc::internal::RpcMethod rpcmethod_SubscribeInAir_;
@@ -656,6 +712,8 @@ class TelemetryService final {
     const ::grpc::internal::RpcMethod rpcmethod_SubscribeActuatorControlTarget_;
     const ::grpc::internal::RpcMethod rpcmethod_SubscribeActuatorOutputStatus_;
     const ::grpc::internal::RpcMethod rpcmethod_SubscribeOdometry_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetTelemetrySnapshot_;
+    const ::grpc::internal::RpcMethod rpcmethod_SubscribeTelemetrySnapshot_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -703,6 +761,10 @@ class TelemetryService final {
     virtual ::grpc::Status SubscribeActuatorOutputStatus(::grpc::ServerContext* context, const ::mavsdk::rpc::telemetry::SubscribeActuatorOutputStatusRequest* request, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::ActuatorOutputStatusResponse>* writer);
     // Subscribe to 'odometry' updates.
     virtual ::grpc::Status SubscribeOdometry(::grpc::ServerContext* context, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest* request, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::OdometryResponse>* writer);
+    // Get the selected telemetry fields in a single response.
+    virtual ::grpc::Status GetTelemetrySnapshot(::grpc::ServerContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response);
+    // Subscribe to snapshots of the selected telemetry fields at a fixed rate.
+    virtual ::grpc::Status SubscribeTelemetrySnapshot(::grpc::ServerContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* request, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_SubscribePosition : public BaseClass {
@@ -1104,7 +1166,47 @@ class TelemetryService final {
       ::grpc::Service::RequestAsyncServerStreaming(19, context, request, writer, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_SubscribePosition<WithAsyncMethod_SubscribeHome<WithAsyncMethod_SubscribeInAir<WithAsyncMethod_SubscribeLandedState<WithAsyncMethod_SubscribeArmed<WithAsyncMethod_SubscribeAttitudeQuaternion<WithAsyncMethod_SubscribeAttitudeEuler<WithAsyncMethod_SubscribeAttitudeAngularVelocityBody<WithAsyncMethod_SubscribeCameraAttitudeQuaternion<WithAsyncMethod_SubscribeCameraAttitudeEuler<WithAsyncMethod_SubscribeGroundSpeedNed<WithAsyncMethod_SubscribeGpsInfo<WithAsyncMethod_SubscribeBattery<WithAsyncMethod_SubscribeFlightMode<WithAsyncMethod_SubscribeHealth<WithAsyncMethod_SubscribeRcStatus<WithAsyncMethod_SubscribeStatusText<WithAsyncMethod_SubscribeActuatorControlTarget<WithAsyncMethod_SubscribeActuatorOutputStatus<WithAsyncMethod_SubscribeOdometry<Service > > > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetTelemetrySnapshot() {
+      ::grpc::Service::MarkMethodAsync(20);
+    }
+    ~WithAsyncMethod_GetTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* /*request*/, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetTelemetrySnapshot(::grpc::ServerContext* context, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::grpc::ServerAsyncResponseWriter< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SubscribeTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SubscribeTelemetrySnapshot() {
+      ::grpc::Service::MarkMethodAsync(21);
+    }
+    ~WithAsyncMethod_SubscribeTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeTelemetrySnapshot(::grpc::ServerContext* context, ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* request, ::grpc::ServerAsyncWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(21, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_SubscribePosition<WithAsyncMethod_SubscribeHome<WithAsyncMethod_SubscribeInAir<WithAsyncMethod_SubscribeLandedState<WithAsyncMethod_SubscribeArmed<WithAsyncMethod_SubscribeAttitudeQuaternion<WithAsyncMethod_SubscribeAttitudeEuler<WithAsyncMethod_SubscribeAttitudeAngularVelocityBody<WithAsyncMethod_SubscribeCameraAttitudeQuaternion<WithAsyncMethod_SubscribeCameraAttitudeEuler<WithAsyncMethod_SubscribeGroundSpeedNed<WithAsyncMethod_SubscribeGpsInfo<WithAsyncMethod_SubscribeBattery<WithAsyncMethod_SubscribeFlightMode<WithAsyncMethod_SubscribeHealth<WithAsyncMethod_SubscribeRcStatus<WithAsyncMethod_SubscribeStatusText<WithAsyncMethod_SubscribeActuatorControlTarget<WithAsyncMethod_SubscribeActuatorOutputStatus<WithAsyncMethod_SubscribeOdometry<WithAsyncMethod_GetTelemetrySnapshot<WithAsyncMethod_SubscribeTelemetrySnapshot<Service > > > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_SubscribePosition : public BaseClass {
    private:
@@ -1505,7 +1607,52 @@ class TelemetryService final {
     }
     virtual ::grpc::experimental::ServerWriteReactor< ::mavsdk::rpc::telemetry::OdometryResponse>* SubscribeOdometry(::grpc::experimental::CallbackServerContext* /*context*/, const ::mavsdk::rpc::telemetry::SubscribeOdometryRequest* /*request*/) { return nullptr; }
   };
-  typedef ExperimentalWithCallbackMethod_SubscribePosition<ExperimentalWithCallbackMethod_SubscribeHome<ExperimentalWithCallbackMethod_SubscribeInAir<ExperimentalWithCallbackMethod_SubscribeLandedState<ExperimentalWithCallbackMethod_SubscribeArmed<ExperimentalWithCallbackMethod_SubscribeAttitudeQuaternion<ExperimentalWithCallbackMethod_SubscribeAttitudeEuler<ExperimentalWithCallbackMethod_SubscribeAttitudeAngularVelocityBody<ExperimentalWithCallbackMethod_SubscribeCameraAttitudeQuaternion<ExperimentalWithCallbackMethod_SubscribeCameraAttitudeEuler<ExperimentalWithCallbackMethod_SubscribeGroundSpeedNed<ExperimentalWithCallbackMethod_SubscribeGpsInfo<ExperimentalWithCallbackMethod_SubscribeBattery<ExperimentalWithCallbackMethod_SubscribeFlightMode<ExperimentalWithCallbackMethod_SubscribeHealth<ExperimentalWithCallbackMethod_SubscribeRcStatus<ExperimentalWithCallbackMethod_SubscribeStatusText<ExperimentalWithCallbackMethod_SubscribeActuatorControlTarget<ExperimentalWithCallbackMethod_SubscribeActuatorOutputStatus<ExperimentalWithCallbackMethod_SubscribeOdometry<Service > > > > > > > > > > > > > > > > > > > > ExperimentalCallbackService;
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_GetTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_GetTelemetrySnapshot() {
+      ::grpc::Service::experimental().MarkMethodCallback(20,
+        new ::grpc_impl::internal::CallbackUnaryHandler< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>(
+          [this](::grpc::experimental::CallbackServerContext* context, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* request, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* response) { return this->GetTelemetrySnapshot(context, request, response); }));}
+    void SetMessageAllocatorFor_GetTelemetrySnapshot(
+        ::grpc::experimental::MessageAllocator< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* allocator) {
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>*>(
+          ::grpc::Service::experimental().GetHandler(20))
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_GetTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* /*request*/, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::experimental::ServerUnaryReactor* GetTelemetrySnapshot(::grpc::experimental::CallbackServerContext* /*context*/, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* /*request*/, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* /*response*/) { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_SubscribeTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_SubscribeTelemetrySnapshot() {
+      ::grpc::Service::experimental().MarkMethodCallback(21,
+        new ::grpc_impl::internal::CallbackServerStreamingHandler< ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest, ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>(
+          [this](::grpc::experimental::CallbackServerContext* context, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* request) { return this->SubscribeTelemetrySnapshot(context, request); }));
+    }
+    ~ExperimentalWithCallbackMethod_SubscribeTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::experimental::ServerWriteReactor< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* SubscribeTelemetrySnapshot(::grpc::experimental::CallbackServerContext* /*context*/, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* /*request*/) { return nullptr; }
+  };
+  typedef ExperimentalWithCallbackMethod_SubscribePosition<ExperimentalWithCallbackMethod_SubscribeHome<ExperimentalWithCallbackMethod_SubscribeInAir<ExperimentalWithCallbackMethod_SubscribeLandedState<ExperimentalWithCallbackMethod_SubscribeArmed<ExperimentalWithCallbackMethod_SubscribeAttitudeQuaternion<ExperimentalWithCallbackMethod_SubscribeAttitudeEuler<ExperimentalWithCallbackMethod_SubscribeAttitudeAngularVelocityBody<ExperimentalWithCallbackMethod_SubscribeCameraAttitudeQuaternion<ExperimentalWithCallbackMethod_SubscribeCameraAttitudeEuler<ExperimentalWithCallbackMethod_SubscribeGroundSpeedNed<ExperimentalWithCallbackMethod_SubscribeGpsInfo<ExperimentalWithCallbackMethod_SubscribeBattery<ExperimentalWithCallbackMethod_SubscribeFlightMode<ExperimentalWithCallbackMethod_SubscribeHealth<ExperimentalWithCallbackMethod_SubscribeRcStatus<ExperimentalWithCallbackMethod_SubscribeStatusText<ExperimentalWithCallbackMethod_SubscribeActuatorControlTarget<ExperimentalWithCallbackMethod_SubscribeActuatorOutputStatus<ExperimentalWithCallbackMethod_SubscribeOdometry<ExperimentalWithCallbackMethod_GetTelemetrySnapshot<ExperimentalWithCallbackMethod_SubscribeTelemetrySnapshot<Service > > > > > > > > > > > > > > > > > > > > > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_SubscribePosition : public BaseClass {
    private:
@@ -1847,6 +1994,40 @@ class TelemetryService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetTelemetrySnapshot() {
+      ::grpc::Service::MarkMethodGeneric(20);
+    }
+    ~WithGenericMethod_GetTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* /*request*/, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SubscribeTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SubscribeTelemetrySnapshot() {
+      ::grpc::Service::MarkMethodGeneric(21);
+    }
+    ~WithGenericMethod_SubscribeTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_SubscribePosition : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2247,6 +2428,46 @@ class TelemetryService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetTelemetrySnapshot() {
+      ::grpc::Service::MarkMethodRaw(20);
+    }
+    ~WithRawMethod_GetTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* /*request*/, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetTelemetrySnapshot(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(20, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SubscribeTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SubscribeTelemetrySnapshot() {
+      ::grpc::Service::MarkMethodRaw(21);
+    }
+    ~WithRawMethod_SubscribeTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSubscribeTelemetrySnapshot(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(21, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_SubscribePosition : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2646,7 +2867,67 @@ class TelemetryService final {
     }
     virtual ::grpc::experimental::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeOdometry(::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/) { return nullptr; }
   };
-  typedef Service StreamedUnaryService;
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_GetTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_GetTelemetrySnapshot() {
+      ::grpc::Service::experimental().MarkMethodRawCallback(20,
+        new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+          [this](::grpc::experimental::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetTelemetrySnapshot(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_GetTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* /*request*/, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::experimental::ServerUnaryReactor* GetTelemetrySnapshot(::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/) { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_SubscribeTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_SubscribeTelemetrySnapshot() {
+      ::grpc::Service::experimental().MarkMethodRawCallback(21,
+        new ::grpc_impl::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+          [this](::grpc::experimental::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->SubscribeTelemetrySnapshot(context, request); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_SubscribeTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SubscribeTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::experimental::ServerWriteReactor< ::grpc::ByteBuffer>* SubscribeTelemetrySnapshot(::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/) { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetTelemetrySnapshot() {
+      ::grpc::Service::MarkMethodStreamed(20,
+        new ::grpc::internal::StreamedUnaryHandler< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>(std::bind(&WithStreamedUnaryMethod_GetTelemetrySnapshot<BaseClass>::StreamedGetTelemetrySnapshot, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithStreamedUnaryMethod_GetTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* /*request*/, ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetTelemetrySnapshot(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest,::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_GetTelemetrySnapshot<Service > StreamedUnaryService;
   template <class BaseClass>
   class WithSplitStreamingMethod_SubscribePosition : public BaseClass {
    private:
@@ -3047,8 +3328,28 @@ class TelemetryService final {
     // replace default version of method with split streamed
     virtual ::grpc::Status StreamedSubscribeOdometry(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::mavsdk::rpc::telemetry::SubscribeOdometryRequest,::mavsdk::rpc::telemetry::OdometryResponse>* server_split_streamer) = 0;
   };
-  typedef WithSplitStreamingMethod_SubscribePosition<WithSplitStreamingMethod_SubscribeHome<WithSplitStreamingMethod_SubscribeInAir<WithSplitStreamingMethod_SubscribeLandedState<WithSplitStreamingMethod_SubscribeArmed<WithSplitStreamingMethod_SubscribeAttitudeQuaternion<WithSplitStreamingMethod_SubscribeAttitudeEuler<WithSplitStreamingMethod_SubscribeAttitudeAngularVelocityBody<WithSplitStreamingMethod_SubscribeCameraAttitudeQuaternion<WithSplitStreamingMethod_SubscribeCameraAttitudeEuler<WithSplitStreamingMethod_SubscribeGroundSpeedNed<WithSplitStreamingMethod_SubscribeGpsInfo<WithSplitStreamingMethod_SubscribeBattery<WithSplitStreamingMethod_SubscribeFlightMode<WithSplitStreamingMethod_SubscribeHealth<WithSplitStreamingMethod_SubscribeRcStatus<WithSplitStreamingMethod_SubscribeStatusText<WithSplitStreamingMethod_SubscribeActuatorControlTarget<WithSplitStreamingMethod_SubscribeActuatorOutputStatus<WithSplitStreamingMethod_SubscribeOdometry<Service > > > > > > > > > > > > > > > > > > > > SplitStreamedService;
-  typedef WithSplitStreamingMethod_SubscribePosition<WithSplitStreamingMethod_SubscribeHome<WithSplitStreamingMethod_SubscribeInAir<WithSplitStreamingMethod_SubscribeLandedState<WithSplitStreamingMethod_SubscribeArmed<WithSplitStreamingMethod_SubscribeAttitudeQuaternion<WithSplitStreamingMethod_SubscribeAttitudeEuler<WithSplitStreamingMethod_SubscribeAttitudeAngularVelocityBody<WithSplitStreamingMethod_SubscribeCameraAttitudeQuaternion<WithSplitStreamingMethod_SubscribeCameraAttitudeEuler<WithSplitStreamingMethod_SubscribeGroundSpeedNed<WithSplitStreamingMethod_SubscribeGpsInfo<WithSplitStreamingMethod_SubscribeBattery<WithSplitStreamingMethod_SubscribeFlightMode<WithSplitStreamingMethod_SubscribeHealth<WithSplitStreamingMethod_SubscribeRcStatus<WithSplitStreamingMethod_SubscribeStatusText<WithSplitStreamingMethod_SubscribeActuatorControlTarget<WithSplitStreamingMethod_SubscribeActuatorOutputStatus<WithSplitStreamingMethod_SubscribeOdometry<Service > > > > > > > > > > > > > > > > > > > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SubscribeTelemetrySnapshot : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_SubscribeTelemetrySnapshot() {
+      ::grpc::Service::MarkMethodStreamed(21,
+        new ::grpc::internal::SplitServerStreamingHandler< ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest, ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>(std::bind(&WithSplitStreamingMethod_SubscribeTelemetrySnapshot<BaseClass>::StreamedSubscribeTelemetrySnapshot, this, std::placeholders::_1, std::placeholders::_2)));
+    }
+    ~WithSplitStreamingMethod_SubscribeTelemetrySnapshot() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SubscribeTelemetrySnapshot(::grpc::ServerContext* /*context*/, const ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* /*request*/, ::grpc::ServerWriter< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSubscribeTelemetrySnapshot(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest,::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_SubscribePosition<WithSplitStreamingMethod_SubscribeHome<WithSplitStreamingMethod_SubscribeInAir<WithSplitStreamingMethod_SubscribeLandedState<WithSplitStreamingMethod_SubscribeArmed<WithSplitStreamingMethod_SubscribeAttitudeQuaternion<WithSplitStreamingMethod_SubscribeAttitudeEuler<WithSplitStreamingMethod_SubscribeAttitudeAngularVelocityBody<WithSplitStreamingMethod_SubscribeCameraAttitudeQuaternion<WithSplitStreamingMethod_SubscribeCameraAttitudeEuler<WithSplitStreamingMethod_SubscribeGroundSpeedNed<WithSplitStreamingMethod_SubscribeGpsInfo<WithSplitStreamingMethod_SubscribeBattery<WithSplitStreamingMethod_SubscribeFlightMode<WithSplitStreamingMethod_SubscribeHealth<WithSplitStreamingMethod_SubscribeRcStatus<WithSplitStreamingMethod_SubscribeStatusText<WithSplitStreamingMethod_SubscribeActuatorControlTarget<WithSplitStreamingMethod_SubscribeActuatorOutputStatus<WithSplitStreamingMethod_SubscribeOdometry<WithSplitStreamingMethod_SubscribeTelemetrySnapshot<Service > > > > > > > > > > > > > > > > > > > > > SplitStreamedService;
+  typedef WithSplitStreamingMethod_SubscribePosition<WithSplitStreamingMethod_SubscribeHome<WithSplitStreamingMethod_SubscribeInAir<WithSplitStreamingMethod_SubscribeLandedState<WithSplitStreamingMethod_SubscribeArmed<WithSplitStreamingMethod_SubscribeAttitudeQuaternion<WithSplitStreamingMethod_SubscribeAttitudeEuler<WithSplitStreamingMethod_SubscribeAttitudeAngularVelocityBody<WithSplitStreamingMethod_SubscribeCameraAttitudeQuaternion<WithSplitStreamingMethod_SubscribeCameraAttitudeEuler<WithSplitStreamingMethod_SubscribeGroundSpeedNed<WithSplitStreamingMethod_SubscribeGpsInfo<WithSplitStreamingMethod_SubscribeBattery<WithSplitStreamingMethod_SubscribeFlightMode<WithSplitStreamingMethod_SubscribeHealth<WithSplitStreamingMethod_SubscribeRcStatus<WithSplitStreamingMethod_SubscribeStatusText<WithSplitStreamingMethod_SubscribeActuatorControlTarget<WithSplitStreamingMethod_SubscribeActuatorOutputStatus<WithSplitStreamingMethod_SubscribeOdometry<WithStreamedUnaryMethod_GetTelemetrySnapshot<WithSplitStreamingMethod_SubscribeTelemetrySnapshot<Service > > > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace telemetry
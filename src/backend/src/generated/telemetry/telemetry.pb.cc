@@ -30,6 +30,7 @@ extern PROTOBUF_INTERNAL_EXPORT_telemetry_2ftelemetry_2eproto ::PROTOBUF_NAMESPA
 extern PROTOBUF_INTERNAL_EXPORT_telemetry_2ftelemetry_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SpeedBody_telemetry_2ftelemetry_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_telemetry_2ftelemetry_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SpeedNed_telemetry_2ftelemetry_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_telemetry_2ftelemetry_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_StatusText_telemetry_2ftelemetry_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_telemetry_2ftelemetry_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<8> scc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto;
 namespace mavsdk {
 namespace rpc {
 namespace telemetry {
@@ -257,6 +258,26 @@ class PositionBodyDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PositionBody> _instance;
 } _PositionBody_default_instance_;
+class GetTelemetrySnapshotRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetTelemetrySnapshotRequest> _instance;
+} _GetTelemetrySnapshotRequest_default_instance_;
+class GetTelemetrySnapshotResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetTelemetrySnapshotResponse> _instance;
+} _GetTelemetrySnapshotResponse_default_instance_;
+class SubscribeTelemetrySnapshotRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SubscribeTelemetrySnapshotRequest> _instance;
+} _SubscribeTelemetrySnapshotRequest_default_instance_;
+class TelemetrySnapshotResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TelemetrySnapshotResponse> _instance;
+} _TelemetrySnapshotResponse_default_instance_;
+class TelemetrySnapshotDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<TelemetrySnapshot> _instance;
+} _TelemetrySnapshot_default_instance_;
 }  // namespace telemetry
 }  // namespace rpc
 }  // namespace mavsdk
@@ -492,6 +513,35 @@ static void InitDefaultsscc_info_FlightModeResponse_telemetry_2ftelemetry_2eprot
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_FlightModeResponse_telemetry_2ftelemetry_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_FlightModeResponse_telemetry_2ftelemetry_2eproto}, {}};
 
+static void InitDefaultsscc_info_GetTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::mavsdk::rpc::telemetry::_GetTelemetrySnapshotRequest_default_instance_;
+    new (ptr) ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_GetTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto}, {}};
+
+static void InitDefaultsscc_info_GetTelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::mavsdk::rpc::telemetry::_GetTelemetrySnapshotResponse_default_instance_;
+    new (ptr) ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetTelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GetTelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto}, {
+      &scc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto.base,}};
+
 static void InitDefaultsscc_info_GpsInfo_telemetry_2ftelemetry_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -1065,7 +1115,58 @@ static void InitDefaultsscc_info_SubscribeStatusTextRequest_telemetry_2ftelemetr
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SubscribeStatusTextRequest_telemetry_2ftelemetry_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_SubscribeStatusTextRequest_telemetry_2ftelemetry_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_telemetry_2ftelemetry_2eproto[56];
+static void InitDefaultsscc_info_SubscribeTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::mavsdk::rpc::telemetry::_SubscribeTelemetrySnapshotRequest_default_instance_;
+    new (ptr) ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SubscribeTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_SubscribeTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto}, {}};
+
+static void InitDefaultsscc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_;
+    new (ptr) ::mavsdk::rpc::telemetry::TelemetrySnapshot();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<8> scc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 8, 0, InitDefaultsscc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto}, {
+      &scc_info_Position_telemetry_2ftelemetry_2eproto.base,
+      &scc_info_EulerAngle_telemetry_2ftelemetry_2eproto.base,
+      &scc_info_SpeedNed_telemetry_2ftelemetry_2eproto.base,
+      &scc_info_GpsInfo_telemetry_2ftelemetry_2eproto.base,
+      &scc_info_Battery_telemetry_2ftelemetry_2eproto.base,
+      &scc_info_Health_telemetry_2ftelemetry_2eproto.base,
+      &scc_info_RcStatus_telemetry_2ftelemetry_2eproto.base,
+      &scc_info_StatusText_telemetry_2ftelemetry_2eproto.base,}};
+
+static void InitDefaultsscc_info_TelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::mavsdk::rpc::telemetry::_TelemetrySnapshotResponse_default_instance_;
+    new (ptr) ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_TelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_TelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto}, {
+      &scc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto.base,}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_telemetry_2ftelemetry_2eproto[61];
 static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_telemetry_2ftelemetry_2eproto[5];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_telemetry_2ftelemetry_2eproto = nullptr;
 
@@ -1423,6 +1524,51 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_telemetry_2ftelemetry_2eproto:
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::PositionBody, x_m_),
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::PositionBody, y_m_),
   PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::PositionBody, z_m_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest, fields_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse, telemetry_snapshot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest, fields_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest, rate_hz_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshotResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshotResponse, telemetry_snapshot_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, timestamp_us_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, fields_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, position_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, home_position_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, in_air_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, armed_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, landed_state_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, flight_mode_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, attitude_euler_angle_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, ground_speed_ned_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, gps_info_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, battery_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, health_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, rc_status_),
+  PROTOBUF_FIELD_OFFSET(::mavsdk::rpc::telemetry::TelemetrySnapshot, status_text_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::mavsdk::rpc::telemetry::SubscribePositionRequest)},
@@ -1481,6 +1627,11 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 331, -1, sizeof(::mavsdk::rpc::telemetry::Covariance)},
   { 337, -1, sizeof(::mavsdk::rpc::telemetry::SpeedBody)},
   { 345, -1, sizeof(::mavsdk::rpc::telemetry::PositionBody)},
+  { 353, -1, sizeof(::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest)},
+  { 359, -1, sizeof(::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse)},
+  { 365, -1, sizeof(::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest)},
+  { 372, -1, sizeof(::mavsdk::rpc::telemetry::TelemetrySnapshotResponse)},
+  { 378, -1, sizeof(::mavsdk::rpc::telemetry::TelemetrySnapshot)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -1540,6 +1691,11 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::mavsdk::rpc::telemetry::_Covariance_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::mavsdk::rpc::telemetry::_SpeedBody_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::mavsdk::rpc::telemetry::_PositionBody_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::mavsdk::rpc::telemetry::_GetTelemetrySnapshotRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::mavsdk::rpc::telemetry::_GetTelemetrySnapshotResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::mavsdk::rpc::telemetry::_SubscribeTelemetrySnapshotRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::mavsdk::rpc::telemetry::_TelemetrySnapshotResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_),
 };
 
 const char descriptor_table_protodef_telemetry_2ftelemetry_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -1647,87 +1803,119 @@ const char descriptor_table_protodef_telemetry_2ftelemetry_2eproto[] PROTOBUF_SE
   "S\n\tSpeedBody\022\026\n\016velocity_x_m_s\030\001 \001(\002\022\026\n\016"
   "velocity_y_m_s\030\002 \001(\002\022\026\n\016velocity_z_m_s\030\003"
   " \001(\002\"5\n\014PositionBody\022\013\n\003x_m\030\001 \001(\002\022\013\n\003y_m"
-  "\030\002 \001(\002\022\013\n\003z_m\030\003 \001(\002*e\n\007FixType\022\n\n\006NO_GPS"
-  "\020\000\022\n\n\006NO_FIX\020\001\022\n\n\006FIX_2D\020\002\022\n\n\006FIX_3D\020\003\022\014"
-  "\n\010FIX_DGPS\020\004\022\r\n\tRTK_FLOAT\020\005\022\r\n\tRTK_FIXED"
-  "\020\006*\322\001\n\nFlightMode\022\013\n\007UNKNOWN\020\000\022\t\n\005READY\020"
-  "\001\022\013\n\007TAKEOFF\020\002\022\010\n\004HOLD\020\003\022\013\n\007MISSION\020\004\022\024\n"
-  "\020RETURN_TO_LAUNCH\020\005\022\010\n\004LAND\020\006\022\014\n\010OFFBOAR"
-  "D\020\007\022\r\n\tFOLLOW_ME\020\010\022\n\n\006MANUAL\020\t\022\n\n\006ALTCTL"
-  "\020\n\022\n\n\006POSCTL\020\013\022\010\n\004ACRO\020\014\022\016\n\nSTABILIZED\020\r"
-  "\022\r\n\tRATTITUDE\020\016*\223\001\n\013LandedState\022\030\n\024LANDE"
-  "D_STATE_UNKNOWN\020\000\022\032\n\026LANDED_STATE_ON_GRO"
-  "UND\020\001\022\027\n\023LANDED_STATE_IN_AIR\020\002\022\033\n\027LANDED"
-  "_STATE_TAKING_OFF\020\003\022\030\n\024LANDED_STATE_LAND"
-  "ING\020\0042\354\023\n\020TelemetryService\022o\n\021SubscribeP"
-  "osition\022..mavsdk.rpc.telemetry.Subscribe"
-  "PositionRequest\032&.mavsdk.rpc.telemetry.P"
-  "ositionResponse\"\0000\001\022c\n\rSubscribeHome\022*.m"
-  "avsdk.rpc.telemetry.SubscribeHomeRequest"
-  "\032\".mavsdk.rpc.telemetry.HomeResponse\"\0000\001"
-  "\022f\n\016SubscribeInAir\022+.mavsdk.rpc.telemetr"
-  "y.SubscribeInAirRequest\032#.mavsdk.rpc.tel"
-  "emetry.InAirResponse\"\0000\001\022x\n\024SubscribeLan"
-  "dedState\0221.mavsdk.rpc.telemetry.Subscrib"
-  "eLandedStateRequest\032).mavsdk.rpc.telemet"
-  "ry.LandedStateResponse\"\0000\001\022f\n\016SubscribeA"
-  "rmed\022+.mavsdk.rpc.telemetry.SubscribeArm"
-  "edRequest\032#.mavsdk.rpc.telemetry.ArmedRe"
-  "sponse\"\0000\001\022\215\001\n\033SubscribeAttitudeQuaterni"
-  "on\0228.mavsdk.rpc.telemetry.SubscribeAttit"
-  "udeQuaternionRequest\0320.mavsdk.rpc.teleme"
-  "try.AttitudeQuaternionResponse\"\0000\001\022~\n\026Su"
-  "bscribeAttitudeEuler\0223.mavsdk.rpc.teleme"
-  "try.SubscribeAttitudeEulerRequest\032+.mavs"
-  "dk.rpc.telemetry.AttitudeEulerResponse\"\000"
-  "0\001\022\250\001\n$SubscribeAttitudeAngularVelocityB"
-  "ody\022A.mavsdk.rpc.telemetry.SubscribeAtti"
-  "tudeAngularVelocityBodyRequest\0329.mavsdk."
-  "rpc.telemetry.AttitudeAngularVelocityBod"
-  "yResponse\"\0000\001\022\237\001\n!SubscribeCameraAttitud"
-  "eQuaternion\022>.mavsdk.rpc.telemetry.Subsc"
-  "ribeCameraAttitudeQuaternionRequest\0326.ma"
-  "vsdk.rpc.telemetry.CameraAttitudeQuatern"
-  "ionResponse\"\0000\001\022\220\001\n\034SubscribeCameraAttit"
-  "udeEuler\0229.mavsdk.rpc.telemetry.Subscrib"
-  "eCameraAttitudeEulerRequest\0321.mavsdk.rpc"
-  ".telemetry.CameraAttitudeEulerResponse\"\000"
-  "0\001\022\201\001\n\027SubscribeGroundSpeedNed\0224.mavsdk."
-  "rpc.telemetry.SubscribeGroundSpeedNedReq"
-  "uest\032,.mavsdk.rpc.telemetry.GroundSpeedN"
-  "edResponse\"\0000\001\022l\n\020SubscribeGpsInfo\022-.mav"
-  "sdk.rpc.telemetry.SubscribeGpsInfoReques"
-  "t\032%.mavsdk.rpc.telemetry.GpsInfoResponse"
-  "\"\0000\001\022l\n\020SubscribeBattery\022-.mavsdk.rpc.te"
-  "lemetry.SubscribeBatteryRequest\032%.mavsdk"
-  ".rpc.telemetry.BatteryResponse\"\0000\001\022u\n\023Su"
-  "bscribeFlightMode\0220.mavsdk.rpc.telemetry"
-  ".SubscribeFlightModeRequest\032(.mavsdk.rpc"
-  ".telemetry.FlightModeResponse\"\0000\001\022i\n\017Sub"
-  "scribeHealth\022,.mavsdk.rpc.telemetry.Subs"
-  "cribeHealthRequest\032$.mavsdk.rpc.telemetr"
-  "y.HealthResponse\"\0000\001\022o\n\021SubscribeRcStatu"
-  "s\022..mavsdk.rpc.telemetry.SubscribeRcStat"
-  "usRequest\032&.mavsdk.rpc.telemetry.RcStatu"
-  "sResponse\"\0000\001\022u\n\023SubscribeStatusText\0220.m"
-  "avsdk.rpc.telemetry.SubscribeStatusTextR"
-  "equest\032(.mavsdk.rpc.telemetry.StatusText"
-  "Response\"\0000\001\022\226\001\n\036SubscribeActuatorContro"
-  "lTarget\022;.mavsdk.rpc.telemetry.Subscribe"
-  "ActuatorControlTargetRequest\0323.mavsdk.rp"
-  "c.telemetry.ActuatorControlTargetRespons"
-  "e\"\0000\001\022\223\001\n\035SubscribeActuatorOutputStatus\022"
-  ":.mavsdk.rpc.telemetry.SubscribeActuator"
-  "OutputStatusRequest\0322.mavsdk.rpc.telemet"
-  "ry.ActuatorOutputStatusResponse\"\0000\001\022o\n\021S"
-  "ubscribeOdometry\022..mavsdk.rpc.telemetry."
-  "SubscribeOdometryRequest\032&.mavsdk.rpc.te"
-  "lemetry.OdometryResponse\"\0000\001B%\n\023io.mavsd"
-  "k.telemetryB\016TelemetryProtob\006proto3"
+  "\030\002 \001(\002\022\013\n\003z_m\030\003 \001(\002\"-\n\033GetTelemetrySnaps"
+  "hotRequest\022\016\n\006fields\030\001 \001(\r\"c\n\034GetTelemet"
+  "rySnapshotResponse\022C\n\022telemetry_snapshot"
+  "\030\001 \001(\0132\'.mavsdk.rpc.telemetry.TelemetryS"
+  "napshot\"D\n!SubscribeTelemetrySnapshotReq"
+  "uest\022\016\n\006fields\030\001 \001(\r\022\017\n\007rate_hz\030\002 \001(\001\"`\n"
+  "\031TelemetrySnapshotResponse\022C\n\022telemetry_"
+  "snapshot\030\001 \001(\0132\'.mavsdk.rpc.telemetry.Te"
+  "lemetrySnapshot\"\244\005\n\021TelemetrySnapshot\022\024\n"
+  "\014timestamp_us\030\001 \001(\004\022\016\n\006fields\030\002 \001(\r\0220\n\010p"
+  "osition\030\003 \001(\0132\036.mavsdk.rpc.telemetry.Pos"
+  "ition\0225\n\rhome_position\030\004 \001(\0132\036.mavsdk.rp"
+  "c.telemetry.Position\022\016\n\006in_air\030\005 \001(\010\022\r\n\005"
+  "armed\030\006 \001(\010\0227\n\014landed_state\030\007 \001(\0162!.mavs"
+  "dk.rpc.telemetry.LandedState\0225\n\013flight_m"
+  "ode\030\010 \001(\0162 .mavsdk.rpc.telemetry.FlightM"
+  "ode\022>\n\024attitude_euler_angle\030\t \001(\0132 .mavs"
+  "dk.rpc.telemetry.EulerAngle\0228\n\020ground_sp"
+  "eed_ned\030\n \001(\0132\036.mavsdk.rpc.telemetry.Spe"
+  "edNed\022/\n\010gps_info\030\013 \001(\0132\035.mavsdk.rpc.tel"
+  "emetry.GpsInfo\022.\n\007battery\030\014 \001(\0132\035.mavsdk"
+  ".rpc.telemetry.Battery\022,\n\006health\030\r \001(\0132\034"
+  ".mavsdk.rpc.telemetry.Health\0221\n\trc_statu"
+  "s\030\016 \001(\0132\036.mavsdk.rpc.telemetry.RcStatus\022"
+  "5\n\013status_text\030\017 \001(\0132 .mavsdk.rpc.teleme"
+  "try.StatusText*e\n\007FixType\022\n\n\006NO_GPS\020\000\022\n\n"
+  "\006NO_FIX\020\001\022\n\n\006FIX_2D\020\002\022\n\n\006FIX_3D\020\003\022\014\n\010FIX"
+  "_DGPS\020\004\022\r\n\tRTK_FLOAT\020\005\022\r\n\tRTK_FIXED\020\006*\322\001"
+  "\n\nFlightMode\022\013\n\007UNKNOWN\020\000\022\t\n\005READY\020\001\022\013\n\007"
+  "TAKEOFF\020\002\022\010\n\004HOLD\020\003\022\013\n\007MISSION\020\004\022\024\n\020RETU"
+  "RN_TO_LAUNCH\020\005\022\010\n\004LAND\020\006\022\014\n\010OFFBOARD\020\007\022\r"
+  "\n\tFOLLOW_ME\020\010\022\n\n\006MANUAL\020\t\022\n\n\006ALTCTL\020\n\022\n\n"
+  "\006POSCTL\020\013\022\010\n\004ACRO\020\014\022\016\n\nSTABILIZED\020\r\022\r\n\tR"
+  "ATTITUDE\020\016*\223\001\n\013LandedState\022\030\n\024LANDED_STA"
+  "TE_UNKNOWN\020\000\022\032\n\026LANDED_STATE_ON_GROUND\020\001"
+  "\022\027\n\023LANDED_STATE_IN_AIR\020\002\022\033\n\027LANDED_STAT"
+  "E_TAKING_OFF\020\003\022\030\n\024LANDED_STATE_LANDING\020\004"
+  "2\372\025\n\020TelemetryService\022o\n\021SubscribePositi"
+  "on\022..mavsdk.rpc.telemetry.SubscribePosit"
+  "ionRequest\032&.mavsdk.rpc.telemetry.Positi"
+  "onResponse\"\0000\001\022c\n\rSubscribeHome\022*.mavsdk"
+  ".rpc.telemetry.SubscribeHomeRequest\032\".ma"
+  "vsdk.rpc.telemetry.HomeResponse\"\0000\001\022f\n\016S"
+  "ubscribeInAir\022+.mavsdk.rpc.telemetry.Sub"
+  "scribeInAirRequest\032#.mavsdk.rpc.telemetr"
+  "y.InAirResponse\"\0000\001\022x\n\024SubscribeLandedSt"
+  "ate\0221.mavsdk.rpc.telemetry.SubscribeLand"
+  "edStateRequest\032).mavsdk.rpc.telemetry.La"
+  "ndedStateResponse\"\0000\001\022f\n\016SubscribeArmed\022"
+  "+.mavsdk.rpc.telemetry.SubscribeArmedReq"
+  "uest\032#.mavsdk.rpc.telemetry.ArmedRespons"
+  "e\"\0000\001\022\215\001\n\033SubscribeAttitudeQuaternion\0228."
+  "mavsdk.rpc.telemetry.SubscribeAttitudeQu"
+  "aternionRequest\0320.mavsdk.rpc.telemetry.A"
+  "ttitudeQuaternionResponse\"\0000\001\022~\n\026Subscri"
+  "beAttitudeEuler\0223.mavsdk.rpc.telemetry.S"
+  "ubscribeAttitudeEulerRequest\032+.mavsdk.rp"
+  "c.telemetry.AttitudeEulerResponse\"\0000\001\022\250\001"
+  "\n$SubscribeAttitudeAngularVelocityBody\022A"
+  ".mavsdk.rpc.telemetry.SubscribeAttitudeA"
+  "ngularVelocityBodyRequest\0329.mavsdk.rpc.t"
+  "elemetry.AttitudeAngularVelocityBodyResp"
+  "onse\"\0000\001\022\237\001\n!SubscribeCameraAttitudeQuat"
+  "ernion\022>.mavsdk.rpc.telemetry.SubscribeC"
+  "ameraAttitudeQuaternionRequest\0326.mavsdk."
+  "rpc.telemetry.CameraAttitudeQuaternionRe"
+  "sponse\"\0000\001\022\220\001\n\034SubscribeCameraAttitudeEu"
+  "ler\0229.mavsdk.rpc.telemetry.SubscribeCame"
+  "raAttitudeEulerRequest\0321.mavsdk.rpc.tele"
+  "metry.CameraAttitudeEulerResponse\"\0000\001\022\201\001"
+  "\n\027SubscribeGroundSpeedNed\0224.mavsdk.rpc.t"
+  "elemetry.SubscribeGroundSpeedNedRequest\032"
+  ",.mavsdk.rpc.telemetry.GroundSpeedNedRes"
+  "ponse\"\0000\001\022l\n\020SubscribeGpsInfo\022-.mavsdk.r"
+  "pc.telemetry.SubscribeGpsInfoRequest\032%.m"
+  "avsdk.rpc.telemetry.GpsInfoResponse\"\0000\001\022"
+  "l\n\020SubscribeBattery\022-.mavsdk.rpc.telemet"
+  "ry.SubscribeBatteryRequest\032%.mavsdk.rpc."
+  "telemetry.BatteryResponse\"\0000\001\022u\n\023Subscri"
+  "beFlightMode\0220.mavsdk.rpc.telemetry.Subs"
+  "cribeFlightModeRequest\032(.mavsdk.rpc.tele"
+  "metry.FlightModeResponse\"\0000\001\022i\n\017Subscrib"
+  "eHealth\022,.mavsdk.rpc.telemetry.Subscribe"
+  "HealthRequest\032$.mavsdk.rpc.telemetry.Hea"
+  "lthResponse\"\0000\001\022o\n\021SubscribeRcStatus\022..m"
+  "avsdk.rpc.telemetry.SubscribeRcStatusReq"
+  "uest\032&.mavsdk.rpc.telemetry.RcStatusResp"
+  "onse\"\0000\001\022u\n\023SubscribeStatusText\0220.mavsdk"
+  ".rpc.telemetry.SubscribeStatusTextReques"
+  "t\032(.mavsdk.rpc.telemetry.StatusTextRespo"
+  "nse\"\0000\001\022\226\001\n\036SubscribeActuatorControlTarg"
+  "et\022;.mavsdk.rpc.telemetry.SubscribeActua"
+  "torControlTargetRequest\0323.mavsdk.rpc.tel"
+  "emetry.ActuatorControlTargetResponse\"\0000\001"
+  "\022\223\001\n\035SubscribeActuatorOutputStatus\022:.mav"
+  "sdk.rpc.telemetry.SubscribeActuatorOutpu"
+  "tStatusRequest\0322.mavsdk.rpc.telemetry.Ac"
+  "tuatorOutputStatusResponse\"\0000\001\022o\n\021Subscr"
+  "ibeOdometry\022..mavsdk.rpc.telemetry.Subsc"
+  "ribeOdometryRequest\032&.mavsdk.rpc.telemet"
+  "ry.OdometryResponse\"\0000\001\022\177\n\024GetTelemetryS"
+  "napshot\0221.mavsdk.rpc.telemetry.GetTeleme"
+  "trySnapshotRequest\0322.mavsdk.rpc.telemetr"
+  "y.GetTelemetrySnapshotResponse\"\000\022\212\001\n\032Sub"
+  "scribeTelemetrySnapshot\0227.mavsdk.rpc.tel"
+  "emetry.SubscribeTelemetrySnapshotRequest"
+  "\032/.mavsdk.rpc.telemetry.TelemetrySnapsho"
+  "tResponse\"\0000\001B%\n\023io.mavsdk.telemetryB\016Te"
+  "lemetryProtob\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_telemetry_2ftelemetry_2eproto_deps[1] = {
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_telemetry_2ftelemetry_2eproto_sccs[56] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_telemetry_2ftelemetry_2eproto_sccs[61] = {
   &scc_info_ActuatorControlTarget_telemetry_2ftelemetry_2eproto.base,
   &scc_info_ActuatorControlTargetResponse_telemetry_2ftelemetry_2eproto.base,
   &scc_info_ActuatorOutputStatus_telemetry_2ftelemetry_2eproto.base,
@@ -1744,6 +1932,8 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_tel
   &scc_info_Covariance_telemetry_2ftelemetry_2eproto.base,
   &scc_info_EulerAngle_telemetry_2ftelemetry_2eproto.base,
   &scc_info_FlightModeResponse_telemetry_2ftelemetry_2eproto.base,
+  &scc_info_GetTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto.base,
+  &scc_info_GetTelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto.base,
   &scc_info_GpsInfo_telemetry_2ftelemetry_2eproto.base,
   &scc_info_GpsInfoResponse_telemetry_2ftelemetry_2eproto.base,
   &scc_info_GroundSpeedNedResponse_telemetry_2ftelemetry_2eproto.base,
@@ -1784,14 +1974,17 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_tel
   &scc_info_SubscribePositionRequest_telemetry_2ftelemetry_2eproto.base,
   &scc_info_SubscribeRcStatusRequest_telemetry_2ftelemetry_2eproto.base,
   &scc_info_SubscribeStatusTextRequest_telemetry_2ftelemetry_2eproto.base,
+  &scc_info_SubscribeTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto.base,
+  &scc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto.base,
+  &scc_info_TelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto.base,
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_telemetry_2ftelemetry_2eproto_once;
 static bool descriptor_table_telemetry_2ftelemetry_2eproto_initialized = false;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_telemetry_2ftelemetry_2eproto = {
-  &descriptor_table_telemetry_2ftelemetry_2eproto_initialized, descriptor_table_protodef_telemetry_2ftelemetry_2eproto, "telemetry/telemetry.proto", 7235,
-  &descriptor_table_telemetry_2ftelemetry_2eproto_once, descriptor_table_telemetry_2ftelemetry_2eproto_sccs, descriptor_table_telemetry_2ftelemetry_2eproto_deps, 56, 0,
+  &descriptor_table_telemetry_2ftelemetry_2eproto_initialized, descriptor_table_protodef_telemetry_2ftelemetry_2eproto, "telemetry/telemetry.proto", 8500,
+  &descriptor_table_telemetry_2ftelemetry_2eproto_once, descriptor_table_telemetry_2ftelemetry_2eproto_sccs, descriptor_table_telemetry_2ftelemetry_2eproto_deps, 61, 0,
   schemas, file_default_instances, TableStruct_telemetry_2ftelemetry_2eproto::offsets,
-  file_level_metadata_telemetry_2ftelemetry_2eproto, 56, file_level_enum_descriptors_telemetry_2ftelemetry_2eproto, file_level_service_descriptors_telemetry_2ftelemetry_2eproto,
+  file_level_metadata_telemetry_2ftelemetry_2eproto, 61, file_level_enum_descriptors_telemetry_2ftelemetry_2eproto, file_level_service_descriptors_telemetry_2ftelemetry_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -13025,88 +13218,1594 @@ void PositionBody::InternalSwap(PositionBody* other) {
 }
 
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace telemetry
-}  // namespace rpc
-}  // namespace mavsdk
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribePositionRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribePositionRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribePositionRequest >(arena);
+// ===================================================================
+
+void GetTelemetrySnapshotRequest::InitAsDefaultInstance() {
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::PositionResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::PositionResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::PositionResponse >(arena);
+class GetTelemetrySnapshotRequest::_Internal {
+ public:
+};
+
+GetTelemetrySnapshotRequest::GetTelemetrySnapshotRequest()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeHomeRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeHomeRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeHomeRequest >(arena);
+GetTelemetrySnapshotRequest::GetTelemetrySnapshotRequest(const GetTelemetrySnapshotRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  fields_ = from.fields_;
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::HomeResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::HomeResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::HomeResponse >(arena);
+
+void GetTelemetrySnapshotRequest::SharedCtor() {
+  fields_ = 0u;
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeInAirRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeInAirRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeInAirRequest >(arena);
+
+GetTelemetrySnapshotRequest::~GetTelemetrySnapshotRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::InAirResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::InAirResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::InAirResponse >(arena);
+
+void GetTelemetrySnapshotRequest::SharedDtor() {
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeLandedStateRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeLandedStateRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeLandedStateRequest >(arena);
+
+void GetTelemetrySnapshotRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::LandedStateResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::LandedStateResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::LandedStateResponse >(arena);
+const GetTelemetrySnapshotRequest& GetTelemetrySnapshotRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto.base);
+  return *internal_default_instance();
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeArmedRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeArmedRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeArmedRequest >(arena);
+
+
+void GetTelemetrySnapshotRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  fields_ = 0u;
+  _internal_metadata_.Clear();
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::ArmedResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::ArmedResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::ArmedResponse >(arena);
+
+const char* GetTelemetrySnapshotRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint32 fields = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          fields_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeAttitudeQuaternionRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeAttitudeQuaternionRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeAttitudeQuaternionRequest >(arena);
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetTelemetrySnapshotRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 fields = 1;
+  if (this->fields() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_fields(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  return target;
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::AttitudeQuaternionResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::AttitudeQuaternionResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::AttitudeQuaternionResponse >(arena);
+
+size_t GetTelemetrySnapshotRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 fields = 1;
+  if (this->fields() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_fields());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeAttitudeEulerRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeAttitudeEulerRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeAttitudeEulerRequest >(arena);
+
+void GetTelemetrySnapshotRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetTelemetrySnapshotRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetTelemetrySnapshotRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+    MergeFrom(*source);
+  }
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::AttitudeEulerResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::AttitudeEulerResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::AttitudeEulerResponse >(arena);
+
+void GetTelemetrySnapshotRequest::MergeFrom(const GetTelemetrySnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.fields() != 0) {
+    _internal_set_fields(from._internal_fields());
+  }
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeAttitudeAngularVelocityBodyRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeAttitudeAngularVelocityBodyRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeAttitudeAngularVelocityBodyRequest >(arena);
+
+void GetTelemetrySnapshotRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::AttitudeAngularVelocityBodyResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::AttitudeAngularVelocityBodyResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::AttitudeAngularVelocityBodyResponse >(arena);
+
+void GetTelemetrySnapshotRequest::CopyFrom(const GetTelemetrySnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeQuaternionRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeQuaternionRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeQuaternionRequest >(arena);
+
+bool GetTelemetrySnapshotRequest::IsInitialized() const {
+  return true;
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::CameraAttitudeQuaternionResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::CameraAttitudeQuaternionResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::CameraAttitudeQuaternionResponse >(arena);
+
+void GetTelemetrySnapshotRequest::InternalSwap(GetTelemetrySnapshotRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(fields_, other->fields_);
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeEulerRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeEulerRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeEulerRequest >(arena);
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetTelemetrySnapshotRequest::GetMetadata() const {
+  return GetMetadataStatic();
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::CameraAttitudeEulerResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::CameraAttitudeEulerResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::CameraAttitudeEulerResponse >(arena);
+
+
+// ===================================================================
+
+void GetTelemetrySnapshotResponse::InitAsDefaultInstance() {
+  ::mavsdk::rpc::telemetry::_GetTelemetrySnapshotResponse_default_instance_._instance.get_mutable()->telemetry_snapshot_ = const_cast< ::mavsdk::rpc::telemetry::TelemetrySnapshot*>(
+      ::mavsdk::rpc::telemetry::TelemetrySnapshot::internal_default_instance());
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeGroundSpeedNedRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeGroundSpeedNedRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeGroundSpeedNedRequest >(arena);
+class GetTelemetrySnapshotResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::telemetry::TelemetrySnapshot& telemetry_snapshot(const GetTelemetrySnapshotResponse* msg);
+};
+
+const ::mavsdk::rpc::telemetry::TelemetrySnapshot&
+GetTelemetrySnapshotResponse::_Internal::telemetry_snapshot(const GetTelemetrySnapshotResponse* msg) {
+  return *msg->telemetry_snapshot_;
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::GroundSpeedNedResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::GroundSpeedNedResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::GroundSpeedNedResponse >(arena);
+GetTelemetrySnapshotResponse::GetTelemetrySnapshotResponse()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeGpsInfoRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeGpsInfoRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeGpsInfoRequest >(arena);
+GetTelemetrySnapshotResponse::GetTelemetrySnapshotResponse(const GetTelemetrySnapshotResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from._internal_has_telemetry_snapshot()) {
+    telemetry_snapshot_ = new ::mavsdk::rpc::telemetry::TelemetrySnapshot(*from.telemetry_snapshot_);
+  } else {
+    telemetry_snapshot_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::GpsInfoResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::GpsInfoResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::GpsInfoResponse >(arena);
+
+void GetTelemetrySnapshotResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetTelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto.base);
+  telemetry_snapshot_ = nullptr;
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeBatteryRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeBatteryRequest >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeBatteryRequest >(arena);
+
+GetTelemetrySnapshotResponse::~GetTelemetrySnapshotResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::BatteryResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::BatteryResponse >(Arena* arena) {
-  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::BatteryResponse >(arena);
+
+void GetTelemetrySnapshotResponse::SharedDtor() {
+  if (this != internal_default_instance()) delete telemetry_snapshot_;
+}
+
+void GetTelemetrySnapshotResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const GetTelemetrySnapshotResponse& GetTelemetrySnapshotResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetTelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void GetTelemetrySnapshotResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && telemetry_snapshot_ != nullptr) {
+    delete telemetry_snapshot_;
+  }
+  telemetry_snapshot_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+const char* GetTelemetrySnapshotResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_telemetry_snapshot(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetTelemetrySnapshotResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+  if (this->has_telemetry_snapshot()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::telemetry_snapshot(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  return target;
+}
+
+size_t GetTelemetrySnapshotResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+  if (this->has_telemetry_snapshot()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *telemetry_snapshot_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GetTelemetrySnapshotResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetTelemetrySnapshotResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetTelemetrySnapshotResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+    MergeFrom(*source);
+  }
+}
+
+void GetTelemetrySnapshotResponse::MergeFrom(const GetTelemetrySnapshotResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_telemetry_snapshot()) {
+    _internal_mutable_telemetry_snapshot()->::mavsdk::rpc::telemetry::TelemetrySnapshot::MergeFrom(from._internal_telemetry_snapshot());
+  }
+}
+
+void GetTelemetrySnapshotResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetTelemetrySnapshotResponse::CopyFrom(const GetTelemetrySnapshotResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetTelemetrySnapshotResponse::IsInitialized() const {
+  return true;
+}
+
+void GetTelemetrySnapshotResponse::InternalSwap(GetTelemetrySnapshotResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(telemetry_snapshot_, other->telemetry_snapshot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetTelemetrySnapshotResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void SubscribeTelemetrySnapshotRequest::InitAsDefaultInstance() {
+}
+class SubscribeTelemetrySnapshotRequest::_Internal {
+ public:
+};
+
+SubscribeTelemetrySnapshotRequest::SubscribeTelemetrySnapshotRequest()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+}
+SubscribeTelemetrySnapshotRequest::SubscribeTelemetrySnapshotRequest(const SubscribeTelemetrySnapshotRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&rate_hz_, &from.rate_hz_,
+    static_cast<size_t>(reinterpret_cast<char*>(&fields_) -
+    reinterpret_cast<char*>(&rate_hz_)) + sizeof(fields_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+}
+
+void SubscribeTelemetrySnapshotRequest::SharedCtor() {
+  ::memset(&rate_hz_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&fields_) -
+      reinterpret_cast<char*>(&rate_hz_)) + sizeof(fields_));
+}
+
+SubscribeTelemetrySnapshotRequest::~SubscribeTelemetrySnapshotRequest() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  SharedDtor();
+}
+
+void SubscribeTelemetrySnapshotRequest::SharedDtor() {
+}
+
+void SubscribeTelemetrySnapshotRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const SubscribeTelemetrySnapshotRequest& SubscribeTelemetrySnapshotRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SubscribeTelemetrySnapshotRequest_telemetry_2ftelemetry_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void SubscribeTelemetrySnapshotRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&rate_hz_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&fields_) -
+      reinterpret_cast<char*>(&rate_hz_)) + sizeof(fields_));
+  _internal_metadata_.Clear();
+}
+
+const char* SubscribeTelemetrySnapshotRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint32 fields = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          fields_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // double rate_hz = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 17)) {
+          rate_hz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* SubscribeTelemetrySnapshotRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 fields = 1;
+  if (this->fields() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(1, this->_internal_fields(), target);
+  }
+
+  // double rate_hz = 2;
+  if (!(this->rate_hz() <= 0 && this->rate_hz() >= 0)) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteDoubleToArray(2, this->_internal_rate_hz(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  return target;
+}
+
+size_t SubscribeTelemetrySnapshotRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double rate_hz = 2;
+  if (!(this->rate_hz() <= 0 && this->rate_hz() >= 0)) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 fields = 1;
+  if (this->fields() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_fields());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubscribeTelemetrySnapshotRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SubscribeTelemetrySnapshotRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SubscribeTelemetrySnapshotRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+    MergeFrom(*source);
+  }
+}
+
+void SubscribeTelemetrySnapshotRequest::MergeFrom(const SubscribeTelemetrySnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!(from.rate_hz() <= 0 && from.rate_hz() >= 0)) {
+    _internal_set_rate_hz(from._internal_rate_hz());
+  }
+  if (from.fields() != 0) {
+    _internal_set_fields(from._internal_fields());
+  }
+}
+
+void SubscribeTelemetrySnapshotRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SubscribeTelemetrySnapshotRequest::CopyFrom(const SubscribeTelemetrySnapshotRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubscribeTelemetrySnapshotRequest::IsInitialized() const {
+  return true;
+}
+
+void SubscribeTelemetrySnapshotRequest::InternalSwap(SubscribeTelemetrySnapshotRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(rate_hz_, other->rate_hz_);
+  swap(fields_, other->fields_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SubscribeTelemetrySnapshotRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TelemetrySnapshotResponse::InitAsDefaultInstance() {
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshotResponse_default_instance_._instance.get_mutable()->telemetry_snapshot_ = const_cast< ::mavsdk::rpc::telemetry::TelemetrySnapshot*>(
+      ::mavsdk::rpc::telemetry::TelemetrySnapshot::internal_default_instance());
+}
+class TelemetrySnapshotResponse::_Internal {
+ public:
+  static const ::mavsdk::rpc::telemetry::TelemetrySnapshot& telemetry_snapshot(const TelemetrySnapshotResponse* msg);
+};
+
+const ::mavsdk::rpc::telemetry::TelemetrySnapshot&
+TelemetrySnapshotResponse::_Internal::telemetry_snapshot(const TelemetrySnapshotResponse* msg) {
+  return *msg->telemetry_snapshot_;
+}
+TelemetrySnapshotResponse::TelemetrySnapshotResponse()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+}
+TelemetrySnapshotResponse::TelemetrySnapshotResponse(const TelemetrySnapshotResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from._internal_has_telemetry_snapshot()) {
+    telemetry_snapshot_ = new ::mavsdk::rpc::telemetry::TelemetrySnapshot(*from.telemetry_snapshot_);
+  } else {
+    telemetry_snapshot_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+}
+
+void TelemetrySnapshotResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto.base);
+  telemetry_snapshot_ = nullptr;
+}
+
+TelemetrySnapshotResponse::~TelemetrySnapshotResponse() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  SharedDtor();
+}
+
+void TelemetrySnapshotResponse::SharedDtor() {
+  if (this != internal_default_instance()) delete telemetry_snapshot_;
+}
+
+void TelemetrySnapshotResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TelemetrySnapshotResponse& TelemetrySnapshotResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TelemetrySnapshotResponse_telemetry_2ftelemetry_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TelemetrySnapshotResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && telemetry_snapshot_ != nullptr) {
+    delete telemetry_snapshot_;
+  }
+  telemetry_snapshot_ = nullptr;
+  _internal_metadata_.Clear();
+}
+
+const char* TelemetrySnapshotResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_telemetry_snapshot(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TelemetrySnapshotResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+  if (this->has_telemetry_snapshot()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::telemetry_snapshot(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  return target;
+}
+
+size_t TelemetrySnapshotResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+  if (this->has_telemetry_snapshot()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *telemetry_snapshot_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TelemetrySnapshotResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TelemetrySnapshotResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TelemetrySnapshotResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+    MergeFrom(*source);
+  }
+}
+
+void TelemetrySnapshotResponse::MergeFrom(const TelemetrySnapshotResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_telemetry_snapshot()) {
+    _internal_mutable_telemetry_snapshot()->::mavsdk::rpc::telemetry::TelemetrySnapshot::MergeFrom(from._internal_telemetry_snapshot());
+  }
+}
+
+void TelemetrySnapshotResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TelemetrySnapshotResponse::CopyFrom(const TelemetrySnapshotResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TelemetrySnapshotResponse::IsInitialized() const {
+  return true;
+}
+
+void TelemetrySnapshotResponse::InternalSwap(TelemetrySnapshotResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(telemetry_snapshot_, other->telemetry_snapshot_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TelemetrySnapshotResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void TelemetrySnapshot::InitAsDefaultInstance() {
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->position_ = const_cast< ::mavsdk::rpc::telemetry::Position*>(
+      ::mavsdk::rpc::telemetry::Position::internal_default_instance());
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->home_position_ = const_cast< ::mavsdk::rpc::telemetry::Position*>(
+      ::mavsdk::rpc::telemetry::Position::internal_default_instance());
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->attitude_euler_angle_ = const_cast< ::mavsdk::rpc::telemetry::EulerAngle*>(
+      ::mavsdk::rpc::telemetry::EulerAngle::internal_default_instance());
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->ground_speed_ned_ = const_cast< ::mavsdk::rpc::telemetry::SpeedNed*>(
+      ::mavsdk::rpc::telemetry::SpeedNed::internal_default_instance());
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->gps_info_ = const_cast< ::mavsdk::rpc::telemetry::GpsInfo*>(
+      ::mavsdk::rpc::telemetry::GpsInfo::internal_default_instance());
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->battery_ = const_cast< ::mavsdk::rpc::telemetry::Battery*>(
+      ::mavsdk::rpc::telemetry::Battery::internal_default_instance());
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->health_ = const_cast< ::mavsdk::rpc::telemetry::Health*>(
+      ::mavsdk::rpc::telemetry::Health::internal_default_instance());
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->rc_status_ = const_cast< ::mavsdk::rpc::telemetry::RcStatus*>(
+      ::mavsdk::rpc::telemetry::RcStatus::internal_default_instance());
+  ::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_._instance.get_mutable()->status_text_ = const_cast< ::mavsdk::rpc::telemetry::StatusText*>(
+      ::mavsdk::rpc::telemetry::StatusText::internal_default_instance());
+}
+class TelemetrySnapshot::_Internal {
+ public:
+  static const ::mavsdk::rpc::telemetry::Position& position(const TelemetrySnapshot* msg);
+  static const ::mavsdk::rpc::telemetry::Position& home_position(const TelemetrySnapshot* msg);
+  static const ::mavsdk::rpc::telemetry::EulerAngle& attitude_euler_angle(const TelemetrySnapshot* msg);
+  static const ::mavsdk::rpc::telemetry::SpeedNed& ground_speed_ned(const TelemetrySnapshot* msg);
+  static const ::mavsdk::rpc::telemetry::GpsInfo& gps_info(const TelemetrySnapshot* msg);
+  static const ::mavsdk::rpc::telemetry::Battery& battery(const TelemetrySnapshot* msg);
+  static const ::mavsdk::rpc::telemetry::Health& health(const TelemetrySnapshot* msg);
+  static const ::mavsdk::rpc::telemetry::RcStatus& rc_status(const TelemetrySnapshot* msg);
+  static const ::mavsdk::rpc::telemetry::StatusText& status_text(const TelemetrySnapshot* msg);
+};
+
+const ::mavsdk::rpc::telemetry::Position&
+TelemetrySnapshot::_Internal::position(const TelemetrySnapshot* msg) {
+  return *msg->position_;
+}
+const ::mavsdk::rpc::telemetry::Position&
+TelemetrySnapshot::_Internal::home_position(const TelemetrySnapshot* msg) {
+  return *msg->home_position_;
+}
+const ::mavsdk::rpc::telemetry::EulerAngle&
+TelemetrySnapshot::_Internal::attitude_euler_angle(const TelemetrySnapshot* msg) {
+  return *msg->attitude_euler_angle_;
+}
+const ::mavsdk::rpc::telemetry::SpeedNed&
+TelemetrySnapshot::_Internal::ground_speed_ned(const TelemetrySnapshot* msg) {
+  return *msg->ground_speed_ned_;
+}
+const ::mavsdk::rpc::telemetry::GpsInfo&
+TelemetrySnapshot::_Internal::gps_info(const TelemetrySnapshot* msg) {
+  return *msg->gps_info_;
+}
+const ::mavsdk::rpc::telemetry::Battery&
+TelemetrySnapshot::_Internal::battery(const TelemetrySnapshot* msg) {
+  return *msg->battery_;
+}
+const ::mavsdk::rpc::telemetry::Health&
+TelemetrySnapshot::_Internal::health(const TelemetrySnapshot* msg) {
+  return *msg->health_;
+}
+const ::mavsdk::rpc::telemetry::RcStatus&
+TelemetrySnapshot::_Internal::rc_status(const TelemetrySnapshot* msg) {
+  return *msg->rc_status_;
+}
+const ::mavsdk::rpc::telemetry::StatusText&
+TelemetrySnapshot::_Internal::status_text(const TelemetrySnapshot* msg) {
+  return *msg->status_text_;
+}
+TelemetrySnapshot::TelemetrySnapshot()
+  : ::PROTOBUF_NAMESPACE_ID::Message(), _internal_metadata_(nullptr) {
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:mavsdk.rpc.telemetry.TelemetrySnapshot)
+}
+TelemetrySnapshot::TelemetrySnapshot(const TelemetrySnapshot& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      _internal_metadata_(nullptr) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from._internal_has_position()) {
+    position_ = new ::mavsdk::rpc::telemetry::Position(*from.position_);
+  } else {
+    position_ = nullptr;
+  }
+  if (from._internal_has_home_position()) {
+    home_position_ = new ::mavsdk::rpc::telemetry::Position(*from.home_position_);
+  } else {
+    home_position_ = nullptr;
+  }
+  if (from._internal_has_attitude_euler_angle()) {
+    attitude_euler_angle_ = new ::mavsdk::rpc::telemetry::EulerAngle(*from.attitude_euler_angle_);
+  } else {
+    attitude_euler_angle_ = nullptr;
+  }
+  if (from._internal_has_ground_speed_ned()) {
+    ground_speed_ned_ = new ::mavsdk::rpc::telemetry::SpeedNed(*from.ground_speed_ned_);
+  } else {
+    ground_speed_ned_ = nullptr;
+  }
+  if (from._internal_has_gps_info()) {
+    gps_info_ = new ::mavsdk::rpc::telemetry::GpsInfo(*from.gps_info_);
+  } else {
+    gps_info_ = nullptr;
+  }
+  if (from._internal_has_battery()) {
+    battery_ = new ::mavsdk::rpc::telemetry::Battery(*from.battery_);
+  } else {
+    battery_ = nullptr;
+  }
+  if (from._internal_has_health()) {
+    health_ = new ::mavsdk::rpc::telemetry::Health(*from.health_);
+  } else {
+    health_ = nullptr;
+  }
+  if (from._internal_has_rc_status()) {
+    rc_status_ = new ::mavsdk::rpc::telemetry::RcStatus(*from.rc_status_);
+  } else {
+    rc_status_ = nullptr;
+  }
+  if (from._internal_has_status_text()) {
+    status_text_ = new ::mavsdk::rpc::telemetry::StatusText(*from.status_text_);
+  } else {
+    status_text_ = nullptr;
+  }
+  ::memcpy(&timestamp_us_, &from.timestamp_us_,
+    static_cast<size_t>(reinterpret_cast<char*>(&flight_mode_) -
+    reinterpret_cast<char*>(&timestamp_us_)) + sizeof(flight_mode_));
+  // @@protoc_insertion_point(copy_constructor:mavsdk.rpc.telemetry.TelemetrySnapshot)
+}
+
+void TelemetrySnapshot::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto.base);
+  ::memset(&position_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&flight_mode_) -
+      reinterpret_cast<char*>(&position_)) + sizeof(flight_mode_));
+}
+
+TelemetrySnapshot::~TelemetrySnapshot() {
+  // @@protoc_insertion_point(destructor:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  SharedDtor();
+}
+
+void TelemetrySnapshot::SharedDtor() {
+  if (this != internal_default_instance()) delete position_;
+  if (this != internal_default_instance()) delete home_position_;
+  if (this != internal_default_instance()) delete attitude_euler_angle_;
+  if (this != internal_default_instance()) delete ground_speed_ned_;
+  if (this != internal_default_instance()) delete gps_info_;
+  if (this != internal_default_instance()) delete battery_;
+  if (this != internal_default_instance()) delete health_;
+  if (this != internal_default_instance()) delete rc_status_;
+  if (this != internal_default_instance()) delete status_text_;
+}
+
+void TelemetrySnapshot::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const TelemetrySnapshot& TelemetrySnapshot::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_TelemetrySnapshot_telemetry_2ftelemetry_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void TelemetrySnapshot::Clear() {
+// @@protoc_insertion_point(message_clear_start:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
+    delete position_;
+  }
+  position_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && home_position_ != nullptr) {
+    delete home_position_;
+  }
+  home_position_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && attitude_euler_angle_ != nullptr) {
+    delete attitude_euler_angle_;
+  }
+  attitude_euler_angle_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && ground_speed_ned_ != nullptr) {
+    delete ground_speed_ned_;
+  }
+  ground_speed_ned_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && gps_info_ != nullptr) {
+    delete gps_info_;
+  }
+  gps_info_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && battery_ != nullptr) {
+    delete battery_;
+  }
+  battery_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && health_ != nullptr) {
+    delete health_;
+  }
+  health_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && rc_status_ != nullptr) {
+    delete rc_status_;
+  }
+  rc_status_ = nullptr;
+  if (GetArenaNoVirtual() == nullptr && status_text_ != nullptr) {
+    delete status_text_;
+  }
+  status_text_ = nullptr;
+  ::memset(&timestamp_us_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&flight_mode_) -
+      reinterpret_cast<char*>(&timestamp_us_)) + sizeof(flight_mode_));
+  _internal_metadata_.Clear();
+}
+
+const char* TelemetrySnapshot::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // uint64 timestamp_us = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          timestamp_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint32 fields = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          fields_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.Position position = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_position(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.Position home_position = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_home_position(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool in_air = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          in_air_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool armed = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 48)) {
+          armed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.LandedState landed_state = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+          _internal_set_landed_state(static_cast<::mavsdk::rpc::telemetry::LandedState>(val));
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.FlightMode flight_mode = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint(&ptr);
+          CHK_(ptr);
+          _internal_set_flight_mode(static_cast<::mavsdk::rpc::telemetry::FlightMode>(val));
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.EulerAngle attitude_euler_angle = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_attitude_euler_angle(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.SpeedNed ground_speed_ned = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ground_speed_ned(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.GpsInfo gps_info = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gps_info(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.Battery battery = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_battery(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.Health health = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_health(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.RcStatus rc_status = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rc_status(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // .mavsdk.rpc.telemetry.StatusText status_text = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_status_text(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag, &_internal_metadata_, ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* TelemetrySnapshot::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 timestamp_us = 1;
+  if (this->timestamp_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(1, this->_internal_timestamp_us(), target);
+  }
+
+  // uint32 fields = 2;
+  if (this->fields() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_fields(), target);
+  }
+
+  // .mavsdk.rpc.telemetry.Position position = 3;
+  if (this->has_position()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::position(this), target, stream);
+  }
+
+  // .mavsdk.rpc.telemetry.Position home_position = 4;
+  if (this->has_home_position()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::home_position(this), target, stream);
+  }
+
+  // bool in_air = 5;
+  if (this->in_air() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(5, this->_internal_in_air(), target);
+  }
+
+  // bool armed = 6;
+  if (this->armed() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(6, this->_internal_armed(), target);
+  }
+
+  // .mavsdk.rpc.telemetry.LandedState landed_state = 7;
+  if (this->landed_state() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      7, this->_internal_landed_state(), target);
+  }
+
+  // .mavsdk.rpc.telemetry.FlightMode flight_mode = 8;
+  if (this->flight_mode() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      8, this->_internal_flight_mode(), target);
+  }
+
+  // .mavsdk.rpc.telemetry.EulerAngle attitude_euler_angle = 9;
+  if (this->has_attitude_euler_angle()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        9, _Internal::attitude_euler_angle(this), target, stream);
+  }
+
+  // .mavsdk.rpc.telemetry.SpeedNed ground_speed_ned = 10;
+  if (this->has_ground_speed_ned()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        10, _Internal::ground_speed_ned(this), target, stream);
+  }
+
+  // .mavsdk.rpc.telemetry.GpsInfo gps_info = 11;
+  if (this->has_gps_info()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::gps_info(this), target, stream);
+  }
+
+  // .mavsdk.rpc.telemetry.Battery battery = 12;
+  if (this->has_battery()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        12, _Internal::battery(this), target, stream);
+  }
+
+  // .mavsdk.rpc.telemetry.Health health = 13;
+  if (this->has_health()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        13, _Internal::health(this), target, stream);
+  }
+
+  // .mavsdk.rpc.telemetry.RcStatus rc_status = 14;
+  if (this->has_rc_status()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        14, _Internal::rc_status(this), target, stream);
+  }
+
+  // .mavsdk.rpc.telemetry.StatusText status_text = 15;
+  if (this->has_status_text()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        15, _Internal::status_text(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields(), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  return target;
+}
+
+size_t TelemetrySnapshot::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .mavsdk.rpc.telemetry.Position position = 3;
+  if (this->has_position()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *position_);
+  }
+
+  // .mavsdk.rpc.telemetry.Position home_position = 4;
+  if (this->has_home_position()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *home_position_);
+  }
+
+  // .mavsdk.rpc.telemetry.EulerAngle attitude_euler_angle = 9;
+  if (this->has_attitude_euler_angle()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *attitude_euler_angle_);
+  }
+
+  // .mavsdk.rpc.telemetry.SpeedNed ground_speed_ned = 10;
+  if (this->has_ground_speed_ned()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *ground_speed_ned_);
+  }
+
+  // .mavsdk.rpc.telemetry.GpsInfo gps_info = 11;
+  if (this->has_gps_info()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *gps_info_);
+  }
+
+  // .mavsdk.rpc.telemetry.Battery battery = 12;
+  if (this->has_battery()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *battery_);
+  }
+
+  // .mavsdk.rpc.telemetry.Health health = 13;
+  if (this->has_health()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *health_);
+  }
+
+  // .mavsdk.rpc.telemetry.RcStatus rc_status = 14;
+  if (this->has_rc_status()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *rc_status_);
+  }
+
+  // .mavsdk.rpc.telemetry.StatusText status_text = 15;
+  if (this->has_status_text()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *status_text_);
+  }
+
+  // uint64 timestamp_us = 1;
+  if (this->timestamp_us() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_timestamp_us());
+  }
+
+  // uint32 fields = 2;
+  if (this->fields() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
+        this->_internal_fields());
+  }
+
+  // bool in_air = 5;
+  if (this->in_air() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool armed = 6;
+  if (this->armed() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .mavsdk.rpc.telemetry.LandedState landed_state = 7;
+  if (this->landed_state() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_landed_state());
+  }
+
+  // .mavsdk.rpc.telemetry.FlightMode flight_mode = 8;
+  if (this->flight_mode() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_flight_mode());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void TelemetrySnapshot::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  GOOGLE_DCHECK_NE(&from, this);
+  const TelemetrySnapshot* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<TelemetrySnapshot>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:mavsdk.rpc.telemetry.TelemetrySnapshot)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:mavsdk.rpc.telemetry.TelemetrySnapshot)
+    MergeFrom(*source);
+  }
+}
+
+void TelemetrySnapshot::MergeFrom(const TelemetrySnapshot& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_position()) {
+    _internal_mutable_position()->::mavsdk::rpc::telemetry::Position::MergeFrom(from._internal_position());
+  }
+  if (from.has_home_position()) {
+    _internal_mutable_home_position()->::mavsdk::rpc::telemetry::Position::MergeFrom(from._internal_home_position());
+  }
+  if (from.has_attitude_euler_angle()) {
+    _internal_mutable_attitude_euler_angle()->::mavsdk::rpc::telemetry::EulerAngle::MergeFrom(from._internal_attitude_euler_angle());
+  }
+  if (from.has_ground_speed_ned()) {
+    _internal_mutable_ground_speed_ned()->::mavsdk::rpc::telemetry::SpeedNed::MergeFrom(from._internal_ground_speed_ned());
+  }
+  if (from.has_gps_info()) {
+    _internal_mutable_gps_info()->::mavsdk::rpc::telemetry::GpsInfo::MergeFrom(from._internal_gps_info());
+  }
+  if (from.has_battery()) {
+    _internal_mutable_battery()->::mavsdk::rpc::telemetry::Battery::MergeFrom(from._internal_battery());
+  }
+  if (from.has_health()) {
+    _internal_mutable_health()->::mavsdk::rpc::telemetry::Health::MergeFrom(from._internal_health());
+  }
+  if (from.has_rc_status()) {
+    _internal_mutable_rc_status()->::mavsdk::rpc::telemetry::RcStatus::MergeFrom(from._internal_rc_status());
+  }
+  if (from.has_status_text()) {
+    _internal_mutable_status_text()->::mavsdk::rpc::telemetry::StatusText::MergeFrom(from._internal_status_text());
+  }
+  if (from.timestamp_us() != 0) {
+    _internal_set_timestamp_us(from._internal_timestamp_us());
+  }
+  if (from.fields() != 0) {
+    _internal_set_fields(from._internal_fields());
+  }
+  if (from.in_air() != 0) {
+    _internal_set_in_air(from._internal_in_air());
+  }
+  if (from.armed() != 0) {
+    _internal_set_armed(from._internal_armed());
+  }
+  if (from.landed_state() != 0) {
+    _internal_set_landed_state(from._internal_landed_state());
+  }
+  if (from.flight_mode() != 0) {
+    _internal_set_flight_mode(from._internal_flight_mode());
+  }
+}
+
+void TelemetrySnapshot::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void TelemetrySnapshot::CopyFrom(const TelemetrySnapshot& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:mavsdk.rpc.telemetry.TelemetrySnapshot)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TelemetrySnapshot::IsInitialized() const {
+  return true;
+}
+
+void TelemetrySnapshot::InternalSwap(TelemetrySnapshot* other) {
+  using std::swap;
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  swap(position_, other->position_);
+  swap(home_position_, other->home_position_);
+  swap(attitude_euler_angle_, other->attitude_euler_angle_);
+  swap(ground_speed_ned_, other->ground_speed_ned_);
+  swap(gps_info_, other->gps_info_);
+  swap(battery_, other->battery_);
+  swap(health_, other->health_);
+  swap(rc_status_, other->rc_status_);
+  swap(status_text_, other->status_text_);
+  swap(timestamp_us_, other->timestamp_us_);
+  swap(fields_, other->fields_);
+  swap(in_air_, other->in_air_);
+  swap(armed_, other->armed_);
+  swap(landed_state_, other->landed_state_);
+  swap(flight_mode_, other->flight_mode_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TelemetrySnapshot::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace telemetry
+}  // namespace rpc
+}  // namespace mavsdk
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribePositionRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribePositionRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribePositionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::PositionResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::PositionResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::PositionResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeHomeRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeHomeRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeHomeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::HomeResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::HomeResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::HomeResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeInAirRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeInAirRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeInAirRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::InAirResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::InAirResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::InAirResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeLandedStateRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeLandedStateRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeLandedStateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::LandedStateResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::LandedStateResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::LandedStateResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeArmedRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeArmedRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeArmedRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::ArmedResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::ArmedResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::ArmedResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeAttitudeQuaternionRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeAttitudeQuaternionRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeAttitudeQuaternionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::AttitudeQuaternionResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::AttitudeQuaternionResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::AttitudeQuaternionResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeAttitudeEulerRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeAttitudeEulerRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeAttitudeEulerRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::AttitudeEulerResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::AttitudeEulerResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::AttitudeEulerResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeAttitudeAngularVelocityBodyRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeAttitudeAngularVelocityBodyRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeAttitudeAngularVelocityBodyRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::AttitudeAngularVelocityBodyResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::AttitudeAngularVelocityBodyResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::AttitudeAngularVelocityBodyResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeQuaternionRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeQuaternionRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeQuaternionRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::CameraAttitudeQuaternionResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::CameraAttitudeQuaternionResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::CameraAttitudeQuaternionResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeEulerRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeEulerRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeCameraAttitudeEulerRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::CameraAttitudeEulerResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::CameraAttitudeEulerResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::CameraAttitudeEulerResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeGroundSpeedNedRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeGroundSpeedNedRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeGroundSpeedNedRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::GroundSpeedNedResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::GroundSpeedNedResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::GroundSpeedNedResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeGpsInfoRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeGpsInfoRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeGpsInfoRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::GpsInfoResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::GpsInfoResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::GpsInfoResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeBatteryRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeBatteryRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeBatteryRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::BatteryResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::BatteryResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::BatteryResponse >(arena);
 }
 template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeFlightModeRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeFlightModeRequest >(Arena* arena) {
   return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeFlightModeRequest >(arena);
@@ -13198,6 +14897,21 @@ template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SpeedBody* Arena::CreateM
 template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::PositionBody* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::PositionBody >(Arena* arena) {
   return Arena::CreateInternal< ::mavsdk::rpc::telemetry::PositionBody >(arena);
 }
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::mavsdk::rpc::telemetry::TelemetrySnapshot* Arena::CreateMaybeMessage< ::mavsdk::rpc::telemetry::TelemetrySnapshot >(Arena* arena) {
+  return Arena::CreateInternal< ::mavsdk::rpc::telemetry::TelemetrySnapshot >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -48,7 +48,7 @@ struct TableStruct_telemetry_2ftelemetry_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[56]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[61]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -106,6 +106,12 @@ extern EulerAngleDefaultTypeInternal _EulerAngle_default_instance_;
 class FlightModeResponse;
 class FlightModeResponseDefaultTypeInternal;
 extern FlightModeResponseDefaultTypeInternal _FlightModeResponse_default_instance_;
+class GetTelemetrySnapshotRequest;
+class GetTelemetrySnapshotRequestDefaultTypeInternal;
+extern GetTelemetrySnapshotRequestDefaultTypeInternal _GetTelemetrySnapshotRequest_default_instance_;
+class GetTelemetrySnapshotResponse;
+class GetTelemetrySnapshotResponseDefaultTypeInternal;
+extern GetTelemetrySnapshotResponseDefaultTypeInternal _GetTelemetrySnapshotResponse_default_instance_;
 class GpsInfo;
 class GpsInfoDefaultTypeInternal;
 extern GpsInfoDefaultTypeInternal _GpsInfo_default_instance_;
@@ -226,6 +232,15 @@ extern SubscribeRcStatusRequestDefaultTypeInternal _SubscribeRcStatusRequest_def
 class SubscribeStatusTextRequest;
 class SubscribeStatusTextRequestDefaultTypeInternal;
 extern SubscribeStatusTextRequestDefaultTypeInternal _SubscribeStatusTextRequest_default_instance_;
+class SubscribeTelemetrySnapshotRequest;
+class SubscribeTelemetrySnapshotRequestDefaultTypeInternal;
+extern SubscribeTelemetrySnapshotRequestDefaultTypeInternal _SubscribeTelemetrySnapshotRequest_default_instance_;
+class TelemetrySnapshot;
+class TelemetrySnapshotDefaultTypeInternal;
+extern TelemetrySnapshotDefaultTypeInternal _TelemetrySnapshot_default_instance_;
+class TelemetrySnapshotResponse;
+class TelemetrySnapshotResponseDefaultTypeInternal;
+extern TelemetrySnapshotResponseDefaultTypeInternal _TelemetrySnapshotResponse_default_instance_;
 }  // namespace telemetry
 }  // namespace rpc
 }  // namespace mavsdk
@@ -246,6 +261,8 @@ template<> ::mavsdk::rpc::telemetry::CameraAttitudeQuaternionResponse* Arena::Cr
 template<> ::mavsdk::rpc::telemetry::Covariance* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::Covariance>(Arena*);
 template<> ::mavsdk::rpc::telemetry::EulerAngle* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::EulerAngle>(Arena*);
 template<> ::mavsdk::rpc::telemetry::FlightModeResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::FlightModeResponse>(Arena*);
+template<> ::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest>(Arena*);
+template<> ::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse>(Arena*);
 template<> ::mavsdk::rpc::telemetry::GpsInfo* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::GpsInfo>(Arena*);
 template<> ::mavsdk::rpc::telemetry::GpsInfoResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::GpsInfoResponse>(Arena*);
 template<> ::mavsdk::rpc::telemetry::GroundSpeedNedResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::GroundSpeedNedResponse>(Arena*);
@@ -286,6 +303,9 @@ template<> ::mavsdk::rpc::telemetry::SubscribeOdometryRequest* Arena::CreateMayb
 template<> ::mavsdk::rpc::telemetry::SubscribePositionRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::SubscribePositionRequest>(Arena*);
 template<> ::mavsdk::rpc::telemetry::SubscribeRcStatusRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::SubscribeRcStatusRequest>(Arena*);
 template<> ::mavsdk::rpc::telemetry::SubscribeStatusTextRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::SubscribeStatusTextRequest>(Arena*);
+template<> ::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest>(Arena*);
+template<> ::mavsdk::rpc::telemetry::TelemetrySnapshot* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::TelemetrySnapshot>(Arena*);
+template<> ::mavsdk::rpc::telemetry::TelemetrySnapshotResponse* Arena::CreateMaybeMessage<::mavsdk::rpc::telemetry::TelemetrySnapshotResponse>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace mavsdk {
 namespace rpc {
@@ -8002,2701 +8022,4442 @@ class PositionBody :
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_telemetry_2ftelemetry_2eproto;
 };
+// -------------------------------------------------------------------
+
+class GetTelemetrySnapshotRequest :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest) */ {
+ public:
+  GetTelemetrySnapshotRequest();
+  virtual ~GetTelemetrySnapshotRequest();
+
+  GetTelemetrySnapshotRequest(const GetTelemetrySnapshotRequest& from);
+  GetTelemetrySnapshotRequest(GetTelemetrySnapshotRequest&& from) noexcept
+    : GetTelemetrySnapshotRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetTelemetrySnapshotRequest& operator=(const GetTelemetrySnapshotRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetTelemetrySnapshotRequest& operator=(GetTelemetrySnapshotRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetTelemetrySnapshotRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetTelemetrySnapshotRequest* internal_default_instance() {
+    return reinterpret_cast<const GetTelemetrySnapshotRequest*>(
+               &_GetTelemetrySnapshotRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    56;
+
+  friend void swap(GetTelemetrySnapshotRequest& a, GetTelemetrySnapshotRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetTelemetrySnapshotRequest* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetTelemetrySnapshotRequest* New() const final {
+    return CreateMaybeMessage<GetTelemetrySnapshotRequest>(nullptr);
+  }
+
+  GetTelemetrySnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetTelemetrySnapshotRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetTelemetrySnapshotRequest& from);
+  void MergeFrom(const GetTelemetrySnapshotRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetTelemetrySnapshotRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_telemetry_2ftelemetry_2eproto);
+    return ::descriptor_table_telemetry_2ftelemetry_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFieldsFieldNumber = 1,
+  };
+  // uint32 fields = 1;
+  void clear_fields();
+  ::PROTOBUF_NAMESPACE_ID::uint32 fields() const;
+  void set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_fields() const;
+  void _internal_set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 fields_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_telemetry_2ftelemetry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetTelemetrySnapshotResponse :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse) */ {
+ public:
+  GetTelemetrySnapshotResponse();
+  virtual ~GetTelemetrySnapshotResponse();
+
+  GetTelemetrySnapshotResponse(const GetTelemetrySnapshotResponse& from);
+  GetTelemetrySnapshotResponse(GetTelemetrySnapshotResponse&& from) noexcept
+    : GetTelemetrySnapshotResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetTelemetrySnapshotResponse& operator=(const GetTelemetrySnapshotResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetTelemetrySnapshotResponse& operator=(GetTelemetrySnapshotResponse&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetTelemetrySnapshotResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetTelemetrySnapshotResponse* internal_default_instance() {
+    return reinterpret_cast<const GetTelemetrySnapshotResponse*>(
+               &_GetTelemetrySnapshotResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    57;
+
+  friend void swap(GetTelemetrySnapshotResponse& a, GetTelemetrySnapshotResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetTelemetrySnapshotResponse* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetTelemetrySnapshotResponse* New() const final {
+    return CreateMaybeMessage<GetTelemetrySnapshotResponse>(nullptr);
+  }
+
+  GetTelemetrySnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetTelemetrySnapshotResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetTelemetrySnapshotResponse& from);
+  void MergeFrom(const GetTelemetrySnapshotResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetTelemetrySnapshotResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_telemetry_2ftelemetry_2eproto);
+    return ::descriptor_table_telemetry_2ftelemetry_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTelemetrySnapshotFieldNumber = 1,
+  };
+  // .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+  bool has_telemetry_snapshot() const;
+  private:
+  bool _internal_has_telemetry_snapshot() const;
+  public:
+  void clear_telemetry_snapshot();
+  const ::mavsdk::rpc::telemetry::TelemetrySnapshot& telemetry_snapshot() const;
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* release_telemetry_snapshot();
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* mutable_telemetry_snapshot();
+  void set_allocated_telemetry_snapshot(::mavsdk::rpc::telemetry::TelemetrySnapshot* telemetry_snapshot);
+  private:
+  const ::mavsdk::rpc::telemetry::TelemetrySnapshot& _internal_telemetry_snapshot() const;
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* _internal_mutable_telemetry_snapshot();
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* telemetry_snapshot_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_telemetry_2ftelemetry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubscribeTelemetrySnapshotRequest :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest) */ {
+ public:
+  SubscribeTelemetrySnapshotRequest();
+  virtual ~SubscribeTelemetrySnapshotRequest();
+
+  SubscribeTelemetrySnapshotRequest(const SubscribeTelemetrySnapshotRequest& from);
+  SubscribeTelemetrySnapshotRequest(SubscribeTelemetrySnapshotRequest&& from) noexcept
+    : SubscribeTelemetrySnapshotRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SubscribeTelemetrySnapshotRequest& operator=(const SubscribeTelemetrySnapshotRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubscribeTelemetrySnapshotRequest& operator=(SubscribeTelemetrySnapshotRequest&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SubscribeTelemetrySnapshotRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SubscribeTelemetrySnapshotRequest* internal_default_instance() {
+    return reinterpret_cast<const SubscribeTelemetrySnapshotRequest*>(
+               &_SubscribeTelemetrySnapshotRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    58;
+
+  friend void swap(SubscribeTelemetrySnapshotRequest& a, SubscribeTelemetrySnapshotRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubscribeTelemetrySnapshotRequest* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SubscribeTelemetrySnapshotRequest* New() const final {
+    return CreateMaybeMessage<SubscribeTelemetrySnapshotRequest>(nullptr);
+  }
+
+  SubscribeTelemetrySnapshotRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SubscribeTelemetrySnapshotRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SubscribeTelemetrySnapshotRequest& from);
+  void MergeFrom(const SubscribeTelemetrySnapshotRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SubscribeTelemetrySnapshotRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_telemetry_2ftelemetry_2eproto);
+    return ::descriptor_table_telemetry_2ftelemetry_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRateHzFieldNumber = 2,
+    kFieldsFieldNumber = 1,
+  };
+  // double rate_hz = 2;
+  void clear_rate_hz();
+  double rate_hz() const;
+  void set_rate_hz(double value);
+  private:
+  double _internal_rate_hz() const;
+  void _internal_set_rate_hz(double value);
+  public:
+
+  // uint32 fields = 1;
+  void clear_fields();
+  ::PROTOBUF_NAMESPACE_ID::uint32 fields() const;
+  void set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_fields() const;
+  void _internal_set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  double rate_hz_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 fields_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_telemetry_2ftelemetry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TelemetrySnapshotResponse :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.telemetry.TelemetrySnapshotResponse) */ {
+ public:
+  TelemetrySnapshotResponse();
+  virtual ~TelemetrySnapshotResponse();
+
+  TelemetrySnapshotResponse(const TelemetrySnapshotResponse& from);
+  TelemetrySnapshotResponse(TelemetrySnapshotResponse&& from) noexcept
+    : TelemetrySnapshotResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline TelemetrySnapshotResponse& operator=(const TelemetrySnapshotResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TelemetrySnapshotResponse& operator=(TelemetrySnapshotResponse&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TelemetrySnapshotResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TelemetrySnapshotResponse* internal_default_instance() {
+    return reinterpret_cast<const TelemetrySnapshotResponse*>(
+               &_TelemetrySnapshotResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    59;
+
+  friend void swap(TelemetrySnapshotResponse& a, TelemetrySnapshotResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TelemetrySnapshotResponse* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TelemetrySnapshotResponse* New() const final {
+    return CreateMaybeMessage<TelemetrySnapshotResponse>(nullptr);
+  }
+
+  TelemetrySnapshotResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TelemetrySnapshotResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TelemetrySnapshotResponse& from);
+  void MergeFrom(const TelemetrySnapshotResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TelemetrySnapshotResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.telemetry.TelemetrySnapshotResponse";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_telemetry_2ftelemetry_2eproto);
+    return ::descriptor_table_telemetry_2ftelemetry_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTelemetrySnapshotFieldNumber = 1,
+  };
+  // .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+  bool has_telemetry_snapshot() const;
+  private:
+  bool _internal_has_telemetry_snapshot() const;
+  public:
+  void clear_telemetry_snapshot();
+  const ::mavsdk::rpc::telemetry::TelemetrySnapshot& telemetry_snapshot() const;
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* release_telemetry_snapshot();
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* mutable_telemetry_snapshot();
+  void set_allocated_telemetry_snapshot(::mavsdk::rpc::telemetry::TelemetrySnapshot* telemetry_snapshot);
+  private:
+  const ::mavsdk::rpc::telemetry::TelemetrySnapshot& _internal_telemetry_snapshot() const;
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* _internal_mutable_telemetry_snapshot();
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.telemetry.TelemetrySnapshotResponse)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* telemetry_snapshot_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_telemetry_2ftelemetry_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TelemetrySnapshot :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:mavsdk.rpc.telemetry.TelemetrySnapshot) */ {
+ public:
+  TelemetrySnapshot();
+  virtual ~TelemetrySnapshot();
+
+  TelemetrySnapshot(const TelemetrySnapshot& from);
+  TelemetrySnapshot(TelemetrySnapshot&& from) noexcept
+    : TelemetrySnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline TelemetrySnapshot& operator=(const TelemetrySnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TelemetrySnapshot& operator=(TelemetrySnapshot&& from) noexcept {
+    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const TelemetrySnapshot& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const TelemetrySnapshot* internal_default_instance() {
+    return reinterpret_cast<const TelemetrySnapshot*>(
+               &_TelemetrySnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    60;
+
+  friend void swap(TelemetrySnapshot& a, TelemetrySnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TelemetrySnapshot* other) {
+    if (other == this) return;
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline TelemetrySnapshot* New() const final {
+    return CreateMaybeMessage<TelemetrySnapshot>(nullptr);
+  }
+
+  TelemetrySnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<TelemetrySnapshot>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const TelemetrySnapshot& from);
+  void MergeFrom(const TelemetrySnapshot& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TelemetrySnapshot* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "mavsdk.rpc.telemetry.TelemetrySnapshot";
+  }
+  private:
+  inline ::PROTOBUF_NAMESPACE_ID::Arena* GetArenaNoVirtual() const {
+    return nullptr;
+  }
+  inline void* MaybeArenaPtr() const {
+    return nullptr;
+  }
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_telemetry_2ftelemetry_2eproto);
+    return ::descriptor_table_telemetry_2ftelemetry_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPositionFieldNumber = 3,
+    kHomePositionFieldNumber = 4,
+    kAttitudeEulerAngleFieldNumber = 9,
+    kGroundSpeedNedFieldNumber = 10,
+    kGpsInfoFieldNumber = 11,
+    kBatteryFieldNumber = 12,
+    kHealthFieldNumber = 13,
+    kRcStatusFieldNumber = 14,
+    kStatusTextFieldNumber = 15,
+    kTimestampUsFieldNumber = 1,
+    kFieldsFieldNumber = 2,
+    kInAirFieldNumber = 5,
+    kArmedFieldNumber = 6,
+    kLandedStateFieldNumber = 7,
+    kFlightModeFieldNumber = 8,
+  };
+  // .mavsdk.rpc.telemetry.Position position = 3;
+  bool has_position() const;
+  private:
+  bool _internal_has_position() const;
+  public:
+  void clear_position();
+  const ::mavsdk::rpc::telemetry::Position& position() const;
+  ::mavsdk::rpc::telemetry::Position* release_position();
+  ::mavsdk::rpc::telemetry::Position* mutable_position();
+  void set_allocated_position(::mavsdk::rpc::telemetry::Position* position);
+  private:
+  const ::mavsdk::rpc::telemetry::Position& _internal_position() const;
+  ::mavsdk::rpc::telemetry::Position* _internal_mutable_position();
+  public:
+
+  // .mavsdk.rpc.telemetry.Position home_position = 4;
+  bool has_home_position() const;
+  private:
+  bool _internal_has_home_position() const;
+  public:
+  void clear_home_position();
+  const ::mavsdk::rpc::telemetry::Position& home_position() const;
+  ::mavsdk::rpc::telemetry::Position* release_home_position();
+  ::mavsdk::rpc::telemetry::Position* mutable_home_position();
+  void set_allocated_home_position(::mavsdk::rpc::telemetry::Position* home_position);
+  private:
+  const ::mavsdk::rpc::telemetry::Position& _internal_home_position() const;
+  ::mavsdk::rpc::telemetry::Position* _internal_mutable_home_position();
+  public:
+
+  // .mavsdk.rpc.telemetry.EulerAngle attitude_euler_angle = 9;
+  bool has_attitude_euler_angle() const;
+  private:
+  bool _internal_has_attitude_euler_angle() const;
+  public:
+  void clear_attitude_euler_angle();
+  const ::mavsdk::rpc::telemetry::EulerAngle& attitude_euler_angle() const;
+  ::mavsdk::rpc::telemetry::EulerAngle* release_attitude_euler_angle();
+  ::mavsdk::rpc::telemetry::EulerAngle* mutable_attitude_euler_angle();
+  void set_allocated_attitude_euler_angle(::mavsdk::rpc::telemetry::EulerAngle* attitude_euler_angle);
+  private:
+  const ::mavsdk::rpc::telemetry::EulerAngle& _internal_attitude_euler_angle() const;
+  ::mavsdk::rpc::telemetry::EulerAngle* _internal_mutable_attitude_euler_angle();
+  public:
+
+  // .mavsdk.rpc.telemetry.SpeedNed ground_speed_ned = 10;
+  bool has_ground_speed_ned() const;
+  private:
+  bool _internal_has_ground_speed_ned() const;
+  public:
+  void clear_ground_speed_ned();
+  const ::mavsdk::rpc::telemetry::SpeedNed& ground_speed_ned() const;
+  ::mavsdk::rpc::telemetry::SpeedNed* release_ground_speed_ned();
+  ::mavsdk::rpc::telemetry::SpeedNed* mutable_ground_speed_ned();
+  void set_allocated_ground_speed_ned(::mavsdk::rpc::telemetry::SpeedNed* ground_speed_ned);
+  private:
+  const ::mavsdk::rpc::telemetry::SpeedNed& _internal_ground_speed_ned() const;
+  ::mavsdk::rpc::telemetry::SpeedNed* _internal_mutable_ground_speed_ned();
+  public:
+
+  // .mavsdk.rpc.telemetry.GpsInfo gps_info = 11;
+  bool has_gps_info() const;
+  private:
+  bool _internal_has_gps_info() const;
+  public:
+  void clear_gps_info();
+  const ::mavsdk::rpc::telemetry::GpsInfo& gps_info() const;
+  ::mavsdk::rpc::telemetry::GpsInfo* release_gps_info();
+  ::mavsdk::rpc::telemetry::GpsInfo* mutable_gps_info();
+  void set_allocated_gps_info(::mavsdk::rpc::telemetry::GpsInfo* gps_info);
+  private:
+  const ::mavsdk::rpc::telemetry::GpsInfo& _internal_gps_info() const;
+  ::mavsdk::rpc::telemetry::GpsInfo* _internal_mutable_gps_info();
+  public:
+
+  // .mavsdk.rpc.telemetry.Battery battery = 12;
+  bool has_battery() const;
+  private:
+  bool _internal_has_battery() const;
+  public:
+  void clear_battery();
+  const ::mavsdk::rpc::telemetry::Battery& battery() const;
+  ::mavsdk::rpc::telemetry::Battery* release_battery();
+  ::mavsdk::rpc::telemetry::Battery* mutable_battery();
+  void set_allocated_battery(::mavsdk::rpc::telemetry::Battery* battery);
+  private:
+  const ::mavsdk::rpc::telemetry::Battery& _internal_battery() const;
+  ::mavsdk::rpc::telemetry::Battery* _internal_mutable_battery();
+  public:
+
+  // .mavsdk.rpc.telemetry.Health health = 13;
+  bool has_health() const;
+  private:
+  bool _internal_has_health() const;
+  public:
+  void clear_health();
+  const ::mavsdk::rpc::telemetry::Health& health() const;
+  ::mavsdk::rpc::telemetry::Health* release_health();
+  ::mavsdk::rpc::telemetry::Health* mutable_health();
+  void set_allocated_health(::mavsdk::rpc::telemetry::Health* health);
+  private:
+  const ::mavsdk::rpc::telemetry::Health& _internal_health() const;
+  ::mavsdk::rpc::telemetry::Health* _internal_mutable_health();
+  public:
+
+  // .mavsdk.rpc.telemetry.RcStatus rc_status = 14;
+  bool has_rc_status() const;
+  private:
+  bool _internal_has_rc_status() const;
+  public:
+  void clear_rc_status();
+  const ::mavsdk::rpc::telemetry::RcStatus& rc_status() const;
+  ::mavsdk::rpc::telemetry::RcStatus* release_rc_status();
+  ::mavsdk::rpc::telemetry::RcStatus* mutable_rc_status();
+  void set_allocated_rc_status(::mavsdk::rpc::telemetry::RcStatus* rc_status);
+  private:
+  const ::mavsdk::rpc::telemetry::RcStatus& _internal_rc_status() const;
+  ::mavsdk::rpc::telemetry::RcStatus* _internal_mutable_rc_status();
+  public:
+
+  // .mavsdk.rpc.telemetry.StatusText status_text = 15;
+  bool has_status_text() const;
+  private:
+  bool _internal_has_status_text() const;
+  public:
+  void clear_status_text();
+  const ::mavsdk::rpc::telemetry::StatusText& status_text() const;
+  ::mavsdk::rpc::telemetry::StatusText* release_status_text();
+  ::mavsdk::rpc::telemetry::StatusText* mutable_status_text();
+  void set_allocated_status_text(::mavsdk::rpc::telemetry::StatusText* status_text);
+  private:
+  const ::mavsdk::rpc::telemetry::StatusText& _internal_status_text() const;
+  ::mavsdk::rpc::telemetry::StatusText* _internal_mutable_status_text();
+  public:
+
+  // uint64 timestamp_us = 1;
+  void clear_timestamp_us();
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_us() const;
+  void set_timestamp_us(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_timestamp_us() const;
+  void _internal_set_timestamp_us(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint32 fields = 2;
+  void clear_fields();
+  ::PROTOBUF_NAMESPACE_ID::uint32 fields() const;
+  void set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_fields() const;
+  void _internal_set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  public:
+
+  // bool in_air = 5;
+  void clear_in_air();
+  bool in_air() const;
+  void set_in_air(bool value);
+  private:
+  bool _internal_in_air() const;
+  void _internal_set_in_air(bool value);
+  public:
+
+  // bool armed = 6;
+  void clear_armed();
+  bool armed() const;
+  void set_armed(bool value);
+  private:
+  bool _internal_armed() const;
+  void _internal_set_armed(bool value);
+  public:
+
+  // .mavsdk.rpc.telemetry.LandedState landed_state = 7;
+  void clear_landed_state();
+  ::mavsdk::rpc::telemetry::LandedState landed_state() const;
+  void set_landed_state(::mavsdk::rpc::telemetry::LandedState value);
+  private:
+  ::mavsdk::rpc::telemetry::LandedState _internal_landed_state() const;
+  void _internal_set_landed_state(::mavsdk::rpc::telemetry::LandedState value);
+  public:
+
+  // .mavsdk.rpc.telemetry.FlightMode flight_mode = 8;
+  void clear_flight_mode();
+  ::mavsdk::rpc::telemetry::FlightMode flight_mode() const;
+  void set_flight_mode(::mavsdk::rpc::telemetry::FlightMode value);
+  private:
+  ::mavsdk::rpc::telemetry::FlightMode _internal_flight_mode() const;
+  void _internal_set_flight_mode(::mavsdk::rpc::telemetry::FlightMode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:mavsdk.rpc.telemetry.TelemetrySnapshot)
+ private:
+  class _Internal;
+
+  ::PROTOBUF_NAMESPACE_ID::internal::InternalMetadataWithArena _internal_metadata_;
+  ::mavsdk::rpc::telemetry::Position* position_;
+  ::mavsdk::rpc::telemetry::Position* home_position_;
+  ::mavsdk::rpc::telemetry::EulerAngle* attitude_euler_angle_;
+  ::mavsdk::rpc::telemetry::SpeedNed* ground_speed_ned_;
+  ::mavsdk::rpc::telemetry::GpsInfo* gps_info_;
+  ::mavsdk::rpc::telemetry::Battery* battery_;
+  ::mavsdk::rpc::telemetry::Health* health_;
+  ::mavsdk::rpc::telemetry::RcStatus* rc_status_;
+  ::mavsdk::rpc::telemetry::StatusText* status_text_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 timestamp_us_;
+  ::PROTOBUF_NAMESPACE_ID::uint32 fields_;
+  bool in_air_;
+  bool armed_;
+  int landed_state_;
+  int flight_mode_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_telemetry_2ftelemetry_2eproto;
+};
+// ===================================================================
+
+
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SubscribePositionRequest
+
+// -------------------------------------------------------------------
+
+// PositionResponse
+
+// .mavsdk.rpc.telemetry.Position position = 1;
+inline bool PositionResponse::_internal_has_position() const {
+  return this != internal_default_instance() && position_ != nullptr;
+}
+inline bool PositionResponse::has_position() const {
+  return _internal_has_position();
+}
+inline void PositionResponse::clear_position() {
+  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
+    delete position_;
+  }
+  position_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::Position& PositionResponse::_internal_position() const {
+  const ::mavsdk::rpc::telemetry::Position* p = position_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Position*>(
+      &::mavsdk::rpc::telemetry::_Position_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::Position& PositionResponse::position() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.PositionResponse.position)
+  return _internal_position();
+}
+inline ::mavsdk::rpc::telemetry::Position* PositionResponse::release_position() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.PositionResponse.position)
+  
+  ::mavsdk::rpc::telemetry::Position* temp = position_;
+  position_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::Position* PositionResponse::_internal_mutable_position() {
+  
+  if (position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Position>(GetArenaNoVirtual());
+    position_ = p;
+  }
+  return position_;
+}
+inline ::mavsdk::rpc::telemetry::Position* PositionResponse::mutable_position() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.PositionResponse.position)
+  return _internal_mutable_position();
+}
+inline void PositionResponse::set_allocated_position(::mavsdk::rpc::telemetry::Position* position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete position_;
+  }
+  if (position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  position_ = position;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.PositionResponse.position)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeHomeRequest
+
+// -------------------------------------------------------------------
+
+// HomeResponse
+
+// .mavsdk.rpc.telemetry.Position home = 1;
+inline bool HomeResponse::_internal_has_home() const {
+  return this != internal_default_instance() && home_ != nullptr;
+}
+inline bool HomeResponse::has_home() const {
+  return _internal_has_home();
+}
+inline void HomeResponse::clear_home() {
+  if (GetArenaNoVirtual() == nullptr && home_ != nullptr) {
+    delete home_;
+  }
+  home_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::Position& HomeResponse::_internal_home() const {
+  const ::mavsdk::rpc::telemetry::Position* p = home_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Position*>(
+      &::mavsdk::rpc::telemetry::_Position_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::Position& HomeResponse::home() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.HomeResponse.home)
+  return _internal_home();
+}
+inline ::mavsdk::rpc::telemetry::Position* HomeResponse::release_home() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.HomeResponse.home)
+  
+  ::mavsdk::rpc::telemetry::Position* temp = home_;
+  home_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::Position* HomeResponse::_internal_mutable_home() {
+  
+  if (home_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Position>(GetArenaNoVirtual());
+    home_ = p;
+  }
+  return home_;
+}
+inline ::mavsdk::rpc::telemetry::Position* HomeResponse::mutable_home() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.HomeResponse.home)
+  return _internal_mutable_home();
+}
+inline void HomeResponse::set_allocated_home(::mavsdk::rpc::telemetry::Position* home) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete home_;
+  }
+  if (home) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      home = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, home, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  home_ = home;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.HomeResponse.home)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeInAirRequest
+
+// -------------------------------------------------------------------
+
+// InAirResponse
+
+// bool is_in_air = 1;
+inline void InAirResponse::clear_is_in_air() {
+  is_in_air_ = false;
+}
+inline bool InAirResponse::_internal_is_in_air() const {
+  return is_in_air_;
+}
+inline bool InAirResponse::is_in_air() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.InAirResponse.is_in_air)
+  return _internal_is_in_air();
+}
+inline void InAirResponse::_internal_set_is_in_air(bool value) {
+  
+  is_in_air_ = value;
+}
+inline void InAirResponse::set_is_in_air(bool value) {
+  _internal_set_is_in_air(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.InAirResponse.is_in_air)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeLandedStateRequest
+
+// -------------------------------------------------------------------
+
+// LandedStateResponse
+
+// .mavsdk.rpc.telemetry.LandedState landed_state = 1;
+inline void LandedStateResponse::clear_landed_state() {
+  landed_state_ = 0;
+}
+inline ::mavsdk::rpc::telemetry::LandedState LandedStateResponse::_internal_landed_state() const {
+  return static_cast< ::mavsdk::rpc::telemetry::LandedState >(landed_state_);
+}
+inline ::mavsdk::rpc::telemetry::LandedState LandedStateResponse::landed_state() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.LandedStateResponse.landed_state)
+  return _internal_landed_state();
+}
+inline void LandedStateResponse::_internal_set_landed_state(::mavsdk::rpc::telemetry::LandedState value) {
+  
+  landed_state_ = value;
+}
+inline void LandedStateResponse::set_landed_state(::mavsdk::rpc::telemetry::LandedState value) {
+  _internal_set_landed_state(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.LandedStateResponse.landed_state)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeArmedRequest
+
+// -------------------------------------------------------------------
+
+// ArmedResponse
+
+// bool is_armed = 1;
+inline void ArmedResponse::clear_is_armed() {
+  is_armed_ = false;
+}
+inline bool ArmedResponse::_internal_is_armed() const {
+  return is_armed_;
+}
+inline bool ArmedResponse::is_armed() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ArmedResponse.is_armed)
+  return _internal_is_armed();
+}
+inline void ArmedResponse::_internal_set_is_armed(bool value) {
+  
+  is_armed_ = value;
+}
+inline void ArmedResponse::set_is_armed(bool value) {
+  _internal_set_is_armed(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ArmedResponse.is_armed)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeAttitudeQuaternionRequest
+
+// -------------------------------------------------------------------
+
+// AttitudeQuaternionResponse
+
+// .mavsdk.rpc.telemetry.Quaternion attitude_quaternion = 1;
+inline bool AttitudeQuaternionResponse::_internal_has_attitude_quaternion() const {
+  return this != internal_default_instance() && attitude_quaternion_ != nullptr;
+}
+inline bool AttitudeQuaternionResponse::has_attitude_quaternion() const {
+  return _internal_has_attitude_quaternion();
+}
+inline void AttitudeQuaternionResponse::clear_attitude_quaternion() {
+  if (GetArenaNoVirtual() == nullptr && attitude_quaternion_ != nullptr) {
+    delete attitude_quaternion_;
+  }
+  attitude_quaternion_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::Quaternion& AttitudeQuaternionResponse::_internal_attitude_quaternion() const {
+  const ::mavsdk::rpc::telemetry::Quaternion* p = attitude_quaternion_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Quaternion*>(
+      &::mavsdk::rpc::telemetry::_Quaternion_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::Quaternion& AttitudeQuaternionResponse::attitude_quaternion() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AttitudeQuaternionResponse.attitude_quaternion)
+  return _internal_attitude_quaternion();
+}
+inline ::mavsdk::rpc::telemetry::Quaternion* AttitudeQuaternionResponse::release_attitude_quaternion() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.AttitudeQuaternionResponse.attitude_quaternion)
+  
+  ::mavsdk::rpc::telemetry::Quaternion* temp = attitude_quaternion_;
+  attitude_quaternion_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::Quaternion* AttitudeQuaternionResponse::_internal_mutable_attitude_quaternion() {
+  
+  if (attitude_quaternion_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Quaternion>(GetArenaNoVirtual());
+    attitude_quaternion_ = p;
+  }
+  return attitude_quaternion_;
+}
+inline ::mavsdk::rpc::telemetry::Quaternion* AttitudeQuaternionResponse::mutable_attitude_quaternion() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.AttitudeQuaternionResponse.attitude_quaternion)
+  return _internal_mutable_attitude_quaternion();
+}
+inline void AttitudeQuaternionResponse::set_allocated_attitude_quaternion(::mavsdk::rpc::telemetry::Quaternion* attitude_quaternion) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete attitude_quaternion_;
+  }
+  if (attitude_quaternion) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      attitude_quaternion = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, attitude_quaternion, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  attitude_quaternion_ = attitude_quaternion;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.AttitudeQuaternionResponse.attitude_quaternion)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeAttitudeEulerRequest
+
+// -------------------------------------------------------------------
+
+// AttitudeEulerResponse
+
+// .mavsdk.rpc.telemetry.EulerAngle attitude_euler = 1;
+inline bool AttitudeEulerResponse::_internal_has_attitude_euler() const {
+  return this != internal_default_instance() && attitude_euler_ != nullptr;
+}
+inline bool AttitudeEulerResponse::has_attitude_euler() const {
+  return _internal_has_attitude_euler();
+}
+inline void AttitudeEulerResponse::clear_attitude_euler() {
+  if (GetArenaNoVirtual() == nullptr && attitude_euler_ != nullptr) {
+    delete attitude_euler_;
+  }
+  attitude_euler_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::EulerAngle& AttitudeEulerResponse::_internal_attitude_euler() const {
+  const ::mavsdk::rpc::telemetry::EulerAngle* p = attitude_euler_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::EulerAngle*>(
+      &::mavsdk::rpc::telemetry::_EulerAngle_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::EulerAngle& AttitudeEulerResponse::attitude_euler() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AttitudeEulerResponse.attitude_euler)
+  return _internal_attitude_euler();
+}
+inline ::mavsdk::rpc::telemetry::EulerAngle* AttitudeEulerResponse::release_attitude_euler() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.AttitudeEulerResponse.attitude_euler)
+  
+  ::mavsdk::rpc::telemetry::EulerAngle* temp = attitude_euler_;
+  attitude_euler_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::EulerAngle* AttitudeEulerResponse::_internal_mutable_attitude_euler() {
+  
+  if (attitude_euler_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::EulerAngle>(GetArenaNoVirtual());
+    attitude_euler_ = p;
+  }
+  return attitude_euler_;
+}
+inline ::mavsdk::rpc::telemetry::EulerAngle* AttitudeEulerResponse::mutable_attitude_euler() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.AttitudeEulerResponse.attitude_euler)
+  return _internal_mutable_attitude_euler();
+}
+inline void AttitudeEulerResponse::set_allocated_attitude_euler(::mavsdk::rpc::telemetry::EulerAngle* attitude_euler) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete attitude_euler_;
+  }
+  if (attitude_euler) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      attitude_euler = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, attitude_euler, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  attitude_euler_ = attitude_euler;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.AttitudeEulerResponse.attitude_euler)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeAttitudeAngularVelocityBodyRequest
+
+// -------------------------------------------------------------------
+
+// AttitudeAngularVelocityBodyResponse
+
+// .mavsdk.rpc.telemetry.AngularVelocityBody attitude_angular_velocity_body = 1;
+inline bool AttitudeAngularVelocityBodyResponse::_internal_has_attitude_angular_velocity_body() const {
+  return this != internal_default_instance() && attitude_angular_velocity_body_ != nullptr;
+}
+inline bool AttitudeAngularVelocityBodyResponse::has_attitude_angular_velocity_body() const {
+  return _internal_has_attitude_angular_velocity_body();
+}
+inline void AttitudeAngularVelocityBodyResponse::clear_attitude_angular_velocity_body() {
+  if (GetArenaNoVirtual() == nullptr && attitude_angular_velocity_body_ != nullptr) {
+    delete attitude_angular_velocity_body_;
+  }
+  attitude_angular_velocity_body_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::AngularVelocityBody& AttitudeAngularVelocityBodyResponse::_internal_attitude_angular_velocity_body() const {
+  const ::mavsdk::rpc::telemetry::AngularVelocityBody* p = attitude_angular_velocity_body_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::AngularVelocityBody*>(
+      &::mavsdk::rpc::telemetry::_AngularVelocityBody_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::AngularVelocityBody& AttitudeAngularVelocityBodyResponse::attitude_angular_velocity_body() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AttitudeAngularVelocityBodyResponse.attitude_angular_velocity_body)
+  return _internal_attitude_angular_velocity_body();
+}
+inline ::mavsdk::rpc::telemetry::AngularVelocityBody* AttitudeAngularVelocityBodyResponse::release_attitude_angular_velocity_body() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.AttitudeAngularVelocityBodyResponse.attitude_angular_velocity_body)
+  
+  ::mavsdk::rpc::telemetry::AngularVelocityBody* temp = attitude_angular_velocity_body_;
+  attitude_angular_velocity_body_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::AngularVelocityBody* AttitudeAngularVelocityBodyResponse::_internal_mutable_attitude_angular_velocity_body() {
+  
+  if (attitude_angular_velocity_body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::AngularVelocityBody>(GetArenaNoVirtual());
+    attitude_angular_velocity_body_ = p;
+  }
+  return attitude_angular_velocity_body_;
+}
+inline ::mavsdk::rpc::telemetry::AngularVelocityBody* AttitudeAngularVelocityBodyResponse::mutable_attitude_angular_velocity_body() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.AttitudeAngularVelocityBodyResponse.attitude_angular_velocity_body)
+  return _internal_mutable_attitude_angular_velocity_body();
+}
+inline void AttitudeAngularVelocityBodyResponse::set_allocated_attitude_angular_velocity_body(::mavsdk::rpc::telemetry::AngularVelocityBody* attitude_angular_velocity_body) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete attitude_angular_velocity_body_;
+  }
+  if (attitude_angular_velocity_body) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      attitude_angular_velocity_body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, attitude_angular_velocity_body, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  attitude_angular_velocity_body_ = attitude_angular_velocity_body;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.AttitudeAngularVelocityBodyResponse.attitude_angular_velocity_body)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeCameraAttitudeQuaternionRequest
+
+// -------------------------------------------------------------------
+
+// CameraAttitudeQuaternionResponse
+
+// .mavsdk.rpc.telemetry.Quaternion attitude_quaternion = 1;
+inline bool CameraAttitudeQuaternionResponse::_internal_has_attitude_quaternion() const {
+  return this != internal_default_instance() && attitude_quaternion_ != nullptr;
+}
+inline bool CameraAttitudeQuaternionResponse::has_attitude_quaternion() const {
+  return _internal_has_attitude_quaternion();
+}
+inline void CameraAttitudeQuaternionResponse::clear_attitude_quaternion() {
+  if (GetArenaNoVirtual() == nullptr && attitude_quaternion_ != nullptr) {
+    delete attitude_quaternion_;
+  }
+  attitude_quaternion_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::Quaternion& CameraAttitudeQuaternionResponse::_internal_attitude_quaternion() const {
+  const ::mavsdk::rpc::telemetry::Quaternion* p = attitude_quaternion_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Quaternion*>(
+      &::mavsdk::rpc::telemetry::_Quaternion_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::Quaternion& CameraAttitudeQuaternionResponse::attitude_quaternion() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.CameraAttitudeQuaternionResponse.attitude_quaternion)
+  return _internal_attitude_quaternion();
+}
+inline ::mavsdk::rpc::telemetry::Quaternion* CameraAttitudeQuaternionResponse::release_attitude_quaternion() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.CameraAttitudeQuaternionResponse.attitude_quaternion)
+  
+  ::mavsdk::rpc::telemetry::Quaternion* temp = attitude_quaternion_;
+  attitude_quaternion_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::Quaternion* CameraAttitudeQuaternionResponse::_internal_mutable_attitude_quaternion() {
+  
+  if (attitude_quaternion_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Quaternion>(GetArenaNoVirtual());
+    attitude_quaternion_ = p;
+  }
+  return attitude_quaternion_;
+}
+inline ::mavsdk::rpc::telemetry::Quaternion* CameraAttitudeQuaternionResponse::mutable_attitude_quaternion() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.CameraAttitudeQuaternionResponse.attitude_quaternion)
+  return _internal_mutable_attitude_quaternion();
+}
+inline void CameraAttitudeQuaternionResponse::set_allocated_attitude_quaternion(::mavsdk::rpc::telemetry::Quaternion* attitude_quaternion) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete attitude_quaternion_;
+  }
+  if (attitude_quaternion) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      attitude_quaternion = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, attitude_quaternion, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  attitude_quaternion_ = attitude_quaternion;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.CameraAttitudeQuaternionResponse.attitude_quaternion)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeCameraAttitudeEulerRequest
+
+// -------------------------------------------------------------------
+
+// CameraAttitudeEulerResponse
+
+// .mavsdk.rpc.telemetry.EulerAngle attitude_euler = 1;
+inline bool CameraAttitudeEulerResponse::_internal_has_attitude_euler() const {
+  return this != internal_default_instance() && attitude_euler_ != nullptr;
+}
+inline bool CameraAttitudeEulerResponse::has_attitude_euler() const {
+  return _internal_has_attitude_euler();
+}
+inline void CameraAttitudeEulerResponse::clear_attitude_euler() {
+  if (GetArenaNoVirtual() == nullptr && attitude_euler_ != nullptr) {
+    delete attitude_euler_;
+  }
+  attitude_euler_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::EulerAngle& CameraAttitudeEulerResponse::_internal_attitude_euler() const {
+  const ::mavsdk::rpc::telemetry::EulerAngle* p = attitude_euler_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::EulerAngle*>(
+      &::mavsdk::rpc::telemetry::_EulerAngle_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::EulerAngle& CameraAttitudeEulerResponse::attitude_euler() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.CameraAttitudeEulerResponse.attitude_euler)
+  return _internal_attitude_euler();
+}
+inline ::mavsdk::rpc::telemetry::EulerAngle* CameraAttitudeEulerResponse::release_attitude_euler() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.CameraAttitudeEulerResponse.attitude_euler)
+  
+  ::mavsdk::rpc::telemetry::EulerAngle* temp = attitude_euler_;
+  attitude_euler_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::EulerAngle* CameraAttitudeEulerResponse::_internal_mutable_attitude_euler() {
+  
+  if (attitude_euler_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::EulerAngle>(GetArenaNoVirtual());
+    attitude_euler_ = p;
+  }
+  return attitude_euler_;
+}
+inline ::mavsdk::rpc::telemetry::EulerAngle* CameraAttitudeEulerResponse::mutable_attitude_euler() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.CameraAttitudeEulerResponse.attitude_euler)
+  return _internal_mutable_attitude_euler();
+}
+inline void CameraAttitudeEulerResponse::set_allocated_attitude_euler(::mavsdk::rpc::telemetry::EulerAngle* attitude_euler) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete attitude_euler_;
+  }
+  if (attitude_euler) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      attitude_euler = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, attitude_euler, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  attitude_euler_ = attitude_euler;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.CameraAttitudeEulerResponse.attitude_euler)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeGroundSpeedNedRequest
+
+// -------------------------------------------------------------------
+
+// GroundSpeedNedResponse
+
+// .mavsdk.rpc.telemetry.SpeedNed ground_speed_ned = 1;
+inline bool GroundSpeedNedResponse::_internal_has_ground_speed_ned() const {
+  return this != internal_default_instance() && ground_speed_ned_ != nullptr;
+}
+inline bool GroundSpeedNedResponse::has_ground_speed_ned() const {
+  return _internal_has_ground_speed_ned();
+}
+inline void GroundSpeedNedResponse::clear_ground_speed_ned() {
+  if (GetArenaNoVirtual() == nullptr && ground_speed_ned_ != nullptr) {
+    delete ground_speed_ned_;
+  }
+  ground_speed_ned_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::SpeedNed& GroundSpeedNedResponse::_internal_ground_speed_ned() const {
+  const ::mavsdk::rpc::telemetry::SpeedNed* p = ground_speed_ned_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::SpeedNed*>(
+      &::mavsdk::rpc::telemetry::_SpeedNed_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::SpeedNed& GroundSpeedNedResponse::ground_speed_ned() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GroundSpeedNedResponse.ground_speed_ned)
+  return _internal_ground_speed_ned();
+}
+inline ::mavsdk::rpc::telemetry::SpeedNed* GroundSpeedNedResponse::release_ground_speed_ned() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.GroundSpeedNedResponse.ground_speed_ned)
+  
+  ::mavsdk::rpc::telemetry::SpeedNed* temp = ground_speed_ned_;
+  ground_speed_ned_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::SpeedNed* GroundSpeedNedResponse::_internal_mutable_ground_speed_ned() {
+  
+  if (ground_speed_ned_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::SpeedNed>(GetArenaNoVirtual());
+    ground_speed_ned_ = p;
+  }
+  return ground_speed_ned_;
+}
+inline ::mavsdk::rpc::telemetry::SpeedNed* GroundSpeedNedResponse::mutable_ground_speed_ned() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.GroundSpeedNedResponse.ground_speed_ned)
+  return _internal_mutable_ground_speed_ned();
+}
+inline void GroundSpeedNedResponse::set_allocated_ground_speed_ned(::mavsdk::rpc::telemetry::SpeedNed* ground_speed_ned) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete ground_speed_ned_;
+  }
+  if (ground_speed_ned) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      ground_speed_ned = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ground_speed_ned, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  ground_speed_ned_ = ground_speed_ned;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.GroundSpeedNedResponse.ground_speed_ned)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeGpsInfoRequest
+
+// -------------------------------------------------------------------
+
+// GpsInfoResponse
+
+// .mavsdk.rpc.telemetry.GpsInfo gps_info = 1;
+inline bool GpsInfoResponse::_internal_has_gps_info() const {
+  return this != internal_default_instance() && gps_info_ != nullptr;
+}
+inline bool GpsInfoResponse::has_gps_info() const {
+  return _internal_has_gps_info();
+}
+inline void GpsInfoResponse::clear_gps_info() {
+  if (GetArenaNoVirtual() == nullptr && gps_info_ != nullptr) {
+    delete gps_info_;
+  }
+  gps_info_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::GpsInfo& GpsInfoResponse::_internal_gps_info() const {
+  const ::mavsdk::rpc::telemetry::GpsInfo* p = gps_info_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::GpsInfo*>(
+      &::mavsdk::rpc::telemetry::_GpsInfo_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::GpsInfo& GpsInfoResponse::gps_info() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GpsInfoResponse.gps_info)
+  return _internal_gps_info();
+}
+inline ::mavsdk::rpc::telemetry::GpsInfo* GpsInfoResponse::release_gps_info() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.GpsInfoResponse.gps_info)
+  
+  ::mavsdk::rpc::telemetry::GpsInfo* temp = gps_info_;
+  gps_info_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::GpsInfo* GpsInfoResponse::_internal_mutable_gps_info() {
+  
+  if (gps_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::GpsInfo>(GetArenaNoVirtual());
+    gps_info_ = p;
+  }
+  return gps_info_;
+}
+inline ::mavsdk::rpc::telemetry::GpsInfo* GpsInfoResponse::mutable_gps_info() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.GpsInfoResponse.gps_info)
+  return _internal_mutable_gps_info();
+}
+inline void GpsInfoResponse::set_allocated_gps_info(::mavsdk::rpc::telemetry::GpsInfo* gps_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete gps_info_;
+  }
+  if (gps_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      gps_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gps_info, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  gps_info_ = gps_info;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.GpsInfoResponse.gps_info)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeBatteryRequest
+
+// -------------------------------------------------------------------
+
+// BatteryResponse
+
+// .mavsdk.rpc.telemetry.Battery battery = 1;
+inline bool BatteryResponse::_internal_has_battery() const {
+  return this != internal_default_instance() && battery_ != nullptr;
+}
+inline bool BatteryResponse::has_battery() const {
+  return _internal_has_battery();
+}
+inline void BatteryResponse::clear_battery() {
+  if (GetArenaNoVirtual() == nullptr && battery_ != nullptr) {
+    delete battery_;
+  }
+  battery_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::Battery& BatteryResponse::_internal_battery() const {
+  const ::mavsdk::rpc::telemetry::Battery* p = battery_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Battery*>(
+      &::mavsdk::rpc::telemetry::_Battery_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::Battery& BatteryResponse::battery() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.BatteryResponse.battery)
+  return _internal_battery();
+}
+inline ::mavsdk::rpc::telemetry::Battery* BatteryResponse::release_battery() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.BatteryResponse.battery)
+  
+  ::mavsdk::rpc::telemetry::Battery* temp = battery_;
+  battery_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::Battery* BatteryResponse::_internal_mutable_battery() {
+  
+  if (battery_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Battery>(GetArenaNoVirtual());
+    battery_ = p;
+  }
+  return battery_;
+}
+inline ::mavsdk::rpc::telemetry::Battery* BatteryResponse::mutable_battery() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.BatteryResponse.battery)
+  return _internal_mutable_battery();
+}
+inline void BatteryResponse::set_allocated_battery(::mavsdk::rpc::telemetry::Battery* battery) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete battery_;
+  }
+  if (battery) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      battery = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, battery, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  battery_ = battery;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.BatteryResponse.battery)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeFlightModeRequest
+
+// -------------------------------------------------------------------
+
+// FlightModeResponse
+
+// .mavsdk.rpc.telemetry.FlightMode flight_mode = 1;
+inline void FlightModeResponse::clear_flight_mode() {
+  flight_mode_ = 0;
+}
+inline ::mavsdk::rpc::telemetry::FlightMode FlightModeResponse::_internal_flight_mode() const {
+  return static_cast< ::mavsdk::rpc::telemetry::FlightMode >(flight_mode_);
+}
+inline ::mavsdk::rpc::telemetry::FlightMode FlightModeResponse::flight_mode() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.FlightModeResponse.flight_mode)
+  return _internal_flight_mode();
+}
+inline void FlightModeResponse::_internal_set_flight_mode(::mavsdk::rpc::telemetry::FlightMode value) {
+  
+  flight_mode_ = value;
+}
+inline void FlightModeResponse::set_flight_mode(::mavsdk::rpc::telemetry::FlightMode value) {
+  _internal_set_flight_mode(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.FlightModeResponse.flight_mode)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeHealthRequest
+
+// -------------------------------------------------------------------
+
+// HealthResponse
+
+// .mavsdk.rpc.telemetry.Health health = 1;
+inline bool HealthResponse::_internal_has_health() const {
+  return this != internal_default_instance() && health_ != nullptr;
+}
+inline bool HealthResponse::has_health() const {
+  return _internal_has_health();
+}
+inline void HealthResponse::clear_health() {
+  if (GetArenaNoVirtual() == nullptr && health_ != nullptr) {
+    delete health_;
+  }
+  health_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::Health& HealthResponse::_internal_health() const {
+  const ::mavsdk::rpc::telemetry::Health* p = health_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Health*>(
+      &::mavsdk::rpc::telemetry::_Health_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::Health& HealthResponse::health() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.HealthResponse.health)
+  return _internal_health();
+}
+inline ::mavsdk::rpc::telemetry::Health* HealthResponse::release_health() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.HealthResponse.health)
+  
+  ::mavsdk::rpc::telemetry::Health* temp = health_;
+  health_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::Health* HealthResponse::_internal_mutable_health() {
+  
+  if (health_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Health>(GetArenaNoVirtual());
+    health_ = p;
+  }
+  return health_;
+}
+inline ::mavsdk::rpc::telemetry::Health* HealthResponse::mutable_health() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.HealthResponse.health)
+  return _internal_mutable_health();
+}
+inline void HealthResponse::set_allocated_health(::mavsdk::rpc::telemetry::Health* health) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete health_;
+  }
+  if (health) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      health = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, health, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  health_ = health;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.HealthResponse.health)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeRcStatusRequest
+
+// -------------------------------------------------------------------
+
+// RcStatusResponse
+
+// .mavsdk.rpc.telemetry.RcStatus rc_status = 1;
+inline bool RcStatusResponse::_internal_has_rc_status() const {
+  return this != internal_default_instance() && rc_status_ != nullptr;
+}
+inline bool RcStatusResponse::has_rc_status() const {
+  return _internal_has_rc_status();
+}
+inline void RcStatusResponse::clear_rc_status() {
+  if (GetArenaNoVirtual() == nullptr && rc_status_ != nullptr) {
+    delete rc_status_;
+  }
+  rc_status_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::RcStatus& RcStatusResponse::_internal_rc_status() const {
+  const ::mavsdk::rpc::telemetry::RcStatus* p = rc_status_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::RcStatus*>(
+      &::mavsdk::rpc::telemetry::_RcStatus_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::RcStatus& RcStatusResponse::rc_status() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.RcStatusResponse.rc_status)
+  return _internal_rc_status();
+}
+inline ::mavsdk::rpc::telemetry::RcStatus* RcStatusResponse::release_rc_status() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.RcStatusResponse.rc_status)
+  
+  ::mavsdk::rpc::telemetry::RcStatus* temp = rc_status_;
+  rc_status_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::RcStatus* RcStatusResponse::_internal_mutable_rc_status() {
+  
+  if (rc_status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::RcStatus>(GetArenaNoVirtual());
+    rc_status_ = p;
+  }
+  return rc_status_;
+}
+inline ::mavsdk::rpc::telemetry::RcStatus* RcStatusResponse::mutable_rc_status() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.RcStatusResponse.rc_status)
+  return _internal_mutable_rc_status();
+}
+inline void RcStatusResponse::set_allocated_rc_status(::mavsdk::rpc::telemetry::RcStatus* rc_status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete rc_status_;
+  }
+  if (rc_status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      rc_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rc_status, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  rc_status_ = rc_status;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.RcStatusResponse.rc_status)
+}
+
+// -------------------------------------------------------------------
 
-// ===================================================================
+// SubscribeStatusTextRequest
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// SubscribePositionRequest
+// -------------------------------------------------------------------
+
+// StatusTextResponse
+
+// .mavsdk.rpc.telemetry.StatusText status_text = 1;
+inline bool StatusTextResponse::_internal_has_status_text() const {
+  return this != internal_default_instance() && status_text_ != nullptr;
+}
+inline bool StatusTextResponse::has_status_text() const {
+  return _internal_has_status_text();
+}
+inline void StatusTextResponse::clear_status_text() {
+  if (GetArenaNoVirtual() == nullptr && status_text_ != nullptr) {
+    delete status_text_;
+  }
+  status_text_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::StatusText& StatusTextResponse::_internal_status_text() const {
+  const ::mavsdk::rpc::telemetry::StatusText* p = status_text_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::StatusText*>(
+      &::mavsdk::rpc::telemetry::_StatusText_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::StatusText& StatusTextResponse::status_text() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.StatusTextResponse.status_text)
+  return _internal_status_text();
+}
+inline ::mavsdk::rpc::telemetry::StatusText* StatusTextResponse::release_status_text() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.StatusTextResponse.status_text)
+  
+  ::mavsdk::rpc::telemetry::StatusText* temp = status_text_;
+  status_text_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::StatusText* StatusTextResponse::_internal_mutable_status_text() {
+  
+  if (status_text_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::StatusText>(GetArenaNoVirtual());
+    status_text_ = p;
+  }
+  return status_text_;
+}
+inline ::mavsdk::rpc::telemetry::StatusText* StatusTextResponse::mutable_status_text() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.StatusTextResponse.status_text)
+  return _internal_mutable_status_text();
+}
+inline void StatusTextResponse::set_allocated_status_text(::mavsdk::rpc::telemetry::StatusText* status_text) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete status_text_;
+  }
+  if (status_text) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      status_text = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status_text, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  status_text_ = status_text;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.StatusTextResponse.status_text)
+}
 
 // -------------------------------------------------------------------
 
-// PositionResponse
+// SubscribeActuatorControlTargetRequest
 
-// .mavsdk.rpc.telemetry.Position position = 1;
-inline bool PositionResponse::_internal_has_position() const {
-  return this != internal_default_instance() && position_ != nullptr;
+// -------------------------------------------------------------------
+
+// ActuatorControlTargetResponse
+
+// .mavsdk.rpc.telemetry.ActuatorControlTarget actuator_control_target = 1;
+inline bool ActuatorControlTargetResponse::_internal_has_actuator_control_target() const {
+  return this != internal_default_instance() && actuator_control_target_ != nullptr;
 }
-inline bool PositionResponse::has_position() const {
-  return _internal_has_position();
+inline bool ActuatorControlTargetResponse::has_actuator_control_target() const {
+  return _internal_has_actuator_control_target();
 }
-inline void PositionResponse::clear_position() {
-  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
-    delete position_;
+inline void ActuatorControlTargetResponse::clear_actuator_control_target() {
+  if (GetArenaNoVirtual() == nullptr && actuator_control_target_ != nullptr) {
+    delete actuator_control_target_;
   }
-  position_ = nullptr;
+  actuator_control_target_ = nullptr;
 }
-inline const ::mavsdk::rpc::telemetry::Position& PositionResponse::_internal_position() const {
-  const ::mavsdk::rpc::telemetry::Position* p = position_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Position*>(
-      &::mavsdk::rpc::telemetry::_Position_default_instance_);
+inline const ::mavsdk::rpc::telemetry::ActuatorControlTarget& ActuatorControlTargetResponse::_internal_actuator_control_target() const {
+  const ::mavsdk::rpc::telemetry::ActuatorControlTarget* p = actuator_control_target_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::ActuatorControlTarget*>(
+      &::mavsdk::rpc::telemetry::_ActuatorControlTarget_default_instance_);
 }
-inline const ::mavsdk::rpc::telemetry::Position& PositionResponse::position() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.PositionResponse.position)
-  return _internal_position();
+inline const ::mavsdk::rpc::telemetry::ActuatorControlTarget& ActuatorControlTargetResponse::actuator_control_target() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorControlTargetResponse.actuator_control_target)
+  return _internal_actuator_control_target();
 }
-inline ::mavsdk::rpc::telemetry::Position* PositionResponse::release_position() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.PositionResponse.position)
+inline ::mavsdk::rpc::telemetry::ActuatorControlTarget* ActuatorControlTargetResponse::release_actuator_control_target() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.ActuatorControlTargetResponse.actuator_control_target)
   
-  ::mavsdk::rpc::telemetry::Position* temp = position_;
-  position_ = nullptr;
+  ::mavsdk::rpc::telemetry::ActuatorControlTarget* temp = actuator_control_target_;
+  actuator_control_target_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::telemetry::Position* PositionResponse::_internal_mutable_position() {
+inline ::mavsdk::rpc::telemetry::ActuatorControlTarget* ActuatorControlTargetResponse::_internal_mutable_actuator_control_target() {
   
-  if (position_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Position>(GetArenaNoVirtual());
-    position_ = p;
+  if (actuator_control_target_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::ActuatorControlTarget>(GetArenaNoVirtual());
+    actuator_control_target_ = p;
   }
-  return position_;
+  return actuator_control_target_;
 }
-inline ::mavsdk::rpc::telemetry::Position* PositionResponse::mutable_position() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.PositionResponse.position)
-  return _internal_mutable_position();
+inline ::mavsdk::rpc::telemetry::ActuatorControlTarget* ActuatorControlTargetResponse::mutable_actuator_control_target() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.ActuatorControlTargetResponse.actuator_control_target)
+  return _internal_mutable_actuator_control_target();
 }
-inline void PositionResponse::set_allocated_position(::mavsdk::rpc::telemetry::Position* position) {
+inline void ActuatorControlTargetResponse::set_allocated_actuator_control_target(::mavsdk::rpc::telemetry::ActuatorControlTarget* actuator_control_target) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete position_;
+    delete actuator_control_target_;
   }
-  if (position) {
+  if (actuator_control_target) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, position, submessage_arena);
+      actuator_control_target = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, actuator_control_target, submessage_arena);
     }
     
   } else {
     
   }
-  position_ = position;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.PositionResponse.position)
+  actuator_control_target_ = actuator_control_target;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.ActuatorControlTargetResponse.actuator_control_target)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeHomeRequest
+// SubscribeActuatorOutputStatusRequest
 
 // -------------------------------------------------------------------
 
-// HomeResponse
+// ActuatorOutputStatusResponse
 
-// .mavsdk.rpc.telemetry.Position home = 1;
-inline bool HomeResponse::_internal_has_home() const {
-  return this != internal_default_instance() && home_ != nullptr;
+// .mavsdk.rpc.telemetry.ActuatorOutputStatus actuator_output_status = 1;
+inline bool ActuatorOutputStatusResponse::_internal_has_actuator_output_status() const {
+  return this != internal_default_instance() && actuator_output_status_ != nullptr;
 }
-inline bool HomeResponse::has_home() const {
-  return _internal_has_home();
+inline bool ActuatorOutputStatusResponse::has_actuator_output_status() const {
+  return _internal_has_actuator_output_status();
 }
-inline void HomeResponse::clear_home() {
-  if (GetArenaNoVirtual() == nullptr && home_ != nullptr) {
-    delete home_;
+inline void ActuatorOutputStatusResponse::clear_actuator_output_status() {
+  if (GetArenaNoVirtual() == nullptr && actuator_output_status_ != nullptr) {
+    delete actuator_output_status_;
   }
-  home_ = nullptr;
+  actuator_output_status_ = nullptr;
 }
-inline const ::mavsdk::rpc::telemetry::Position& HomeResponse::_internal_home() const {
-  const ::mavsdk::rpc::telemetry::Position* p = home_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Position*>(
-      &::mavsdk::rpc::telemetry::_Position_default_instance_);
+inline const ::mavsdk::rpc::telemetry::ActuatorOutputStatus& ActuatorOutputStatusResponse::_internal_actuator_output_status() const {
+  const ::mavsdk::rpc::telemetry::ActuatorOutputStatus* p = actuator_output_status_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::ActuatorOutputStatus*>(
+      &::mavsdk::rpc::telemetry::_ActuatorOutputStatus_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::ActuatorOutputStatus& ActuatorOutputStatusResponse::actuator_output_status() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorOutputStatusResponse.actuator_output_status)
+  return _internal_actuator_output_status();
+}
+inline ::mavsdk::rpc::telemetry::ActuatorOutputStatus* ActuatorOutputStatusResponse::release_actuator_output_status() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.ActuatorOutputStatusResponse.actuator_output_status)
+  
+  ::mavsdk::rpc::telemetry::ActuatorOutputStatus* temp = actuator_output_status_;
+  actuator_output_status_ = nullptr;
+  return temp;
+}
+inline ::mavsdk::rpc::telemetry::ActuatorOutputStatus* ActuatorOutputStatusResponse::_internal_mutable_actuator_output_status() {
+  
+  if (actuator_output_status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::ActuatorOutputStatus>(GetArenaNoVirtual());
+    actuator_output_status_ = p;
+  }
+  return actuator_output_status_;
+}
+inline ::mavsdk::rpc::telemetry::ActuatorOutputStatus* ActuatorOutputStatusResponse::mutable_actuator_output_status() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.ActuatorOutputStatusResponse.actuator_output_status)
+  return _internal_mutable_actuator_output_status();
+}
+inline void ActuatorOutputStatusResponse::set_allocated_actuator_output_status(::mavsdk::rpc::telemetry::ActuatorOutputStatus* actuator_output_status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete actuator_output_status_;
+  }
+  if (actuator_output_status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      actuator_output_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, actuator_output_status, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  actuator_output_status_ = actuator_output_status;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.ActuatorOutputStatusResponse.actuator_output_status)
+}
+
+// -------------------------------------------------------------------
+
+// SubscribeOdometryRequest
+
+// -------------------------------------------------------------------
+
+// OdometryResponse
+
+// .mavsdk.rpc.telemetry.Odometry odometry = 1;
+inline bool OdometryResponse::_internal_has_odometry() const {
+  return this != internal_default_instance() && odometry_ != nullptr;
+}
+inline bool OdometryResponse::has_odometry() const {
+  return _internal_has_odometry();
+}
+inline void OdometryResponse::clear_odometry() {
+  if (GetArenaNoVirtual() == nullptr && odometry_ != nullptr) {
+    delete odometry_;
+  }
+  odometry_ = nullptr;
+}
+inline const ::mavsdk::rpc::telemetry::Odometry& OdometryResponse::_internal_odometry() const {
+  const ::mavsdk::rpc::telemetry::Odometry* p = odometry_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Odometry*>(
+      &::mavsdk::rpc::telemetry::_Odometry_default_instance_);
 }
-inline const ::mavsdk::rpc::telemetry::Position& HomeResponse::home() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.HomeResponse.home)
-  return _internal_home();
+inline const ::mavsdk::rpc::telemetry::Odometry& OdometryResponse::odometry() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.OdometryResponse.odometry)
+  return _internal_odometry();
 }
-inline ::mavsdk::rpc::telemetry::Position* HomeResponse::release_home() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.HomeResponse.home)
+inline ::mavsdk::rpc::telemetry::Odometry* OdometryResponse::release_odometry() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.OdometryResponse.odometry)
   
-  ::mavsdk::rpc::telemetry::Position* temp = home_;
-  home_ = nullptr;
+  ::mavsdk::rpc::telemetry::Odometry* temp = odometry_;
+  odometry_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::telemetry::Position* HomeResponse::_internal_mutable_home() {
+inline ::mavsdk::rpc::telemetry::Odometry* OdometryResponse::_internal_mutable_odometry() {
   
-  if (home_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Position>(GetArenaNoVirtual());
-    home_ = p;
+  if (odometry_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Odometry>(GetArenaNoVirtual());
+    odometry_ = p;
   }
-  return home_;
+  return odometry_;
 }
-inline ::mavsdk::rpc::telemetry::Position* HomeResponse::mutable_home() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.HomeResponse.home)
-  return _internal_mutable_home();
+inline ::mavsdk::rpc::telemetry::Odometry* OdometryResponse::mutable_odometry() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.OdometryResponse.odometry)
+  return _internal_mutable_odometry();
 }
-inline void HomeResponse::set_allocated_home(::mavsdk::rpc::telemetry::Position* home) {
+inline void OdometryResponse::set_allocated_odometry(::mavsdk::rpc::telemetry::Odometry* odometry) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete home_;
+    delete odometry_;
   }
-  if (home) {
+  if (odometry) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      home = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, home, submessage_arena);
+      odometry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, odometry, submessage_arena);
     }
     
   } else {
     
   }
-  home_ = home;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.HomeResponse.home)
+  odometry_ = odometry;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.OdometryResponse.odometry)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeInAirRequest
-
-// -------------------------------------------------------------------
-
-// InAirResponse
+// Position
 
-// bool is_in_air = 1;
-inline void InAirResponse::clear_is_in_air() {
-  is_in_air_ = false;
+// double latitude_deg = 1;
+inline void Position::clear_latitude_deg() {
+  latitude_deg_ = 0;
 }
-inline bool InAirResponse::_internal_is_in_air() const {
-  return is_in_air_;
+inline double Position::_internal_latitude_deg() const {
+  return latitude_deg_;
 }
-inline bool InAirResponse::is_in_air() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.InAirResponse.is_in_air)
-  return _internal_is_in_air();
+inline double Position::latitude_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Position.latitude_deg)
+  return _internal_latitude_deg();
 }
-inline void InAirResponse::_internal_set_is_in_air(bool value) {
+inline void Position::_internal_set_latitude_deg(double value) {
   
-  is_in_air_ = value;
+  latitude_deg_ = value;
 }
-inline void InAirResponse::set_is_in_air(bool value) {
-  _internal_set_is_in_air(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.InAirResponse.is_in_air)
+inline void Position::set_latitude_deg(double value) {
+  _internal_set_latitude_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Position.latitude_deg)
 }
 
-// -------------------------------------------------------------------
-
-// SubscribeLandedStateRequest
-
-// -------------------------------------------------------------------
-
-// LandedStateResponse
-
-// .mavsdk.rpc.telemetry.LandedState landed_state = 1;
-inline void LandedStateResponse::clear_landed_state() {
-  landed_state_ = 0;
+// double longitude_deg = 2;
+inline void Position::clear_longitude_deg() {
+  longitude_deg_ = 0;
 }
-inline ::mavsdk::rpc::telemetry::LandedState LandedStateResponse::_internal_landed_state() const {
-  return static_cast< ::mavsdk::rpc::telemetry::LandedState >(landed_state_);
+inline double Position::_internal_longitude_deg() const {
+  return longitude_deg_;
 }
-inline ::mavsdk::rpc::telemetry::LandedState LandedStateResponse::landed_state() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.LandedStateResponse.landed_state)
-  return _internal_landed_state();
+inline double Position::longitude_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Position.longitude_deg)
+  return _internal_longitude_deg();
 }
-inline void LandedStateResponse::_internal_set_landed_state(::mavsdk::rpc::telemetry::LandedState value) {
+inline void Position::_internal_set_longitude_deg(double value) {
   
-  landed_state_ = value;
+  longitude_deg_ = value;
 }
-inline void LandedStateResponse::set_landed_state(::mavsdk::rpc::telemetry::LandedState value) {
-  _internal_set_landed_state(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.LandedStateResponse.landed_state)
+inline void Position::set_longitude_deg(double value) {
+  _internal_set_longitude_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Position.longitude_deg)
 }
 
-// -------------------------------------------------------------------
-
-// SubscribeArmedRequest
-
-// -------------------------------------------------------------------
-
-// ArmedResponse
-
-// bool is_armed = 1;
-inline void ArmedResponse::clear_is_armed() {
-  is_armed_ = false;
+// float absolute_altitude_m = 3;
+inline void Position::clear_absolute_altitude_m() {
+  absolute_altitude_m_ = 0;
 }
-inline bool ArmedResponse::_internal_is_armed() const {
-  return is_armed_;
+inline float Position::_internal_absolute_altitude_m() const {
+  return absolute_altitude_m_;
 }
-inline bool ArmedResponse::is_armed() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ArmedResponse.is_armed)
-  return _internal_is_armed();
+inline float Position::absolute_altitude_m() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Position.absolute_altitude_m)
+  return _internal_absolute_altitude_m();
 }
-inline void ArmedResponse::_internal_set_is_armed(bool value) {
+inline void Position::_internal_set_absolute_altitude_m(float value) {
   
-  is_armed_ = value;
+  absolute_altitude_m_ = value;
 }
-inline void ArmedResponse::set_is_armed(bool value) {
-  _internal_set_is_armed(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ArmedResponse.is_armed)
+inline void Position::set_absolute_altitude_m(float value) {
+  _internal_set_absolute_altitude_m(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Position.absolute_altitude_m)
 }
 
-// -------------------------------------------------------------------
-
-// SubscribeAttitudeQuaternionRequest
+// float relative_altitude_m = 4;
+inline void Position::clear_relative_altitude_m() {
+  relative_altitude_m_ = 0;
+}
+inline float Position::_internal_relative_altitude_m() const {
+  return relative_altitude_m_;
+}
+inline float Position::relative_altitude_m() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Position.relative_altitude_m)
+  return _internal_relative_altitude_m();
+}
+inline void Position::_internal_set_relative_altitude_m(float value) {
+  
+  relative_altitude_m_ = value;
+}
+inline void Position::set_relative_altitude_m(float value) {
+  _internal_set_relative_altitude_m(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Position.relative_altitude_m)
+}
 
 // -------------------------------------------------------------------
 
-// AttitudeQuaternionResponse
+// Quaternion
 
-// .mavsdk.rpc.telemetry.Quaternion attitude_quaternion = 1;
-inline bool AttitudeQuaternionResponse::_internal_has_attitude_quaternion() const {
-  return this != internal_default_instance() && attitude_quaternion_ != nullptr;
-}
-inline bool AttitudeQuaternionResponse::has_attitude_quaternion() const {
-  return _internal_has_attitude_quaternion();
-}
-inline void AttitudeQuaternionResponse::clear_attitude_quaternion() {
-  if (GetArenaNoVirtual() == nullptr && attitude_quaternion_ != nullptr) {
-    delete attitude_quaternion_;
-  }
-  attitude_quaternion_ = nullptr;
+// float w = 1;
+inline void Quaternion::clear_w() {
+  w_ = 0;
 }
-inline const ::mavsdk::rpc::telemetry::Quaternion& AttitudeQuaternionResponse::_internal_attitude_quaternion() const {
-  const ::mavsdk::rpc::telemetry::Quaternion* p = attitude_quaternion_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Quaternion*>(
-      &::mavsdk::rpc::telemetry::_Quaternion_default_instance_);
+inline float Quaternion::_internal_w() const {
+  return w_;
 }
-inline const ::mavsdk::rpc::telemetry::Quaternion& AttitudeQuaternionResponse::attitude_quaternion() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AttitudeQuaternionResponse.attitude_quaternion)
-  return _internal_attitude_quaternion();
+inline float Quaternion::w() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Quaternion.w)
+  return _internal_w();
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* AttitudeQuaternionResponse::release_attitude_quaternion() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.AttitudeQuaternionResponse.attitude_quaternion)
+inline void Quaternion::_internal_set_w(float value) {
   
-  ::mavsdk::rpc::telemetry::Quaternion* temp = attitude_quaternion_;
-  attitude_quaternion_ = nullptr;
-  return temp;
+  w_ = value;
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* AttitudeQuaternionResponse::_internal_mutable_attitude_quaternion() {
-  
-  if (attitude_quaternion_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Quaternion>(GetArenaNoVirtual());
-    attitude_quaternion_ = p;
-  }
-  return attitude_quaternion_;
+inline void Quaternion::set_w(float value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Quaternion.w)
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* AttitudeQuaternionResponse::mutable_attitude_quaternion() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.AttitudeQuaternionResponse.attitude_quaternion)
-  return _internal_mutable_attitude_quaternion();
+
+// float x = 2;
+inline void Quaternion::clear_x() {
+  x_ = 0;
 }
-inline void AttitudeQuaternionResponse::set_allocated_attitude_quaternion(::mavsdk::rpc::telemetry::Quaternion* attitude_quaternion) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete attitude_quaternion_;
-  }
-  if (attitude_quaternion) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      attitude_quaternion = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, attitude_quaternion, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  attitude_quaternion_ = attitude_quaternion;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.AttitudeQuaternionResponse.attitude_quaternion)
+inline float Quaternion::_internal_x() const {
+  return x_;
 }
-
-// -------------------------------------------------------------------
-
-// SubscribeAttitudeEulerRequest
-
-// -------------------------------------------------------------------
-
-// AttitudeEulerResponse
-
-// .mavsdk.rpc.telemetry.EulerAngle attitude_euler = 1;
-inline bool AttitudeEulerResponse::_internal_has_attitude_euler() const {
-  return this != internal_default_instance() && attitude_euler_ != nullptr;
+inline float Quaternion::x() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Quaternion.x)
+  return _internal_x();
+}
+inline void Quaternion::_internal_set_x(float value) {
+  
+  x_ = value;
 }
-inline bool AttitudeEulerResponse::has_attitude_euler() const {
-  return _internal_has_attitude_euler();
+inline void Quaternion::set_x(float value) {
+  _internal_set_x(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Quaternion.x)
 }
-inline void AttitudeEulerResponse::clear_attitude_euler() {
-  if (GetArenaNoVirtual() == nullptr && attitude_euler_ != nullptr) {
-    delete attitude_euler_;
-  }
-  attitude_euler_ = nullptr;
+
+// float y = 3;
+inline void Quaternion::clear_y() {
+  y_ = 0;
 }
-inline const ::mavsdk::rpc::telemetry::EulerAngle& AttitudeEulerResponse::_internal_attitude_euler() const {
-  const ::mavsdk::rpc::telemetry::EulerAngle* p = attitude_euler_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::EulerAngle*>(
-      &::mavsdk::rpc::telemetry::_EulerAngle_default_instance_);
+inline float Quaternion::_internal_y() const {
+  return y_;
 }
-inline const ::mavsdk::rpc::telemetry::EulerAngle& AttitudeEulerResponse::attitude_euler() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AttitudeEulerResponse.attitude_euler)
-  return _internal_attitude_euler();
+inline float Quaternion::y() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Quaternion.y)
+  return _internal_y();
 }
-inline ::mavsdk::rpc::telemetry::EulerAngle* AttitudeEulerResponse::release_attitude_euler() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.AttitudeEulerResponse.attitude_euler)
+inline void Quaternion::_internal_set_y(float value) {
   
-  ::mavsdk::rpc::telemetry::EulerAngle* temp = attitude_euler_;
-  attitude_euler_ = nullptr;
-  return temp;
+  y_ = value;
 }
-inline ::mavsdk::rpc::telemetry::EulerAngle* AttitudeEulerResponse::_internal_mutable_attitude_euler() {
-  
-  if (attitude_euler_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::EulerAngle>(GetArenaNoVirtual());
-    attitude_euler_ = p;
-  }
-  return attitude_euler_;
+inline void Quaternion::set_y(float value) {
+  _internal_set_y(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Quaternion.y)
 }
-inline ::mavsdk::rpc::telemetry::EulerAngle* AttitudeEulerResponse::mutable_attitude_euler() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.AttitudeEulerResponse.attitude_euler)
-  return _internal_mutable_attitude_euler();
+
+// float z = 4;
+inline void Quaternion::clear_z() {
+  z_ = 0;
 }
-inline void AttitudeEulerResponse::set_allocated_attitude_euler(::mavsdk::rpc::telemetry::EulerAngle* attitude_euler) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete attitude_euler_;
-  }
-  if (attitude_euler) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      attitude_euler = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, attitude_euler, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  attitude_euler_ = attitude_euler;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.AttitudeEulerResponse.attitude_euler)
+inline float Quaternion::_internal_z() const {
+  return z_;
+}
+inline float Quaternion::z() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Quaternion.z)
+  return _internal_z();
+}
+inline void Quaternion::_internal_set_z(float value) {
+  
+  z_ = value;
+}
+inline void Quaternion::set_z(float value) {
+  _internal_set_z(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Quaternion.z)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeAttitudeAngularVelocityBodyRequest
-
-// -------------------------------------------------------------------
-
-// AttitudeAngularVelocityBodyResponse
+// EulerAngle
 
-// .mavsdk.rpc.telemetry.AngularVelocityBody attitude_angular_velocity_body = 1;
-inline bool AttitudeAngularVelocityBodyResponse::_internal_has_attitude_angular_velocity_body() const {
-  return this != internal_default_instance() && attitude_angular_velocity_body_ != nullptr;
+// float roll_deg = 1;
+inline void EulerAngle::clear_roll_deg() {
+  roll_deg_ = 0;
 }
-inline bool AttitudeAngularVelocityBodyResponse::has_attitude_angular_velocity_body() const {
-  return _internal_has_attitude_angular_velocity_body();
+inline float EulerAngle::_internal_roll_deg() const {
+  return roll_deg_;
 }
-inline void AttitudeAngularVelocityBodyResponse::clear_attitude_angular_velocity_body() {
-  if (GetArenaNoVirtual() == nullptr && attitude_angular_velocity_body_ != nullptr) {
-    delete attitude_angular_velocity_body_;
-  }
-  attitude_angular_velocity_body_ = nullptr;
+inline float EulerAngle::roll_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.EulerAngle.roll_deg)
+  return _internal_roll_deg();
 }
-inline const ::mavsdk::rpc::telemetry::AngularVelocityBody& AttitudeAngularVelocityBodyResponse::_internal_attitude_angular_velocity_body() const {
-  const ::mavsdk::rpc::telemetry::AngularVelocityBody* p = attitude_angular_velocity_body_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::AngularVelocityBody*>(
-      &::mavsdk::rpc::telemetry::_AngularVelocityBody_default_instance_);
+inline void EulerAngle::_internal_set_roll_deg(float value) {
+  
+  roll_deg_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::AngularVelocityBody& AttitudeAngularVelocityBodyResponse::attitude_angular_velocity_body() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AttitudeAngularVelocityBodyResponse.attitude_angular_velocity_body)
-  return _internal_attitude_angular_velocity_body();
+inline void EulerAngle::set_roll_deg(float value) {
+  _internal_set_roll_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.EulerAngle.roll_deg)
 }
-inline ::mavsdk::rpc::telemetry::AngularVelocityBody* AttitudeAngularVelocityBodyResponse::release_attitude_angular_velocity_body() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.AttitudeAngularVelocityBodyResponse.attitude_angular_velocity_body)
-  
-  ::mavsdk::rpc::telemetry::AngularVelocityBody* temp = attitude_angular_velocity_body_;
-  attitude_angular_velocity_body_ = nullptr;
-  return temp;
+
+// float pitch_deg = 2;
+inline void EulerAngle::clear_pitch_deg() {
+  pitch_deg_ = 0;
 }
-inline ::mavsdk::rpc::telemetry::AngularVelocityBody* AttitudeAngularVelocityBodyResponse::_internal_mutable_attitude_angular_velocity_body() {
-  
-  if (attitude_angular_velocity_body_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::AngularVelocityBody>(GetArenaNoVirtual());
-    attitude_angular_velocity_body_ = p;
-  }
-  return attitude_angular_velocity_body_;
+inline float EulerAngle::_internal_pitch_deg() const {
+  return pitch_deg_;
 }
-inline ::mavsdk::rpc::telemetry::AngularVelocityBody* AttitudeAngularVelocityBodyResponse::mutable_attitude_angular_velocity_body() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.AttitudeAngularVelocityBodyResponse.attitude_angular_velocity_body)
-  return _internal_mutable_attitude_angular_velocity_body();
+inline float EulerAngle::pitch_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.EulerAngle.pitch_deg)
+  return _internal_pitch_deg();
 }
-inline void AttitudeAngularVelocityBodyResponse::set_allocated_attitude_angular_velocity_body(::mavsdk::rpc::telemetry::AngularVelocityBody* attitude_angular_velocity_body) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete attitude_angular_velocity_body_;
-  }
-  if (attitude_angular_velocity_body) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      attitude_angular_velocity_body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, attitude_angular_velocity_body, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  attitude_angular_velocity_body_ = attitude_angular_velocity_body;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.AttitudeAngularVelocityBodyResponse.attitude_angular_velocity_body)
+inline void EulerAngle::_internal_set_pitch_deg(float value) {
+  
+  pitch_deg_ = value;
+}
+inline void EulerAngle::set_pitch_deg(float value) {
+  _internal_set_pitch_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.EulerAngle.pitch_deg)
 }
 
-// -------------------------------------------------------------------
-
-// SubscribeCameraAttitudeQuaternionRequest
-
-// -------------------------------------------------------------------
-
-// CameraAttitudeQuaternionResponse
-
-// .mavsdk.rpc.telemetry.Quaternion attitude_quaternion = 1;
-inline bool CameraAttitudeQuaternionResponse::_internal_has_attitude_quaternion() const {
-  return this != internal_default_instance() && attitude_quaternion_ != nullptr;
+// float yaw_deg = 3;
+inline void EulerAngle::clear_yaw_deg() {
+  yaw_deg_ = 0;
 }
-inline bool CameraAttitudeQuaternionResponse::has_attitude_quaternion() const {
-  return _internal_has_attitude_quaternion();
+inline float EulerAngle::_internal_yaw_deg() const {
+  return yaw_deg_;
 }
-inline void CameraAttitudeQuaternionResponse::clear_attitude_quaternion() {
-  if (GetArenaNoVirtual() == nullptr && attitude_quaternion_ != nullptr) {
-    delete attitude_quaternion_;
-  }
-  attitude_quaternion_ = nullptr;
+inline float EulerAngle::yaw_deg() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.EulerAngle.yaw_deg)
+  return _internal_yaw_deg();
 }
-inline const ::mavsdk::rpc::telemetry::Quaternion& CameraAttitudeQuaternionResponse::_internal_attitude_quaternion() const {
-  const ::mavsdk::rpc::telemetry::Quaternion* p = attitude_quaternion_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Quaternion*>(
-      &::mavsdk::rpc::telemetry::_Quaternion_default_instance_);
+inline void EulerAngle::_internal_set_yaw_deg(float value) {
+  
+  yaw_deg_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::Quaternion& CameraAttitudeQuaternionResponse::attitude_quaternion() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.CameraAttitudeQuaternionResponse.attitude_quaternion)
-  return _internal_attitude_quaternion();
+inline void EulerAngle::set_yaw_deg(float value) {
+  _internal_set_yaw_deg(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.EulerAngle.yaw_deg)
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* CameraAttitudeQuaternionResponse::release_attitude_quaternion() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.CameraAttitudeQuaternionResponse.attitude_quaternion)
-  
-  ::mavsdk::rpc::telemetry::Quaternion* temp = attitude_quaternion_;
-  attitude_quaternion_ = nullptr;
-  return temp;
+
+// -------------------------------------------------------------------
+
+// AngularVelocityBody
+
+// float roll_rad_s = 1;
+inline void AngularVelocityBody::clear_roll_rad_s() {
+  roll_rad_s_ = 0;
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* CameraAttitudeQuaternionResponse::_internal_mutable_attitude_quaternion() {
-  
-  if (attitude_quaternion_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Quaternion>(GetArenaNoVirtual());
-    attitude_quaternion_ = p;
-  }
-  return attitude_quaternion_;
+inline float AngularVelocityBody::_internal_roll_rad_s() const {
+  return roll_rad_s_;
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* CameraAttitudeQuaternionResponse::mutable_attitude_quaternion() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.CameraAttitudeQuaternionResponse.attitude_quaternion)
-  return _internal_mutable_attitude_quaternion();
+inline float AngularVelocityBody::roll_rad_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AngularVelocityBody.roll_rad_s)
+  return _internal_roll_rad_s();
 }
-inline void CameraAttitudeQuaternionResponse::set_allocated_attitude_quaternion(::mavsdk::rpc::telemetry::Quaternion* attitude_quaternion) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete attitude_quaternion_;
-  }
-  if (attitude_quaternion) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      attitude_quaternion = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, attitude_quaternion, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  attitude_quaternion_ = attitude_quaternion;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.CameraAttitudeQuaternionResponse.attitude_quaternion)
+inline void AngularVelocityBody::_internal_set_roll_rad_s(float value) {
+  
+  roll_rad_s_ = value;
+}
+inline void AngularVelocityBody::set_roll_rad_s(float value) {
+  _internal_set_roll_rad_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.AngularVelocityBody.roll_rad_s)
 }
 
-// -------------------------------------------------------------------
-
-// SubscribeCameraAttitudeEulerRequest
-
-// -------------------------------------------------------------------
-
-// CameraAttitudeEulerResponse
-
-// .mavsdk.rpc.telemetry.EulerAngle attitude_euler = 1;
-inline bool CameraAttitudeEulerResponse::_internal_has_attitude_euler() const {
-  return this != internal_default_instance() && attitude_euler_ != nullptr;
+// float pitch_rad_s = 2;
+inline void AngularVelocityBody::clear_pitch_rad_s() {
+  pitch_rad_s_ = 0;
 }
-inline bool CameraAttitudeEulerResponse::has_attitude_euler() const {
-  return _internal_has_attitude_euler();
+inline float AngularVelocityBody::_internal_pitch_rad_s() const {
+  return pitch_rad_s_;
 }
-inline void CameraAttitudeEulerResponse::clear_attitude_euler() {
-  if (GetArenaNoVirtual() == nullptr && attitude_euler_ != nullptr) {
-    delete attitude_euler_;
-  }
-  attitude_euler_ = nullptr;
+inline float AngularVelocityBody::pitch_rad_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AngularVelocityBody.pitch_rad_s)
+  return _internal_pitch_rad_s();
 }
-inline const ::mavsdk::rpc::telemetry::EulerAngle& CameraAttitudeEulerResponse::_internal_attitude_euler() const {
-  const ::mavsdk::rpc::telemetry::EulerAngle* p = attitude_euler_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::EulerAngle*>(
-      &::mavsdk::rpc::telemetry::_EulerAngle_default_instance_);
+inline void AngularVelocityBody::_internal_set_pitch_rad_s(float value) {
+  
+  pitch_rad_s_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::EulerAngle& CameraAttitudeEulerResponse::attitude_euler() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.CameraAttitudeEulerResponse.attitude_euler)
-  return _internal_attitude_euler();
+inline void AngularVelocityBody::set_pitch_rad_s(float value) {
+  _internal_set_pitch_rad_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.AngularVelocityBody.pitch_rad_s)
 }
-inline ::mavsdk::rpc::telemetry::EulerAngle* CameraAttitudeEulerResponse::release_attitude_euler() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.CameraAttitudeEulerResponse.attitude_euler)
-  
-  ::mavsdk::rpc::telemetry::EulerAngle* temp = attitude_euler_;
-  attitude_euler_ = nullptr;
-  return temp;
+
+// float yaw_rad_s = 3;
+inline void AngularVelocityBody::clear_yaw_rad_s() {
+  yaw_rad_s_ = 0;
 }
-inline ::mavsdk::rpc::telemetry::EulerAngle* CameraAttitudeEulerResponse::_internal_mutable_attitude_euler() {
-  
-  if (attitude_euler_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::EulerAngle>(GetArenaNoVirtual());
-    attitude_euler_ = p;
-  }
-  return attitude_euler_;
+inline float AngularVelocityBody::_internal_yaw_rad_s() const {
+  return yaw_rad_s_;
 }
-inline ::mavsdk::rpc::telemetry::EulerAngle* CameraAttitudeEulerResponse::mutable_attitude_euler() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.CameraAttitudeEulerResponse.attitude_euler)
-  return _internal_mutable_attitude_euler();
+inline float AngularVelocityBody::yaw_rad_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AngularVelocityBody.yaw_rad_s)
+  return _internal_yaw_rad_s();
 }
-inline void CameraAttitudeEulerResponse::set_allocated_attitude_euler(::mavsdk::rpc::telemetry::EulerAngle* attitude_euler) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete attitude_euler_;
-  }
-  if (attitude_euler) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      attitude_euler = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, attitude_euler, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  attitude_euler_ = attitude_euler;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.CameraAttitudeEulerResponse.attitude_euler)
+inline void AngularVelocityBody::_internal_set_yaw_rad_s(float value) {
+  
+  yaw_rad_s_ = value;
+}
+inline void AngularVelocityBody::set_yaw_rad_s(float value) {
+  _internal_set_yaw_rad_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.AngularVelocityBody.yaw_rad_s)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeGroundSpeedNedRequest
-
-// -------------------------------------------------------------------
-
-// GroundSpeedNedResponse
+// SpeedNed
 
-// .mavsdk.rpc.telemetry.SpeedNed ground_speed_ned = 1;
-inline bool GroundSpeedNedResponse::_internal_has_ground_speed_ned() const {
-  return this != internal_default_instance() && ground_speed_ned_ != nullptr;
+// float velocity_north_m_s = 1;
+inline void SpeedNed::clear_velocity_north_m_s() {
+  velocity_north_m_s_ = 0;
 }
-inline bool GroundSpeedNedResponse::has_ground_speed_ned() const {
-  return _internal_has_ground_speed_ned();
+inline float SpeedNed::_internal_velocity_north_m_s() const {
+  return velocity_north_m_s_;
 }
-inline void GroundSpeedNedResponse::clear_ground_speed_ned() {
-  if (GetArenaNoVirtual() == nullptr && ground_speed_ned_ != nullptr) {
-    delete ground_speed_ned_;
-  }
-  ground_speed_ned_ = nullptr;
+inline float SpeedNed::velocity_north_m_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedNed.velocity_north_m_s)
+  return _internal_velocity_north_m_s();
 }
-inline const ::mavsdk::rpc::telemetry::SpeedNed& GroundSpeedNedResponse::_internal_ground_speed_ned() const {
-  const ::mavsdk::rpc::telemetry::SpeedNed* p = ground_speed_ned_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::SpeedNed*>(
-      &::mavsdk::rpc::telemetry::_SpeedNed_default_instance_);
+inline void SpeedNed::_internal_set_velocity_north_m_s(float value) {
+  
+  velocity_north_m_s_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::SpeedNed& GroundSpeedNedResponse::ground_speed_ned() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GroundSpeedNedResponse.ground_speed_ned)
-  return _internal_ground_speed_ned();
+inline void SpeedNed::set_velocity_north_m_s(float value) {
+  _internal_set_velocity_north_m_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedNed.velocity_north_m_s)
 }
-inline ::mavsdk::rpc::telemetry::SpeedNed* GroundSpeedNedResponse::release_ground_speed_ned() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.GroundSpeedNedResponse.ground_speed_ned)
-  
-  ::mavsdk::rpc::telemetry::SpeedNed* temp = ground_speed_ned_;
-  ground_speed_ned_ = nullptr;
-  return temp;
+
+// float velocity_east_m_s = 2;
+inline void SpeedNed::clear_velocity_east_m_s() {
+  velocity_east_m_s_ = 0;
 }
-inline ::mavsdk::rpc::telemetry::SpeedNed* GroundSpeedNedResponse::_internal_mutable_ground_speed_ned() {
-  
-  if (ground_speed_ned_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::SpeedNed>(GetArenaNoVirtual());
-    ground_speed_ned_ = p;
-  }
-  return ground_speed_ned_;
+inline float SpeedNed::_internal_velocity_east_m_s() const {
+  return velocity_east_m_s_;
 }
-inline ::mavsdk::rpc::telemetry::SpeedNed* GroundSpeedNedResponse::mutable_ground_speed_ned() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.GroundSpeedNedResponse.ground_speed_ned)
-  return _internal_mutable_ground_speed_ned();
+inline float SpeedNed::velocity_east_m_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedNed.velocity_east_m_s)
+  return _internal_velocity_east_m_s();
 }
-inline void GroundSpeedNedResponse::set_allocated_ground_speed_ned(::mavsdk::rpc::telemetry::SpeedNed* ground_speed_ned) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete ground_speed_ned_;
-  }
-  if (ground_speed_ned) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      ground_speed_ned = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, ground_speed_ned, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  ground_speed_ned_ = ground_speed_ned;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.GroundSpeedNedResponse.ground_speed_ned)
+inline void SpeedNed::_internal_set_velocity_east_m_s(float value) {
+  
+  velocity_east_m_s_ = value;
+}
+inline void SpeedNed::set_velocity_east_m_s(float value) {
+  _internal_set_velocity_east_m_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedNed.velocity_east_m_s)
 }
 
-// -------------------------------------------------------------------
-
-// SubscribeGpsInfoRequest
+// float velocity_down_m_s = 3;
+inline void SpeedNed::clear_velocity_down_m_s() {
+  velocity_down_m_s_ = 0;
+}
+inline float SpeedNed::_internal_velocity_down_m_s() const {
+  return velocity_down_m_s_;
+}
+inline float SpeedNed::velocity_down_m_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedNed.velocity_down_m_s)
+  return _internal_velocity_down_m_s();
+}
+inline void SpeedNed::_internal_set_velocity_down_m_s(float value) {
+  
+  velocity_down_m_s_ = value;
+}
+inline void SpeedNed::set_velocity_down_m_s(float value) {
+  _internal_set_velocity_down_m_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedNed.velocity_down_m_s)
+}
 
 // -------------------------------------------------------------------
 
-// GpsInfoResponse
+// GpsInfo
 
-// .mavsdk.rpc.telemetry.GpsInfo gps_info = 1;
-inline bool GpsInfoResponse::_internal_has_gps_info() const {
-  return this != internal_default_instance() && gps_info_ != nullptr;
+// int32 num_satellites = 1;
+inline void GpsInfo::clear_num_satellites() {
+  num_satellites_ = 0;
 }
-inline bool GpsInfoResponse::has_gps_info() const {
-  return _internal_has_gps_info();
+inline ::PROTOBUF_NAMESPACE_ID::int32 GpsInfo::_internal_num_satellites() const {
+  return num_satellites_;
 }
-inline void GpsInfoResponse::clear_gps_info() {
-  if (GetArenaNoVirtual() == nullptr && gps_info_ != nullptr) {
-    delete gps_info_;
-  }
-  gps_info_ = nullptr;
+inline ::PROTOBUF_NAMESPACE_ID::int32 GpsInfo::num_satellites() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GpsInfo.num_satellites)
+  return _internal_num_satellites();
 }
-inline const ::mavsdk::rpc::telemetry::GpsInfo& GpsInfoResponse::_internal_gps_info() const {
-  const ::mavsdk::rpc::telemetry::GpsInfo* p = gps_info_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::GpsInfo*>(
-      &::mavsdk::rpc::telemetry::_GpsInfo_default_instance_);
+inline void GpsInfo::_internal_set_num_satellites(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  num_satellites_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::GpsInfo& GpsInfoResponse::gps_info() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GpsInfoResponse.gps_info)
-  return _internal_gps_info();
+inline void GpsInfo::set_num_satellites(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_num_satellites(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.GpsInfo.num_satellites)
 }
-inline ::mavsdk::rpc::telemetry::GpsInfo* GpsInfoResponse::release_gps_info() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.GpsInfoResponse.gps_info)
-  
-  ::mavsdk::rpc::telemetry::GpsInfo* temp = gps_info_;
-  gps_info_ = nullptr;
-  return temp;
+
+// .mavsdk.rpc.telemetry.FixType fix_type = 2;
+inline void GpsInfo::clear_fix_type() {
+  fix_type_ = 0;
 }
-inline ::mavsdk::rpc::telemetry::GpsInfo* GpsInfoResponse::_internal_mutable_gps_info() {
-  
-  if (gps_info_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::GpsInfo>(GetArenaNoVirtual());
-    gps_info_ = p;
-  }
-  return gps_info_;
+inline ::mavsdk::rpc::telemetry::FixType GpsInfo::_internal_fix_type() const {
+  return static_cast< ::mavsdk::rpc::telemetry::FixType >(fix_type_);
+}
+inline ::mavsdk::rpc::telemetry::FixType GpsInfo::fix_type() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GpsInfo.fix_type)
+  return _internal_fix_type();
 }
-inline ::mavsdk::rpc::telemetry::GpsInfo* GpsInfoResponse::mutable_gps_info() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.GpsInfoResponse.gps_info)
-  return _internal_mutable_gps_info();
+inline void GpsInfo::_internal_set_fix_type(::mavsdk::rpc::telemetry::FixType value) {
+  
+  fix_type_ = value;
 }
-inline void GpsInfoResponse::set_allocated_gps_info(::mavsdk::rpc::telemetry::GpsInfo* gps_info) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete gps_info_;
-  }
-  if (gps_info) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      gps_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, gps_info, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  gps_info_ = gps_info;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.GpsInfoResponse.gps_info)
+inline void GpsInfo::set_fix_type(::mavsdk::rpc::telemetry::FixType value) {
+  _internal_set_fix_type(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.GpsInfo.fix_type)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeBatteryRequest
-
-// -------------------------------------------------------------------
-
-// BatteryResponse
+// Battery
 
-// .mavsdk.rpc.telemetry.Battery battery = 1;
-inline bool BatteryResponse::_internal_has_battery() const {
-  return this != internal_default_instance() && battery_ != nullptr;
+// float voltage_v = 1;
+inline void Battery::clear_voltage_v() {
+  voltage_v_ = 0;
 }
-inline bool BatteryResponse::has_battery() const {
-  return _internal_has_battery();
+inline float Battery::_internal_voltage_v() const {
+  return voltage_v_;
 }
-inline void BatteryResponse::clear_battery() {
-  if (GetArenaNoVirtual() == nullptr && battery_ != nullptr) {
-    delete battery_;
-  }
-  battery_ = nullptr;
+inline float Battery::voltage_v() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Battery.voltage_v)
+  return _internal_voltage_v();
 }
-inline const ::mavsdk::rpc::telemetry::Battery& BatteryResponse::_internal_battery() const {
-  const ::mavsdk::rpc::telemetry::Battery* p = battery_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Battery*>(
-      &::mavsdk::rpc::telemetry::_Battery_default_instance_);
+inline void Battery::_internal_set_voltage_v(float value) {
+  
+  voltage_v_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::Battery& BatteryResponse::battery() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.BatteryResponse.battery)
-  return _internal_battery();
+inline void Battery::set_voltage_v(float value) {
+  _internal_set_voltage_v(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Battery.voltage_v)
 }
-inline ::mavsdk::rpc::telemetry::Battery* BatteryResponse::release_battery() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.BatteryResponse.battery)
-  
-  ::mavsdk::rpc::telemetry::Battery* temp = battery_;
-  battery_ = nullptr;
-  return temp;
+
+// float remaining_percent = 2;
+inline void Battery::clear_remaining_percent() {
+  remaining_percent_ = 0;
 }
-inline ::mavsdk::rpc::telemetry::Battery* BatteryResponse::_internal_mutable_battery() {
-  
-  if (battery_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Battery>(GetArenaNoVirtual());
-    battery_ = p;
-  }
-  return battery_;
+inline float Battery::_internal_remaining_percent() const {
+  return remaining_percent_;
 }
-inline ::mavsdk::rpc::telemetry::Battery* BatteryResponse::mutable_battery() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.BatteryResponse.battery)
-  return _internal_mutable_battery();
+inline float Battery::remaining_percent() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Battery.remaining_percent)
+  return _internal_remaining_percent();
 }
-inline void BatteryResponse::set_allocated_battery(::mavsdk::rpc::telemetry::Battery* battery) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete battery_;
-  }
-  if (battery) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      battery = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, battery, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  battery_ = battery;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.BatteryResponse.battery)
+inline void Battery::_internal_set_remaining_percent(float value) {
+  
+  remaining_percent_ = value;
+}
+inline void Battery::set_remaining_percent(float value) {
+  _internal_set_remaining_percent(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Battery.remaining_percent)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeFlightModeRequest
-
-// -------------------------------------------------------------------
-
-// FlightModeResponse
+// Health
 
-// .mavsdk.rpc.telemetry.FlightMode flight_mode = 1;
-inline void FlightModeResponse::clear_flight_mode() {
-  flight_mode_ = 0;
+// bool is_gyrometer_calibration_ok = 1;
+inline void Health::clear_is_gyrometer_calibration_ok() {
+  is_gyrometer_calibration_ok_ = false;
 }
-inline ::mavsdk::rpc::telemetry::FlightMode FlightModeResponse::_internal_flight_mode() const {
-  return static_cast< ::mavsdk::rpc::telemetry::FlightMode >(flight_mode_);
+inline bool Health::_internal_is_gyrometer_calibration_ok() const {
+  return is_gyrometer_calibration_ok_;
 }
-inline ::mavsdk::rpc::telemetry::FlightMode FlightModeResponse::flight_mode() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.FlightModeResponse.flight_mode)
-  return _internal_flight_mode();
+inline bool Health::is_gyrometer_calibration_ok() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_gyrometer_calibration_ok)
+  return _internal_is_gyrometer_calibration_ok();
 }
-inline void FlightModeResponse::_internal_set_flight_mode(::mavsdk::rpc::telemetry::FlightMode value) {
+inline void Health::_internal_set_is_gyrometer_calibration_ok(bool value) {
   
-  flight_mode_ = value;
+  is_gyrometer_calibration_ok_ = value;
 }
-inline void FlightModeResponse::set_flight_mode(::mavsdk::rpc::telemetry::FlightMode value) {
-  _internal_set_flight_mode(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.FlightModeResponse.flight_mode)
+inline void Health::set_is_gyrometer_calibration_ok(bool value) {
+  _internal_set_is_gyrometer_calibration_ok(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_gyrometer_calibration_ok)
 }
 
-// -------------------------------------------------------------------
-
-// SubscribeHealthRequest
-
-// -------------------------------------------------------------------
-
-// HealthResponse
-
-// .mavsdk.rpc.telemetry.Health health = 1;
-inline bool HealthResponse::_internal_has_health() const {
-  return this != internal_default_instance() && health_ != nullptr;
+// bool is_accelerometer_calibration_ok = 2;
+inline void Health::clear_is_accelerometer_calibration_ok() {
+  is_accelerometer_calibration_ok_ = false;
 }
-inline bool HealthResponse::has_health() const {
-  return _internal_has_health();
+inline bool Health::_internal_is_accelerometer_calibration_ok() const {
+  return is_accelerometer_calibration_ok_;
 }
-inline void HealthResponse::clear_health() {
-  if (GetArenaNoVirtual() == nullptr && health_ != nullptr) {
-    delete health_;
-  }
-  health_ = nullptr;
+inline bool Health::is_accelerometer_calibration_ok() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_accelerometer_calibration_ok)
+  return _internal_is_accelerometer_calibration_ok();
 }
-inline const ::mavsdk::rpc::telemetry::Health& HealthResponse::_internal_health() const {
-  const ::mavsdk::rpc::telemetry::Health* p = health_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Health*>(
-      &::mavsdk::rpc::telemetry::_Health_default_instance_);
+inline void Health::_internal_set_is_accelerometer_calibration_ok(bool value) {
+  
+  is_accelerometer_calibration_ok_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::Health& HealthResponse::health() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.HealthResponse.health)
-  return _internal_health();
+inline void Health::set_is_accelerometer_calibration_ok(bool value) {
+  _internal_set_is_accelerometer_calibration_ok(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_accelerometer_calibration_ok)
 }
-inline ::mavsdk::rpc::telemetry::Health* HealthResponse::release_health() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.HealthResponse.health)
-  
-  ::mavsdk::rpc::telemetry::Health* temp = health_;
-  health_ = nullptr;
-  return temp;
+
+// bool is_magnetometer_calibration_ok = 3;
+inline void Health::clear_is_magnetometer_calibration_ok() {
+  is_magnetometer_calibration_ok_ = false;
 }
-inline ::mavsdk::rpc::telemetry::Health* HealthResponse::_internal_mutable_health() {
-  
-  if (health_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Health>(GetArenaNoVirtual());
-    health_ = p;
-  }
-  return health_;
+inline bool Health::_internal_is_magnetometer_calibration_ok() const {
+  return is_magnetometer_calibration_ok_;
 }
-inline ::mavsdk::rpc::telemetry::Health* HealthResponse::mutable_health() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.HealthResponse.health)
-  return _internal_mutable_health();
+inline bool Health::is_magnetometer_calibration_ok() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_magnetometer_calibration_ok)
+  return _internal_is_magnetometer_calibration_ok();
 }
-inline void HealthResponse::set_allocated_health(::mavsdk::rpc::telemetry::Health* health) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete health_;
-  }
-  if (health) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      health = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, health, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  health_ = health;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.HealthResponse.health)
+inline void Health::_internal_set_is_magnetometer_calibration_ok(bool value) {
+  
+  is_magnetometer_calibration_ok_ = value;
+}
+inline void Health::set_is_magnetometer_calibration_ok(bool value) {
+  _internal_set_is_magnetometer_calibration_ok(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_magnetometer_calibration_ok)
 }
 
-// -------------------------------------------------------------------
-
-// SubscribeRcStatusRequest
-
-// -------------------------------------------------------------------
-
-// RcStatusResponse
-
-// .mavsdk.rpc.telemetry.RcStatus rc_status = 1;
-inline bool RcStatusResponse::_internal_has_rc_status() const {
-  return this != internal_default_instance() && rc_status_ != nullptr;
+// bool is_level_calibration_ok = 4;
+inline void Health::clear_is_level_calibration_ok() {
+  is_level_calibration_ok_ = false;
+}
+inline bool Health::_internal_is_level_calibration_ok() const {
+  return is_level_calibration_ok_;
+}
+inline bool Health::is_level_calibration_ok() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_level_calibration_ok)
+  return _internal_is_level_calibration_ok();
+}
+inline void Health::_internal_set_is_level_calibration_ok(bool value) {
+  
+  is_level_calibration_ok_ = value;
 }
-inline bool RcStatusResponse::has_rc_status() const {
-  return _internal_has_rc_status();
+inline void Health::set_is_level_calibration_ok(bool value) {
+  _internal_set_is_level_calibration_ok(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_level_calibration_ok)
 }
-inline void RcStatusResponse::clear_rc_status() {
-  if (GetArenaNoVirtual() == nullptr && rc_status_ != nullptr) {
-    delete rc_status_;
-  }
-  rc_status_ = nullptr;
+
+// bool is_local_position_ok = 5;
+inline void Health::clear_is_local_position_ok() {
+  is_local_position_ok_ = false;
 }
-inline const ::mavsdk::rpc::telemetry::RcStatus& RcStatusResponse::_internal_rc_status() const {
-  const ::mavsdk::rpc::telemetry::RcStatus* p = rc_status_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::RcStatus*>(
-      &::mavsdk::rpc::telemetry::_RcStatus_default_instance_);
+inline bool Health::_internal_is_local_position_ok() const {
+  return is_local_position_ok_;
 }
-inline const ::mavsdk::rpc::telemetry::RcStatus& RcStatusResponse::rc_status() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.RcStatusResponse.rc_status)
-  return _internal_rc_status();
+inline bool Health::is_local_position_ok() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_local_position_ok)
+  return _internal_is_local_position_ok();
 }
-inline ::mavsdk::rpc::telemetry::RcStatus* RcStatusResponse::release_rc_status() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.RcStatusResponse.rc_status)
+inline void Health::_internal_set_is_local_position_ok(bool value) {
   
-  ::mavsdk::rpc::telemetry::RcStatus* temp = rc_status_;
-  rc_status_ = nullptr;
-  return temp;
+  is_local_position_ok_ = value;
 }
-inline ::mavsdk::rpc::telemetry::RcStatus* RcStatusResponse::_internal_mutable_rc_status() {
-  
-  if (rc_status_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::RcStatus>(GetArenaNoVirtual());
-    rc_status_ = p;
-  }
-  return rc_status_;
+inline void Health::set_is_local_position_ok(bool value) {
+  _internal_set_is_local_position_ok(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_local_position_ok)
 }
-inline ::mavsdk::rpc::telemetry::RcStatus* RcStatusResponse::mutable_rc_status() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.RcStatusResponse.rc_status)
-  return _internal_mutable_rc_status();
+
+// bool is_global_position_ok = 6;
+inline void Health::clear_is_global_position_ok() {
+  is_global_position_ok_ = false;
 }
-inline void RcStatusResponse::set_allocated_rc_status(::mavsdk::rpc::telemetry::RcStatus* rc_status) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete rc_status_;
-  }
-  if (rc_status) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      rc_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, rc_status, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  rc_status_ = rc_status;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.RcStatusResponse.rc_status)
+inline bool Health::_internal_is_global_position_ok() const {
+  return is_global_position_ok_;
 }
-
-// -------------------------------------------------------------------
-
-// SubscribeStatusTextRequest
-
-// -------------------------------------------------------------------
-
-// StatusTextResponse
-
-// .mavsdk.rpc.telemetry.StatusText status_text = 1;
-inline bool StatusTextResponse::_internal_has_status_text() const {
-  return this != internal_default_instance() && status_text_ != nullptr;
+inline bool Health::is_global_position_ok() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_global_position_ok)
+  return _internal_is_global_position_ok();
 }
-inline bool StatusTextResponse::has_status_text() const {
-  return _internal_has_status_text();
+inline void Health::_internal_set_is_global_position_ok(bool value) {
+  
+  is_global_position_ok_ = value;
 }
-inline void StatusTextResponse::clear_status_text() {
-  if (GetArenaNoVirtual() == nullptr && status_text_ != nullptr) {
-    delete status_text_;
-  }
-  status_text_ = nullptr;
+inline void Health::set_is_global_position_ok(bool value) {
+  _internal_set_is_global_position_ok(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_global_position_ok)
 }
-inline const ::mavsdk::rpc::telemetry::StatusText& StatusTextResponse::_internal_status_text() const {
-  const ::mavsdk::rpc::telemetry::StatusText* p = status_text_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::StatusText*>(
-      &::mavsdk::rpc::telemetry::_StatusText_default_instance_);
+
+// bool is_home_position_ok = 7;
+inline void Health::clear_is_home_position_ok() {
+  is_home_position_ok_ = false;
 }
-inline const ::mavsdk::rpc::telemetry::StatusText& StatusTextResponse::status_text() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.StatusTextResponse.status_text)
-  return _internal_status_text();
+inline bool Health::_internal_is_home_position_ok() const {
+  return is_home_position_ok_;
 }
-inline ::mavsdk::rpc::telemetry::StatusText* StatusTextResponse::release_status_text() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.StatusTextResponse.status_text)
-  
-  ::mavsdk::rpc::telemetry::StatusText* temp = status_text_;
-  status_text_ = nullptr;
-  return temp;
+inline bool Health::is_home_position_ok() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_home_position_ok)
+  return _internal_is_home_position_ok();
 }
-inline ::mavsdk::rpc::telemetry::StatusText* StatusTextResponse::_internal_mutable_status_text() {
+inline void Health::_internal_set_is_home_position_ok(bool value) {
   
-  if (status_text_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::StatusText>(GetArenaNoVirtual());
-    status_text_ = p;
-  }
-  return status_text_;
-}
-inline ::mavsdk::rpc::telemetry::StatusText* StatusTextResponse::mutable_status_text() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.StatusTextResponse.status_text)
-  return _internal_mutable_status_text();
+  is_home_position_ok_ = value;
 }
-inline void StatusTextResponse::set_allocated_status_text(::mavsdk::rpc::telemetry::StatusText* status_text) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete status_text_;
-  }
-  if (status_text) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      status_text = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, status_text, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  status_text_ = status_text;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.StatusTextResponse.status_text)
+inline void Health::set_is_home_position_ok(bool value) {
+  _internal_set_is_home_position_ok(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_home_position_ok)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeActuatorControlTargetRequest
-
-// -------------------------------------------------------------------
-
-// ActuatorControlTargetResponse
+// RcStatus
 
-// .mavsdk.rpc.telemetry.ActuatorControlTarget actuator_control_target = 1;
-inline bool ActuatorControlTargetResponse::_internal_has_actuator_control_target() const {
-  return this != internal_default_instance() && actuator_control_target_ != nullptr;
+// bool was_available_once = 1;
+inline void RcStatus::clear_was_available_once() {
+  was_available_once_ = false;
 }
-inline bool ActuatorControlTargetResponse::has_actuator_control_target() const {
-  return _internal_has_actuator_control_target();
+inline bool RcStatus::_internal_was_available_once() const {
+  return was_available_once_;
 }
-inline void ActuatorControlTargetResponse::clear_actuator_control_target() {
-  if (GetArenaNoVirtual() == nullptr && actuator_control_target_ != nullptr) {
-    delete actuator_control_target_;
-  }
-  actuator_control_target_ = nullptr;
+inline bool RcStatus::was_available_once() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.RcStatus.was_available_once)
+  return _internal_was_available_once();
 }
-inline const ::mavsdk::rpc::telemetry::ActuatorControlTarget& ActuatorControlTargetResponse::_internal_actuator_control_target() const {
-  const ::mavsdk::rpc::telemetry::ActuatorControlTarget* p = actuator_control_target_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::ActuatorControlTarget*>(
-      &::mavsdk::rpc::telemetry::_ActuatorControlTarget_default_instance_);
+inline void RcStatus::_internal_set_was_available_once(bool value) {
+  
+  was_available_once_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::ActuatorControlTarget& ActuatorControlTargetResponse::actuator_control_target() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorControlTargetResponse.actuator_control_target)
-  return _internal_actuator_control_target();
+inline void RcStatus::set_was_available_once(bool value) {
+  _internal_set_was_available_once(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.RcStatus.was_available_once)
 }
-inline ::mavsdk::rpc::telemetry::ActuatorControlTarget* ActuatorControlTargetResponse::release_actuator_control_target() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.ActuatorControlTargetResponse.actuator_control_target)
-  
-  ::mavsdk::rpc::telemetry::ActuatorControlTarget* temp = actuator_control_target_;
-  actuator_control_target_ = nullptr;
-  return temp;
+
+// bool is_available = 2;
+inline void RcStatus::clear_is_available() {
+  is_available_ = false;
 }
-inline ::mavsdk::rpc::telemetry::ActuatorControlTarget* ActuatorControlTargetResponse::_internal_mutable_actuator_control_target() {
+inline bool RcStatus::_internal_is_available() const {
+  return is_available_;
+}
+inline bool RcStatus::is_available() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.RcStatus.is_available)
+  return _internal_is_available();
+}
+inline void RcStatus::_internal_set_is_available(bool value) {
   
-  if (actuator_control_target_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::ActuatorControlTarget>(GetArenaNoVirtual());
-    actuator_control_target_ = p;
-  }
-  return actuator_control_target_;
+  is_available_ = value;
 }
-inline ::mavsdk::rpc::telemetry::ActuatorControlTarget* ActuatorControlTargetResponse::mutable_actuator_control_target() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.ActuatorControlTargetResponse.actuator_control_target)
-  return _internal_mutable_actuator_control_target();
+inline void RcStatus::set_is_available(bool value) {
+  _internal_set_is_available(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.RcStatus.is_available)
 }
-inline void ActuatorControlTargetResponse::set_allocated_actuator_control_target(::mavsdk::rpc::telemetry::ActuatorControlTarget* actuator_control_target) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete actuator_control_target_;
-  }
-  if (actuator_control_target) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      actuator_control_target = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, actuator_control_target, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  actuator_control_target_ = actuator_control_target;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.ActuatorControlTargetResponse.actuator_control_target)
+
+// float signal_strength_percent = 3;
+inline void RcStatus::clear_signal_strength_percent() {
+  signal_strength_percent_ = 0;
+}
+inline float RcStatus::_internal_signal_strength_percent() const {
+  return signal_strength_percent_;
+}
+inline float RcStatus::signal_strength_percent() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.RcStatus.signal_strength_percent)
+  return _internal_signal_strength_percent();
+}
+inline void RcStatus::_internal_set_signal_strength_percent(float value) {
+  
+  signal_strength_percent_ = value;
+}
+inline void RcStatus::set_signal_strength_percent(float value) {
+  _internal_set_signal_strength_percent(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.RcStatus.signal_strength_percent)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeActuatorOutputStatusRequest
-
-// -------------------------------------------------------------------
+// StatusText
 
-// ActuatorOutputStatusResponse
+// .mavsdk.rpc.telemetry.StatusText.StatusType type = 1;
+inline void StatusText::clear_type() {
+  type_ = 0;
+}
+inline ::mavsdk::rpc::telemetry::StatusText_StatusType StatusText::_internal_type() const {
+  return static_cast< ::mavsdk::rpc::telemetry::StatusText_StatusType >(type_);
+}
+inline ::mavsdk::rpc::telemetry::StatusText_StatusType StatusText::type() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.StatusText.type)
+  return _internal_type();
+}
+inline void StatusText::_internal_set_type(::mavsdk::rpc::telemetry::StatusText_StatusType value) {
+  
+  type_ = value;
+}
+inline void StatusText::set_type(::mavsdk::rpc::telemetry::StatusText_StatusType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.StatusText.type)
+}
 
-// .mavsdk.rpc.telemetry.ActuatorOutputStatus actuator_output_status = 1;
-inline bool ActuatorOutputStatusResponse::_internal_has_actuator_output_status() const {
-  return this != internal_default_instance() && actuator_output_status_ != nullptr;
+// string text = 2;
+inline void StatusText::clear_text() {
+  text_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
-inline bool ActuatorOutputStatusResponse::has_actuator_output_status() const {
-  return _internal_has_actuator_output_status();
+inline const std::string& StatusText::text() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.StatusText.text)
+  return _internal_text();
 }
-inline void ActuatorOutputStatusResponse::clear_actuator_output_status() {
-  if (GetArenaNoVirtual() == nullptr && actuator_output_status_ != nullptr) {
-    delete actuator_output_status_;
-  }
-  actuator_output_status_ = nullptr;
+inline void StatusText::set_text(const std::string& value) {
+  _internal_set_text(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.StatusText.text)
 }
-inline const ::mavsdk::rpc::telemetry::ActuatorOutputStatus& ActuatorOutputStatusResponse::_internal_actuator_output_status() const {
-  const ::mavsdk::rpc::telemetry::ActuatorOutputStatus* p = actuator_output_status_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::ActuatorOutputStatus*>(
-      &::mavsdk::rpc::telemetry::_ActuatorOutputStatus_default_instance_);
+inline std::string* StatusText::mutable_text() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.StatusText.text)
+  return _internal_mutable_text();
 }
-inline const ::mavsdk::rpc::telemetry::ActuatorOutputStatus& ActuatorOutputStatusResponse::actuator_output_status() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorOutputStatusResponse.actuator_output_status)
-  return _internal_actuator_output_status();
+inline const std::string& StatusText::_internal_text() const {
+  return text_.GetNoArena();
 }
-inline ::mavsdk::rpc::telemetry::ActuatorOutputStatus* ActuatorOutputStatusResponse::release_actuator_output_status() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.ActuatorOutputStatusResponse.actuator_output_status)
+inline void StatusText::_internal_set_text(const std::string& value) {
   
-  ::mavsdk::rpc::telemetry::ActuatorOutputStatus* temp = actuator_output_status_;
-  actuator_output_status_ = nullptr;
-  return temp;
+  text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
 }
-inline ::mavsdk::rpc::telemetry::ActuatorOutputStatus* ActuatorOutputStatusResponse::_internal_mutable_actuator_output_status() {
+inline void StatusText::set_text(std::string&& value) {
   
-  if (actuator_output_status_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::ActuatorOutputStatus>(GetArenaNoVirtual());
-    actuator_output_status_ = p;
-  }
-  return actuator_output_status_;
+  text_.SetNoArena(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:mavsdk.rpc.telemetry.StatusText.text)
 }
-inline ::mavsdk::rpc::telemetry::ActuatorOutputStatus* ActuatorOutputStatusResponse::mutable_actuator_output_status() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.ActuatorOutputStatusResponse.actuator_output_status)
-  return _internal_mutable_actuator_output_status();
+inline void StatusText::set_text(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:mavsdk.rpc.telemetry.StatusText.text)
 }
-inline void ActuatorOutputStatusResponse::set_allocated_actuator_output_status(::mavsdk::rpc::telemetry::ActuatorOutputStatus* actuator_output_status) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete actuator_output_status_;
-  }
-  if (actuator_output_status) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      actuator_output_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, actuator_output_status, submessage_arena);
-    }
+inline void StatusText::set_text(const char* value, size_t size) {
+  
+  text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:mavsdk.rpc.telemetry.StatusText.text)
+}
+inline std::string* StatusText::_internal_mutable_text() {
+  
+  return text_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline std::string* StatusText::release_text() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.StatusText.text)
+  
+  return text_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+inline void StatusText::set_allocated_text(std::string* text) {
+  if (text != nullptr) {
     
   } else {
     
   }
-  actuator_output_status_ = actuator_output_status;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.ActuatorOutputStatusResponse.actuator_output_status)
+  text_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), text);
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.StatusText.text)
 }
 
 // -------------------------------------------------------------------
 
-// SubscribeOdometryRequest
-
-// -------------------------------------------------------------------
-
-// OdometryResponse
+// ActuatorControlTarget
 
-// .mavsdk.rpc.telemetry.Odometry odometry = 1;
-inline bool OdometryResponse::_internal_has_odometry() const {
-  return this != internal_default_instance() && odometry_ != nullptr;
+// int32 group = 1;
+inline void ActuatorControlTarget::clear_group() {
+  group_ = 0;
 }
-inline bool OdometryResponse::has_odometry() const {
-  return _internal_has_odometry();
+inline ::PROTOBUF_NAMESPACE_ID::int32 ActuatorControlTarget::_internal_group() const {
+  return group_;
 }
-inline void OdometryResponse::clear_odometry() {
-  if (GetArenaNoVirtual() == nullptr && odometry_ != nullptr) {
-    delete odometry_;
-  }
-  odometry_ = nullptr;
+inline ::PROTOBUF_NAMESPACE_ID::int32 ActuatorControlTarget::group() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorControlTarget.group)
+  return _internal_group();
 }
-inline const ::mavsdk::rpc::telemetry::Odometry& OdometryResponse::_internal_odometry() const {
-  const ::mavsdk::rpc::telemetry::Odometry* p = odometry_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Odometry*>(
-      &::mavsdk::rpc::telemetry::_Odometry_default_instance_);
+inline void ActuatorControlTarget::_internal_set_group(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  group_ = value;
 }
-inline const ::mavsdk::rpc::telemetry::Odometry& OdometryResponse::odometry() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.OdometryResponse.odometry)
-  return _internal_odometry();
+inline void ActuatorControlTarget::set_group(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_group(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ActuatorControlTarget.group)
 }
-inline ::mavsdk::rpc::telemetry::Odometry* OdometryResponse::release_odometry() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.OdometryResponse.odometry)
-  
-  ::mavsdk::rpc::telemetry::Odometry* temp = odometry_;
-  odometry_ = nullptr;
-  return temp;
+
+// repeated float controls = 2;
+inline int ActuatorControlTarget::_internal_controls_size() const {
+  return controls_.size();
 }
-inline ::mavsdk::rpc::telemetry::Odometry* OdometryResponse::_internal_mutable_odometry() {
-  
-  if (odometry_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Odometry>(GetArenaNoVirtual());
-    odometry_ = p;
-  }
-  return odometry_;
+inline int ActuatorControlTarget::controls_size() const {
+  return _internal_controls_size();
 }
-inline ::mavsdk::rpc::telemetry::Odometry* OdometryResponse::mutable_odometry() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.OdometryResponse.odometry)
-  return _internal_mutable_odometry();
+inline void ActuatorControlTarget::clear_controls() {
+  controls_.Clear();
 }
-inline void OdometryResponse::set_allocated_odometry(::mavsdk::rpc::telemetry::Odometry* odometry) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == nullptr) {
-    delete odometry_;
-  }
-  if (odometry) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
-    if (message_arena != submessage_arena) {
-      odometry = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, odometry, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  odometry_ = odometry;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.OdometryResponse.odometry)
+inline float ActuatorControlTarget::_internal_controls(int index) const {
+  return controls_.Get(index);
 }
-
-// -------------------------------------------------------------------
-
-// Position
-
-// double latitude_deg = 1;
-inline void Position::clear_latitude_deg() {
-  latitude_deg_ = 0;
+inline float ActuatorControlTarget::controls(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
+  return _internal_controls(index);
 }
-inline double Position::_internal_latitude_deg() const {
-  return latitude_deg_;
+inline void ActuatorControlTarget::set_controls(int index, float value) {
+  controls_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
 }
-inline double Position::latitude_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Position.latitude_deg)
-  return _internal_latitude_deg();
+inline void ActuatorControlTarget::_internal_add_controls(float value) {
+  controls_.Add(value);
 }
-inline void Position::_internal_set_latitude_deg(double value) {
-  
-  latitude_deg_ = value;
+inline void ActuatorControlTarget::add_controls(float value) {
+  _internal_add_controls(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
 }
-inline void Position::set_latitude_deg(double value) {
-  _internal_set_latitude_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Position.latitude_deg)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+ActuatorControlTarget::_internal_controls() const {
+  return controls_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+ActuatorControlTarget::controls() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
+  return _internal_controls();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+ActuatorControlTarget::_internal_mutable_controls() {
+  return &controls_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+ActuatorControlTarget::mutable_controls() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
+  return _internal_mutable_controls();
 }
 
-// double longitude_deg = 2;
-inline void Position::clear_longitude_deg() {
-  longitude_deg_ = 0;
+// -------------------------------------------------------------------
+
+// ActuatorOutputStatus
+
+// uint32 active = 1;
+inline void ActuatorOutputStatus::clear_active() {
+  active_ = 0u;
 }
-inline double Position::_internal_longitude_deg() const {
-  return longitude_deg_;
+inline ::PROTOBUF_NAMESPACE_ID::uint32 ActuatorOutputStatus::_internal_active() const {
+  return active_;
 }
-inline double Position::longitude_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Position.longitude_deg)
-  return _internal_longitude_deg();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 ActuatorOutputStatus::active() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorOutputStatus.active)
+  return _internal_active();
 }
-inline void Position::_internal_set_longitude_deg(double value) {
+inline void ActuatorOutputStatus::_internal_set_active(::PROTOBUF_NAMESPACE_ID::uint32 value) {
   
-  longitude_deg_ = value;
+  active_ = value;
 }
-inline void Position::set_longitude_deg(double value) {
-  _internal_set_longitude_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Position.longitude_deg)
+inline void ActuatorOutputStatus::set_active(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_active(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ActuatorOutputStatus.active)
 }
 
-// float absolute_altitude_m = 3;
-inline void Position::clear_absolute_altitude_m() {
-  absolute_altitude_m_ = 0;
+// repeated float actuator = 2;
+inline int ActuatorOutputStatus::_internal_actuator_size() const {
+  return actuator_.size();
 }
-inline float Position::_internal_absolute_altitude_m() const {
-  return absolute_altitude_m_;
+inline int ActuatorOutputStatus::actuator_size() const {
+  return _internal_actuator_size();
 }
-inline float Position::absolute_altitude_m() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Position.absolute_altitude_m)
-  return _internal_absolute_altitude_m();
+inline void ActuatorOutputStatus::clear_actuator() {
+  actuator_.Clear();
 }
-inline void Position::_internal_set_absolute_altitude_m(float value) {
-  
-  absolute_altitude_m_ = value;
+inline float ActuatorOutputStatus::_internal_actuator(int index) const {
+  return actuator_.Get(index);
 }
-inline void Position::set_absolute_altitude_m(float value) {
-  _internal_set_absolute_altitude_m(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Position.absolute_altitude_m)
+inline float ActuatorOutputStatus::actuator(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
+  return _internal_actuator(index);
 }
-
-// float relative_altitude_m = 4;
-inline void Position::clear_relative_altitude_m() {
-  relative_altitude_m_ = 0;
+inline void ActuatorOutputStatus::set_actuator(int index, float value) {
+  actuator_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
 }
-inline float Position::_internal_relative_altitude_m() const {
-  return relative_altitude_m_;
+inline void ActuatorOutputStatus::_internal_add_actuator(float value) {
+  actuator_.Add(value);
 }
-inline float Position::relative_altitude_m() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Position.relative_altitude_m)
-  return _internal_relative_altitude_m();
+inline void ActuatorOutputStatus::add_actuator(float value) {
+  _internal_add_actuator(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
 }
-inline void Position::_internal_set_relative_altitude_m(float value) {
-  
-  relative_altitude_m_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+ActuatorOutputStatus::_internal_actuator() const {
+  return actuator_;
 }
-inline void Position::set_relative_altitude_m(float value) {
-  _internal_set_relative_altitude_m(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Position.relative_altitude_m)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+ActuatorOutputStatus::actuator() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
+  return _internal_actuator();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+ActuatorOutputStatus::_internal_mutable_actuator() {
+  return &actuator_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+ActuatorOutputStatus::mutable_actuator() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
+  return _internal_mutable_actuator();
 }
 
 // -------------------------------------------------------------------
 
-// Quaternion
+// Odometry
 
-// float w = 1;
-inline void Quaternion::clear_w() {
-  w_ = 0;
+// uint64 time_usec = 1;
+inline void Odometry::clear_time_usec() {
+  time_usec_ = PROTOBUF_ULONGLONG(0);
 }
-inline float Quaternion::_internal_w() const {
-  return w_;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Odometry::_internal_time_usec() const {
+  return time_usec_;
 }
-inline float Quaternion::w() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Quaternion.w)
-  return _internal_w();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Odometry::time_usec() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.time_usec)
+  return _internal_time_usec();
 }
-inline void Quaternion::_internal_set_w(float value) {
+inline void Odometry::_internal_set_time_usec(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  w_ = value;
+  time_usec_ = value;
 }
-inline void Quaternion::set_w(float value) {
-  _internal_set_w(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Quaternion.w)
+inline void Odometry::set_time_usec(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_time_usec(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Odometry.time_usec)
 }
 
-// float x = 2;
-inline void Quaternion::clear_x() {
-  x_ = 0;
+// .mavsdk.rpc.telemetry.Odometry.MavFrame frame_id = 2;
+inline void Odometry::clear_frame_id() {
+  frame_id_ = 0;
 }
-inline float Quaternion::_internal_x() const {
-  return x_;
+inline ::mavsdk::rpc::telemetry::Odometry_MavFrame Odometry::_internal_frame_id() const {
+  return static_cast< ::mavsdk::rpc::telemetry::Odometry_MavFrame >(frame_id_);
 }
-inline float Quaternion::x() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Quaternion.x)
-  return _internal_x();
+inline ::mavsdk::rpc::telemetry::Odometry_MavFrame Odometry::frame_id() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.frame_id)
+  return _internal_frame_id();
 }
-inline void Quaternion::_internal_set_x(float value) {
+inline void Odometry::_internal_set_frame_id(::mavsdk::rpc::telemetry::Odometry_MavFrame value) {
   
-  x_ = value;
+  frame_id_ = value;
 }
-inline void Quaternion::set_x(float value) {
-  _internal_set_x(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Quaternion.x)
+inline void Odometry::set_frame_id(::mavsdk::rpc::telemetry::Odometry_MavFrame value) {
+  _internal_set_frame_id(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Odometry.frame_id)
 }
 
-// float y = 3;
-inline void Quaternion::clear_y() {
-  y_ = 0;
+// .mavsdk.rpc.telemetry.Odometry.MavFrame child_frame_id = 3;
+inline void Odometry::clear_child_frame_id() {
+  child_frame_id_ = 0;
 }
-inline float Quaternion::_internal_y() const {
-  return y_;
+inline ::mavsdk::rpc::telemetry::Odometry_MavFrame Odometry::_internal_child_frame_id() const {
+  return static_cast< ::mavsdk::rpc::telemetry::Odometry_MavFrame >(child_frame_id_);
 }
-inline float Quaternion::y() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Quaternion.y)
-  return _internal_y();
+inline ::mavsdk::rpc::telemetry::Odometry_MavFrame Odometry::child_frame_id() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.child_frame_id)
+  return _internal_child_frame_id();
 }
-inline void Quaternion::_internal_set_y(float value) {
+inline void Odometry::_internal_set_child_frame_id(::mavsdk::rpc::telemetry::Odometry_MavFrame value) {
   
-  y_ = value;
+  child_frame_id_ = value;
 }
-inline void Quaternion::set_y(float value) {
-  _internal_set_y(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Quaternion.y)
+inline void Odometry::set_child_frame_id(::mavsdk::rpc::telemetry::Odometry_MavFrame value) {
+  _internal_set_child_frame_id(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Odometry.child_frame_id)
 }
 
-// float z = 4;
-inline void Quaternion::clear_z() {
-  z_ = 0;
-}
-inline float Quaternion::_internal_z() const {
-  return z_;
-}
-inline float Quaternion::z() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Quaternion.z)
-  return _internal_z();
-}
-inline void Quaternion::_internal_set_z(float value) {
-  
-  z_ = value;
+// .mavsdk.rpc.telemetry.PositionBody position_body = 4;
+inline bool Odometry::_internal_has_position_body() const {
+  return this != internal_default_instance() && position_body_ != nullptr;
 }
-inline void Quaternion::set_z(float value) {
-  _internal_set_z(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Quaternion.z)
+inline bool Odometry::has_position_body() const {
+  return _internal_has_position_body();
 }
-
-// -------------------------------------------------------------------
-
-// EulerAngle
-
-// float roll_deg = 1;
-inline void EulerAngle::clear_roll_deg() {
-  roll_deg_ = 0;
+inline void Odometry::clear_position_body() {
+  if (GetArenaNoVirtual() == nullptr && position_body_ != nullptr) {
+    delete position_body_;
+  }
+  position_body_ = nullptr;
 }
-inline float EulerAngle::_internal_roll_deg() const {
-  return roll_deg_;
+inline const ::mavsdk::rpc::telemetry::PositionBody& Odometry::_internal_position_body() const {
+  const ::mavsdk::rpc::telemetry::PositionBody* p = position_body_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::PositionBody*>(
+      &::mavsdk::rpc::telemetry::_PositionBody_default_instance_);
 }
-inline float EulerAngle::roll_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.EulerAngle.roll_deg)
-  return _internal_roll_deg();
+inline const ::mavsdk::rpc::telemetry::PositionBody& Odometry::position_body() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.position_body)
+  return _internal_position_body();
 }
-inline void EulerAngle::_internal_set_roll_deg(float value) {
+inline ::mavsdk::rpc::telemetry::PositionBody* Odometry::release_position_body() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.position_body)
   
-  roll_deg_ = value;
-}
-inline void EulerAngle::set_roll_deg(float value) {
-  _internal_set_roll_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.EulerAngle.roll_deg)
-}
-
-// float pitch_deg = 2;
-inline void EulerAngle::clear_pitch_deg() {
-  pitch_deg_ = 0;
-}
-inline float EulerAngle::_internal_pitch_deg() const {
-  return pitch_deg_;
-}
-inline float EulerAngle::pitch_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.EulerAngle.pitch_deg)
-  return _internal_pitch_deg();
+  ::mavsdk::rpc::telemetry::PositionBody* temp = position_body_;
+  position_body_ = nullptr;
+  return temp;
 }
-inline void EulerAngle::_internal_set_pitch_deg(float value) {
+inline ::mavsdk::rpc::telemetry::PositionBody* Odometry::_internal_mutable_position_body() {
   
-  pitch_deg_ = value;
+  if (position_body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::PositionBody>(GetArenaNoVirtual());
+    position_body_ = p;
+  }
+  return position_body_;
 }
-inline void EulerAngle::set_pitch_deg(float value) {
-  _internal_set_pitch_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.EulerAngle.pitch_deg)
+inline ::mavsdk::rpc::telemetry::PositionBody* Odometry::mutable_position_body() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.position_body)
+  return _internal_mutable_position_body();
+}
+inline void Odometry::set_allocated_position_body(::mavsdk::rpc::telemetry::PositionBody* position_body) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete position_body_;
+  }
+  if (position_body) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      position_body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position_body, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  position_body_ = position_body;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.position_body)
 }
 
-// float yaw_deg = 3;
-inline void EulerAngle::clear_yaw_deg() {
-  yaw_deg_ = 0;
-}
-inline float EulerAngle::_internal_yaw_deg() const {
-  return yaw_deg_;
-}
-inline float EulerAngle::yaw_deg() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.EulerAngle.yaw_deg)
-  return _internal_yaw_deg();
-}
-inline void EulerAngle::_internal_set_yaw_deg(float value) {
-  
-  yaw_deg_ = value;
+// .mavsdk.rpc.telemetry.Quaternion q = 5;
+inline bool Odometry::_internal_has_q() const {
+  return this != internal_default_instance() && q_ != nullptr;
 }
-inline void EulerAngle::set_yaw_deg(float value) {
-  _internal_set_yaw_deg(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.EulerAngle.yaw_deg)
+inline bool Odometry::has_q() const {
+  return _internal_has_q();
 }
-
-// -------------------------------------------------------------------
-
-// AngularVelocityBody
-
-// float roll_rad_s = 1;
-inline void AngularVelocityBody::clear_roll_rad_s() {
-  roll_rad_s_ = 0;
+inline void Odometry::clear_q() {
+  if (GetArenaNoVirtual() == nullptr && q_ != nullptr) {
+    delete q_;
+  }
+  q_ = nullptr;
 }
-inline float AngularVelocityBody::_internal_roll_rad_s() const {
-  return roll_rad_s_;
+inline const ::mavsdk::rpc::telemetry::Quaternion& Odometry::_internal_q() const {
+  const ::mavsdk::rpc::telemetry::Quaternion* p = q_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Quaternion*>(
+      &::mavsdk::rpc::telemetry::_Quaternion_default_instance_);
 }
-inline float AngularVelocityBody::roll_rad_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AngularVelocityBody.roll_rad_s)
-  return _internal_roll_rad_s();
+inline const ::mavsdk::rpc::telemetry::Quaternion& Odometry::q() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.q)
+  return _internal_q();
 }
-inline void AngularVelocityBody::_internal_set_roll_rad_s(float value) {
+inline ::mavsdk::rpc::telemetry::Quaternion* Odometry::release_q() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.q)
   
-  roll_rad_s_ = value;
+  ::mavsdk::rpc::telemetry::Quaternion* temp = q_;
+  q_ = nullptr;
+  return temp;
 }
-inline void AngularVelocityBody::set_roll_rad_s(float value) {
-  _internal_set_roll_rad_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.AngularVelocityBody.roll_rad_s)
+inline ::mavsdk::rpc::telemetry::Quaternion* Odometry::_internal_mutable_q() {
+  
+  if (q_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Quaternion>(GetArenaNoVirtual());
+    q_ = p;
+  }
+  return q_;
 }
-
-// float pitch_rad_s = 2;
-inline void AngularVelocityBody::clear_pitch_rad_s() {
-  pitch_rad_s_ = 0;
+inline ::mavsdk::rpc::telemetry::Quaternion* Odometry::mutable_q() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.q)
+  return _internal_mutable_q();
 }
-inline float AngularVelocityBody::_internal_pitch_rad_s() const {
-  return pitch_rad_s_;
+inline void Odometry::set_allocated_q(::mavsdk::rpc::telemetry::Quaternion* q) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete q_;
+  }
+  if (q) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      q = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, q, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  q_ = q;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.q)
 }
-inline float AngularVelocityBody::pitch_rad_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AngularVelocityBody.pitch_rad_s)
-  return _internal_pitch_rad_s();
+
+// .mavsdk.rpc.telemetry.SpeedBody speed_body = 6;
+inline bool Odometry::_internal_has_speed_body() const {
+  return this != internal_default_instance() && speed_body_ != nullptr;
 }
-inline void AngularVelocityBody::_internal_set_pitch_rad_s(float value) {
-  
-  pitch_rad_s_ = value;
+inline bool Odometry::has_speed_body() const {
+  return _internal_has_speed_body();
 }
-inline void AngularVelocityBody::set_pitch_rad_s(float value) {
-  _internal_set_pitch_rad_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.AngularVelocityBody.pitch_rad_s)
+inline void Odometry::clear_speed_body() {
+  if (GetArenaNoVirtual() == nullptr && speed_body_ != nullptr) {
+    delete speed_body_;
+  }
+  speed_body_ = nullptr;
 }
-
-// float yaw_rad_s = 3;
-inline void AngularVelocityBody::clear_yaw_rad_s() {
-  yaw_rad_s_ = 0;
+inline const ::mavsdk::rpc::telemetry::SpeedBody& Odometry::_internal_speed_body() const {
+  const ::mavsdk::rpc::telemetry::SpeedBody* p = speed_body_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::SpeedBody*>(
+      &::mavsdk::rpc::telemetry::_SpeedBody_default_instance_);
 }
-inline float AngularVelocityBody::_internal_yaw_rad_s() const {
-  return yaw_rad_s_;
+inline const ::mavsdk::rpc::telemetry::SpeedBody& Odometry::speed_body() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.speed_body)
+  return _internal_speed_body();
 }
-inline float AngularVelocityBody::yaw_rad_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.AngularVelocityBody.yaw_rad_s)
-  return _internal_yaw_rad_s();
+inline ::mavsdk::rpc::telemetry::SpeedBody* Odometry::release_speed_body() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.speed_body)
+  
+  ::mavsdk::rpc::telemetry::SpeedBody* temp = speed_body_;
+  speed_body_ = nullptr;
+  return temp;
 }
-inline void AngularVelocityBody::_internal_set_yaw_rad_s(float value) {
+inline ::mavsdk::rpc::telemetry::SpeedBody* Odometry::_internal_mutable_speed_body() {
   
-  yaw_rad_s_ = value;
+  if (speed_body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::SpeedBody>(GetArenaNoVirtual());
+    speed_body_ = p;
+  }
+  return speed_body_;
 }
-inline void AngularVelocityBody::set_yaw_rad_s(float value) {
-  _internal_set_yaw_rad_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.AngularVelocityBody.yaw_rad_s)
+inline ::mavsdk::rpc::telemetry::SpeedBody* Odometry::mutable_speed_body() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.speed_body)
+  return _internal_mutable_speed_body();
+}
+inline void Odometry::set_allocated_speed_body(::mavsdk::rpc::telemetry::SpeedBody* speed_body) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete speed_body_;
+  }
+  if (speed_body) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      speed_body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, speed_body, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  speed_body_ = speed_body;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.speed_body)
 }
 
-// -------------------------------------------------------------------
-
-// SpeedNed
-
-// float velocity_north_m_s = 1;
-inline void SpeedNed::clear_velocity_north_m_s() {
-  velocity_north_m_s_ = 0;
+// .mavsdk.rpc.telemetry.AngularVelocityBody angular_velocity_body = 7;
+inline bool Odometry::_internal_has_angular_velocity_body() const {
+  return this != internal_default_instance() && angular_velocity_body_ != nullptr;
 }
-inline float SpeedNed::_internal_velocity_north_m_s() const {
-  return velocity_north_m_s_;
+inline bool Odometry::has_angular_velocity_body() const {
+  return _internal_has_angular_velocity_body();
 }
-inline float SpeedNed::velocity_north_m_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedNed.velocity_north_m_s)
-  return _internal_velocity_north_m_s();
+inline void Odometry::clear_angular_velocity_body() {
+  if (GetArenaNoVirtual() == nullptr && angular_velocity_body_ != nullptr) {
+    delete angular_velocity_body_;
+  }
+  angular_velocity_body_ = nullptr;
 }
-inline void SpeedNed::_internal_set_velocity_north_m_s(float value) {
-  
-  velocity_north_m_s_ = value;
+inline const ::mavsdk::rpc::telemetry::AngularVelocityBody& Odometry::_internal_angular_velocity_body() const {
+  const ::mavsdk::rpc::telemetry::AngularVelocityBody* p = angular_velocity_body_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::AngularVelocityBody*>(
+      &::mavsdk::rpc::telemetry::_AngularVelocityBody_default_instance_);
 }
-inline void SpeedNed::set_velocity_north_m_s(float value) {
-  _internal_set_velocity_north_m_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedNed.velocity_north_m_s)
+inline const ::mavsdk::rpc::telemetry::AngularVelocityBody& Odometry::angular_velocity_body() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.angular_velocity_body)
+  return _internal_angular_velocity_body();
 }
-
-// float velocity_east_m_s = 2;
-inline void SpeedNed::clear_velocity_east_m_s() {
-  velocity_east_m_s_ = 0;
+inline ::mavsdk::rpc::telemetry::AngularVelocityBody* Odometry::release_angular_velocity_body() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.angular_velocity_body)
+  
+  ::mavsdk::rpc::telemetry::AngularVelocityBody* temp = angular_velocity_body_;
+  angular_velocity_body_ = nullptr;
+  return temp;
 }
-inline float SpeedNed::_internal_velocity_east_m_s() const {
-  return velocity_east_m_s_;
+inline ::mavsdk::rpc::telemetry::AngularVelocityBody* Odometry::_internal_mutable_angular_velocity_body() {
+  
+  if (angular_velocity_body_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::AngularVelocityBody>(GetArenaNoVirtual());
+    angular_velocity_body_ = p;
+  }
+  return angular_velocity_body_;
 }
-inline float SpeedNed::velocity_east_m_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedNed.velocity_east_m_s)
-  return _internal_velocity_east_m_s();
+inline ::mavsdk::rpc::telemetry::AngularVelocityBody* Odometry::mutable_angular_velocity_body() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.angular_velocity_body)
+  return _internal_mutable_angular_velocity_body();
 }
-inline void SpeedNed::_internal_set_velocity_east_m_s(float value) {
-  
-  velocity_east_m_s_ = value;
+inline void Odometry::set_allocated_angular_velocity_body(::mavsdk::rpc::telemetry::AngularVelocityBody* angular_velocity_body) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete angular_velocity_body_;
+  }
+  if (angular_velocity_body) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      angular_velocity_body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, angular_velocity_body, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  angular_velocity_body_ = angular_velocity_body;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.angular_velocity_body)
 }
-inline void SpeedNed::set_velocity_east_m_s(float value) {
-  _internal_set_velocity_east_m_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedNed.velocity_east_m_s)
+
+// .mavsdk.rpc.telemetry.Covariance pose_covariance = 8;
+inline bool Odometry::_internal_has_pose_covariance() const {
+  return this != internal_default_instance() && pose_covariance_ != nullptr;
+}
+inline bool Odometry::has_pose_covariance() const {
+  return _internal_has_pose_covariance();
 }
-
-// float velocity_down_m_s = 3;
-inline void SpeedNed::clear_velocity_down_m_s() {
-  velocity_down_m_s_ = 0;
+inline void Odometry::clear_pose_covariance() {
+  if (GetArenaNoVirtual() == nullptr && pose_covariance_ != nullptr) {
+    delete pose_covariance_;
+  }
+  pose_covariance_ = nullptr;
 }
-inline float SpeedNed::_internal_velocity_down_m_s() const {
-  return velocity_down_m_s_;
+inline const ::mavsdk::rpc::telemetry::Covariance& Odometry::_internal_pose_covariance() const {
+  const ::mavsdk::rpc::telemetry::Covariance* p = pose_covariance_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Covariance*>(
+      &::mavsdk::rpc::telemetry::_Covariance_default_instance_);
 }
-inline float SpeedNed::velocity_down_m_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedNed.velocity_down_m_s)
-  return _internal_velocity_down_m_s();
+inline const ::mavsdk::rpc::telemetry::Covariance& Odometry::pose_covariance() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.pose_covariance)
+  return _internal_pose_covariance();
 }
-inline void SpeedNed::_internal_set_velocity_down_m_s(float value) {
+inline ::mavsdk::rpc::telemetry::Covariance* Odometry::release_pose_covariance() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.pose_covariance)
   
-  velocity_down_m_s_ = value;
+  ::mavsdk::rpc::telemetry::Covariance* temp = pose_covariance_;
+  pose_covariance_ = nullptr;
+  return temp;
 }
-inline void SpeedNed::set_velocity_down_m_s(float value) {
-  _internal_set_velocity_down_m_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedNed.velocity_down_m_s)
+inline ::mavsdk::rpc::telemetry::Covariance* Odometry::_internal_mutable_pose_covariance() {
+  
+  if (pose_covariance_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Covariance>(GetArenaNoVirtual());
+    pose_covariance_ = p;
+  }
+  return pose_covariance_;
 }
-
-// -------------------------------------------------------------------
-
-// GpsInfo
-
-// int32 num_satellites = 1;
-inline void GpsInfo::clear_num_satellites() {
-  num_satellites_ = 0;
+inline ::mavsdk::rpc::telemetry::Covariance* Odometry::mutable_pose_covariance() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.pose_covariance)
+  return _internal_mutable_pose_covariance();
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GpsInfo::_internal_num_satellites() const {
-  return num_satellites_;
+inline void Odometry::set_allocated_pose_covariance(::mavsdk::rpc::telemetry::Covariance* pose_covariance) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete pose_covariance_;
+  }
+  if (pose_covariance) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      pose_covariance = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pose_covariance, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  pose_covariance_ = pose_covariance;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.pose_covariance)
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 GpsInfo::num_satellites() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GpsInfo.num_satellites)
-  return _internal_num_satellites();
+
+// .mavsdk.rpc.telemetry.Covariance velocity_covariance = 9;
+inline bool Odometry::_internal_has_velocity_covariance() const {
+  return this != internal_default_instance() && velocity_covariance_ != nullptr;
 }
-inline void GpsInfo::_internal_set_num_satellites(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  num_satellites_ = value;
+inline bool Odometry::has_velocity_covariance() const {
+  return _internal_has_velocity_covariance();
 }
-inline void GpsInfo::set_num_satellites(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_num_satellites(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.GpsInfo.num_satellites)
+inline void Odometry::clear_velocity_covariance() {
+  if (GetArenaNoVirtual() == nullptr && velocity_covariance_ != nullptr) {
+    delete velocity_covariance_;
+  }
+  velocity_covariance_ = nullptr;
 }
-
-// .mavsdk.rpc.telemetry.FixType fix_type = 2;
-inline void GpsInfo::clear_fix_type() {
-  fix_type_ = 0;
+inline const ::mavsdk::rpc::telemetry::Covariance& Odometry::_internal_velocity_covariance() const {
+  const ::mavsdk::rpc::telemetry::Covariance* p = velocity_covariance_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Covariance*>(
+      &::mavsdk::rpc::telemetry::_Covariance_default_instance_);
 }
-inline ::mavsdk::rpc::telemetry::FixType GpsInfo::_internal_fix_type() const {
-  return static_cast< ::mavsdk::rpc::telemetry::FixType >(fix_type_);
+inline const ::mavsdk::rpc::telemetry::Covariance& Odometry::velocity_covariance() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.velocity_covariance)
+  return _internal_velocity_covariance();
 }
-inline ::mavsdk::rpc::telemetry::FixType GpsInfo::fix_type() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GpsInfo.fix_type)
-  return _internal_fix_type();
+inline ::mavsdk::rpc::telemetry::Covariance* Odometry::release_velocity_covariance() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.velocity_covariance)
+  
+  ::mavsdk::rpc::telemetry::Covariance* temp = velocity_covariance_;
+  velocity_covariance_ = nullptr;
+  return temp;
 }
-inline void GpsInfo::_internal_set_fix_type(::mavsdk::rpc::telemetry::FixType value) {
+inline ::mavsdk::rpc::telemetry::Covariance* Odometry::_internal_mutable_velocity_covariance() {
   
-  fix_type_ = value;
+  if (velocity_covariance_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Covariance>(GetArenaNoVirtual());
+    velocity_covariance_ = p;
+  }
+  return velocity_covariance_;
 }
-inline void GpsInfo::set_fix_type(::mavsdk::rpc::telemetry::FixType value) {
-  _internal_set_fix_type(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.GpsInfo.fix_type)
+inline ::mavsdk::rpc::telemetry::Covariance* Odometry::mutable_velocity_covariance() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.velocity_covariance)
+  return _internal_mutable_velocity_covariance();
+}
+inline void Odometry::set_allocated_velocity_covariance(::mavsdk::rpc::telemetry::Covariance* velocity_covariance) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete velocity_covariance_;
+  }
+  if (velocity_covariance) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      velocity_covariance = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, velocity_covariance, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  velocity_covariance_ = velocity_covariance;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.velocity_covariance)
 }
 
 // -------------------------------------------------------------------
 
-// Battery
+// Covariance
 
-// float voltage_v = 1;
-inline void Battery::clear_voltage_v() {
-  voltage_v_ = 0;
+// repeated float covariance_matrix = 1;
+inline int Covariance::_internal_covariance_matrix_size() const {
+  return covariance_matrix_.size();
 }
-inline float Battery::_internal_voltage_v() const {
-  return voltage_v_;
+inline int Covariance::covariance_matrix_size() const {
+  return _internal_covariance_matrix_size();
 }
-inline float Battery::voltage_v() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Battery.voltage_v)
-  return _internal_voltage_v();
+inline void Covariance::clear_covariance_matrix() {
+  covariance_matrix_.Clear();
 }
-inline void Battery::_internal_set_voltage_v(float value) {
-  
-  voltage_v_ = value;
+inline float Covariance::_internal_covariance_matrix(int index) const {
+  return covariance_matrix_.Get(index);
 }
-inline void Battery::set_voltage_v(float value) {
-  _internal_set_voltage_v(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Battery.voltage_v)
+inline float Covariance::covariance_matrix(int index) const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
+  return _internal_covariance_matrix(index);
 }
-
-// float remaining_percent = 2;
-inline void Battery::clear_remaining_percent() {
-  remaining_percent_ = 0;
+inline void Covariance::set_covariance_matrix(int index, float value) {
+  covariance_matrix_.Set(index, value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
 }
-inline float Battery::_internal_remaining_percent() const {
-  return remaining_percent_;
+inline void Covariance::_internal_add_covariance_matrix(float value) {
+  covariance_matrix_.Add(value);
 }
-inline float Battery::remaining_percent() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Battery.remaining_percent)
-  return _internal_remaining_percent();
+inline void Covariance::add_covariance_matrix(float value) {
+  _internal_add_covariance_matrix(value);
+  // @@protoc_insertion_point(field_add:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
 }
-inline void Battery::_internal_set_remaining_percent(float value) {
-  
-  remaining_percent_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Covariance::_internal_covariance_matrix() const {
+  return covariance_matrix_;
 }
-inline void Battery::set_remaining_percent(float value) {
-  _internal_set_remaining_percent(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Battery.remaining_percent)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+Covariance::covariance_matrix() const {
+  // @@protoc_insertion_point(field_list:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
+  return _internal_covariance_matrix();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Covariance::_internal_mutable_covariance_matrix() {
+  return &covariance_matrix_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+Covariance::mutable_covariance_matrix() {
+  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
+  return _internal_mutable_covariance_matrix();
 }
 
 // -------------------------------------------------------------------
 
-// Health
-
-// bool is_gyrometer_calibration_ok = 1;
-inline void Health::clear_is_gyrometer_calibration_ok() {
-  is_gyrometer_calibration_ok_ = false;
-}
-inline bool Health::_internal_is_gyrometer_calibration_ok() const {
-  return is_gyrometer_calibration_ok_;
-}
-inline bool Health::is_gyrometer_calibration_ok() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_gyrometer_calibration_ok)
-  return _internal_is_gyrometer_calibration_ok();
-}
-inline void Health::_internal_set_is_gyrometer_calibration_ok(bool value) {
-  
-  is_gyrometer_calibration_ok_ = value;
-}
-inline void Health::set_is_gyrometer_calibration_ok(bool value) {
-  _internal_set_is_gyrometer_calibration_ok(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_gyrometer_calibration_ok)
-}
+// SpeedBody
 
-// bool is_accelerometer_calibration_ok = 2;
-inline void Health::clear_is_accelerometer_calibration_ok() {
-  is_accelerometer_calibration_ok_ = false;
+// float velocity_x_m_s = 1;
+inline void SpeedBody::clear_velocity_x_m_s() {
+  velocity_x_m_s_ = 0;
 }
-inline bool Health::_internal_is_accelerometer_calibration_ok() const {
-  return is_accelerometer_calibration_ok_;
+inline float SpeedBody::_internal_velocity_x_m_s() const {
+  return velocity_x_m_s_;
 }
-inline bool Health::is_accelerometer_calibration_ok() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_accelerometer_calibration_ok)
-  return _internal_is_accelerometer_calibration_ok();
+inline float SpeedBody::velocity_x_m_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedBody.velocity_x_m_s)
+  return _internal_velocity_x_m_s();
 }
-inline void Health::_internal_set_is_accelerometer_calibration_ok(bool value) {
+inline void SpeedBody::_internal_set_velocity_x_m_s(float value) {
   
-  is_accelerometer_calibration_ok_ = value;
-}
-inline void Health::set_is_accelerometer_calibration_ok(bool value) {
-  _internal_set_is_accelerometer_calibration_ok(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_accelerometer_calibration_ok)
+  velocity_x_m_s_ = value;
+}
+inline void SpeedBody::set_velocity_x_m_s(float value) {
+  _internal_set_velocity_x_m_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedBody.velocity_x_m_s)
 }
 
-// bool is_magnetometer_calibration_ok = 3;
-inline void Health::clear_is_magnetometer_calibration_ok() {
-  is_magnetometer_calibration_ok_ = false;
+// float velocity_y_m_s = 2;
+inline void SpeedBody::clear_velocity_y_m_s() {
+  velocity_y_m_s_ = 0;
 }
-inline bool Health::_internal_is_magnetometer_calibration_ok() const {
-  return is_magnetometer_calibration_ok_;
+inline float SpeedBody::_internal_velocity_y_m_s() const {
+  return velocity_y_m_s_;
 }
-inline bool Health::is_magnetometer_calibration_ok() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_magnetometer_calibration_ok)
-  return _internal_is_magnetometer_calibration_ok();
+inline float SpeedBody::velocity_y_m_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedBody.velocity_y_m_s)
+  return _internal_velocity_y_m_s();
 }
-inline void Health::_internal_set_is_magnetometer_calibration_ok(bool value) {
+inline void SpeedBody::_internal_set_velocity_y_m_s(float value) {
   
-  is_magnetometer_calibration_ok_ = value;
+  velocity_y_m_s_ = value;
 }
-inline void Health::set_is_magnetometer_calibration_ok(bool value) {
-  _internal_set_is_magnetometer_calibration_ok(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_magnetometer_calibration_ok)
+inline void SpeedBody::set_velocity_y_m_s(float value) {
+  _internal_set_velocity_y_m_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedBody.velocity_y_m_s)
 }
 
-// bool is_level_calibration_ok = 4;
-inline void Health::clear_is_level_calibration_ok() {
-  is_level_calibration_ok_ = false;
+// float velocity_z_m_s = 3;
+inline void SpeedBody::clear_velocity_z_m_s() {
+  velocity_z_m_s_ = 0;
 }
-inline bool Health::_internal_is_level_calibration_ok() const {
-  return is_level_calibration_ok_;
+inline float SpeedBody::_internal_velocity_z_m_s() const {
+  return velocity_z_m_s_;
 }
-inline bool Health::is_level_calibration_ok() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_level_calibration_ok)
-  return _internal_is_level_calibration_ok();
+inline float SpeedBody::velocity_z_m_s() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedBody.velocity_z_m_s)
+  return _internal_velocity_z_m_s();
 }
-inline void Health::_internal_set_is_level_calibration_ok(bool value) {
+inline void SpeedBody::_internal_set_velocity_z_m_s(float value) {
   
-  is_level_calibration_ok_ = value;
+  velocity_z_m_s_ = value;
 }
-inline void Health::set_is_level_calibration_ok(bool value) {
-  _internal_set_is_level_calibration_ok(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_level_calibration_ok)
+inline void SpeedBody::set_velocity_z_m_s(float value) {
+  _internal_set_velocity_z_m_s(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedBody.velocity_z_m_s)
 }
 
-// bool is_local_position_ok = 5;
-inline void Health::clear_is_local_position_ok() {
-  is_local_position_ok_ = false;
+// -------------------------------------------------------------------
+
+// PositionBody
+
+// float x_m = 1;
+inline void PositionBody::clear_x_m() {
+  x_m_ = 0;
 }
-inline bool Health::_internal_is_local_position_ok() const {
-  return is_local_position_ok_;
+inline float PositionBody::_internal_x_m() const {
+  return x_m_;
 }
-inline bool Health::is_local_position_ok() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_local_position_ok)
-  return _internal_is_local_position_ok();
+inline float PositionBody::x_m() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.PositionBody.x_m)
+  return _internal_x_m();
 }
-inline void Health::_internal_set_is_local_position_ok(bool value) {
+inline void PositionBody::_internal_set_x_m(float value) {
   
-  is_local_position_ok_ = value;
+  x_m_ = value;
 }
-inline void Health::set_is_local_position_ok(bool value) {
-  _internal_set_is_local_position_ok(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_local_position_ok)
+inline void PositionBody::set_x_m(float value) {
+  _internal_set_x_m(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.PositionBody.x_m)
 }
 
-// bool is_global_position_ok = 6;
-inline void Health::clear_is_global_position_ok() {
-  is_global_position_ok_ = false;
+// float y_m = 2;
+inline void PositionBody::clear_y_m() {
+  y_m_ = 0;
 }
-inline bool Health::_internal_is_global_position_ok() const {
-  return is_global_position_ok_;
+inline float PositionBody::_internal_y_m() const {
+  return y_m_;
 }
-inline bool Health::is_global_position_ok() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_global_position_ok)
-  return _internal_is_global_position_ok();
+inline float PositionBody::y_m() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.PositionBody.y_m)
+  return _internal_y_m();
 }
-inline void Health::_internal_set_is_global_position_ok(bool value) {
+inline void PositionBody::_internal_set_y_m(float value) {
   
-  is_global_position_ok_ = value;
+  y_m_ = value;
 }
-inline void Health::set_is_global_position_ok(bool value) {
-  _internal_set_is_global_position_ok(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_global_position_ok)
+inline void PositionBody::set_y_m(float value) {
+  _internal_set_y_m(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.PositionBody.y_m)
 }
 
-// bool is_home_position_ok = 7;
-inline void Health::clear_is_home_position_ok() {
-  is_home_position_ok_ = false;
+// float z_m = 3;
+inline void PositionBody::clear_z_m() {
+  z_m_ = 0;
 }
-inline bool Health::_internal_is_home_position_ok() const {
-  return is_home_position_ok_;
+inline float PositionBody::_internal_z_m() const {
+  return z_m_;
 }
-inline bool Health::is_home_position_ok() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Health.is_home_position_ok)
-  return _internal_is_home_position_ok();
+inline float PositionBody::z_m() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.PositionBody.z_m)
+  return _internal_z_m();
 }
-inline void Health::_internal_set_is_home_position_ok(bool value) {
+inline void PositionBody::_internal_set_z_m(float value) {
   
-  is_home_position_ok_ = value;
+  z_m_ = value;
 }
-inline void Health::set_is_home_position_ok(bool value) {
-  _internal_set_is_home_position_ok(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Health.is_home_position_ok)
+inline void PositionBody::set_z_m(float value) {
+  _internal_set_z_m(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.PositionBody.z_m)
 }
 
 // -------------------------------------------------------------------
 
-// RcStatus
+// GetTelemetrySnapshotRequest
 
-// bool was_available_once = 1;
-inline void RcStatus::clear_was_available_once() {
-  was_available_once_ = false;
+// uint32 fields = 1;
+inline void GetTelemetrySnapshotRequest::clear_fields() {
+  fields_ = 0u;
 }
-inline bool RcStatus::_internal_was_available_once() const {
-  return was_available_once_;
+inline ::PROTOBUF_NAMESPACE_ID::uint32 GetTelemetrySnapshotRequest::_internal_fields() const {
+  return fields_;
 }
-inline bool RcStatus::was_available_once() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.RcStatus.was_available_once)
-  return _internal_was_available_once();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 GetTelemetrySnapshotRequest::fields() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest.fields)
+  return _internal_fields();
 }
-inline void RcStatus::_internal_set_was_available_once(bool value) {
+inline void GetTelemetrySnapshotRequest::_internal_set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value) {
   
-  was_available_once_ = value;
+  fields_ = value;
 }
-inline void RcStatus::set_was_available_once(bool value) {
-  _internal_set_was_available_once(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.RcStatus.was_available_once)
+inline void GetTelemetrySnapshotRequest::set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_fields(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.GetTelemetrySnapshotRequest.fields)
 }
 
-// bool is_available = 2;
-inline void RcStatus::clear_is_available() {
-  is_available_ = false;
-}
-inline bool RcStatus::_internal_is_available() const {
-  return is_available_;
-}
-inline bool RcStatus::is_available() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.RcStatus.is_available)
-  return _internal_is_available();
+// -------------------------------------------------------------------
+
+// GetTelemetrySnapshotResponse
+
+// .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+inline bool GetTelemetrySnapshotResponse::_internal_has_telemetry_snapshot() const {
+  return this != internal_default_instance() && telemetry_snapshot_ != nullptr;
 }
-inline void RcStatus::_internal_set_is_available(bool value) {
-  
-  is_available_ = value;
+inline bool GetTelemetrySnapshotResponse::has_telemetry_snapshot() const {
+  return _internal_has_telemetry_snapshot();
 }
-inline void RcStatus::set_is_available(bool value) {
-  _internal_set_is_available(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.RcStatus.is_available)
+inline void GetTelemetrySnapshotResponse::clear_telemetry_snapshot() {
+  if (GetArenaNoVirtual() == nullptr && telemetry_snapshot_ != nullptr) {
+    delete telemetry_snapshot_;
+  }
+  telemetry_snapshot_ = nullptr;
 }
-
-// float signal_strength_percent = 3;
-inline void RcStatus::clear_signal_strength_percent() {
-  signal_strength_percent_ = 0;
+inline const ::mavsdk::rpc::telemetry::TelemetrySnapshot& GetTelemetrySnapshotResponse::_internal_telemetry_snapshot() const {
+  const ::mavsdk::rpc::telemetry::TelemetrySnapshot* p = telemetry_snapshot_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::TelemetrySnapshot*>(
+      &::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_);
 }
-inline float RcStatus::_internal_signal_strength_percent() const {
-  return signal_strength_percent_;
+inline const ::mavsdk::rpc::telemetry::TelemetrySnapshot& GetTelemetrySnapshotResponse::telemetry_snapshot() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse.telemetry_snapshot)
+  return _internal_telemetry_snapshot();
 }
-inline float RcStatus::signal_strength_percent() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.RcStatus.signal_strength_percent)
-  return _internal_signal_strength_percent();
+inline ::mavsdk::rpc::telemetry::TelemetrySnapshot* GetTelemetrySnapshotResponse::release_telemetry_snapshot() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse.telemetry_snapshot)
+  
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* temp = telemetry_snapshot_;
+  telemetry_snapshot_ = nullptr;
+  return temp;
 }
-inline void RcStatus::_internal_set_signal_strength_percent(float value) {
+inline ::mavsdk::rpc::telemetry::TelemetrySnapshot* GetTelemetrySnapshotResponse::_internal_mutable_telemetry_snapshot() {
   
-  signal_strength_percent_ = value;
+  if (telemetry_snapshot_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::TelemetrySnapshot>(GetArenaNoVirtual());
+    telemetry_snapshot_ = p;
+  }
+  return telemetry_snapshot_;
 }
-inline void RcStatus::set_signal_strength_percent(float value) {
-  _internal_set_signal_strength_percent(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.RcStatus.signal_strength_percent)
+inline ::mavsdk::rpc::telemetry::TelemetrySnapshot* GetTelemetrySnapshotResponse::mutable_telemetry_snapshot() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse.telemetry_snapshot)
+  return _internal_mutable_telemetry_snapshot();
+}
+inline void GetTelemetrySnapshotResponse::set_allocated_telemetry_snapshot(::mavsdk::rpc::telemetry::TelemetrySnapshot* telemetry_snapshot) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete telemetry_snapshot_;
+  }
+  if (telemetry_snapshot) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      telemetry_snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, telemetry_snapshot, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  telemetry_snapshot_ = telemetry_snapshot;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.GetTelemetrySnapshotResponse.telemetry_snapshot)
 }
 
 // -------------------------------------------------------------------
 
-// StatusText
+// SubscribeTelemetrySnapshotRequest
 
-// .mavsdk.rpc.telemetry.StatusText.StatusType type = 1;
-inline void StatusText::clear_type() {
-  type_ = 0;
+// uint32 fields = 1;
+inline void SubscribeTelemetrySnapshotRequest::clear_fields() {
+  fields_ = 0u;
 }
-inline ::mavsdk::rpc::telemetry::StatusText_StatusType StatusText::_internal_type() const {
-  return static_cast< ::mavsdk::rpc::telemetry::StatusText_StatusType >(type_);
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SubscribeTelemetrySnapshotRequest::_internal_fields() const {
+  return fields_;
 }
-inline ::mavsdk::rpc::telemetry::StatusText_StatusType StatusText::type() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.StatusText.type)
-  return _internal_type();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 SubscribeTelemetrySnapshotRequest::fields() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest.fields)
+  return _internal_fields();
 }
-inline void StatusText::_internal_set_type(::mavsdk::rpc::telemetry::StatusText_StatusType value) {
+inline void SubscribeTelemetrySnapshotRequest::_internal_set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value) {
   
-  type_ = value;
+  fields_ = value;
 }
-inline void StatusText::set_type(::mavsdk::rpc::telemetry::StatusText_StatusType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.StatusText.type)
+inline void SubscribeTelemetrySnapshotRequest::set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_fields(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest.fields)
 }
 
-// string text = 2;
-inline void StatusText::clear_text() {
-  text_.ClearToEmptyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+// double rate_hz = 2;
+inline void SubscribeTelemetrySnapshotRequest::clear_rate_hz() {
+  rate_hz_ = 0;
 }
-inline const std::string& StatusText::text() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.StatusText.text)
-  return _internal_text();
+inline double SubscribeTelemetrySnapshotRequest::_internal_rate_hz() const {
+  return rate_hz_;
 }
-inline void StatusText::set_text(const std::string& value) {
-  _internal_set_text(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.StatusText.text)
+inline double SubscribeTelemetrySnapshotRequest::rate_hz() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest.rate_hz)
+  return _internal_rate_hz();
 }
-inline std::string* StatusText::mutable_text() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.StatusText.text)
-  return _internal_mutable_text();
+inline void SubscribeTelemetrySnapshotRequest::_internal_set_rate_hz(double value) {
+  
+  rate_hz_ = value;
 }
-inline const std::string& StatusText::_internal_text() const {
-  return text_.GetNoArena();
+inline void SubscribeTelemetrySnapshotRequest::set_rate_hz(double value) {
+  _internal_set_rate_hz(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SubscribeTelemetrySnapshotRequest.rate_hz)
 }
-inline void StatusText::_internal_set_text(const std::string& value) {
-  
-  text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value);
+
+// -------------------------------------------------------------------
+
+// TelemetrySnapshotResponse
+
+// .mavsdk.rpc.telemetry.TelemetrySnapshot telemetry_snapshot = 1;
+inline bool TelemetrySnapshotResponse::_internal_has_telemetry_snapshot() const {
+  return this != internal_default_instance() && telemetry_snapshot_ != nullptr;
 }
-inline void StatusText::set_text(std::string&& value) {
-  
-  text_.SetNoArena(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:mavsdk.rpc.telemetry.StatusText.text)
+inline bool TelemetrySnapshotResponse::has_telemetry_snapshot() const {
+  return _internal_has_telemetry_snapshot();
 }
-inline void StatusText::set_text(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:mavsdk.rpc.telemetry.StatusText.text)
+inline void TelemetrySnapshotResponse::clear_telemetry_snapshot() {
+  if (GetArenaNoVirtual() == nullptr && telemetry_snapshot_ != nullptr) {
+    delete telemetry_snapshot_;
+  }
+  telemetry_snapshot_ = nullptr;
 }
-inline void StatusText::set_text(const char* value, size_t size) {
-  
-  text_.SetNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:mavsdk.rpc.telemetry.StatusText.text)
+inline const ::mavsdk::rpc::telemetry::TelemetrySnapshot& TelemetrySnapshotResponse::_internal_telemetry_snapshot() const {
+  const ::mavsdk::rpc::telemetry::TelemetrySnapshot* p = telemetry_snapshot_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::TelemetrySnapshot*>(
+      &::mavsdk::rpc::telemetry::_TelemetrySnapshot_default_instance_);
 }
-inline std::string* StatusText::_internal_mutable_text() {
+inline const ::mavsdk::rpc::telemetry::TelemetrySnapshot& TelemetrySnapshotResponse::telemetry_snapshot() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshotResponse.telemetry_snapshot)
+  return _internal_telemetry_snapshot();
+}
+inline ::mavsdk::rpc::telemetry::TelemetrySnapshot* TelemetrySnapshotResponse::release_telemetry_snapshot() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshotResponse.telemetry_snapshot)
   
-  return text_.MutableNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::mavsdk::rpc::telemetry::TelemetrySnapshot* temp = telemetry_snapshot_;
+  telemetry_snapshot_ = nullptr;
+  return temp;
 }
-inline std::string* StatusText::release_text() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.StatusText.text)
+inline ::mavsdk::rpc::telemetry::TelemetrySnapshot* TelemetrySnapshotResponse::_internal_mutable_telemetry_snapshot() {
   
-  return text_.ReleaseNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (telemetry_snapshot_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::TelemetrySnapshot>(GetArenaNoVirtual());
+    telemetry_snapshot_ = p;
+  }
+  return telemetry_snapshot_;
 }
-inline void StatusText::set_allocated_text(std::string* text) {
-  if (text != nullptr) {
+inline ::mavsdk::rpc::telemetry::TelemetrySnapshot* TelemetrySnapshotResponse::mutable_telemetry_snapshot() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshotResponse.telemetry_snapshot)
+  return _internal_mutable_telemetry_snapshot();
+}
+inline void TelemetrySnapshotResponse::set_allocated_telemetry_snapshot(::mavsdk::rpc::telemetry::TelemetrySnapshot* telemetry_snapshot) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete telemetry_snapshot_;
+  }
+  if (telemetry_snapshot) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      telemetry_snapshot = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, telemetry_snapshot, submessage_arena);
+    }
     
   } else {
     
   }
-  text_.SetAllocatedNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), text);
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.StatusText.text)
+  telemetry_snapshot_ = telemetry_snapshot;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshotResponse.telemetry_snapshot)
 }
 
 // -------------------------------------------------------------------
 
-// ActuatorControlTarget
+// TelemetrySnapshot
 
-// int32 group = 1;
-inline void ActuatorControlTarget::clear_group() {
-  group_ = 0;
+// uint64 timestamp_us = 1;
+inline void TelemetrySnapshot::clear_timestamp_us() {
+  timestamp_us_ = PROTOBUF_ULONGLONG(0);
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ActuatorControlTarget::_internal_group() const {
-  return group_;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TelemetrySnapshot::_internal_timestamp_us() const {
+  return timestamp_us_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::int32 ActuatorControlTarget::group() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorControlTarget.group)
-  return _internal_group();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 TelemetrySnapshot::timestamp_us() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.timestamp_us)
+  return _internal_timestamp_us();
 }
-inline void ActuatorControlTarget::_internal_set_group(::PROTOBUF_NAMESPACE_ID::int32 value) {
+inline void TelemetrySnapshot::_internal_set_timestamp_us(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  group_ = value;
+  timestamp_us_ = value;
 }
-inline void ActuatorControlTarget::set_group(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_group(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ActuatorControlTarget.group)
+inline void TelemetrySnapshot::set_timestamp_us(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_timestamp_us(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.TelemetrySnapshot.timestamp_us)
 }
 
-// repeated float controls = 2;
-inline int ActuatorControlTarget::_internal_controls_size() const {
-  return controls_.size();
+// uint32 fields = 2;
+inline void TelemetrySnapshot::clear_fields() {
+  fields_ = 0u;
 }
-inline int ActuatorControlTarget::controls_size() const {
-  return _internal_controls_size();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TelemetrySnapshot::_internal_fields() const {
+  return fields_;
 }
-inline void ActuatorControlTarget::clear_controls() {
-  controls_.Clear();
+inline ::PROTOBUF_NAMESPACE_ID::uint32 TelemetrySnapshot::fields() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.fields)
+  return _internal_fields();
 }
-inline float ActuatorControlTarget::_internal_controls(int index) const {
-  return controls_.Get(index);
+inline void TelemetrySnapshot::_internal_set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  
+  fields_ = value;
 }
-inline float ActuatorControlTarget::controls(int index) const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
-  return _internal_controls(index);
+inline void TelemetrySnapshot::set_fields(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+  _internal_set_fields(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.TelemetrySnapshot.fields)
 }
-inline void ActuatorControlTarget::set_controls(int index, float value) {
-  controls_.Set(index, value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
+
+// .mavsdk.rpc.telemetry.Position position = 3;
+inline bool TelemetrySnapshot::_internal_has_position() const {
+  return this != internal_default_instance() && position_ != nullptr;
 }
-inline void ActuatorControlTarget::_internal_add_controls(float value) {
-  controls_.Add(value);
+inline bool TelemetrySnapshot::has_position() const {
+  return _internal_has_position();
 }
-inline void ActuatorControlTarget::add_controls(float value) {
-  _internal_add_controls(value);
-  // @@protoc_insertion_point(field_add:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
+inline void TelemetrySnapshot::clear_position() {
+  if (GetArenaNoVirtual() == nullptr && position_ != nullptr) {
+    delete position_;
+  }
+  position_ = nullptr;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-ActuatorControlTarget::_internal_controls() const {
-  return controls_;
+inline const ::mavsdk::rpc::telemetry::Position& TelemetrySnapshot::_internal_position() const {
+  const ::mavsdk::rpc::telemetry::Position* p = position_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Position*>(
+      &::mavsdk::rpc::telemetry::_Position_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-ActuatorControlTarget::controls() const {
-  // @@protoc_insertion_point(field_list:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
-  return _internal_controls();
+inline const ::mavsdk::rpc::telemetry::Position& TelemetrySnapshot::position() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.position)
+  return _internal_position();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-ActuatorControlTarget::_internal_mutable_controls() {
-  return &controls_;
+inline ::mavsdk::rpc::telemetry::Position* TelemetrySnapshot::release_position() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.position)
+  
+  ::mavsdk::rpc::telemetry::Position* temp = position_;
+  position_ = nullptr;
+  return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-ActuatorControlTarget::mutable_controls() {
-  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.telemetry.ActuatorControlTarget.controls)
-  return _internal_mutable_controls();
+inline ::mavsdk::rpc::telemetry::Position* TelemetrySnapshot::_internal_mutable_position() {
+  
+  if (position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Position>(GetArenaNoVirtual());
+    position_ = p;
+  }
+  return position_;
+}
+inline ::mavsdk::rpc::telemetry::Position* TelemetrySnapshot::mutable_position() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.position)
+  return _internal_mutable_position();
+}
+inline void TelemetrySnapshot::set_allocated_position(::mavsdk::rpc::telemetry::Position* position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete position_;
+  }
+  if (position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  position_ = position;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.position)
 }
 
-// -------------------------------------------------------------------
-
-// ActuatorOutputStatus
-
-// uint32 active = 1;
-inline void ActuatorOutputStatus::clear_active() {
-  active_ = 0u;
+// .mavsdk.rpc.telemetry.Position home_position = 4;
+inline bool TelemetrySnapshot::_internal_has_home_position() const {
+  return this != internal_default_instance() && home_position_ != nullptr;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ActuatorOutputStatus::_internal_active() const {
-  return active_;
+inline bool TelemetrySnapshot::has_home_position() const {
+  return _internal_has_home_position();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 ActuatorOutputStatus::active() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorOutputStatus.active)
-  return _internal_active();
+inline void TelemetrySnapshot::clear_home_position() {
+  if (GetArenaNoVirtual() == nullptr && home_position_ != nullptr) {
+    delete home_position_;
+  }
+  home_position_ = nullptr;
 }
-inline void ActuatorOutputStatus::_internal_set_active(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline const ::mavsdk::rpc::telemetry::Position& TelemetrySnapshot::_internal_home_position() const {
+  const ::mavsdk::rpc::telemetry::Position* p = home_position_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Position*>(
+      &::mavsdk::rpc::telemetry::_Position_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::Position& TelemetrySnapshot::home_position() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.home_position)
+  return _internal_home_position();
+}
+inline ::mavsdk::rpc::telemetry::Position* TelemetrySnapshot::release_home_position() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.home_position)
   
-  active_ = value;
+  ::mavsdk::rpc::telemetry::Position* temp = home_position_;
+  home_position_ = nullptr;
+  return temp;
 }
-inline void ActuatorOutputStatus::set_active(::PROTOBUF_NAMESPACE_ID::uint32 value) {
-  _internal_set_active(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ActuatorOutputStatus.active)
+inline ::mavsdk::rpc::telemetry::Position* TelemetrySnapshot::_internal_mutable_home_position() {
+  
+  if (home_position_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Position>(GetArenaNoVirtual());
+    home_position_ = p;
+  }
+  return home_position_;
 }
-
-// repeated float actuator = 2;
-inline int ActuatorOutputStatus::_internal_actuator_size() const {
-  return actuator_.size();
+inline ::mavsdk::rpc::telemetry::Position* TelemetrySnapshot::mutable_home_position() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.home_position)
+  return _internal_mutable_home_position();
 }
-inline int ActuatorOutputStatus::actuator_size() const {
-  return _internal_actuator_size();
+inline void TelemetrySnapshot::set_allocated_home_position(::mavsdk::rpc::telemetry::Position* home_position) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete home_position_;
+  }
+  if (home_position) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      home_position = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, home_position, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  home_position_ = home_position;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.home_position)
 }
-inline void ActuatorOutputStatus::clear_actuator() {
-  actuator_.Clear();
+
+// bool in_air = 5;
+inline void TelemetrySnapshot::clear_in_air() {
+  in_air_ = false;
 }
-inline float ActuatorOutputStatus::_internal_actuator(int index) const {
-  return actuator_.Get(index);
+inline bool TelemetrySnapshot::_internal_in_air() const {
+  return in_air_;
 }
-inline float ActuatorOutputStatus::actuator(int index) const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
-  return _internal_actuator(index);
+inline bool TelemetrySnapshot::in_air() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.in_air)
+  return _internal_in_air();
 }
-inline void ActuatorOutputStatus::set_actuator(int index, float value) {
-  actuator_.Set(index, value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
+inline void TelemetrySnapshot::_internal_set_in_air(bool value) {
+  
+  in_air_ = value;
 }
-inline void ActuatorOutputStatus::_internal_add_actuator(float value) {
-  actuator_.Add(value);
+inline void TelemetrySnapshot::set_in_air(bool value) {
+  _internal_set_in_air(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.TelemetrySnapshot.in_air)
 }
-inline void ActuatorOutputStatus::add_actuator(float value) {
-  _internal_add_actuator(value);
-  // @@protoc_insertion_point(field_add:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
+
+// bool armed = 6;
+inline void TelemetrySnapshot::clear_armed() {
+  armed_ = false;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-ActuatorOutputStatus::_internal_actuator() const {
-  return actuator_;
+inline bool TelemetrySnapshot::_internal_armed() const {
+  return armed_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-ActuatorOutputStatus::actuator() const {
-  // @@protoc_insertion_point(field_list:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
-  return _internal_actuator();
+inline bool TelemetrySnapshot::armed() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.armed)
+  return _internal_armed();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-ActuatorOutputStatus::_internal_mutable_actuator() {
-  return &actuator_;
+inline void TelemetrySnapshot::_internal_set_armed(bool value) {
+  
+  armed_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-ActuatorOutputStatus::mutable_actuator() {
-  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.telemetry.ActuatorOutputStatus.actuator)
-  return _internal_mutable_actuator();
+inline void TelemetrySnapshot::set_armed(bool value) {
+  _internal_set_armed(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.TelemetrySnapshot.armed)
 }
 
-// -------------------------------------------------------------------
-
-// Odometry
-
-// uint64 time_usec = 1;
-inline void Odometry::clear_time_usec() {
-  time_usec_ = PROTOBUF_ULONGLONG(0);
+// .mavsdk.rpc.telemetry.LandedState landed_state = 7;
+inline void TelemetrySnapshot::clear_landed_state() {
+  landed_state_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Odometry::_internal_time_usec() const {
-  return time_usec_;
+inline ::mavsdk::rpc::telemetry::LandedState TelemetrySnapshot::_internal_landed_state() const {
+  return static_cast< ::mavsdk::rpc::telemetry::LandedState >(landed_state_);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Odometry::time_usec() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.time_usec)
-  return _internal_time_usec();
+inline ::mavsdk::rpc::telemetry::LandedState TelemetrySnapshot::landed_state() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.landed_state)
+  return _internal_landed_state();
 }
-inline void Odometry::_internal_set_time_usec(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void TelemetrySnapshot::_internal_set_landed_state(::mavsdk::rpc::telemetry::LandedState value) {
   
-  time_usec_ = value;
+  landed_state_ = value;
 }
-inline void Odometry::set_time_usec(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_time_usec(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Odometry.time_usec)
+inline void TelemetrySnapshot::set_landed_state(::mavsdk::rpc::telemetry::LandedState value) {
+  _internal_set_landed_state(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.TelemetrySnapshot.landed_state)
 }
 
-// .mavsdk.rpc.telemetry.Odometry.MavFrame frame_id = 2;
-inline void Odometry::clear_frame_id() {
-  frame_id_ = 0;
+// .mavsdk.rpc.telemetry.FlightMode flight_mode = 8;
+inline void TelemetrySnapshot::clear_flight_mode() {
+  flight_mode_ = 0;
 }
-inline ::mavsdk::rpc::telemetry::Odometry_MavFrame Odometry::_internal_frame_id() const {
-  return static_cast< ::mavsdk::rpc::telemetry::Odometry_MavFrame >(frame_id_);
+inline ::mavsdk::rpc::telemetry::FlightMode TelemetrySnapshot::_internal_flight_mode() const {
+  return static_cast< ::mavsdk::rpc::telemetry::FlightMode >(flight_mode_);
 }
-inline ::mavsdk::rpc::telemetry::Odometry_MavFrame Odometry::frame_id() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.frame_id)
-  return _internal_frame_id();
+inline ::mavsdk::rpc::telemetry::FlightMode TelemetrySnapshot::flight_mode() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.flight_mode)
+  return _internal_flight_mode();
 }
-inline void Odometry::_internal_set_frame_id(::mavsdk::rpc::telemetry::Odometry_MavFrame value) {
+inline void TelemetrySnapshot::_internal_set_flight_mode(::mavsdk::rpc::telemetry::FlightMode value) {
   
-  frame_id_ = value;
+  flight_mode_ = value;
 }
-inline void Odometry::set_frame_id(::mavsdk::rpc::telemetry::Odometry_MavFrame value) {
-  _internal_set_frame_id(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Odometry.frame_id)
+inline void TelemetrySnapshot::set_flight_mode(::mavsdk::rpc::telemetry::FlightMode value) {
+  _internal_set_flight_mode(value);
+  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.TelemetrySnapshot.flight_mode)
 }
 
-// .mavsdk.rpc.telemetry.Odometry.MavFrame child_frame_id = 3;
-inline void Odometry::clear_child_frame_id() {
-  child_frame_id_ = 0;
+// .mavsdk.rpc.telemetry.EulerAngle attitude_euler_angle = 9;
+inline bool TelemetrySnapshot::_internal_has_attitude_euler_angle() const {
+  return this != internal_default_instance() && attitude_euler_angle_ != nullptr;
 }
-inline ::mavsdk::rpc::telemetry::Odometry_MavFrame Odometry::_internal_child_frame_id() const {
-  return static_cast< ::mavsdk::rpc::telemetry::Odometry_MavFrame >(child_frame_id_);
+inline bool TelemetrySnapshot::has_attitude_euler_angle() const {
+  return _internal_has_attitude_euler_angle();
 }
-inline ::mavsdk::rpc::telemetry::Odometry_MavFrame Odometry::child_frame_id() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.child_frame_id)
-  return _internal_child_frame_id();
+inline void TelemetrySnapshot::clear_attitude_euler_angle() {
+  if (GetArenaNoVirtual() == nullptr && attitude_euler_angle_ != nullptr) {
+    delete attitude_euler_angle_;
+  }
+  attitude_euler_angle_ = nullptr;
 }
-inline void Odometry::_internal_set_child_frame_id(::mavsdk::rpc::telemetry::Odometry_MavFrame value) {
+inline const ::mavsdk::rpc::telemetry::EulerAngle& TelemetrySnapshot::_internal_attitude_euler_angle() const {
+  const ::mavsdk::rpc::telemetry::EulerAngle* p = attitude_euler_angle_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::EulerAngle*>(
+      &::mavsdk::rpc::telemetry::_EulerAngle_default_instance_);
+}
+inline const ::mavsdk::rpc::telemetry::EulerAngle& TelemetrySnapshot::attitude_euler_angle() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.attitude_euler_angle)
+  return _internal_attitude_euler_angle();
+}
+inline ::mavsdk::rpc::telemetry::EulerAngle* TelemetrySnapshot::release_attitude_euler_angle() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.attitude_euler_angle)
   
-  child_frame_id_ = value;
+  ::mavsdk::rpc::telemetry::EulerAngle* temp = attitude_euler_angle_;
+  attitude_euler_angle_ = nullptr;
+  return temp;
 }
-inline void Odometry::set_child_frame_id(::mavsdk::rpc::telemetry::Odometry_MavFrame value) {
-  _internal_set_child_frame_id(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Odometry.child_frame_id)
+inline ::mavsdk::rpc::telemetry::EulerAngle* TelemetrySnapshot::_internal_mutable_attitude_euler_angle() {
+  
+  if (attitude_euler_angle_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::EulerAngle>(GetArenaNoVirtual());
+    attitude_euler_angle_ = p;
+  }
+  return attitude_euler_angle_;
+}
+inline ::mavsdk::rpc::telemetry::EulerAngle* TelemetrySnapshot::mutable_attitude_euler_angle() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.attitude_euler_angle)
+  return _internal_mutable_attitude_euler_angle();
+}
+inline void TelemetrySnapshot::set_allocated_attitude_euler_angle(::mavsdk::rpc::telemetry::EulerAngle* attitude_euler_angle) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == nullptr) {
+    delete attitude_euler_angle_;
+  }
+  if (attitude_euler_angle) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
+    if (message_arena != submessage_arena) {
+      attitude_euler_angle = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, attitude_euler_angle, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  attitude_euler_angle_ = attitude_euler_angle;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.attitude_euler_angle)
 }
 
-// .mavsdk.rpc.telemetry.PositionBody position_body = 4;
-inline bool Odometry::_internal_has_position_body() const {
-  return this != internal_default_instance() && position_body_ != nullptr;
+// .mavsdk.rpc.telemetry.SpeedNed ground_speed_ned = 10;
+inline bool TelemetrySnapshot::_internal_has_ground_speed_ned() const {
+  return this != internal_default_instance() && ground_speed_ned_ != nullptr;
 }
-inline bool Odometry::has_position_body() const {
-  return _internal_has_position_body();
+inline bool TelemetrySnapshot::has_ground_speed_ned() const {
+  return _internal_has_ground_speed_ned();
 }
-inline void Odometry::clear_position_body() {
-  if (GetArenaNoVirtual() == nullptr && position_body_ != nullptr) {
-    delete position_body_;
+inline void TelemetrySnapshot::clear_ground_speed_ned() {
+  if (GetArenaNoVirtual() == nullptr && ground_speed_ned_ != nullptr) {
+    delete ground_speed_ned_;
   }
-  position_body_ = nullptr;
+  ground_speed_ned_ = nullptr;
 }
-inline const ::mavsdk::rpc::telemetry::PositionBody& Odometry::_internal_position_body() const {
-  const ::mavsdk::rpc::telemetry::PositionBody* p = position_body_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::PositionBody*>(
-      &::mavsdk::rpc::telemetry::_PositionBody_default_instance_);
+inline const ::mavsdk::rpc::telemetry::SpeedNed& TelemetrySnapshot::_internal_ground_speed_ned() const {
+  const ::mavsdk::rpc::telemetry::SpeedNed* p = ground_speed_ned_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::SpeedNed*>(
+      &::mavsdk::rpc::telemetry::_SpeedNed_default_instance_);
 }
-inline const ::mavsdk::rpc::telemetry::PositionBody& Odometry::position_body() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.position_body)
-  return _internal_position_body();
+inline const ::mavsdk::rpc::telemetry::SpeedNed& TelemetrySnapshot::ground_speed_ned() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.ground_speed_ned)
+  return _internal_ground_speed_ned();
 }
-inline ::mavsdk::rpc::telemetry::PositionBody* Odometry::release_position_body() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.position_body)
+inline ::mavsdk::rpc::telemetry::SpeedNed* TelemetrySnapshot::release_ground_speed_ned() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.ground_speed_ned)
   
-  ::mavsdk::rpc::telemetry::PositionBody* temp = position_body_;
-  position_body_ = nullptr;
+  ::mavsdk::rpc::telemetry::SpeedNed* temp = ground_speed_ned_;
+  ground_speed_ned_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::telemetry::PositionBody* Odometry::_internal_mutable_position_body() {
+inline ::mavsdk::rpc::telemetry::SpeedNed* TelemetrySnapshot::_internal_mutable_ground_speed_ned() {
   
-  if (position_body_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::PositionBody>(GetArenaNoVirtual());
-    position_body_ = p;
+  if (ground_speed_ned_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::SpeedNed>(GetArenaNoVirtual());
+    ground_speed_ned_ = p;
   }
-  return position_body_;
+  return ground_speed_ned_;
 }
-inline ::mavsdk::rpc::telemetry::PositionBody* Odometry::mutable_position_body() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.position_body)
-  return _internal_mutable_position_body();
+inline ::mavsdk::rpc::telemetry::SpeedNed* TelemetrySnapshot::mutable_ground_speed_ned() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.ground_speed_ned)
+  return _internal_mutable_ground_speed_ned();
 }
-inline void Odometry::set_allocated_position_body(::mavsdk::rpc::telemetry::PositionBody* position_body) {
+inline void TelemetrySnapshot::set_allocated_ground_speed_ned(::mavsdk::rpc::telemetry::SpeedNed* ground_speed_ned) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete position_body_;
+    delete ground_speed_ned_;
   }
-  if (position_body) {
+  if (ground_speed_ned) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      position_body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, position_body, submessage_arena);
+      ground_speed_ned = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, ground_speed_ned, submessage_arena);
     }
     
   } else {
     
   }
-  position_body_ = position_body;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.position_body)
+  ground_speed_ned_ = ground_speed_ned;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.ground_speed_ned)
 }
 
-// .mavsdk.rpc.telemetry.Quaternion q = 5;
-inline bool Odometry::_internal_has_q() const {
-  return this != internal_default_instance() && q_ != nullptr;
+// .mavsdk.rpc.telemetry.GpsInfo gps_info = 11;
+inline bool TelemetrySnapshot::_internal_has_gps_info() const {
+  return this != internal_default_instance() && gps_info_ != nullptr;
 }
-inline bool Odometry::has_q() const {
-  return _internal_has_q();
+inline bool TelemetrySnapshot::has_gps_info() const {
+  return _internal_has_gps_info();
 }
-inline void Odometry::clear_q() {
-  if (GetArenaNoVirtual() == nullptr && q_ != nullptr) {
-    delete q_;
+inline void TelemetrySnapshot::clear_gps_info() {
+  if (GetArenaNoVirtual() == nullptr && gps_info_ != nullptr) {
+    delete gps_info_;
   }
-  q_ = nullptr;
+  gps_info_ = nullptr;
 }
-inline const ::mavsdk::rpc::telemetry::Quaternion& Odometry::_internal_q() const {
-  const ::mavsdk::rpc::telemetry::Quaternion* p = q_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Quaternion*>(
-      &::mavsdk::rpc::telemetry::_Quaternion_default_instance_);
+inline const ::mavsdk::rpc::telemetry::GpsInfo& TelemetrySnapshot::_internal_gps_info() const {
+  const ::mavsdk::rpc::telemetry::GpsInfo* p = gps_info_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::GpsInfo*>(
+      &::mavsdk::rpc::telemetry::_GpsInfo_default_instance_);
 }
-inline const ::mavsdk::rpc::telemetry::Quaternion& Odometry::q() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.q)
-  return _internal_q();
+inline const ::mavsdk::rpc::telemetry::GpsInfo& TelemetrySnapshot::gps_info() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.gps_info)
+  return _internal_gps_info();
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* Odometry::release_q() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.q)
+inline ::mavsdk::rpc::telemetry::GpsInfo* TelemetrySnapshot::release_gps_info() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.gps_info)
   
-  ::mavsdk::rpc::telemetry::Quaternion* temp = q_;
-  q_ = nullptr;
+  ::mavsdk::rpc::telemetry::GpsInfo* temp = gps_info_;
+  gps_info_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* Odometry::_internal_mutable_q() {
+inline ::mavsdk::rpc::telemetry::GpsInfo* TelemetrySnapshot::_internal_mutable_gps_info() {
   
-  if (q_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Quaternion>(GetArenaNoVirtual());
-    q_ = p;
+  if (gps_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::GpsInfo>(GetArenaNoVirtual());
+    gps_info_ = p;
   }
-  return q_;
+  return gps_info_;
 }
-inline ::mavsdk::rpc::telemetry::Quaternion* Odometry::mutable_q() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.q)
-  return _internal_mutable_q();
+inline ::mavsdk::rpc::telemetry::GpsInfo* TelemetrySnapshot::mutable_gps_info() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.gps_info)
+  return _internal_mutable_gps_info();
 }
-inline void Odometry::set_allocated_q(::mavsdk::rpc::telemetry::Quaternion* q) {
+inline void TelemetrySnapshot::set_allocated_gps_info(::mavsdk::rpc::telemetry::GpsInfo* gps_info) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete q_;
+    delete gps_info_;
   }
-  if (q) {
+  if (gps_info) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      q = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, q, submessage_arena);
+      gps_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gps_info, submessage_arena);
     }
     
   } else {
     
   }
-  q_ = q;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.q)
+  gps_info_ = gps_info;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.gps_info)
 }
 
-// .mavsdk.rpc.telemetry.SpeedBody speed_body = 6;
-inline bool Odometry::_internal_has_speed_body() const {
-  return this != internal_default_instance() && speed_body_ != nullptr;
+// .mavsdk.rpc.telemetry.Battery battery = 12;
+inline bool TelemetrySnapshot::_internal_has_battery() const {
+  return this != internal_default_instance() && battery_ != nullptr;
 }
-inline bool Odometry::has_speed_body() const {
-  return _internal_has_speed_body();
+inline bool TelemetrySnapshot::has_battery() const {
+  return _internal_has_battery();
 }
-inline void Odometry::clear_speed_body() {
-  if (GetArenaNoVirtual() == nullptr && speed_body_ != nullptr) {
-    delete speed_body_;
+inline void TelemetrySnapshot::clear_battery() {
+  if (GetArenaNoVirtual() == nullptr && battery_ != nullptr) {
+    delete battery_;
   }
-  speed_body_ = nullptr;
+  battery_ = nullptr;
 }
-inline const ::mavsdk::rpc::telemetry::SpeedBody& Odometry::_internal_speed_body() const {
-  const ::mavsdk::rpc::telemetry::SpeedBody* p = speed_body_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::SpeedBody*>(
-      &::mavsdk::rpc::telemetry::_SpeedBody_default_instance_);
+inline const ::mavsdk::rpc::telemetry::Battery& TelemetrySnapshot::_internal_battery() const {
+  const ::mavsdk::rpc::telemetry::Battery* p = battery_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Battery*>(
+      &::mavsdk::rpc::telemetry::_Battery_default_instance_);
 }
-inline const ::mavsdk::rpc::telemetry::SpeedBody& Odometry::speed_body() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.speed_body)
-  return _internal_speed_body();
+inline const ::mavsdk::rpc::telemetry::Battery& TelemetrySnapshot::battery() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.battery)
+  return _internal_battery();
 }
-inline ::mavsdk::rpc::telemetry::SpeedBody* Odometry::release_speed_body() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.speed_body)
+inline ::mavsdk::rpc::telemetry::Battery* TelemetrySnapshot::release_battery() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.battery)
   
-  ::mavsdk::rpc::telemetry::SpeedBody* temp = speed_body_;
-  speed_body_ = nullptr;
+  ::mavsdk::rpc::telemetry::Battery* temp = battery_;
+  battery_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::telemetry::SpeedBody* Odometry::_internal_mutable_speed_body() {
+inline ::mavsdk::rpc::telemetry::Battery* TelemetrySnapshot::_internal_mutable_battery() {
   
-  if (speed_body_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::SpeedBody>(GetArenaNoVirtual());
-    speed_body_ = p;
+  if (battery_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Battery>(GetArenaNoVirtual());
+    battery_ = p;
   }
-  return speed_body_;
+  return battery_;
 }
-inline ::mavsdk::rpc::telemetry::SpeedBody* Odometry::mutable_speed_body() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.speed_body)
-  return _internal_mutable_speed_body();
+inline ::mavsdk::rpc::telemetry::Battery* TelemetrySnapshot::mutable_battery() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.battery)
+  return _internal_mutable_battery();
 }
-inline void Odometry::set_allocated_speed_body(::mavsdk::rpc::telemetry::SpeedBody* speed_body) {
+inline void TelemetrySnapshot::set_allocated_battery(::mavsdk::rpc::telemetry::Battery* battery) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete speed_body_;
+    delete battery_;
   }
-  if (speed_body) {
+  if (battery) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      speed_body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, speed_body, submessage_arena);
+      battery = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, battery, submessage_arena);
     }
     
   } else {
     
   }
-  speed_body_ = speed_body;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.speed_body)
+  battery_ = battery;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.battery)
 }
 
-// .mavsdk.rpc.telemetry.AngularVelocityBody angular_velocity_body = 7;
-inline bool Odometry::_internal_has_angular_velocity_body() const {
-  return this != internal_default_instance() && angular_velocity_body_ != nullptr;
+// .mavsdk.rpc.telemetry.Health health = 13;
+inline bool TelemetrySnapshot::_internal_has_health() const {
+  return this != internal_default_instance() && health_ != nullptr;
 }
-inline bool Odometry::has_angular_velocity_body() const {
-  return _internal_has_angular_velocity_body();
+inline bool TelemetrySnapshot::has_health() const {
+  return _internal_has_health();
 }
-inline void Odometry::clear_angular_velocity_body() {
-  if (GetArenaNoVirtual() == nullptr && angular_velocity_body_ != nullptr) {
-    delete angular_velocity_body_;
+inline void TelemetrySnapshot::clear_health() {
+  if (GetArenaNoVirtual() == nullptr && health_ != nullptr) {
+    delete health_;
   }
-  angular_velocity_body_ = nullptr;
+  health_ = nullptr;
 }
-inline const ::mavsdk::rpc::telemetry::AngularVelocityBody& Odometry::_internal_angular_velocity_body() const {
-  const ::mavsdk::rpc::telemetry::AngularVelocityBody* p = angular_velocity_body_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::AngularVelocityBody*>(
-      &::mavsdk::rpc::telemetry::_AngularVelocityBody_default_instance_);
+inline const ::mavsdk::rpc::telemetry::Health& TelemetrySnapshot::_internal_health() const {
+  const ::mavsdk::rpc::telemetry::Health* p = health_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Health*>(
+      &::mavsdk::rpc::telemetry::_Health_default_instance_);
 }
-inline const ::mavsdk::rpc::telemetry::AngularVelocityBody& Odometry::angular_velocity_body() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.angular_velocity_body)
-  return _internal_angular_velocity_body();
+inline const ::mavsdk::rpc::telemetry::Health& TelemetrySnapshot::health() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.health)
+  return _internal_health();
 }
-inline ::mavsdk::rpc::telemetry::AngularVelocityBody* Odometry::release_angular_velocity_body() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.angular_velocity_body)
+inline ::mavsdk::rpc::telemetry::Health* TelemetrySnapshot::release_health() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.health)
   
-  ::mavsdk::rpc::telemetry::AngularVelocityBody* temp = angular_velocity_body_;
-  angular_velocity_body_ = nullptr;
+  ::mavsdk::rpc::telemetry::Health* temp = health_;
+  health_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::telemetry::AngularVelocityBody* Odometry::_internal_mutable_angular_velocity_body() {
+inline ::mavsdk::rpc::telemetry::Health* TelemetrySnapshot::_internal_mutable_health() {
   
-  if (angular_velocity_body_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::AngularVelocityBody>(GetArenaNoVirtual());
-    angular_velocity_body_ = p;
+  if (health_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Health>(GetArenaNoVirtual());
+    health_ = p;
   }
-  return angular_velocity_body_;
+  return health_;
 }
-inline ::mavsdk::rpc::telemetry::AngularVelocityBody* Odometry::mutable_angular_velocity_body() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.angular_velocity_body)
-  return _internal_mutable_angular_velocity_body();
+inline ::mavsdk::rpc::telemetry::Health* TelemetrySnapshot::mutable_health() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.health)
+  return _internal_mutable_health();
 }
-inline void Odometry::set_allocated_angular_velocity_body(::mavsdk::rpc::telemetry::AngularVelocityBody* angular_velocity_body) {
+inline void TelemetrySnapshot::set_allocated_health(::mavsdk::rpc::telemetry::Health* health) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete angular_velocity_body_;
+    delete health_;
   }
-  if (angular_velocity_body) {
+  if (health) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      angular_velocity_body = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, angular_velocity_body, submessage_arena);
+      health = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, health, submessage_arena);
     }
     
   } else {
     
   }
-  angular_velocity_body_ = angular_velocity_body;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.angular_velocity_body)
+  health_ = health;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.health)
 }
 
-// .mavsdk.rpc.telemetry.Covariance pose_covariance = 8;
-inline bool Odometry::_internal_has_pose_covariance() const {
-  return this != internal_default_instance() && pose_covariance_ != nullptr;
+// .mavsdk.rpc.telemetry.RcStatus rc_status = 14;
+inline bool TelemetrySnapshot::_internal_has_rc_status() const {
+  return this != internal_default_instance() && rc_status_ != nullptr;
 }
-inline bool Odometry::has_pose_covariance() const {
-  return _internal_has_pose_covariance();
+inline bool TelemetrySnapshot::has_rc_status() const {
+  return _internal_has_rc_status();
 }
-inline void Odometry::clear_pose_covariance() {
-  if (GetArenaNoVirtual() == nullptr && pose_covariance_ != nullptr) {
-    delete pose_covariance_;
+inline void TelemetrySnapshot::clear_rc_status() {
+  if (GetArenaNoVirtual() == nullptr && rc_status_ != nullptr) {
+    delete rc_status_;
   }
-  pose_covariance_ = nullptr;
+  rc_status_ = nullptr;
 }
-inline const ::mavsdk::rpc::telemetry::Covariance& Odometry::_internal_pose_covariance() const {
-  const ::mavsdk::rpc::telemetry::Covariance* p = pose_covariance_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Covariance*>(
-      &::mavsdk::rpc::telemetry::_Covariance_default_instance_);
+inline const ::mavsdk::rpc::telemetry::RcStatus& TelemetrySnapshot::_internal_rc_status() const {
+  const ::mavsdk::rpc::telemetry::RcStatus* p = rc_status_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::RcStatus*>(
+      &::mavsdk::rpc::telemetry::_RcStatus_default_instance_);
 }
-inline const ::mavsdk::rpc::telemetry::Covariance& Odometry::pose_covariance() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.pose_covariance)
-  return _internal_pose_covariance();
+inline const ::mavsdk::rpc::telemetry::RcStatus& TelemetrySnapshot::rc_status() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.rc_status)
+  return _internal_rc_status();
 }
-inline ::mavsdk::rpc::telemetry::Covariance* Odometry::release_pose_covariance() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.pose_covariance)
+inline ::mavsdk::rpc::telemetry::RcStatus* TelemetrySnapshot::release_rc_status() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.rc_status)
   
-  ::mavsdk::rpc::telemetry::Covariance* temp = pose_covariance_;
-  pose_covariance_ = nullptr;
+  ::mavsdk::rpc::telemetry::RcStatus* temp = rc_status_;
+  rc_status_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::telemetry::Covariance* Odometry::_internal_mutable_pose_covariance() {
+inline ::mavsdk::rpc::telemetry::RcStatus* TelemetrySnapshot::_internal_mutable_rc_status() {
   
-  if (pose_covariance_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Covariance>(GetArenaNoVirtual());
-    pose_covariance_ = p;
+  if (rc_status_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::RcStatus>(GetArenaNoVirtual());
+    rc_status_ = p;
   }
-  return pose_covariance_;
+  return rc_status_;
 }
-inline ::mavsdk::rpc::telemetry::Covariance* Odometry::mutable_pose_covariance() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.pose_covariance)
-  return _internal_mutable_pose_covariance();
+inline ::mavsdk::rpc::telemetry::RcStatus* TelemetrySnapshot::mutable_rc_status() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.rc_status)
+  return _internal_mutable_rc_status();
 }
-inline void Odometry::set_allocated_pose_covariance(::mavsdk::rpc::telemetry::Covariance* pose_covariance) {
+inline void TelemetrySnapshot::set_allocated_rc_status(::mavsdk::rpc::telemetry::RcStatus* rc_status) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete pose_covariance_;
+    delete rc_status_;
   }
-  if (pose_covariance) {
+  if (rc_status) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      pose_covariance = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pose_covariance, submessage_arena);
+      rc_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rc_status, submessage_arena);
     }
     
   } else {
     
   }
-  pose_covariance_ = pose_covariance;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.pose_covariance)
+  rc_status_ = rc_status;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.rc_status)
 }
 
-// .mavsdk.rpc.telemetry.Covariance velocity_covariance = 9;
-inline bool Odometry::_internal_has_velocity_covariance() const {
-  return this != internal_default_instance() && velocity_covariance_ != nullptr;
+// .mavsdk.rpc.telemetry.StatusText status_text = 15;
+inline bool TelemetrySnapshot::_internal_has_status_text() const {
+  return this != internal_default_instance() && status_text_ != nullptr;
 }
-inline bool Odometry::has_velocity_covariance() const {
-  return _internal_has_velocity_covariance();
+inline bool TelemetrySnapshot::has_status_text() const {
+  return _internal_has_status_text();
 }
-inline void Odometry::clear_velocity_covariance() {
-  if (GetArenaNoVirtual() == nullptr && velocity_covariance_ != nullptr) {
-    delete velocity_covariance_;
+inline void TelemetrySnapshot::clear_status_text() {
+  if (GetArenaNoVirtual() == nullptr && status_text_ != nullptr) {
+    delete status_text_;
   }
-  velocity_covariance_ = nullptr;
+  status_text_ = nullptr;
 }
-inline const ::mavsdk::rpc::telemetry::Covariance& Odometry::_internal_velocity_covariance() const {
-  const ::mavsdk::rpc::telemetry::Covariance* p = velocity_covariance_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::Covariance*>(
-      &::mavsdk::rpc::telemetry::_Covariance_default_instance_);
+inline const ::mavsdk::rpc::telemetry::StatusText& TelemetrySnapshot::_internal_status_text() const {
+  const ::mavsdk::rpc::telemetry::StatusText* p = status_text_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::mavsdk::rpc::telemetry::StatusText*>(
+      &::mavsdk::rpc::telemetry::_StatusText_default_instance_);
 }
-inline const ::mavsdk::rpc::telemetry::Covariance& Odometry::velocity_covariance() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Odometry.velocity_covariance)
-  return _internal_velocity_covariance();
+inline const ::mavsdk::rpc::telemetry::StatusText& TelemetrySnapshot::status_text() const {
+  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.TelemetrySnapshot.status_text)
+  return _internal_status_text();
 }
-inline ::mavsdk::rpc::telemetry::Covariance* Odometry::release_velocity_covariance() {
-  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.Odometry.velocity_covariance)
+inline ::mavsdk::rpc::telemetry::StatusText* TelemetrySnapshot::release_status_text() {
+  // @@protoc_insertion_point(field_release:mavsdk.rpc.telemetry.TelemetrySnapshot.status_text)
   
-  ::mavsdk::rpc::telemetry::Covariance* temp = velocity_covariance_;
-  velocity_covariance_ = nullptr;
+  ::mavsdk::rpc::telemetry::StatusText* temp = status_text_;
+  status_text_ = nullptr;
   return temp;
 }
-inline ::mavsdk::rpc::telemetry::Covariance* Odometry::_internal_mutable_velocity_covariance() {
+inline ::mavsdk::rpc::telemetry::StatusText* TelemetrySnapshot::_internal_mutable_status_text() {
   
-  if (velocity_covariance_ == nullptr) {
-    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::Covariance>(GetArenaNoVirtual());
-    velocity_covariance_ = p;
+  if (status_text_ == nullptr) {
+    auto* p = CreateMaybeMessage<::mavsdk::rpc::telemetry::StatusText>(GetArenaNoVirtual());
+    status_text_ = p;
   }
-  return velocity_covariance_;
+  return status_text_;
 }
-inline ::mavsdk::rpc::telemetry::Covariance* Odometry::mutable_velocity_covariance() {
-  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.Odometry.velocity_covariance)
-  return _internal_mutable_velocity_covariance();
+inline ::mavsdk::rpc::telemetry::StatusText* TelemetrySnapshot::mutable_status_text() {
+  // @@protoc_insertion_point(field_mutable:mavsdk.rpc.telemetry.TelemetrySnapshot.status_text)
+  return _internal_mutable_status_text();
 }
-inline void Odometry::set_allocated_velocity_covariance(::mavsdk::rpc::telemetry::Covariance* velocity_covariance) {
+inline void TelemetrySnapshot::set_allocated_status_text(::mavsdk::rpc::telemetry::StatusText* status_text) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaNoVirtual();
   if (message_arena == nullptr) {
-    delete velocity_covariance_;
+    delete status_text_;
   }
-  if (velocity_covariance) {
+  if (status_text) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena = nullptr;
     if (message_arena != submessage_arena) {
-      velocity_covariance = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, velocity_covariance, submessage_arena);
+      status_text = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, status_text, submessage_arena);
     }
     
   } else {
     
   }
-  velocity_covariance_ = velocity_covariance;
-  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.Odometry.velocity_covariance)
+  status_text_ = status_text;
+  // @@protoc_insertion_point(field_set_allocated:mavsdk.rpc.telemetry.TelemetrySnapshot.status_text)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
 // -------------------------------------------------------------------
 
-// Covariance
-
-// repeated float covariance_matrix = 1;
-inline int Covariance::_internal_covariance_matrix_size() const {
-  return covariance_matrix_.size();
-}
-inline int Covariance::covariance_matrix_size() const {
-  return _internal_covariance_matrix_size();
-}
-inline void Covariance::clear_covariance_matrix() {
-  covariance_matrix_.Clear();
-}
-inline float Covariance::_internal_covariance_matrix(int index) const {
-  return covariance_matrix_.Get(index);
-}
-inline float Covariance::covariance_matrix(int index) const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
-  return _internal_covariance_matrix(index);
-}
-inline void Covariance::set_covariance_matrix(int index, float value) {
-  covariance_matrix_.Set(index, value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
-}
-inline void Covariance::_internal_add_covariance_matrix(float value) {
-  covariance_matrix_.Add(value);
-}
-inline void Covariance::add_covariance_matrix(float value) {
-  _internal_add_covariance_matrix(value);
-  // @@protoc_insertion_point(field_add:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-Covariance::_internal_covariance_matrix() const {
-  return covariance_matrix_;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
-Covariance::covariance_matrix() const {
-  // @@protoc_insertion_point(field_list:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
-  return _internal_covariance_matrix();
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-Covariance::_internal_mutable_covariance_matrix() {
-  return &covariance_matrix_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
-Covariance::mutable_covariance_matrix() {
-  // @@protoc_insertion_point(field_mutable_list:mavsdk.rpc.telemetry.Covariance.covariance_matrix)
-  return _internal_mutable_covariance_matrix();
-}
-
 // -------------------------------------------------------------------
 
-// SpeedBody
-
-// float velocity_x_m_s = 1;
-inline void SpeedBody::clear_velocity_x_m_s() {
-  velocity_x_m_s_ = 0;
-}
-inline float SpeedBody::_internal_velocity_x_m_s() const {
-  return velocity_x_m_s_;
-}
-inline float SpeedBody::velocity_x_m_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedBody.velocity_x_m_s)
-  return _internal_velocity_x_m_s();
-}
-inline void SpeedBody::_internal_set_velocity_x_m_s(float value) {
-  
-  velocity_x_m_s_ = value;
-}
-inline void SpeedBody::set_velocity_x_m_s(float value) {
-  _internal_set_velocity_x_m_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedBody.velocity_x_m_s)
-}
-
-// float velocity_y_m_s = 2;
-inline void SpeedBody::clear_velocity_y_m_s() {
-  velocity_y_m_s_ = 0;
-}
-inline float SpeedBody::_internal_velocity_y_m_s() const {
-  return velocity_y_m_s_;
-}
-inline float SpeedBody::velocity_y_m_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedBody.velocity_y_m_s)
-  return _internal_velocity_y_m_s();
-}
-inline void SpeedBody::_internal_set_velocity_y_m_s(float value) {
-  
-  velocity_y_m_s_ = value;
-}
-inline void SpeedBody::set_velocity_y_m_s(float value) {
-  _internal_set_velocity_y_m_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedBody.velocity_y_m_s)
-}
-
-// float velocity_z_m_s = 3;
-inline void SpeedBody::clear_velocity_z_m_s() {
-  velocity_z_m_s_ = 0;
-}
-inline float SpeedBody::_internal_velocity_z_m_s() const {
-  return velocity_z_m_s_;
-}
-inline float SpeedBody::velocity_z_m_s() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.SpeedBody.velocity_z_m_s)
-  return _internal_velocity_z_m_s();
-}
-inline void SpeedBody::_internal_set_velocity_z_m_s(float value) {
-  
-  velocity_z_m_s_ = value;
-}
-inline void SpeedBody::set_velocity_z_m_s(float value) {
-  _internal_set_velocity_z_m_s(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.SpeedBody.velocity_z_m_s)
-}
-
 // -------------------------------------------------------------------
 
-// PositionBody
-
-// float x_m = 1;
-inline void PositionBody::clear_x_m() {
-  x_m_ = 0;
-}
-inline float PositionBody::_internal_x_m() const {
-  return x_m_;
-}
-inline float PositionBody::x_m() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.PositionBody.x_m)
-  return _internal_x_m();
-}
-inline void PositionBody::_internal_set_x_m(float value) {
-  
-  x_m_ = value;
-}
-inline void PositionBody::set_x_m(float value) {
-  _internal_set_x_m(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.PositionBody.x_m)
-}
-
-// float y_m = 2;
-inline void PositionBody::clear_y_m() {
-  y_m_ = 0;
-}
-inline float PositionBody::_internal_y_m() const {
-  return y_m_;
-}
-inline float PositionBody::y_m() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.PositionBody.y_m)
-  return _internal_y_m();
-}
-inline void PositionBody::_internal_set_y_m(float value) {
-  
-  y_m_ = value;
-}
-inline void PositionBody::set_y_m(float value) {
-  _internal_set_y_m(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.PositionBody.y_m)
-}
+// -------------------------------------------------------------------
 
-// float z_m = 3;
-inline void PositionBody::clear_z_m() {
-  z_m_ = 0;
-}
-inline float PositionBody::_internal_z_m() const {
-  return z_m_;
-}
-inline float PositionBody::z_m() const {
-  // @@protoc_insertion_point(field_get:mavsdk.rpc.telemetry.PositionBody.z_m)
-  return _internal_z_m();
-}
-inline void PositionBody::_internal_set_z_m(float value) {
-  
-  z_m_ = value;
-}
-inline void PositionBody::set_z_m(float value) {
-  _internal_set_z_m(value);
-  // @@protoc_insertion_point(field_set:mavsdk.rpc.telemetry.PositionBody.z_m)
-}
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -8,11 +8,35 @@
 namespace mavsdk {
 namespace backend {
 
+constexpr unsigned GRPCServer::_num_completion_queue_threads;
+
+GRPCServer::~GRPCServer()
+{
+    if (_server == nullptr) {
+        return;
+    }
+
+    _server->Shutdown();
+
+    // No new calls must be requested once the queue is shut down.
+    _telemetry_service.stop();
+    _completion_queue->Shutdown();
+
+    for (auto& thread : _completion_queue_threads) {
+        thread.join();
+    }
+}
+
 void GRPCServer::set_port(const int port)
 {
     _port = port;
 }
 
+void GRPCServer::set_address(const std::string& address)
+{
+    _address = address;
+}
+
 int GRPCServer::run()
 {
     grpc::ServerBuilder builder;
@@ -32,13 +56,28 @@ int GRPCServer::run()
     builder.RegisterService(&_shell_service);
     builder.RegisterService(&_mocap_service);
 
+    _completion_queue = builder.AddCompletionQueue();
     _server = builder.BuildAndStart();
 
+    if (_server != nullptr) {
+        _telemetry_service.start(_completion_queue.get());
+
+        for (unsigned i = 0; i < _num_completion_queue_threads; ++i) {
+            _completion_queue_threads.emplace_back(&GRPCServer::run_completion_queue, this);
+        }
+    }
+
     if (_bound_port != 0) {
         LogInfo() << "Server started";
-        LogInfo() << "Server set to listen on 0.0.0.0:" << _bound_port;
-    } else {
+        if (_address.empty()) {
+            LogInfo() << "Server set to listen on 0.0.0.0:" << _bound_port;
+        } else {
+            LogInfo() << "Server set to listen on " << _address;
+        }
+    } else if (_address.empty()) {
         LogErr() << "Failed to bind server to port " << _port;
+    } else {
+        LogErr() << "Failed to bind server to " << _address;
     }
 
     return _bound_port;
@@ -53,9 +92,23 @@ void GRPCServer::wait()
     }
 }
 
+void GRPCServer::run_completion_queue()
+{
+    void* tag = nullptr;
+    bool ok = false;
+
+    // Next only returns false once the queue is shut down and drained.
+    while (_completion_queue->Next(&tag, &ok)) {
+        static_cast<AsyncTag*>(tag)->proceed(ok);
+    }
+}
+
 void GRPCServer::setup_port(grpc::ServerBuilder& builder)
 {
-    const std::string server_address("0.0.0.0:" + std::to_string(_port));
+    // For Unix domain sockets, gRPC reports port 1 once bound, so the bound port
+    // tells whether the server is listening either way.
+    const std::string server_address =
+        _address.empty() ? "0.0.0.0:" + std::to_string(_port) : _address;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials(), &_bound_port);
 }
 
@@ -3,6 +3,9 @@
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <memory>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "plugins/action/action.h"
 #include "action/action_service_impl.h"
@@ -14,7 +17,7 @@
 #include "mavsdk.h"
 #include "plugins/mission/mission.h"
 #include "mission/mission_service_impl.h"
-#include "telemetry/telemetry_service_impl.h"
+#include "telemetry/telemetry_async_service_impl.h"
 #include "info/info_service_impl.h"
 #include "plugins/geofence/geofence.h"
 #include "geofence/geofence_service_impl.h"
@@ -38,70 +41,59 @@ public:
         _port(0),
         _dc(dc),
         _core(_dc),
-        _action(_dc.system()),
-        _action_service(_action),
-        _calibration(_dc.system()),
-        _calibration_service(_calibration),
-        _geofence(_dc.system()),
-        _geofence_service(_geofence),
-        _gimbal(_dc.system()),
-        _gimbal_service(_gimbal),
-        _camera(_dc.system()),
-        _camera_service(_camera),
-        _mission(_dc.system()),
-        _mission_service(_mission),
-        _offboard(_dc.system()),
-        _offboard_service(_offboard),
-        _telemetry(_dc.system()),
-        _telemetry_service(_telemetry),
-        _info(_dc.system()),
-        _info_service(_info),
-        _param(_dc.system()),
-        _param_service(_param),
-        _shell(_dc.system()),
-        _shell_service(_shell),
-        _mocap(_dc.system()),
-        _mocap_service(_mocap)
+        _action_service(_dc),
+        _calibration_service(_dc),
+        _camera_service(_dc),
+        _geofence_service(_dc),
+        _gimbal_service(_dc),
+        _mission_service(_dc),
+        _offboard_service(_dc),
+        _telemetry_service(_dc),
+        _info_service(_dc),
+        _param_service(_dc),
+        _shell_service(_dc),
+        _mocap_service(_dc)
     {}
 
+    ~GRPCServer();
+
     void set_port(int port);
+    // Listens on a gRPC address instead of a TCP port on all interfaces, e.g. on
+    // a Unix domain socket with "unix:///run/mavsdk.sock".
+    void set_address(const std::string& address);
     int run();
     void wait();
 
 private:
     void setup_port(grpc::ServerBuilder& builder);
+    void run_completion_queue();
+
+    // Number of threads serving the asynchronous services, independent of the
+    // number of clients and streams.
+    static constexpr unsigned _num_completion_queue_threads = 4;
 
     Mavsdk& _dc;
 
     CoreServiceImpl<> _core;
-    Action _action;
     ActionServiceImpl<> _action_service;
-    Calibration _calibration;
     CalibrationServiceImpl<> _calibration_service;
-    Camera _camera;
     CameraServiceImpl<> _camera_service;
-    Geofence _geofence;
     GeofenceServiceImpl<> _geofence_service;
-    Gimbal _gimbal;
     GimbalServiceImpl<> _gimbal_service;
-    Mission _mission;
     MissionServiceImpl<> _mission_service;
-    Offboard _offboard;
     OffboardServiceImpl<> _offboard_service;
-    Telemetry _telemetry;
-    TelemetryServiceImpl<> _telemetry_service;
-    Info _info;
+    TelemetryAsyncServiceImpl<> _telemetry_service;
     InfoServiceImpl<> _info_service;
-    Param _param;
     ParamServiceImpl<> _param_service;
-    Shell _shell;
     ShellServiceImpl<> _shell_service;
-    Mocap _mocap;
     MocapServiceImpl<> _mocap_service;
 
     std::unique_ptr<grpc::Server> _server;
+    std::unique_ptr<grpc::ServerCompletionQueue> _completion_queue;
+    std::vector<std::thread> _completion_queue_threads{};
 
     int _port;
+    std::string _address{};
     int _bound_port = 0;
 };
 
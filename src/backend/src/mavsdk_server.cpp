@@ -1,4 +1,5 @@
 #include "backend_api.h"
+#include "metrics_server.h"
 
 #include <cctype>
 #include <iostream>
@@ -9,11 +10,14 @@ static auto default_mavsdk_server_port = 0;
 
 static void usage();
 static bool is_integer(const std::string& tested_integer);
+static bool is_unix_socket_address(const std::string& address);
 
 int main(int argc, char** argv)
 {
     std::string connection_url = default_connection;
     int mavsdk_server_port = default_mavsdk_server_port;
+    std::string mavsdk_server_address;
+    int metrics_port = -1;
 
     for (int i = 1; i < argc; i++) {
         const std::string current_arg = argv[i];
@@ -30,24 +34,56 @@ int main(int argc, char** argv)
             const std::string port(argv[i + 1]);
             i++;
 
+            if (is_unix_socket_address(port)) {
+                mavsdk_server_address = port;
+                continue;
+            }
+
             if (!is_integer(port)) {
                 usage();
                 return 1;
             }
 
             mavsdk_server_port = std::stoi(port);
+        } else if (current_arg == "--metrics-port") {
+            if (argc <= i + 1) {
+                usage();
+                return 1;
+            }
+
+            const std::string port(argv[i + 1]);
+            i++;
+
+            if (!is_integer(port)) {
+                usage();
+                return 1;
+            }
+
+            metrics_port = std::stoi(port);
         } else {
             connection_url = current_arg;
         }
     }
 
-    runBackend(connection_url.c_str(), mavsdk_server_port, nullptr, nullptr);
+    // Off unless asked for.
+    mavsdk::backend::MetricsServer metrics_server;
+    if (metrics_port >= 0 && metrics_server.start(metrics_port) == 0) {
+        return 1;
+    }
+
+    if (!mavsdk_server_address.empty()) {
+        runBackendOnAddress(
+            connection_url.c_str(), mavsdk_server_address.c_str(), nullptr, nullptr);
+    } else {
+        runBackend(connection_url.c_str(), mavsdk_server_port, nullptr, nullptr);
+    }
 }
 
 void usage()
 {
     std::cout << "Usage: backend_bin [-h | --help]" << std::endl
-              << "       backend_bin [-p mavsdk_server_port] [Connection URL]" << std::endl
+              << "       backend_bin [-p mavsdk_server_port | -p unix:///path/to/socket]"
+              << " [--metrics-port port] [Connection URL]" << std::endl
               << std::endl
               << "Connection URL format should be:" << std::endl
               << "  Serial: serial:///path/to/serial/dev[:baudrate]" << std::endl
@@ -58,7 +94,11 @@ void usage()
               << std::endl
               << "Options:" << std::endl
               << "  -h | --help : show this help" << std::endl
-              << "  -p          : set the port on which to run the gRPC server" << std::endl;
+              << "  -p          : set the port on which to run the gRPC server, or a Unix"
+              << std::endl
+              << "                domain socket for clients on the same host" << std::endl
+              << "  --metrics-port : serve metrics in the Prometheus text format on" << std::endl
+              << "                   http://127.0.0.1:<port>/metrics" << std::endl;
 }
 
 bool is_integer(const std::string& tested_integer)
@@ -71,3 +111,9 @@ bool is_integer(const std::string& tested_integer)
 
     return true;
 }
+
+bool is_unix_socket_address(const std::string& address)
+{
+    const std::string prefix = "unix://";
+    return address.size() > prefix.size() && address.compare(0, prefix.size(), prefix) == 0;
+}
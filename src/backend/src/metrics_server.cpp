@@ -0,0 +1,222 @@
+#include "metrics_server.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "log.h"
+#include "metrics.h"
+
+#ifdef WINDOWS
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#ifndef MINGW
+#pragma comment(lib, "Ws2_32.lib") // Without this, Ws2_32.lib is not included in static library.
+#endif
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h> // for close()
+#endif
+
+#ifndef WINDOWS
+#define GET_ERROR(_x) strerror(_x)
+#else
+#define GET_ERROR(_x) WSAGetLastError()
+#endif
+
+namespace mavsdk {
+namespace backend {
+
+namespace {
+
+// Requests are a single line and a few headers, anything longer is not for us.
+constexpr size_t max_request_size = 8192;
+
+// A client hanging up early must not take the server down with SIGPIPE.
+#ifdef MSG_NOSIGNAL
+constexpr int send_flags = MSG_NOSIGNAL;
+#else
+constexpr int send_flags = 0;
+#endif
+
+void close_socket(int fd)
+{
+#ifndef WINDOWS
+    close(fd);
+#else
+    closesocket(fd);
+#endif
+}
+
+void send_all(int fd, const std::string& data)
+{
+    size_t sent = 0;
+    while (sent < data.size()) {
+        const auto sent_now = send(fd, data.data() + sent, data.size() - sent, send_flags);
+        if (sent_now <= 0) {
+            return;
+        }
+        sent += static_cast<size_t>(sent_now);
+    }
+}
+
+std::string response(const std::string& status, const std::string& body)
+{
+    return "HTTP/1.0 " + status +
+           "\r\n"
+           "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+           "Content-Length: " +
+           std::to_string(body.size()) +
+           "\r\n"
+           "Connection: close\r\n"
+           "\r\n" +
+           body;
+}
+
+} // namespace
+
+MetricsServer::~MetricsServer()
+{
+    stop();
+}
+
+int MetricsServer::start(int port)
+{
+#ifdef WINDOWS
+    WSADATA wsa;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0) {
+        LogErr() << "Error: Winsock failed, error: " << WSAGetLastError();
+        return 0;
+    }
+#endif
+
+    _socket_fd = static_cast<int>(socket(AF_INET, SOCK_STREAM, 0));
+    if (_socket_fd < 0) {
+        LogErr() << "metrics socket error: " << GET_ERROR(errno);
+        return 0;
+    }
+
+    const int reuse = 1;
+    setsockopt(
+        _socket_fd,
+        SOL_SOCKET,
+        SO_REUSEADDR,
+        reinterpret_cast<const char*>(&reuse),
+        sizeof(reuse));
+
+    // Only local, the metrics are not meant to be exposed to the network.
+    struct sockaddr_in addr {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    socklen_t addr_len = sizeof(addr);
+    if (bind(_socket_fd, reinterpret_cast<sockaddr*>(&addr), addr_len) != 0 ||
+        listen(_socket_fd, 4) != 0 ||
+        getsockname(_socket_fd, reinterpret_cast<sockaddr*>(&addr), &addr_len) != 0) {
+        LogErr() << "metrics bind error: " << GET_ERROR(errno);
+        close_socket(_socket_fd);
+        _socket_fd = -1;
+        return 0;
+    }
+
+    const int bound_port = ntohs(addr.sin_port);
+
+    _should_exit = false;
+    _thread.reset(new std::thread(&MetricsServer::serve, this));
+
+    LogInfo() << "Metrics served on http://127.0.0.1:" << bound_port << "/metrics";
+    return bound_port;
+}
+
+void MetricsServer::stop()
+{
+    if (!_thread) {
+        return;
+    }
+
+    _should_exit = true;
+
+#ifndef WINDOWS
+    // This should interrupt the accept call.
+    shutdown(_socket_fd, SHUT_RDWR);
+#else
+    shutdown(_socket_fd, SD_BOTH);
+#endif
+    close_socket(_socket_fd);
+
+    _thread->join();
+    _thread.reset();
+    _socket_fd = -1;
+
+#ifdef WINDOWS
+    WSACleanup();
+#endif
+}
+
+void MetricsServer::serve()
+{
+    while (!_should_exit) {
+        const int fd = static_cast<int>(accept(_socket_fd, nullptr, nullptr));
+        if (fd < 0) {
+            // Expected when stopping. Otherwise, e.g. when out of file descriptors, accept
+            // would fail again right away, so wait a bit before trying the next client.
+            if (!_should_exit) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+            continue;
+        }
+
+        handle_connection(fd);
+        close_socket(fd);
+    }
+}
+
+void MetricsServer::handle_connection(int fd)
+{
+    // Don't let a client which never finishes its request block the others.
+#ifndef WINDOWS
+    struct timeval timeout {};
+    timeout.tv_sec = 1;
+#else
+    DWORD timeout = 1000;
+#endif
+    setsockopt(
+        fd, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < max_request_size) {
+        const auto received = recv(fd, buffer, sizeof(buffer), 0);
+        if (received <= 0) {
+            return;
+        }
+        request.append(buffer, static_cast<size_t>(received));
+    }
+
+    const auto line_end = request.find("\r\n");
+    const std::string request_line = request.substr(0, line_end);
+
+    if (request_line.compare(0, 4, "GET ") != 0) {
+        send_all(fd, response("405 Method Not Allowed", "Only GET is supported.\n"));
+        return;
+    }
+
+    const auto path_end = request_line.find_first_of(" ?", 4);
+    const std::string path = request_line.substr(4, path_end - 4);
+
+    if (path != "/metrics") {
+        send_all(fd, response("404 Not Found", "Metrics are at /metrics.\n"));
+        return;
+    }
+
+    send_all(fd, response("200 OK", MetricsRegistry::Instance().prometheus_text()));
+}
+
+} // namespace backend
+} // namespace mavsdk
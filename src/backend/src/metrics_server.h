@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace mavsdk {
+namespace backend {
+
+/*
+ * Serves the metrics of MetricsRegistry as Prometheus text on
+ * http://127.0.0.1:<port>/metrics.
+ *
+ * This is deliberately minimal: one request per connection, handled one after
+ * the other on a single thread which otherwise just waits in accept(), so it
+ * costs nothing while nobody scrapes.
+ */
+class MetricsServer {
+public:
+    MetricsServer() = default;
+    ~MetricsServer();
+
+    // Returns the port listened on (useful with port 0), or 0 on failure.
+    int start(int port);
+    void stop();
+
+    // Non-copyable
+    MetricsServer(const MetricsServer&) = delete;
+    const MetricsServer& operator=(const MetricsServer&) = delete;
+
+private:
+    void serve();
+    void handle_connection(int fd);
+
+    int _socket_fd{-1};
+    std::atomic<bool> _should_exit{false};
+    std::unique_ptr<std::thread> _thread{};
+};
+
+} // namespace backend
+} // namespace mavsdk
@@ -1,5 +1,6 @@
 #include "action/action.grpc.pb.h"
 #include "plugins/action/action.h"
+#include "system_plugins.h"
 
 namespace mavsdk {
 namespace backend {
@@ -7,14 +8,20 @@ namespace backend {
 template<typename Action = Action>
 class ActionServiceImpl final : public rpc::action::ActionService::Service {
 public:
-    ActionServiceImpl(Action& action) : _action(action) {}
+    ActionServiceImpl(Action& action) : _actions(action) {}
+    ActionServiceImpl(mavsdk::Mavsdk& mavsdk) : _actions(mavsdk) {}
 
     grpc::Status
-    Arm(grpc::ServerContext* /* context */,
+    Arm(grpc::ServerContext* context,
         const rpc::action::ArmRequest* /* request */,
         rpc::action::ArmResponse* response) override
     {
-        auto action_result = _action.arm();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->arm();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -36,11 +43,16 @@ public:
     }
 
     grpc::Status Disarm(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::DisarmRequest* /* request */,
         rpc::action::DisarmResponse* response) override
     {
-        auto action_result = _action.disarm();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->disarm();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -50,11 +62,16 @@ public:
     }
 
     grpc::Status Takeoff(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::TakeoffRequest* /* request */,
         rpc::action::TakeoffResponse* response) override
     {
-        auto action_result = _action.takeoff();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->takeoff();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -64,11 +81,16 @@ public:
     }
 
     grpc::Status Land(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::LandRequest* /* request */,
         rpc::action::LandResponse* response) override
     {
-        auto action_result = _action.land();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->land();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -78,11 +100,16 @@ public:
     }
 
     grpc::Status Reboot(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::RebootRequest* /* request */,
         rpc::action::RebootResponse* response) override
     {
-        auto action_result = _action.reboot();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->reboot();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -92,11 +119,16 @@ public:
     }
 
     grpc::Status Kill(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::KillRequest* /* request */,
         rpc::action::KillResponse* response) override
     {
-        auto action_result = _action.kill();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->kill();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -106,11 +138,16 @@ public:
     }
 
     grpc::Status ReturnToLaunch(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::ReturnToLaunchRequest* /* request */,
         rpc::action::ReturnToLaunchResponse* response) override
     {
-        auto action_result = _action.return_to_launch();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->return_to_launch();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -120,11 +157,16 @@ public:
     }
 
     grpc::Status TransitionToFixedWing(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::TransitionToFixedWingRequest* /* request */,
         rpc::action::TransitionToFixedWingResponse* response) override
     {
-        auto action_result = _action.transition_to_fixedwing();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->transition_to_fixedwing();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -134,11 +176,16 @@ public:
     }
 
     grpc::Status TransitionToMulticopter(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::TransitionToMulticopterRequest* /* request */,
         rpc::action::TransitionToMulticopterResponse* response) override
     {
-        auto action_result = _action.transition_to_multicopter();
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
+        auto action_result = action->transition_to_multicopter();
 
         if (response != nullptr) {
             fillResponseWithResult(response, action_result);
@@ -148,12 +195,17 @@ public:
     }
 
     grpc::Status GetTakeoffAltitude(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::GetTakeoffAltitudeRequest* /* request */,
         rpc::action::GetTakeoffAltitudeResponse* response) override
     {
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
         if (response != nullptr) {
-            auto result_pair = _action.get_takeoff_altitude();
+            auto result_pair = action->get_takeoff_altitude();
 
             auto* rpc_action_result = new rpc::action::ActionResult();
             rpc_action_result->set_result(
@@ -168,25 +220,35 @@ public:
     }
 
     grpc::Status SetTakeoffAltitude(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::SetTakeoffAltitudeRequest* request,
         rpc::action::SetTakeoffAltitudeResponse* /* response */) override
     {
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_altitude = request->altitude();
-            _action.set_takeoff_altitude(requested_altitude);
+            action->set_takeoff_altitude(requested_altitude);
         }
 
         return grpc::Status::OK;
     }
 
     grpc::Status GetMaximumSpeed(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::GetMaximumSpeedRequest* /* request */,
         rpc::action::GetMaximumSpeedResponse* response) override
     {
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
         if (response != nullptr) {
-            auto result_pair = _action.get_max_speed();
+            auto result_pair = action->get_max_speed();
 
             auto* rpc_action_result = new rpc::action::ActionResult();
             rpc_action_result->set_result(
@@ -201,13 +263,18 @@ public:
     }
 
     grpc::Status SetMaximumSpeed(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::SetMaximumSpeedRequest* request,
         rpc::action::SetMaximumSpeedResponse* response) override
     {
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_speed = request->speed();
-            mavsdk::Action::Result action_result = _action.set_max_speed(requested_speed);
+            mavsdk::Action::Result action_result = action->set_max_speed(requested_speed);
 
             if (response != nullptr) {
                 auto* rpc_action_result = new rpc::action::ActionResult();
@@ -222,12 +289,17 @@ public:
     }
 
     grpc::Status GetReturnToLaunchAltitude(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::GetReturnToLaunchAltitudeRequest* /* request */,
         rpc::action::GetReturnToLaunchAltitudeResponse* response) override
     {
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
         if (response != nullptr) {
-            auto result_pair = _action.get_return_to_launch_return_altitude();
+            auto result_pair = action->get_return_to_launch_return_altitude();
 
             auto* rpc_action_result = new rpc::action::ActionResult();
             rpc_action_result->set_result(
@@ -242,14 +314,19 @@ public:
     }
 
     grpc::Status SetReturnToLaunchAltitude(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::action::SetReturnToLaunchAltitudeRequest* request,
         rpc::action::SetReturnToLaunchAltitudeResponse* response) override
     {
+        auto* action = _actions.get(context);
+        if (action == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_altitude = request->relative_altitude_m();
             const auto action_result =
-                _action.set_return_to_launch_return_altitude(requested_altitude);
+                action->set_return_to_launch_return_altitude(requested_altitude);
 
             if (response != nullptr) {
                 auto* rpc_action_result = new rpc::action::ActionResult();
@@ -265,7 +342,7 @@ public:
     }
 
 private:
-    Action& _action;
+    SystemPlugins<Action> _actions;
 };
 
 } // namespace backend
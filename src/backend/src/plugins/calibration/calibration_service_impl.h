@@ -2,6 +2,7 @@
 
 #include "calibration/calibration.grpc.pb.h"
 #include "plugins/calibration/calibration.h"
+#include "system_plugins.h"
 
 namespace mavsdk {
 namespace backend {
@@ -9,7 +10,8 @@ namespace backend {
 template<typename Calibration = Calibration>
 class CalibrationServiceImpl final : public rpc::calibration::CalibrationService::Service {
 public:
-    CalibrationServiceImpl(Calibration& calibration) : _calibration(calibration) {}
+    CalibrationServiceImpl(Calibration& calibration) : _calibrations(calibration) {}
+    CalibrationServiceImpl(mavsdk::Mavsdk& mavsdk) : _calibrations(mavsdk) {}
 
     static std::unique_ptr<rpc::calibration::CalibrationResult>
     translateCalibrationResult(const mavsdk::Calibration::Result& calibration_result)
@@ -40,17 +42,22 @@ public:
     }
 
     grpc::Status SubscribeCalibrateGyro(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::calibration::SubscribeCalibrateGyroRequest* request,
         grpc::ServerWriter<rpc::calibration::CalibrateGyroResponse>* writer) override
     {
+        auto* calibration = _calibrations.get(context);
+        if (calibration == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _calibration.calibrate_gyro_async(
-            [this, &writer, &stream_closed_promise, is_finished](
+        calibration->calibrate_gyro_async(
+            [this, calibration, &writer, &stream_closed_promise, is_finished](
                 const mavsdk::Calibration::Result result,
                 const mavsdk::Calibration::ProgressData progress_data) {
                 rpc::calibration::CalibrateGyroResponse rpc_response;
@@ -61,7 +68,7 @@ public:
 
                 std::lock_guard<std::mutex> lock(_subscribe_mutex);
                 if (!*is_finished && !writer->Write(rpc_response)) {
-                    _calibration.calibrate_gyro_async(nullptr);
+                    calibration->calibrate_gyro_async(nullptr);
                     *is_finished = true;
                     stream_closed_promise.set_value();
                 }
@@ -72,17 +79,22 @@ public:
     }
 
     grpc::Status SubscribeCalibrateAccelerometer(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::calibration::SubscribeCalibrateAccelerometerRequest* request,
         grpc::ServerWriter<rpc::calibration::CalibrateAccelerometerResponse>* writer) override
     {
+        auto* calibration = _calibrations.get(context);
+        if (calibration == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _calibration.calibrate_accelerometer_async(
-            [this, &writer, &stream_closed_promise, is_finished](
+        calibration->calibrate_accelerometer_async(
+            [this, calibration, &writer, &stream_closed_promise, is_finished](
                 const mavsdk::Calibration::Result result,
                 const mavsdk::Calibration::ProgressData progress_data) {
                 rpc::calibration::CalibrateAccelerometerResponse rpc_response;
@@ -94,7 +106,7 @@ public:
                 std::lock_guard<std::mutex> lock(_subscribe_mutex);
 
                 if (!*is_finished && !writer->Write(rpc_response)) {
-                    _calibration.calibrate_accelerometer_async(nullptr);
+                    calibration->calibrate_accelerometer_async(nullptr);
                     *is_finished = true;
                     stream_closed_promise.set_value();
                 }
@@ -105,17 +117,22 @@ public:
     }
 
     grpc::Status SubscribeCalibrateMagnetometer(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::calibration::SubscribeCalibrateMagnetometerRequest* request,
         grpc::ServerWriter<rpc::calibration::CalibrateMagnetometerResponse>* writer) override
     {
+        auto* calibration = _calibrations.get(context);
+        if (calibration == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _calibration.calibrate_magnetometer_async(
-            [this, &writer, &stream_closed_promise, is_finished](
+        calibration->calibrate_magnetometer_async(
+            [this, calibration, &writer, &stream_closed_promise, is_finished](
                 const mavsdk::Calibration::Result result,
                 const mavsdk::Calibration::ProgressData progress_data) {
                 rpc::calibration::CalibrateMagnetometerResponse rpc_response;
@@ -126,7 +143,7 @@ public:
 
                 std::lock_guard<std::mutex> lock(_subscribe_mutex);
                 if (!*is_finished && !writer->Write(rpc_response)) {
-                    _calibration.calibrate_magnetometer_async(nullptr);
+                    calibration->calibrate_magnetometer_async(nullptr);
                     *is_finished = true;
                     stream_closed_promise.set_value();
                 }
@@ -137,17 +154,22 @@ public:
     }
 
     grpc::Status SubscribeCalibrateGimbalAccelerometer(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::calibration::SubscribeCalibrateGimbalAccelerometerRequest* request,
         grpc::ServerWriter<rpc::calibration::CalibrateGimbalAccelerometerResponse>* writer) override
     {
+        auto* calibration = _calibrations.get(context);
+        if (calibration == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _calibration.calibrate_gimbal_accelerometer_async(
-            [this, &writer, &stream_closed_promise, is_finished](
+        calibration->calibrate_gimbal_accelerometer_async(
+            [this, calibration, &writer, &stream_closed_promise, is_finished](
                 const mavsdk::Calibration::Result result,
                 const mavsdk::Calibration::ProgressData progress_data) {
                 rpc::calibration::CalibrateGimbalAccelerometerResponse rpc_response;
@@ -158,7 +180,7 @@ public:
 
                 std::lock_guard<std::mutex> lock(_subscribe_mutex);
                 if (!*is_finished && !writer->Write(rpc_response)) {
-                    _calibration.calibrate_gimbal_accelerometer_async(nullptr);
+                    calibration->calibrate_gimbal_accelerometer_async(nullptr);
                     *is_finished = true;
                     stream_closed_promise.set_value();
                 }
@@ -169,16 +191,21 @@ public:
     }
 
     grpc::Status Cancel(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::calibration::CancelRequest* /* request */,
         rpc::calibration::CancelResponse* /* response */) override
     {
-        _calibration.cancel_calibration();
+        auto* calibration = _calibrations.get(context);
+        if (calibration == nullptr) {
+            return no_system_status();
+        }
+
+        calibration->cancel_calibration();
         return grpc::Status::OK;
     }
 
 private:
-    Calibration& _calibration;
+    SystemPlugins<Calibration> _calibrations;
     std::mutex _subscribe_mutex{};
 };
 
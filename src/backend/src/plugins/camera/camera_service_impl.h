@@ -1,6 +1,7 @@
 #include <future>
 
 #include "plugins/camera/camera.h"
+#include "system_plugins.h"
 #include "camera/camera.grpc.pb.h"
 
 namespace mavsdk {
@@ -9,14 +10,20 @@ namespace backend {
 template<typename Camera = Camera>
 class CameraServiceImpl final : public rpc::camera::CameraService::Service {
 public:
-    CameraServiceImpl(Camera& camera) : _camera(camera) {}
+    CameraServiceImpl(Camera& camera) : _cameras(camera) {}
+    CameraServiceImpl(mavsdk::Mavsdk& mavsdk) : _cameras(mavsdk) {}
 
     grpc::Status TakePhoto(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::TakePhotoRequest* /* request */,
         rpc::camera::TakePhotoResponse* response) override
     {
-        auto camera_result = _camera.take_photo();
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
+        auto camera_result = camera->take_photo();
 
         if (response != nullptr) {
             fillResponseWithResult(response, camera_result);
@@ -38,10 +45,15 @@ public:
     }
 
     grpc::Status StartPhotoInterval(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::StartPhotoIntervalRequest* request,
         rpc::camera::StartPhotoIntervalResponse* response) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         if (request == nullptr) {
             if (response != nullptr) {
                 fillResponseWithResult(response, mavsdk::Camera::Result::WRONG_ARGUMENT);
@@ -50,7 +62,7 @@ public:
             return grpc::Status::OK;
         }
 
-        auto camera_result = _camera.start_photo_interval(request->interval_s());
+        auto camera_result = camera->start_photo_interval(request->interval_s());
 
         if (response != nullptr) {
             fillResponseWithResult(response, camera_result);
@@ -60,11 +72,16 @@ public:
     }
 
     grpc::Status StopPhotoInterval(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::StopPhotoIntervalRequest* /* request */,
         rpc::camera::StopPhotoIntervalResponse* response) override
     {
-        auto camera_result = _camera.stop_photo_interval();
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
+        auto camera_result = camera->stop_photo_interval();
 
         if (response != nullptr) {
             fillResponseWithResult(response, camera_result);
@@ -74,11 +91,16 @@ public:
     }
 
     grpc::Status StartVideo(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::StartVideoRequest* /* request */,
         rpc::camera::StartVideoResponse* response) override
     {
-        auto camera_result = _camera.start_video();
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
+        auto camera_result = camera->start_video();
 
         if (response != nullptr) {
             fillResponseWithResult(response, camera_result);
@@ -88,11 +110,16 @@ public:
     }
 
     grpc::Status StopVideo(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::StopVideoRequest* /* request */,
         rpc::camera::StopVideoResponse* response) override
     {
-        auto camera_result = _camera.stop_video();
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
+        auto camera_result = camera->stop_video();
 
         if (response != nullptr) {
             fillResponseWithResult(response, camera_result);
@@ -102,11 +129,16 @@ public:
     }
 
     grpc::Status StartVideoStreaming(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::StartVideoStreamingRequest* /* request */,
         rpc::camera::StartVideoStreamingResponse* response) override
     {
-        auto camera_result = _camera.start_video_streaming();
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
+        auto camera_result = camera->start_video_streaming();
 
         if (response != nullptr) {
             fillResponseWithResult(response, camera_result);
@@ -116,11 +148,16 @@ public:
     }
 
     grpc::Status StopVideoStreaming(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::StopVideoStreamingRequest* /* request */,
         rpc::camera::StopVideoStreamingResponse* response) override
     {
-        auto camera_result = _camera.stop_video_streaming();
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
+        auto camera_result = camera->stop_video_streaming();
 
         if (response != nullptr) {
             fillResponseWithResult(response, camera_result);
@@ -130,12 +167,17 @@ public:
     }
 
     grpc::Status SetMode(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::SetModeRequest* request,
         rpc::camera::SetModeResponse* response) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
-            auto camera_result = _camera.set_mode(translateRPCCameraMode(request->camera_mode()));
+            auto camera_result = camera->set_mode(translateRPCCameraMode(request->camera_mode()));
 
             if (response != nullptr) {
                 fillResponseWithResult(response, camera_result);
@@ -170,29 +212,34 @@ public:
     }
 
     grpc::Status SubscribeMode(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::SubscribeModeRequest* /* request */,
         grpc::ServerWriter<rpc::camera::ModeResponse>* writer) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _camera.subscribe_mode(
+        const auto handle = camera->add_mode_subscriber(
             [this, &writer, &stream_closed_promise, is_finished](const mavsdk::Camera::Mode mode) {
                 rpc::camera::ModeResponse rpc_mode_response;
                 rpc_mode_response.set_camera_mode(translateCameraMode(mode));
 
                 std::lock_guard<std::mutex> lock(_subscribe_mutex);
                 if (!*is_finished && !writer->Write(rpc_mode_response)) {
-                    _camera.subscribe_mode(nullptr);
                     *is_finished = true;
                     stream_closed_promise.set_value();
                 }
             });
 
         stream_closed_future.wait();
+        camera->unsubscribe(handle);
         return grpc::Status::OK;
     }
 
@@ -282,60 +329,72 @@ public:
     }
 
     grpc::Status SubscribeVideoStreamInfo(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::SubscribeVideoStreamInfoRequest* /* request */,
         grpc::ServerWriter<rpc::camera::VideoStreamInfoResponse>* writer) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _camera.subscribe_video_stream_info([this, &writer, &stream_closed_promise, is_finished](
-                                                const mavsdk::Camera::VideoStreamInfo video_info) {
-            rpc::camera::VideoStreamInfoResponse rpc_video_stream_info_response;
-            auto video_stream_info = translateVideoStreamInfo(video_info);
-            rpc_video_stream_info_response.set_allocated_video_stream_info(
-                video_stream_info.release());
-
-            std::lock_guard<std::mutex> lock(_subscribe_mutex);
-            if (!*is_finished && !writer->Write(rpc_video_stream_info_response)) {
-                _camera.subscribe_video_stream_info(nullptr);
-                *is_finished = true;
-                stream_closed_promise.set_value();
-            }
-        });
+        const auto handle = camera->add_video_stream_info_subscriber(
+            [this, &writer, &stream_closed_promise, is_finished](
+                const mavsdk::Camera::VideoStreamInfo video_info) {
+                rpc::camera::VideoStreamInfoResponse rpc_video_stream_info_response;
+                auto video_stream_info = translateVideoStreamInfo(video_info);
+                rpc_video_stream_info_response.set_allocated_video_stream_info(
+                    video_stream_info.release());
+
+                std::lock_guard<std::mutex> lock(_subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_video_stream_info_response)) {
+                    *is_finished = true;
+                    stream_closed_promise.set_value();
+                }
+            });
 
         stream_closed_future.wait();
+        camera->unsubscribe(handle);
 
         return grpc::Status::OK;
     }
 
     grpc::Status SubscribeCaptureInfo(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::SubscribeCaptureInfoRequest* /* request */,
         grpc::ServerWriter<rpc::camera::CaptureInfoResponse>* writer) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _camera.subscribe_capture_info([this, &writer, &stream_closed_promise, is_finished](
-                                           const mavsdk::Camera::CaptureInfo capture_info) {
-            rpc::camera::CaptureInfoResponse rpc_capture_info_response;
-            auto rpc_capture_info = translateCaptureInfo(capture_info);
-            rpc_capture_info_response.set_allocated_capture_info(rpc_capture_info.release());
-
-            std::lock_guard<std::mutex> lock(_subscribe_mutex);
-            if (!*is_finished && !writer->Write(rpc_capture_info_response)) {
-                _camera.subscribe_capture_info(nullptr);
-                *is_finished = true;
-                stream_closed_promise.set_value();
-            }
-        });
+        const auto handle = camera->add_capture_info_subscriber(
+            [this, &writer, &stream_closed_promise, is_finished](
+                const mavsdk::Camera::CaptureInfo capture_info) {
+                rpc::camera::CaptureInfoResponse rpc_capture_info_response;
+                auto rpc_capture_info = translateCaptureInfo(capture_info);
+                rpc_capture_info_response.set_allocated_capture_info(rpc_capture_info.release());
+
+                std::lock_guard<std::mutex> lock(_subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_capture_info_response)) {
+                    *is_finished = true;
+                    stream_closed_promise.set_value();
+                }
+            });
 
         stream_closed_future.wait();
+        camera->unsubscribe(handle);
 
         return grpc::Status::OK;
     }
@@ -449,30 +508,36 @@ public:
     }
 
     grpc::Status SubscribeCameraStatus(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::SubscribeCameraStatusRequest* /* request */,
         grpc::ServerWriter<rpc::camera::CameraStatusResponse>* writer) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _camera.subscribe_status([this, &writer, &stream_closed_promise, is_finished](
-                                     const mavsdk::Camera::Status camera_status) {
-            rpc::camera::CameraStatusResponse rpc_camera_status_response;
-            auto rpc_camera_status = translateCameraStatus(camera_status);
-            rpc_camera_status_response.set_allocated_camera_status(rpc_camera_status.release());
-
-            std::lock_guard<std::mutex> lock(_subscribe_mutex);
-            if (!*is_finished && !writer->Write(rpc_camera_status_response)) {
-                _camera.subscribe_status(nullptr);
-                *is_finished = true;
-                stream_closed_promise.set_value();
-            }
-        });
+        const auto handle = camera->add_status_subscriber(
+            [this, &writer, &stream_closed_promise, is_finished](
+                const mavsdk::Camera::Status camera_status) {
+                rpc::camera::CameraStatusResponse rpc_camera_status_response;
+                auto rpc_camera_status = translateCameraStatus(camera_status);
+                rpc_camera_status_response.set_allocated_camera_status(rpc_camera_status.release());
+
+                std::lock_guard<std::mutex> lock(_subscribe_mutex);
+                if (!*is_finished && !writer->Write(rpc_camera_status_response)) {
+                    *is_finished = true;
+                    stream_closed_promise.set_value();
+                }
+            });
 
         stream_closed_future.wait();
+        camera->unsubscribe(handle);
 
         return grpc::Status::OK;
     }
@@ -538,16 +603,21 @@ public:
     }
 
     grpc::Status SubscribeCurrentSettings(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::SubscribeCurrentSettingsRequest* /* request */,
         grpc::ServerWriter<rpc::camera::CurrentSettingsResponse>* writer) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _camera.subscribe_current_settings(
+        const auto handle = camera->add_current_settings_subscriber(
             [this, &writer, &stream_closed_promise, is_finished](
                 const std::vector<mavsdk::Camera::Setting> current_settings) {
                 rpc::camera::CurrentSettingsResponse rpc_current_setting_response;
@@ -559,13 +629,13 @@ public:
 
                 std::lock_guard<std::mutex> lock(_subscribe_mutex);
                 if (!*is_finished && !writer->Write(rpc_current_setting_response)) {
-                    _camera.subscribe_current_settings(nullptr);
                     *is_finished = true;
                     stream_closed_promise.set_value();
                 }
             });
 
         stream_closed_future.wait();
+        camera->unsubscribe(handle);
 
         return grpc::Status::OK;
     }
@@ -607,16 +677,21 @@ public:
     }
 
     grpc::Status SubscribePossibleSettingOptions(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::SubscribePossibleSettingOptionsRequest* /* request */,
         grpc::ServerWriter<rpc::camera::PossibleSettingOptionsResponse>* writer) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _camera.subscribe_possible_setting_options(
+        const auto handle = camera->add_possible_setting_options_subscriber(
             [this, &writer, &stream_closed_promise, is_finished](
                 const std::vector<mavsdk::Camera::SettingOptions> setting_options) {
                 rpc::camera::PossibleSettingOptionsResponse rpc_setting_options_response;
@@ -628,13 +703,13 @@ public:
 
                 std::lock_guard<std::mutex> lock(_subscribe_mutex);
                 if (!*is_finished && !writer->Write(rpc_setting_options_response)) {
-                    _camera.subscribe_possible_setting_options(nullptr);
                     *is_finished = true;
                     stream_closed_promise.set_value();
                 }
             });
 
         stream_closed_future.wait();
+        camera->unsubscribe(handle);
 
         return grpc::Status::OK;
     }
@@ -670,10 +745,15 @@ public:
     }
 
     grpc::Status SetSetting(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::camera::SetSettingRequest* request,
         rpc::camera::SetSettingResponse* response) override
     {
+        auto* camera = _cameras.get(context);
+        if (camera == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> set_option_called_promise;
         auto set_option_called_future = set_option_called_promise.get_future();
 
@@ -686,7 +766,7 @@ public:
             mavsdk::Camera::Option option;
             option.option_id = request->setting().option().option_id();
 
-            _camera.set_option_async(
+            camera->set_option_async(
                 [this, response, &set_option_called_promise](mavsdk::Camera::Result camera_result) {
                     if (camera_result == mavsdk::Camera::Result::IN_PROGRESS) {
                         return;
@@ -707,7 +787,7 @@ public:
     }
 
 private:
-    Camera& _camera;
+    SystemPlugins<Camera> _cameras;
     std::mutex _subscribe_mutex{};
 };
 
@@ -1,5 +1,6 @@
 #include "geofence/geofence.grpc.pb.h"
 #include "plugins/geofence/geofence.h"
+#include "system_plugins.h"
 
 namespace mavsdk {
 namespace backend {
@@ -7,18 +8,24 @@ namespace backend {
 template<typename Geofence = Geofence>
 class GeofenceServiceImpl final : public rpc::geofence::GeofenceService::Service {
 public:
-    GeofenceServiceImpl(Geofence& geofence) : _geofence(geofence) {}
+    GeofenceServiceImpl(Geofence& geofence) : _geofences(geofence) {}
+    GeofenceServiceImpl(mavsdk::Mavsdk& mavsdk) : _geofences(mavsdk) {}
 
     grpc::Status UploadGeofence(
-        grpc::ServerContext*,
+        grpc::ServerContext* context,
         const rpc::geofence::UploadGeofenceRequest* request,
         rpc::geofence::UploadGeofenceResponse* response) override
     {
+        auto* geofence = _geofences.get(context);
+        if (geofence == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> result_promise;
         const auto result_future = result_promise.get_future();
 
         const auto polygons = extractPolygons(request);
-        uploadGeofence(polygons, response, result_promise);
+        uploadGeofence(*geofence, polygons, response, result_promise);
 
         result_future.wait();
         return grpc::Status::OK;
@@ -63,11 +70,12 @@ private:
     }
 
     void uploadGeofence(
+        Geofence& geofence,
         const std::vector<std::shared_ptr<typename Geofence::Polygon>>& polygons,
         rpc::geofence::UploadGeofenceResponse* response,
         std::promise<void>& result_promise) const
     {
-        _geofence.send_geofence_async(
+        geofence.send_geofence_async(
             polygons, [this, response, &result_promise](const mavsdk::Geofence::Result result) {
                 if (response != nullptr) {
                     auto rpc_geofence_result = generateRPCGeofenceResult(result);
@@ -89,7 +97,7 @@ private:
         return rpc_geofence_result;
     }
 
-    Geofence& _geofence;
+    SystemPlugins<Geofence> _geofences;
 };
 
 } // namespace backend
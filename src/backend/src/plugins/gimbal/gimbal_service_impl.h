@@ -1,5 +1,6 @@
 #include "gimbal/gimbal.grpc.pb.h"
 #include "plugins/gimbal/gimbal.h"
+#include "system_plugins.h"
 
 namespace mavsdk {
 namespace backend {
@@ -7,19 +8,25 @@ namespace backend {
 template<typename Gimbal = Gimbal>
 class GimbalServiceImpl final : public rpc::gimbal::GimbalService::Service {
 public:
-    GimbalServiceImpl(Gimbal& gimbal) : _gimbal(gimbal) {}
+    GimbalServiceImpl(Gimbal& gimbal) : _gimbals(gimbal) {}
+    GimbalServiceImpl(mavsdk::Mavsdk& mavsdk) : _gimbals(mavsdk) {}
 
     grpc::Status SetPitchAndYaw(
-        grpc::ServerContext* /*  context */,
+        grpc::ServerContext* context,
         const rpc::gimbal::SetPitchAndYawRequest* request,
         rpc::gimbal::SetPitchAndYawResponse* response) override
     {
+        auto* gimbal = _gimbals.get(context);
+        if (gimbal == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_gimbal_pitch = request->pitch_deg();
             const auto requested_gimbal_yaw = request->yaw_deg();
 
             const auto gimbal_result =
-                _gimbal.set_pitch_and_yaw(requested_gimbal_pitch, requested_gimbal_yaw);
+                gimbal->set_pitch_and_yaw(requested_gimbal_pitch, requested_gimbal_yaw);
 
             if (response != nullptr) {
                 auto* rpc_gimbal_result = new rpc::gimbal::GimbalResult();
@@ -35,15 +42,20 @@ public:
     }
 
     grpc::Status SetMode(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::gimbal::SetModeRequest* request,
         rpc::gimbal::SetModeResponse* response) override
     {
+        auto* gimbal = _gimbals.get(context);
+        if (gimbal == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_gimbal_mode = request->gimbal_mode();
 
             const auto gimbal_result =
-                _gimbal.set_gimbal_mode(translateRPCGimbalMode(requested_gimbal_mode));
+                gimbal->set_gimbal_mode(translateRPCGimbalMode(requested_gimbal_mode));
 
             if (response != nullptr) {
                 auto* rpc_gimbal_result = new rpc::gimbal::GimbalResult();
@@ -71,7 +83,7 @@ public:
     }
 
 private:
-    Gimbal& _gimbal;
+    SystemPlugins<Gimbal> _gimbals;
 };
 
 } // namespace backend
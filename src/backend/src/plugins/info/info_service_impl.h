@@ -1,5 +1,6 @@
 #include "info/info.grpc.pb.h"
 #include "plugins/info/info.h"
+#include "system_plugins.h"
 
 namespace mavsdk {
 namespace backend {
@@ -7,15 +8,21 @@ namespace backend {
 template<typename Info = Info>
 class InfoServiceImpl final : public rpc::info::InfoService::Service {
 public:
-    InfoServiceImpl(Info& info) : _info(info) {}
+    InfoServiceImpl(Info& info) : _infos(info) {}
+    InfoServiceImpl(mavsdk::Mavsdk& mavsdk) : _infos(mavsdk) {}
 
     grpc::Status GetVersion(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::info::GetVersionRequest* /* request */,
         rpc::info::GetVersionResponse* response) override
     {
+        auto* info = _infos.get(context);
+        if (info == nullptr) {
+            return no_system_status();
+        }
+
         if (response != nullptr) {
-            auto result_pair = _info.get_version();
+            auto result_pair = info->get_version();
 
             auto* rpc_info_result = new rpc::info::InfoResult();
             rpc_info_result->set_result(
@@ -41,7 +48,7 @@ public:
     }
 
 private:
-    Info& _info;
+    SystemPlugins<Info> _infos;
 };
 
 } // namespace backend
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "plugins/mission/mission.h"
+#include "system_plugins.h"
 #include "mission/mission.grpc.pb.h"
 #include "plugins/mission/mission_item.h"
 
@@ -13,41 +14,57 @@ namespace backend {
 template<typename Mission = Mission>
 class MissionServiceImpl final : public mavsdk::rpc::mission::MissionService::Service {
 public:
-    MissionServiceImpl(Mission& mission) : _mission(mission) {}
+    MissionServiceImpl(Mission& mission) : _missions(mission) {}
+    MissionServiceImpl(mavsdk::Mavsdk& mavsdk) : _missions(mavsdk) {}
 
     grpc::Status UploadMission(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::UploadMissionRequest* request,
         rpc::mission::UploadMissionResponse* response) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> result_promise;
         const auto result_future = result_promise.get_future();
 
         const auto mission_items = extractMissionItems(request);
-        uploadMissionItems(mission_items, response, result_promise);
+        uploadMissionItems(*mission, mission_items, response, result_promise);
 
         result_future.wait();
         return grpc::Status::OK;
     }
 
     grpc::Status CancelMissionUpload(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::CancelMissionUploadRequest* /* request */,
         rpc::mission::CancelMissionUploadResponse* /* response */) override
     {
-        _mission.upload_mission_cancel();
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
+        mission->upload_mission_cancel();
         return grpc::Status::OK;
     }
 
     grpc::Status DownloadMission(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::DownloadMissionRequest* /* request */,
         rpc::mission::DownloadMissionResponse* response) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> result_promise;
         const auto result_future = result_promise.get_future();
 
-        _mission.download_mission_async(
+        mission->download_mission_async(
             [this, response, &result_promise](
                 const mavsdk::Mission::Result result,
                 const std::vector<std::shared_ptr<MissionItem>> mission_items) {
@@ -69,23 +86,33 @@ public:
     }
 
     grpc::Status CancelMissionDownload(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::CancelMissionDownloadRequest* /* request */,
         rpc::mission::CancelMissionDownloadResponse* /* response */) override
     {
-        _mission.download_mission_cancel();
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
+        mission->download_mission_cancel();
         return grpc::Status::OK;
     }
 
     grpc::Status StartMission(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::StartMissionRequest* /* request */,
         rpc::mission::StartMissionResponse* response) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> result_promise;
         const auto result_future = result_promise.get_future();
 
-        _mission.start_mission_async(
+        mission->start_mission_async(
             [this, response, &result_promise](const mavsdk::Mission::Result result) {
                 if (response != nullptr) {
                     auto rpc_mission_result = generateRPCMissionResult(result);
@@ -100,12 +127,17 @@ public:
     }
 
     grpc::Status IsMissionFinished(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::IsMissionFinishedRequest* /* request */,
         rpc::mission::IsMissionFinishedResponse* response) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         if (response != nullptr) {
-            auto is_mission_finished = _mission.mission_finished();
+            auto is_mission_finished = mission->mission_finished();
             response->set_is_finished(is_mission_finished);
         }
 
@@ -113,14 +145,19 @@ public:
     }
 
     grpc::Status PauseMission(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::PauseMissionRequest* /* request */,
         rpc::mission::PauseMissionResponse* response) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> result_promise;
         const auto result_future = result_promise.get_future();
 
-        _mission.pause_mission_async(
+        mission->pause_mission_async(
             [this, response, &result_promise](const mavsdk::Mission::Result result) {
                 if (response != nullptr) {
                     auto rpc_mission_result = generateRPCMissionResult(result);
@@ -135,14 +172,19 @@ public:
     }
 
     grpc::Status ClearMission(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::ClearMissionRequest* /* request */,
         rpc::mission::ClearMissionResponse* response) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> result_promise;
         const auto result_future = result_promise.get_future();
 
-        _mission.clear_mission_async(
+        mission->clear_mission_async(
             [this, response, &result_promise](const mavsdk::Mission::Result result) {
                 if (response != nullptr) {
                     auto rpc_mission_result = generateRPCMissionResult(result);
@@ -157,10 +199,15 @@ public:
     }
 
     grpc::Status SetCurrentMissionItemIndex(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::SetCurrentMissionItemIndexRequest* request,
         rpc::mission::SetCurrentMissionItemIndexResponse* response) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         if (request == nullptr) {
             return grpc::Status::OK;
         }
@@ -168,7 +215,7 @@ public:
         std::promise<void> result_promise;
         const auto result_future = result_promise.get_future();
 
-        _mission.set_current_mission_item_async(
+        mission->set_current_mission_item_async(
             request->index(),
             [this, response, &result_promise](const mavsdk::Mission::Result result) {
                 if (response != nullptr) {
@@ -184,17 +231,22 @@ public:
     }
 
     grpc::Status SubscribeMissionProgress(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const mavsdk::rpc::mission::SubscribeMissionProgressRequest* /* request */,
         grpc::ServerWriter<rpc::mission::MissionProgressResponse>* writer) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         std::promise<void> stream_closed_promise;
         auto stream_closed_future = stream_closed_promise.get_future();
 
         auto is_finished = std::make_shared<bool>(false);
 
-        _mission.subscribe_progress(
-            [this, &writer, &stream_closed_promise, is_finished](int current, int total) {
+        mission->subscribe_progress(
+            [this, mission, &writer, &stream_closed_promise, is_finished](int current, int total) {
                 mavsdk::rpc::mission::MissionProgressResponse rpc_mission_progress_response;
 
                 auto rpc_mission_progress = std::unique_ptr<mavsdk::rpc::mission::MissionProgress>(
@@ -207,7 +259,7 @@ public:
 
                 std::lock_guard<std::mutex> lock(_write_mutex);
                 if (!*is_finished && !writer->Write(rpc_mission_progress_response)) {
-                    _mission.subscribe_progress(nullptr);
+                    mission->subscribe_progress(nullptr);
                     *is_finished = true;
                     stream_closed_promise.set_value();
                 }
@@ -218,24 +270,34 @@ public:
     }
 
     grpc::Status GetReturnToLaunchAfterMission(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::GetReturnToLaunchAfterMissionRequest* /* request */,
         rpc::mission::GetReturnToLaunchAfterMissionResponse* response) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         if (response != nullptr) {
-            response->set_enable(_mission.get_return_to_launch_after_mission());
+            response->set_enable(mission->get_return_to_launch_after_mission());
         }
 
         return grpc::Status::OK;
     }
 
     grpc::Status SetReturnToLaunchAfterMission(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mission::SetReturnToLaunchAfterMissionRequest* request,
         rpc::mission::SetReturnToLaunchAfterMissionResponse* /* response */) override
     {
+        auto* mission = _missions.get(context);
+        if (mission == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
-            _mission.set_return_to_launch_after_mission(request->enable());
+            mission->set_return_to_launch_after_mission(request->enable());
         }
 
         return grpc::Status::OK;
@@ -334,11 +396,12 @@ private:
     }
 
     void uploadMissionItems(
+        Mission& mission,
         const std::vector<std::shared_ptr<MissionItem>>& mission_items,
         rpc::mission::UploadMissionResponse* response,
         std::promise<void>& result_promise) const
     {
-        _mission.upload_mission_async(
+        mission.upload_mission_async(
             mission_items, [this, response, &result_promise](const mavsdk::Mission::Result result) {
                 if (response != nullptr) {
                     auto rpc_mission_result = generateRPCMissionResult(result);
@@ -361,7 +424,7 @@ private:
         return rpc_mission_result;
     }
 
-    Mission& _mission;
+    SystemPlugins<Mission> _missions;
     std::mutex _write_mutex{};
 };
 
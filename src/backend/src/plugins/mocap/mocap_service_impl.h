@@ -3,6 +3,7 @@
 #include <limits>
 #include "mocap/mocap.grpc.pb.h"
 #include "plugins/mocap/mocap.h"
+#include "system_plugins.h"
 #include "log.h"
 
 namespace mavsdk {
@@ -11,7 +12,8 @@ namespace backend {
 template<typename Mocap = Mocap>
 class MocapServiceImpl final : public mavsdk::rpc::mocap::MocapService::Service {
 public:
-    MocapServiceImpl(Mocap& mocap) : _mocap(mocap) {}
+    MocapServiceImpl(Mocap& mocap) : _mocaps(mocap) {}
+    MocapServiceImpl(mavsdk::Mavsdk& mavsdk) : _mocaps(mavsdk) {}
 
     template<typename ResponseType>
     void fillResponseWithResult(ResponseType* response, mavsdk::Mocap::Result mocap_result) const
@@ -47,10 +49,15 @@ public:
     }
 
     grpc::Status SetVisionPositionEstimate(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::mocap::SetVisionPositionEstimateRequest* rpc_vision_position_request,
         rpc::mocap::SetVisionPositionEstimateResponse* response) override
     {
+        auto* mocap = _mocaps.get(context);
+        if (mocap == nullptr) {
+            return no_system_status();
+        }
+
         mavsdk::Mocap::VisionPositionEstimate position{};
 
         position.time_usec = rpc_vision_position_request->vision_position_estimate().time_usec();
@@ -75,17 +82,22 @@ public:
             return grpc::Status::OK;
         }
 
-        mavsdk::Mocap::Result mocap_result = _mocap.set_vision_position_estimate(position);
+        mavsdk::Mocap::Result mocap_result = mocap->set_vision_position_estimate(position);
         fillResponseWithResult(response, mocap_result);
 
         return grpc::Status::OK;
     }
 
     grpc::Status SetAttitudePositionMocap(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const mavsdk::rpc::mocap::SetAttitudePositionMocapRequest* rpc_attitude_position_request,
         mavsdk::rpc::mocap::SetAttitudePositionMocapResponse* response) override
     {
+        auto* mocap = _mocaps.get(context);
+        if (mocap == nullptr) {
+            return no_system_status();
+        }
+
         mavsdk::Mocap::AttitudePositionMocap attitude_position_mocap{};
 
         attitude_position_mocap.time_usec =
@@ -115,7 +127,7 @@ public:
         }
 
         mavsdk::Mocap::Result mocap_result =
-            _mocap.set_attitude_position_mocap(attitude_position_mocap);
+            mocap->set_attitude_position_mocap(attitude_position_mocap);
         fillResponseWithResult(response, mocap_result);
 
         return grpc::Status::OK;
@@ -135,10 +147,15 @@ public:
     }
 
     grpc::Status SetOdometry(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const mavsdk::rpc::mocap::SetOdometryRequest* rpc_odometry_request,
         mavsdk::rpc::mocap::SetOdometryResponse* response) override
     {
+        auto* mocap = _mocaps.get(context);
+        if (mocap == nullptr) {
+            return no_system_status();
+        }
+
         mavsdk::Mocap::Odometry odometry{};
 
         odometry.time_usec = rpc_odometry_request->odometry().time_usec();
@@ -179,7 +196,7 @@ public:
             return grpc::Status::OK;
         }
 
-        mavsdk::Mocap::Result mocap_result = _mocap.set_odometry(odometry);
+        mavsdk::Mocap::Result mocap_result = mocap->set_odometry(odometry);
         fillResponseWithResult(response, mocap_result);
 
         return grpc::Status::OK;
@@ -188,7 +205,7 @@ public:
     void stop() {}
 
 private:
-    Mocap& _mocap;
+    SystemPlugins<Mocap> _mocaps;
 };
 
 } // namespace backend
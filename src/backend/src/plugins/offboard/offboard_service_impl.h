@@ -1,5 +1,6 @@
 #include "offboard/offboard.grpc.pb.h"
 #include "plugins/offboard/offboard.h"
+#include "system_plugins.h"
 
 namespace mavsdk {
 namespace backend {
@@ -7,7 +8,8 @@ namespace backend {
 template<typename Offboard = Offboard>
 class OffboardServiceImpl final : public rpc::offboard::OffboardService::Service {
 public:
-    OffboardServiceImpl(Offboard& offboard) : _offboard(offboard) {}
+    OffboardServiceImpl(Offboard& offboard) : _offboards(offboard) {}
+    OffboardServiceImpl(mavsdk::Mavsdk& mavsdk) : _offboards(mavsdk) {}
 
     template<typename ResponseType>
     void
@@ -23,11 +25,16 @@ public:
     }
 
     grpc::Status Start(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::StartRequest* /* request */,
         rpc::offboard::StartResponse* response) override
     {
-        auto offboard_result = _offboard.start();
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
+        auto offboard_result = offboard->start();
 
         if (response != nullptr) {
             fillResponseWithResult(response, offboard_result);
@@ -37,11 +44,16 @@ public:
     }
 
     grpc::Status Stop(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::StopRequest* /* request */,
         rpc::offboard::StopResponse* response) override
     {
-        auto offboard_result = _offboard.stop();
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
+        auto offboard_result = offboard->stop();
 
         if (response != nullptr) {
             fillResponseWithResult(response, offboard_result);
@@ -51,12 +63,17 @@ public:
     }
 
     grpc::Status IsActive(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::IsActiveRequest* /* request */,
         rpc::offboard::IsActiveResponse* response) override
     {
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
         if (response != nullptr) {
-            auto is_active = _offboard.is_active();
+            auto is_active = offboard->is_active();
             response->set_is_active(is_active);
         }
 
@@ -64,14 +81,19 @@ public:
     }
 
     grpc::Status SetActuatorControl(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::SetActuatorControlRequest* request,
         rpc::offboard::SetActuatorControlResponse* /* response */) override
     {
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             auto requested_actuator_control =
                 translateRPCActuatorControl(request->actuator_control());
-            _offboard.set_actuator_control(requested_actuator_control);
+            offboard->set_actuator_control(requested_actuator_control);
         }
 
         return grpc::Status::OK;
@@ -96,13 +118,18 @@ public:
     }
 
     grpc::Status SetAttitude(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::SetAttitudeRequest* request,
         rpc::offboard::SetAttitudeResponse* /* response */) override
     {
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             auto requested_attitude = translateRPCAttitude(request->attitude());
-            _offboard.set_attitude(requested_attitude);
+            offboard->set_attitude(requested_attitude);
         }
 
         return grpc::Status::OK;
@@ -122,13 +149,18 @@ public:
     }
 
     grpc::Status SetAttitudeRate(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::SetAttitudeRateRequest* request,
         rpc::offboard::SetAttitudeRateResponse* /* response */) override
     {
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             auto requested_attitude_rate = translateRPCAttitudeRate(request->attitude_rate());
-            _offboard.set_attitude_rate(requested_attitude_rate);
+            offboard->set_attitude_rate(requested_attitude_rate);
         }
 
         return grpc::Status::OK;
@@ -148,14 +180,19 @@ public:
     }
 
     grpc::Status SetPositionNed(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::SetPositionNedRequest* request,
         rpc::offboard::SetPositionNedResponse* /* response */) override
     {
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             auto requested_position_ned_yaw =
                 translateRPCPositionNedYaw(request->position_ned_yaw());
-            _offboard.set_position_ned(requested_position_ned_yaw);
+            offboard->set_position_ned(requested_position_ned_yaw);
         }
 
         return grpc::Status::OK;
@@ -175,14 +212,19 @@ public:
     }
 
     grpc::Status SetVelocityBody(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::SetVelocityBodyRequest* request,
         rpc::offboard::SetVelocityBodyResponse* /* response */) override
     {
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             auto requested_velocity_body_yawspeed =
                 translateRPCVelocityBodyYawspeed(request->velocity_body_yawspeed());
-            _offboard.set_velocity_body(requested_velocity_body_yawspeed);
+            offboard->set_velocity_body(requested_velocity_body_yawspeed);
         }
 
         return grpc::Status::OK;
@@ -202,14 +244,19 @@ public:
     }
 
     grpc::Status SetVelocityNed(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::offboard::SetVelocityNedRequest* request,
         rpc::offboard::SetVelocityNedResponse* /* response */) override
     {
+        auto* offboard = _offboards.get(context);
+        if (offboard == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             auto requested_velocity_ned_yaw =
                 translateRPCVelocityNedYaw(request->velocity_ned_yaw());
-            _offboard.set_velocity_ned(requested_velocity_ned_yaw);
+            offboard->set_velocity_ned(requested_velocity_ned_yaw);
         }
 
         return grpc::Status::OK;
@@ -229,7 +276,7 @@ public:
     }
 
 private:
-    Offboard& _offboard;
+    SystemPlugins<Offboard> _offboards;
 };
 
 } // namespace backend
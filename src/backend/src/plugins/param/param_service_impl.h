@@ -1,5 +1,6 @@
 #include "param/param.grpc.pb.h"
 #include "plugins/param/param.h"
+#include "system_plugins.h"
 
 namespace mavsdk {
 namespace backend {
@@ -7,18 +8,24 @@ namespace backend {
 template<typename Param = Param>
 class ParamServiceImpl final : public rpc::param::ParamService::Service {
 public:
-    ParamServiceImpl(Param& param) : _param(param) {}
+    ParamServiceImpl(Param& param) : _params(param) {}
+    ParamServiceImpl(mavsdk::Mavsdk& mavsdk) : _params(mavsdk) {}
 
     grpc::Status GetIntParam(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::param::GetIntParamRequest* request,
         rpc::param::GetIntParamResponse* response) override
     {
+        auto* param = _params.get(context);
+        if (param == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_param = request->name();
 
             if (response != nullptr) {
-                auto result_pair = _param.get_param_int(requested_param);
+                auto result_pair = param->get_param_int(requested_param);
 
                 auto* rpc_param_result = new rpc::param::ParamResult();
                 rpc_param_result->set_result(
@@ -34,16 +41,21 @@ public:
     }
 
     grpc::Status SetIntParam(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::param::SetIntParamRequest* request,
         rpc::param::SetIntParamResponse* response) override
     {
+        auto* param = _params.get(context);
+        if (param == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_param_name = request->name();
             const auto requested_param_value = request->value();
 
             const auto param_result =
-                _param.set_param_int(requested_param_name, requested_param_value);
+                param->set_param_int(requested_param_name, requested_param_value);
 
             if (response != nullptr) {
                 auto* rpc_param_result = new rpc::param::ParamResult();
@@ -59,15 +71,20 @@ public:
     }
 
     grpc::Status GetFloatParam(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::param::GetFloatParamRequest* request,
         rpc::param::GetFloatParamResponse* response) override
     {
+        auto* param = _params.get(context);
+        if (param == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_param = request->name();
 
             if (response != nullptr) {
-                auto result_pair = _param.get_param_float(requested_param);
+                auto result_pair = param->get_param_float(requested_param);
 
                 auto* rpc_param_result = new rpc::param::ParamResult();
                 rpc_param_result->set_result(
@@ -83,16 +100,21 @@ public:
     }
 
     grpc::Status SetFloatParam(
-        grpc::ServerContext* /* context */,
+        grpc::ServerContext* context,
         const rpc::param::SetFloatParamRequest* request,
         rpc::param::SetFloatParamResponse* response) override
     {
+        auto* param = _params.get(context);
+        if (param == nullptr) {
+            return no_system_status();
+        }
+
         if (request != nullptr) {
             const auto requested_param_name = request->name();
             const auto requested_param_value = request->value();
 
             const auto param_result =
-                _param.set_param_float(requested_param_name, requested_param_value);
+                param->set_param_float(requested_param_name, requested_param_value);
 
             if (response != nullptr) {
                 auto* rpc_param_result = new rpc::param::ParamResult();
@@ -108,7 +130,7 @@ public:
     }
 
 private:
-    Param& _param;
+    SystemPlugins<Param> _params;
 };
 
 } // namespace backend
@@ -0,0 +1,453 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "async_server_stream.h"
+#include "metrics.h"
+#include "system_plugins.h"
+#include "telemetry/telemetry_service_impl.h"
+
+namespace mavsdk {
+namespace backend {
+
+/*
+ * Telemetry service served through a completion queue.
+ *
+ * Every subscription is an AsyncServerStream, so streams don't occupy a thread
+ * each and writes happen as the updates come in. The updates are translated by
+ * the subscribe_* methods of TelemetryServiceImpl, one per system served. Clients
+ * can ask for updates to be sent in batches, see BatchOptions. Unary calls are
+ * answered right when they come in.
+ */
+template<typename Telemetry = Telemetry>
+class TelemetryAsyncServiceImpl final
+    : public mavsdk::rpc::telemetry::TelemetryService::AsyncService {
+public:
+    TelemetryAsyncServiceImpl(Telemetry& telemetry) : _telemetries(telemetry) {}
+    TelemetryAsyncServiceImpl(mavsdk::Mavsdk& mavsdk) : _telemetries(mavsdk) {}
+
+    ~TelemetryAsyncServiceImpl() = default;
+
+    // Starts waiting for calls on the queue. The queue needs to be run by the
+    // caller, e.g. by a pool of threads calling `Next` and `AsyncTag::proceed`.
+    void start(grpc::ServerCompletionQueue* queue)
+    {
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribePosition,
+            &Subscriptions::subscribe_position);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeHome,
+            &Subscriptions::subscribe_home);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeInAir,
+            &Subscriptions::subscribe_in_air);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeLandedState,
+            &Subscriptions::subscribe_landed_state);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeArmed,
+            &Subscriptions::subscribe_armed);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeAttitudeQuaternion,
+            &Subscriptions::subscribe_attitude_quaternion);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeAttitudeEuler,
+            &Subscriptions::subscribe_attitude_euler);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeAttitudeAngularVelocityBody,
+            &Subscriptions::subscribe_attitude_angular_velocity_body);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeCameraAttitudeQuaternion,
+            &Subscriptions::subscribe_camera_attitude_quaternion);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeCameraAttitudeEuler,
+            &Subscriptions::subscribe_camera_attitude_euler);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeGroundSpeedNed,
+            &Subscriptions::subscribe_ground_speed_ned);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeGpsInfo,
+            &Subscriptions::subscribe_gps_info);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeBattery,
+            &Subscriptions::subscribe_battery);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeFlightMode,
+            &Subscriptions::subscribe_flight_mode);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeHealth,
+            &Subscriptions::subscribe_health);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeRcStatus,
+            &Subscriptions::subscribe_rc_status);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeStatusText,
+            &Subscriptions::subscribe_status_text);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeActuatorControlTarget,
+            &Subscriptions::subscribe_actuator_control_target);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeActuatorOutputStatus,
+            &Subscriptions::subscribe_actuator_output_status);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeOdometry,
+            &Subscriptions::subscribe_odometry);
+        serve(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestSubscribeTelemetrySnapshot,
+            &Subscriptions::subscribe_telemetry_snapshot);
+        serve_unary(
+            queue,
+            &TelemetryAsyncServiceImpl::RequestGetTelemetrySnapshot,
+            &Subscriptions::get_telemetry_snapshot);
+    }
+
+    // Finishes all running streams and stops waiting for new calls. Needs to be
+    // called before the queue is shut down.
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_listen_mutex);
+            _stopped = true;
+        }
+
+        for (auto& method : _methods) {
+            std::lock_guard<std::mutex> lock(method->mutex);
+            for (auto& weak_stream : method->streams) {
+                auto stream = weak_stream.lock();
+                if (stream) {
+                    stream->finish();
+                }
+            }
+        }
+    }
+
+    // Messages dropped for clients not keeping up, over all streams served so far.
+    uint64_t dropped_messages() const
+    {
+        uint64_t dropped = _dropped_by_finished_streams.load();
+        for (auto& method : _methods) {
+            std::lock_guard<std::mutex> lock(method->mutex);
+            for (auto& weak_stream : method->streams) {
+                auto stream = weak_stream.lock();
+                if (stream) {
+                    dropped += stream->dropped_messages();
+                }
+            }
+        }
+        return dropped;
+    }
+
+private:
+    typedef TelemetryServiceImpl<Telemetry> Subscriptions;
+    typedef typename Subscriptions::SubscriptionHandle SubscriptionHandle;
+
+    struct Method {
+        std::mutex mutex{};
+        // Waiting for the next call, owned here until it started.
+        std::shared_ptr<AsyncStream> pending{};
+        std::vector<std::weak_ptr<AsyncStream>> streams{};
+        // Every stream has its own subscription, so any number of clients can
+        // subscribe to the same telemetry of a system.
+        std::map<const AsyncStream*, std::pair<Subscriptions*, SubscriptionHandle>>
+            subscriptions{};
+        std::function<void()> listen{};
+    };
+
+    struct UnaryMethod {
+        std::mutex mutex{};
+        // Waiting for the next call, owned here until it started.
+        std::shared_ptr<void> pending{};
+        std::function<void()> listen{};
+    };
+
+    template<class Response>
+    using response_writer_t = typename Subscriptions::template response_writer_t<Response>;
+
+    template<class Request, class Response>
+    using subscribe_function_t = std::function<SubscriptionHandle(
+        Subscriptions&, const Request&, const response_writer_t<Response>&)>;
+
+    // For streams which don't take any parameters.
+    template<class Service, class Request, class Response>
+    void serve(
+        grpc::ServerCompletionQueue* queue,
+        void (Service::*request_method)(
+            grpc::ServerContext*,
+            Request*,
+            grpc::ServerAsyncWriter<Response>*,
+            grpc::CompletionQueue*,
+            grpc::ServerCompletionQueue*,
+            void*),
+        SubscriptionHandle (Subscriptions::*subscribe_method)(const response_writer_t<Response>&))
+    {
+        serve_stream<Service, Request, Response>(
+            queue,
+            request_method,
+            [subscribe_method](
+                Subscriptions& subscriptions,
+                const Request& /* request */,
+                const response_writer_t<Response>& write) {
+                return (subscriptions.*subscribe_method)(write);
+            });
+    }
+
+    // For streams which take the request, e.g. to choose a rate.
+    template<class Service, class Request, class Response>
+    void serve(
+        grpc::ServerCompletionQueue* queue,
+        void (Service::*request_method)(
+            grpc::ServerContext*,
+            Request*,
+            grpc::ServerAsyncWriter<Response>*,
+            grpc::CompletionQueue*,
+            grpc::ServerCompletionQueue*,
+            void*),
+        SubscriptionHandle (Subscriptions::*subscribe_method)(
+            const Request&, const response_writer_t<Response>&))
+    {
+        serve_stream<Service, Request, Response>(
+            queue,
+            request_method,
+            [subscribe_method](
+                Subscriptions& subscriptions,
+                const Request& request,
+                const response_writer_t<Response>& write) {
+                return (subscriptions.*subscribe_method)(request, write);
+            });
+    }
+
+    template<class Service, class Request, class Response>
+    void serve_stream(
+        grpc::ServerCompletionQueue* queue,
+        void (Service::*request_method)(
+            grpc::ServerContext*,
+            Request*,
+            grpc::ServerAsyncWriter<Response>*,
+            grpc::CompletionQueue*,
+            grpc::ServerCompletionQueue*,
+            void*),
+        subscribe_function_t<Request, Response> subscribe)
+    {
+        typedef AsyncServerStream<Request, Response> Stream;
+
+        _methods.push_back(std::unique_ptr<Method>(new Method()));
+        Method* method = _methods.back().get();
+
+        auto on_started = [this, method, subscribe](const std::shared_ptr<Stream>& stream) {
+            // Wait for the next client right away.
+            method->listen();
+
+            std::weak_ptr<Stream> weak_stream = stream;
+            Subscriptions* subscriptions = subscriptions_for(stream->context());
+
+            _active_streams.add(1);
+
+            std::lock_guard<std::mutex> lock(method->mutex);
+            remove_expired(method->streams);
+            method->streams.push_back(stream);
+
+            if (subscriptions == nullptr) {
+                stream->finish(no_system_status());
+                return;
+            }
+
+            const grpc::Status status = Subscriptions::check_request(stream->request_message());
+            if (!status.ok()) {
+                stream->finish(status);
+                return;
+            }
+
+            const SubscriptionHandle handle = subscribe(
+                *subscriptions, stream->request_message(), [weak_stream](Response& response) {
+                    auto locked_stream = weak_stream.lock();
+                    if (locked_stream) {
+                        locked_stream->write_swapped(response);
+                    }
+                });
+            method->subscriptions[stream.get()] = std::make_pair(&subscriptions, handle);
+        };
+
+        auto on_done = [this, method](const std::shared_ptr<Stream>& stream) {
+            std::lock_guard<std::mutex> lock(method->mutex);
+            remove_stream(method->streams, stream.get());
+            _dropped_by_finished_streams += stream->dropped_messages();
+            _active_streams.add(-1);
+            _dropped_messages_metric.increment(stream->dropped_messages());
+
+            // The system might have been discovered since the stream started, so
+            // unsubscribe from the subscriptions it was started with.
+            auto it = method->subscriptions.find(stream.get());
+            if (it != method->subscriptions.end()) {
+                it->second.first->unsubscribe(it->second.second);
+                method->subscriptions.erase(it);
+            }
+        };
+
+        method->listen = [this, queue, method, request_method, on_started, on_done]() {
+            std::lock_guard<std::mutex> listen_lock(_listen_mutex);
+            if (_stopped) {
+                return;
+            }
+
+            auto stream = Stream::create(on_started, on_done, queue);
+            {
+                std::lock_guard<std::mutex> lock(method->mutex);
+                method->pending = stream;
+            }
+
+            stream->request([this, queue, request_method](
+                                grpc::ServerContext* context,
+                                Request* request,
+                                grpc::ServerAsyncWriter<Response>* writer,
+                                void* tag) {
+                (this->*request_method)(context, request, writer, queue, queue, tag);
+            });
+        };
+
+        method->listen();
+    }
+
+    template<class Service, class Request, class Response>
+    void serve_unary(
+        grpc::ServerCompletionQueue* queue,
+        void (Service::*request_method)(
+            grpc::ServerContext*,
+            Request*,
+            grpc::ServerAsyncResponseWriter<Response>*,
+            grpc::CompletionQueue*,
+            grpc::ServerCompletionQueue*,
+            void*),
+        void (Subscriptions::*call_method)(const Request&, Response*))
+    {
+        typedef AsyncUnaryCall<Request, Response> Call;
+
+        _unary_methods.push_back(std::unique_ptr<UnaryMethod>(new UnaryMethod()));
+        UnaryMethod* method = _unary_methods.back().get();
+
+        auto on_started = [this, method, call_method](const std::shared_ptr<Call>& call) {
+            // Wait for the next client right away.
+            method->listen();
+
+            Subscriptions* subscriptions = subscriptions_for(call->context());
+
+            Response response;
+            if (subscriptions == nullptr) {
+                call->respond(response, no_system_status());
+                return;
+            }
+
+            (subscriptions->*call_method)(call->request_message(), &response);
+            call->respond(response);
+        };
+
+        method->listen = [this, queue, method, request_method, on_started]() {
+            std::lock_guard<std::mutex> listen_lock(_listen_mutex);
+            if (_stopped) {
+                return;
+            }
+
+            auto call = Call::create(on_started);
+            {
+                std::lock_guard<std::mutex> lock(method->mutex);
+                method->pending = call;
+            }
+
+            call->request([this, queue, request_method](
+                              grpc::ServerContext* context,
+                              Request* request,
+                              grpc::ServerAsyncResponseWriter<Response>* responder,
+                              void* tag) {
+                (this->*request_method)(context, request, responder, queue, queue, tag);
+            });
+        };
+
+        method->listen();
+    }
+
+    static void remove_expired(std::vector<std::weak_ptr<AsyncStream>>& streams)
+    {
+        streams.erase(
+            std::remove_if(
+                streams.begin(),
+                streams.end(),
+                [](const std::weak_ptr<AsyncStream>& stream) { return stream.expired(); }),
+            streams.end());
+    }
+
+    static void remove_stream(
+        std::vector<std::weak_ptr<AsyncStream>>& streams, const AsyncStream* stream)
+    {
+        streams.erase(
+            std::remove_if(
+                streams.begin(),
+                streams.end(),
+                [stream](const std::weak_ptr<AsyncStream>& weak_stream) {
+                    return weak_stream.expired() || weak_stream.lock().get() == stream;
+                }),
+            streams.end());
+    }
+
+    // nullptr if the system of the call is not discovered.
+    Subscriptions* subscriptions_for(const grpc::ServerContext& context)
+    {
+        Telemetry* telemetry = _telemetries.get(&context);
+        if (telemetry == nullptr) {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(_subscriptions_mutex);
+        auto& subscriptions = _subscriptions[telemetry];
+        if (!subscriptions) {
+            subscriptions.reset(new Subscriptions(*telemetry));
+        }
+        return subscriptions.get();
+    }
+
+    SystemPlugins<Telemetry> _telemetries;
+    std::mutex _subscriptions_mutex{};
+    std::map<Telemetry*, std::unique_ptr<Subscriptions>> _subscriptions{};
+    std::atomic<uint64_t> _dropped_by_finished_streams{0};
+
+    MetricsGauge& _active_streams = MetricsRegistry::Instance().gauge(
+        "mavsdk_server_grpc_streams", "Open gRPC streams.", {{"service", "telemetry"}});
+    MetricsCounter& _dropped_messages_metric = MetricsRegistry::Instance().counter(
+        "mavsdk_server_grpc_stream_dropped_messages_total",
+        "Stream messages dropped for clients not keeping up, counted when a stream ends.",
+        {{"service", "telemetry"}});
+
+    std::mutex _listen_mutex{};
+    bool _stopped{false};
+    std::vector<std::unique_ptr<Method>> _methods{};
+    std::vector<std::unique_ptr<UnaryMethod>> _unary_methods{};
+};
+
+} // namespace backend
+} // namespace mavsdk
@@ -1,4 +1,9 @@
+#pragma once
+
+#include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 
 #include "plugins/telemetry/telemetry.h"
 #include "telemetry/telemetry.grpc.pb.h"
@@ -15,40 +20,65 @@ public:
         _stop_future(_stop_promise.get_future())
     {}
 
-    grpc::Status SubscribePosition(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribePositionRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::PositionResponse>* writer) override
+    // The subscribe_* methods translate the updates of one telemetry stream to rpc
+    // responses and pass them to `write`. They are shared by the synchronous methods
+    // below and the asynchronous service (TelemetryAsyncServiceImpl).
+    //
+    // The response passed to `write` is reused for the next update of the stream, so
+    // `write` may swap it with another message instead of copying it. All fields are
+    // set again for every update.
+    template<typename Response> using response_writer_t = std::function<void(Response&)>;
+
+    // Every stream has its own subscription, remove it with unsubscribe().
+    typedef mavsdk::Telemetry::SubscriptionHandle SubscriptionHandle;
+
+    void unsubscribe(SubscriptionHandle handle) { _telemetry.unsubscribe(handle); }
+
+    SubscriptionHandle subscribe_position(
+        const response_writer_t<rpc::telemetry::PositionResponse>& write)
     {
-        std::mutex position_mutex{};
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::PositionResponse>>();
+        return _telemetry.subscribe_position([write, reused](mavsdk::Telemetry::Position position) {
+            std::lock_guard<std::mutex> lock(reused->mutex);
+            auto& rpc_position_response = reused->response;
 
-        _telemetry.position_async([&writer, &position_mutex](mavsdk::Telemetry::Position position) {
-            auto rpc_position = new mavsdk::rpc::telemetry::Position();
+            auto rpc_position = rpc_position_response.mutable_position();
             rpc_position->set_latitude_deg(position.latitude_deg);
             rpc_position->set_longitude_deg(position.longitude_deg);
             rpc_position->set_relative_altitude_m(position.relative_altitude_m);
             rpc_position->set_absolute_altitude_m(position.absolute_altitude_m);
 
-            mavsdk::rpc::telemetry::PositionResponse rpc_position_response;
-            rpc_position_response.set_allocated_position(rpc_position);
-
-            std::lock_guard<std::mutex> lock(position_mutex);
-            writer->Write(rpc_position_response);
+            write(rpc_position_response);
         });
+    }
+
+    grpc::Status SubscribePosition(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribePositionRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::PositionResponse>* writer) override
+    {
+        std::mutex position_mutex{};
+
+        const auto handle = subscribe_position(
+            [&writer, &position_mutex](const rpc::telemetry::PositionResponse& response) {
+                std::lock_guard<std::mutex> lock(position_mutex);
+                writer->Write(response);
+            });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeHealth(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeHealthRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::HealthResponse>* writer) override
+    SubscriptionHandle subscribe_health(
+        const response_writer_t<rpc::telemetry::HealthResponse>& write)
     {
-        std::mutex health_mutex{};
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::HealthResponse>>();
+        return _telemetry.subscribe_health([write, reused](mavsdk::Telemetry::Health health) {
+            std::lock_guard<std::mutex> lock(reused->mutex);
+            auto& rpc_health_response = reused->response;
 
-        _telemetry.health_async([&writer, &health_mutex](mavsdk::Telemetry::Health health) {
-            auto rpc_health = new mavsdk::rpc::telemetry::Health();
+            auto rpc_health = rpc_health_response.mutable_health();
             rpc_health->set_is_gyrometer_calibration_ok(health.gyrometer_calibration_ok);
             rpc_health->set_is_accelerometer_calibration_ok(health.accelerometer_calibration_ok);
             rpc_health->set_is_magnetometer_calibration_ok(health.magnetometer_calibration_ok);
@@ -57,43 +87,75 @@ public:
             rpc_health->set_is_global_position_ok(health.global_position_ok);
             rpc_health->set_is_home_position_ok(health.home_position_ok);
 
-            mavsdk::rpc::telemetry::HealthResponse rpc_health_response;
-            rpc_health_response.set_allocated_health(rpc_health);
-
-            std::lock_guard<std::mutex> lock(health_mutex);
-            writer->Write(rpc_health_response);
+            write(rpc_health_response);
         });
+    }
+
+    grpc::Status SubscribeHealth(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeHealthRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::HealthResponse>* writer) override
+    {
+        std::mutex health_mutex{};
+
+        const auto handle = subscribe_health(
+            [&writer, &health_mutex](const rpc::telemetry::HealthResponse& response) {
+                std::lock_guard<std::mutex> lock(health_mutex);
+                writer->Write(response);
+            });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeHome(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeHomeRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::HomeResponse>* writer) override
+    SubscriptionHandle subscribe_home(const response_writer_t<rpc::telemetry::HomeResponse>& write)
     {
-        std::mutex home_mutex{};
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::HomeResponse>>();
+        return _telemetry.subscribe_home_position(
+            [write, reused](mavsdk::Telemetry::Position position) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_home_response = reused->response;
 
-        _telemetry.home_position_async(
-            [&writer, &home_mutex](mavsdk::Telemetry::Position position) {
-                auto rpc_position = new mavsdk::rpc::telemetry::Position();
+                auto rpc_position = rpc_home_response.mutable_home();
                 rpc_position->set_latitude_deg(position.latitude_deg);
                 rpc_position->set_longitude_deg(position.longitude_deg);
                 rpc_position->set_relative_altitude_m(position.relative_altitude_m);
                 rpc_position->set_absolute_altitude_m(position.absolute_altitude_m);
 
-                mavsdk::rpc::telemetry::HomeResponse rpc_home_response;
-                rpc_home_response.set_allocated_home(rpc_position);
+                write(rpc_home_response);
+            });
+    }
+
+    grpc::Status SubscribeHome(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeHomeRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::HomeResponse>* writer) override
+    {
+        std::mutex home_mutex{};
 
+        const auto handle = subscribe_home(
+            [&writer, &home_mutex](const rpc::telemetry::HomeResponse& response) {
                 std::lock_guard<std::mutex> lock(home_mutex);
-                writer->Write(rpc_home_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
+    SubscriptionHandle subscribe_in_air(
+        const response_writer_t<rpc::telemetry::InAirResponse>& write)
+    {
+        return _telemetry.subscribe_in_air([write](bool is_in_air) {
+            mavsdk::rpc::telemetry::InAirResponse rpc_in_air_response;
+            rpc_in_air_response.set_is_in_air(is_in_air);
+
+            write(rpc_in_air_response);
+        });
+    }
+
     grpc::Status SubscribeInAir(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeInAirRequest* /* request */,
@@ -101,18 +163,29 @@ public:
     {
         std::mutex in_air_mutex{};
 
-        _telemetry.in_air_async([&writer, &in_air_mutex](bool is_in_air) {
-            mavsdk::rpc::telemetry::InAirResponse rpc_in_air_response;
-            rpc_in_air_response.set_is_in_air(is_in_air);
-
-            std::lock_guard<std::mutex> lock(in_air_mutex);
-            writer->Write(rpc_in_air_response);
-        });
+        const auto handle = subscribe_in_air(
+            [&writer, &in_air_mutex](const rpc::telemetry::InAirResponse& response) {
+                std::lock_guard<std::mutex> lock(in_air_mutex);
+                writer->Write(response);
+            });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
+    SubscriptionHandle subscribe_landed_state(
+        const response_writer_t<rpc::telemetry::LandedStateResponse>& write)
+    {
+        return _telemetry.subscribe_landed_state(
+            [this, write](mavsdk::Telemetry::LandedState landed_state) {
+                mavsdk::rpc::telemetry::LandedStateResponse rpc_landed_state_response;
+                rpc_landed_state_response.set_landed_state(translateLandedState(landed_state));
+
+                write(rpc_landed_state_response);
+            });
+    }
+
     grpc::Status SubscribeLandedState(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeLandedStateRequest* /* request */,
@@ -120,16 +193,14 @@ public:
     {
         std::mutex landed_state_mutex{};
 
-        _telemetry.landed_state_async(
-            [this, &writer, &landed_state_mutex](mavsdk::Telemetry::LandedState landed_state) {
-                mavsdk::rpc::telemetry::LandedStateResponse rpc_landed_state_response;
-                rpc_landed_state_response.set_landed_state(translateLandedState(landed_state));
-
+        const auto handle = subscribe_landed_state(
+            [&writer, &landed_state_mutex](const rpc::telemetry::LandedStateResponse& response) {
                 std::lock_guard<std::mutex> lock(landed_state_mutex);
-                writer->Write(rpc_landed_state_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
@@ -151,6 +222,23 @@ public:
         }
     }
 
+    SubscriptionHandle subscribe_status_text(
+        const response_writer_t<rpc::telemetry::StatusTextResponse>& write)
+    {
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::StatusTextResponse>>();
+        return _telemetry.subscribe_status_text(
+            [this, write, reused](mavsdk::Telemetry::StatusText status_text) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_status_text_response = reused->response;
+
+                auto rpc_status_text = rpc_status_text_response.mutable_status_text();
+                rpc_status_text->set_text(status_text.text);
+                rpc_status_text->set_type(translateStatusTextType(status_text.type));
+
+                write(rpc_status_text_response);
+            });
+    }
+
     grpc::Status SubscribeStatusText(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeStatusTextRequest* /* request */,
@@ -158,20 +246,14 @@ public:
     {
         std::mutex status_text_mutex{};
 
-        _telemetry.status_text_async(
-            [this, &writer, &status_text_mutex](mavsdk::Telemetry::StatusText status_text) {
-                auto rpc_status_text = new mavsdk::rpc::telemetry::StatusText();
-                rpc_status_text->set_text(status_text.text);
-                rpc_status_text->set_type(translateStatusTextType(status_text.type));
-
-                mavsdk::rpc::telemetry::StatusTextResponse rpc_status_text_response;
-                rpc_status_text_response.set_allocated_status_text(rpc_status_text);
-
+        const auto handle = subscribe_status_text(
+            [&writer, &status_text_mutex](const rpc::telemetry::StatusTextResponse& response) {
                 std::lock_guard<std::mutex> lock(status_text_mutex);
-                writer->Write(rpc_status_text_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
@@ -191,6 +273,17 @@ public:
         }
     }
 
+    SubscriptionHandle subscribe_armed(
+        const response_writer_t<rpc::telemetry::ArmedResponse>& write)
+    {
+        return _telemetry.subscribe_armed([write](bool is_armed) {
+            mavsdk::rpc::telemetry::ArmedResponse rpc_armed_response;
+            rpc_armed_response.set_is_armed(is_armed);
+
+            write(rpc_armed_response);
+        });
+    }
+
     grpc::Status SubscribeArmed(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeArmedRequest* /* request */,
@@ -198,18 +291,34 @@ public:
     {
         std::mutex armed_mutex{};
 
-        _telemetry.armed_async([&writer, &armed_mutex](bool is_armed) {
-            mavsdk::rpc::telemetry::ArmedResponse rpc_armed_response;
-            rpc_armed_response.set_is_armed(is_armed);
-
-            std::lock_guard<std::mutex> lock(armed_mutex);
-            writer->Write(rpc_armed_response);
-        });
+        const auto handle = subscribe_armed(
+            [&writer, &armed_mutex](const rpc::telemetry::ArmedResponse& response) {
+                std::lock_guard<std::mutex> lock(armed_mutex);
+                writer->Write(response);
+            });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
+    SubscriptionHandle subscribe_gps_info(
+        const response_writer_t<rpc::telemetry::GpsInfoResponse>& write)
+    {
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::GpsInfoResponse>>();
+        return _telemetry.subscribe_gps_info(
+            [this, write, reused](mavsdk::Telemetry::GPSInfo gps_info) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_gps_info_response = reused->response;
+
+                auto rpc_gps_info = rpc_gps_info_response.mutable_gps_info();
+                rpc_gps_info->set_num_satellites(gps_info.num_satellites);
+                rpc_gps_info->set_fix_type(translateGpsFixType(gps_info.fix_type));
+
+                write(rpc_gps_info_response);
+            });
+    }
+
     grpc::Status SubscribeGpsInfo(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeGpsInfoRequest* /* request */,
@@ -217,20 +326,14 @@ public:
     {
         std::mutex gps_info_mutex{};
 
-        _telemetry.gps_info_async(
-            [this, &writer, &gps_info_mutex](mavsdk::Telemetry::GPSInfo gps_info) {
-                auto rpc_gps_info = new mavsdk::rpc::telemetry::GpsInfo();
-                rpc_gps_info->set_num_satellites(gps_info.num_satellites);
-                rpc_gps_info->set_fix_type(translateGpsFixType(gps_info.fix_type));
-
-                mavsdk::rpc::telemetry::GpsInfoResponse rpc_gps_info_response;
-                rpc_gps_info_response.set_allocated_gps_info(rpc_gps_info);
-
+        const auto handle = subscribe_gps_info(
+            [&writer, &gps_info_mutex](const rpc::telemetry::GpsInfoResponse& response) {
                 std::lock_guard<std::mutex> lock(gps_info_mutex);
-                writer->Write(rpc_gps_info_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
@@ -255,6 +358,22 @@ public:
         }
     }
 
+    SubscriptionHandle subscribe_battery(
+        const response_writer_t<rpc::telemetry::BatteryResponse>& write)
+    {
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::BatteryResponse>>();
+        return _telemetry.subscribe_battery([write, reused](mavsdk::Telemetry::Battery battery) {
+            std::lock_guard<std::mutex> lock(reused->mutex);
+            auto& rpc_battery_response = reused->response;
+
+            auto rpc_battery = rpc_battery_response.mutable_battery();
+            rpc_battery->set_voltage_v(battery.voltage_v);
+            rpc_battery->set_remaining_percent(battery.remaining_percent);
+
+            write(rpc_battery_response);
+        });
+    }
+
     grpc::Status SubscribeBattery(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeBatteryRequest* /* request */,
@@ -262,22 +381,31 @@ public:
     {
         std::mutex battery_mutex{};
 
-        _telemetry.battery_async([&writer, &battery_mutex](mavsdk::Telemetry::Battery battery) {
-            auto rpc_battery = new mavsdk::rpc::telemetry::Battery();
-            rpc_battery->set_voltage_v(battery.voltage_v);
-            rpc_battery->set_remaining_percent(battery.remaining_percent);
-
-            mavsdk::rpc::telemetry::BatteryResponse rpc_battery_response;
-            rpc_battery_response.set_allocated_battery(rpc_battery);
-
-            std::lock_guard<std::mutex> lock(battery_mutex);
-            writer->Write(rpc_battery_response);
-        });
+        const auto handle = subscribe_battery(
+            [&writer, &battery_mutex](const rpc::telemetry::BatteryResponse& response) {
+                std::lock_guard<std::mutex> lock(battery_mutex);
+                writer->Write(response);
+            });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
+    SubscriptionHandle subscribe_flight_mode(
+        const response_writer_t<rpc::telemetry::FlightModeResponse>& write)
+    {
+        return _telemetry.subscribe_flight_mode(
+            [this, write](mavsdk::Telemetry::FlightMode flight_mode) {
+                auto rpc_flight_mode = translateFlightMode(flight_mode);
+
+                mavsdk::rpc::telemetry::FlightModeResponse rpc_flight_mode_response;
+                rpc_flight_mode_response.set_flight_mode(rpc_flight_mode);
+
+                write(rpc_flight_mode_response);
+            });
+    }
+
     grpc::Status SubscribeFlightMode(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeFlightModeRequest* /* request */,
@@ -285,18 +413,14 @@ public:
     {
         std::mutex flight_mode_mutex{};
 
-        _telemetry.flight_mode_async(
-            [this, &writer, &flight_mode_mutex](mavsdk::Telemetry::FlightMode flight_mode) {
-                auto rpc_flight_mode = translateFlightMode(flight_mode);
-
-                mavsdk::rpc::telemetry::FlightModeResponse rpc_flight_mode_response;
-                rpc_flight_mode_response.set_flight_mode(rpc_flight_mode);
-
+        const auto handle = subscribe_flight_mode(
+            [&writer, &flight_mode_mutex](const rpc::telemetry::FlightModeResponse& response) {
                 std::lock_guard<std::mutex> lock(flight_mode_mutex);
-                writer->Write(rpc_flight_mode_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
@@ -338,32 +462,65 @@ public:
         }
     }
 
-    grpc::Status SubscribeAttitudeQuaternion(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeAttitudeQuaternionRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::AttitudeQuaternionResponse>* writer) override
+    SubscriptionHandle subscribe_attitude_quaternion(
+        const response_writer_t<rpc::telemetry::AttitudeQuaternionResponse>& write)
     {
-        std::mutex attitude_quaternion_mutex{};
-
-        _telemetry.attitude_quaternion_async(
-            [&writer, &attitude_quaternion_mutex](mavsdk::Telemetry::Quaternion quaternion) {
-                auto rpc_quaternion = new mavsdk::rpc::telemetry::Quaternion();
+        auto reused =
+            std::make_shared<ReusedResponse<rpc::telemetry::AttitudeQuaternionResponse>>();
+        return _telemetry.subscribe_attitude_quaternion(
+            [write, reused](mavsdk::Telemetry::Quaternion quaternion) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_quaternion_response = reused->response;
+
+                auto rpc_quaternion = rpc_quaternion_response.mutable_attitude_quaternion();
                 rpc_quaternion->set_w(quaternion.w);
                 rpc_quaternion->set_x(quaternion.x);
                 rpc_quaternion->set_y(quaternion.y);
                 rpc_quaternion->set_z(quaternion.z);
 
-                mavsdk::rpc::telemetry::AttitudeQuaternionResponse rpc_quaternion_response;
-                rpc_quaternion_response.set_allocated_attitude_quaternion(rpc_quaternion);
+                write(rpc_quaternion_response);
+            });
+    }
+
+    grpc::Status SubscribeAttitudeQuaternion(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeAttitudeQuaternionRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::AttitudeQuaternionResponse>* writer) override
+    {
+        std::mutex attitude_quaternion_mutex{};
 
+        const auto handle = subscribe_attitude_quaternion(
+            [&writer, &attitude_quaternion_mutex](
+                const rpc::telemetry::AttitudeQuaternionResponse& response) {
                 std::lock_guard<std::mutex> lock(attitude_quaternion_mutex);
-                writer->Write(rpc_quaternion_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
+    SubscriptionHandle subscribe_attitude_angular_velocity_body(
+        const response_writer_t<rpc::telemetry::AttitudeAngularVelocityBodyResponse>& write)
+    {
+        auto reused =
+            std::make_shared<ReusedResponse<rpc::telemetry::AttitudeAngularVelocityBodyResponse>>();
+        return _telemetry.subscribe_attitude_angular_velocity_body(
+            [write, reused](mavsdk::Telemetry::AngularVelocityBody angular_velocity_body) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_angular_velocity_body_response = reused->response;
+
+                auto rpc_angular_velocity_body =
+                    rpc_angular_velocity_body_response.mutable_attitude_angular_velocity_body();
+                rpc_angular_velocity_body->set_roll_rad_s(angular_velocity_body.roll_rad_s);
+                rpc_angular_velocity_body->set_pitch_rad_s(angular_velocity_body.pitch_rad_s);
+                rpc_angular_velocity_body->set_yaw_rad_s(angular_velocity_body.yaw_rad_s);
+
+                write(rpc_angular_velocity_body_response);
+            });
+    }
+
     grpc::Status SubscribeAttitudeAngularVelocityBody(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeAttitudeAngularVelocityBodyRequest* /* request */,
@@ -371,78 +528,113 @@ public:
     {
         std::mutex attitude_angular_velocity_body_mutex{};
 
-        _telemetry.attitude_angular_velocity_body_async(
+        const auto handle = subscribe_attitude_angular_velocity_body(
             [&writer, &attitude_angular_velocity_body_mutex](
-                mavsdk::Telemetry::AngularVelocityBody angular_velocity_body) {
-                auto rpc_angular_velocity_body = new mavsdk::rpc::telemetry::AngularVelocityBody();
-                rpc_angular_velocity_body->set_roll_rad_s(angular_velocity_body.roll_rad_s);
-                rpc_angular_velocity_body->set_pitch_rad_s(angular_velocity_body.pitch_rad_s);
-                rpc_angular_velocity_body->set_yaw_rad_s(angular_velocity_body.yaw_rad_s);
-
-                mavsdk::rpc::telemetry::AttitudeAngularVelocityBodyResponse
-                    rpc_angular_velocity_body_response;
-                rpc_angular_velocity_body_response.set_allocated_attitude_angular_velocity_body(
-                    rpc_angular_velocity_body);
-
+                const rpc::telemetry::AttitudeAngularVelocityBodyResponse& response) {
                 std::lock_guard<std::mutex> lock(attitude_angular_velocity_body_mutex);
-                writer->Write(rpc_angular_velocity_body_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeAttitudeEuler(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeAttitudeEulerRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::AttitudeEulerResponse>* writer) override
+    SubscriptionHandle subscribe_attitude_euler(
+        const response_writer_t<rpc::telemetry::AttitudeEulerResponse>& write)
     {
-        std::mutex attitude_euler_mutex{};
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::AttitudeEulerResponse>>();
+        return _telemetry.subscribe_attitude_euler_angle(
+            [write, reused](mavsdk::Telemetry::EulerAngle euler_angle) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_euler_response = reused->response;
 
-        _telemetry.attitude_euler_angle_async(
-            [&writer, &attitude_euler_mutex](mavsdk::Telemetry::EulerAngle euler_angle) {
-                auto rpc_euler_angle = new mavsdk::rpc::telemetry::EulerAngle();
+                auto rpc_euler_angle = rpc_euler_response.mutable_attitude_euler();
                 rpc_euler_angle->set_roll_deg(euler_angle.roll_deg);
                 rpc_euler_angle->set_pitch_deg(euler_angle.pitch_deg);
                 rpc_euler_angle->set_yaw_deg(euler_angle.yaw_deg);
 
-                mavsdk::rpc::telemetry::AttitudeEulerResponse rpc_euler_response;
-                rpc_euler_response.set_allocated_attitude_euler(rpc_euler_angle);
+                write(rpc_euler_response);
+            });
+    }
+
+    grpc::Status SubscribeAttitudeEuler(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeAttitudeEulerRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::AttitudeEulerResponse>* writer) override
+    {
+        std::mutex attitude_euler_mutex{};
 
+        const auto handle = subscribe_attitude_euler(
+            [&writer, &attitude_euler_mutex](
+                const rpc::telemetry::AttitudeEulerResponse& response) {
                 std::lock_guard<std::mutex> lock(attitude_euler_mutex);
-                writer->Write(rpc_euler_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeCameraAttitudeQuaternion(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeCameraAttitudeQuaternionRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::CameraAttitudeQuaternionResponse>* writer) override
+    SubscriptionHandle subscribe_camera_attitude_quaternion(
+        const response_writer_t<rpc::telemetry::CameraAttitudeQuaternionResponse>& write)
     {
-        std::mutex camera_attitude_quaternion_mutex{};
-
-        _telemetry.camera_attitude_quaternion_async(
-            [&writer, &camera_attitude_quaternion_mutex](mavsdk::Telemetry::Quaternion quaternion) {
-                auto rpc_quaternion = new mavsdk::rpc::telemetry::Quaternion();
+        auto reused =
+            std::make_shared<ReusedResponse<rpc::telemetry::CameraAttitudeQuaternionResponse>>();
+        return _telemetry.subscribe_camera_attitude_quaternion(
+            [write, reused](mavsdk::Telemetry::Quaternion quaternion) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_quaternion_response = reused->response;
+
+                auto rpc_quaternion = rpc_quaternion_response.mutable_attitude_quaternion();
                 rpc_quaternion->set_w(quaternion.w);
                 rpc_quaternion->set_x(quaternion.x);
                 rpc_quaternion->set_y(quaternion.y);
                 rpc_quaternion->set_z(quaternion.z);
 
-                mavsdk::rpc::telemetry::CameraAttitudeQuaternionResponse rpc_quaternion_response;
-                rpc_quaternion_response.set_allocated_attitude_quaternion(rpc_quaternion);
+                write(rpc_quaternion_response);
+            });
+    }
 
+    grpc::Status SubscribeCameraAttitudeQuaternion(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeCameraAttitudeQuaternionRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::CameraAttitudeQuaternionResponse>* writer) override
+    {
+        std::mutex camera_attitude_quaternion_mutex{};
+
+        const auto handle = subscribe_camera_attitude_quaternion(
+            [&writer, &camera_attitude_quaternion_mutex](
+                const rpc::telemetry::CameraAttitudeQuaternionResponse& response) {
                 std::lock_guard<std::mutex> lock(camera_attitude_quaternion_mutex);
-                writer->Write(rpc_quaternion_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
+    SubscriptionHandle subscribe_camera_attitude_euler(
+        const response_writer_t<rpc::telemetry::CameraAttitudeEulerResponse>& write)
+    {
+        auto reused =
+            std::make_shared<ReusedResponse<rpc::telemetry::CameraAttitudeEulerResponse>>();
+        return _telemetry.subscribe_camera_attitude_euler_angle(
+            [write, reused](mavsdk::Telemetry::EulerAngle euler_angle) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_euler_response = reused->response;
+
+                auto rpc_euler_angle = rpc_euler_response.mutable_attitude_euler();
+                rpc_euler_angle->set_roll_deg(euler_angle.roll_deg);
+                rpc_euler_angle->set_pitch_deg(euler_angle.pitch_deg);
+                rpc_euler_angle->set_yaw_deg(euler_angle.yaw_deg);
+
+                write(rpc_euler_response);
+            });
+    }
+
     grpc::Status SubscribeCameraAttitudeEuler(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeCameraAttitudeEulerRequest* /* request */,
@@ -450,131 +642,169 @@ public:
     {
         std::mutex camera_attitude_euler_mutex{};
 
-        _telemetry.camera_attitude_euler_angle_async(
-            [&writer, &camera_attitude_euler_mutex](mavsdk::Telemetry::EulerAngle euler_angle) {
-                auto rpc_euler_angle = new mavsdk::rpc::telemetry::EulerAngle();
-                rpc_euler_angle->set_roll_deg(euler_angle.roll_deg);
-                rpc_euler_angle->set_pitch_deg(euler_angle.pitch_deg);
-                rpc_euler_angle->set_yaw_deg(euler_angle.yaw_deg);
-
-                mavsdk::rpc::telemetry::CameraAttitudeEulerResponse rpc_euler_response;
-                rpc_euler_response.set_allocated_attitude_euler(rpc_euler_angle);
-
+        const auto handle = subscribe_camera_attitude_euler(
+            [&writer, &camera_attitude_euler_mutex](
+                const rpc::telemetry::CameraAttitudeEulerResponse& response) {
                 std::lock_guard<std::mutex> lock(camera_attitude_euler_mutex);
-                writer->Write(rpc_euler_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeGroundSpeedNed(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeGroundSpeedNedRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::GroundSpeedNedResponse>* writer) override
+    SubscriptionHandle subscribe_ground_speed_ned(
+        const response_writer_t<rpc::telemetry::GroundSpeedNedResponse>& write)
     {
-        std::mutex ground_speed_mutex{};
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::GroundSpeedNedResponse>>();
+        return _telemetry.subscribe_ground_speed_ned(
+            [write, reused](mavsdk::Telemetry::GroundSpeedNED ground_speed) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_ground_speed_response = reused->response;
 
-        _telemetry.ground_speed_ned_async(
-            [&writer, &ground_speed_mutex](mavsdk::Telemetry::GroundSpeedNED ground_speed) {
-                auto rpc_ground_speed = new mavsdk::rpc::telemetry::SpeedNed();
+                auto rpc_ground_speed = rpc_ground_speed_response.mutable_ground_speed_ned();
                 rpc_ground_speed->set_velocity_north_m_s(ground_speed.velocity_north_m_s);
                 rpc_ground_speed->set_velocity_east_m_s(ground_speed.velocity_east_m_s);
                 rpc_ground_speed->set_velocity_down_m_s(ground_speed.velocity_down_m_s);
 
-                mavsdk::rpc::telemetry::GroundSpeedNedResponse rpc_ground_speed_response;
-                rpc_ground_speed_response.set_allocated_ground_speed_ned(rpc_ground_speed);
+                write(rpc_ground_speed_response);
+            });
+    }
+
+    grpc::Status SubscribeGroundSpeedNed(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeGroundSpeedNedRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::GroundSpeedNedResponse>* writer) override
+    {
+        std::mutex ground_speed_mutex{};
 
+        const auto handle = subscribe_ground_speed_ned(
+            [&writer, &ground_speed_mutex](const rpc::telemetry::GroundSpeedNedResponse& response) {
                 std::lock_guard<std::mutex> lock(ground_speed_mutex);
-                writer->Write(rpc_ground_speed_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeRcStatus(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeRcStatusRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::RcStatusResponse>* writer) override
+    SubscriptionHandle subscribe_rc_status(
+        const response_writer_t<rpc::telemetry::RcStatusResponse>& write)
     {
-        std::mutex rc_status_mutex{};
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::RcStatusResponse>>();
+        return _telemetry.subscribe_rc_status(
+            [write, reused](mavsdk::Telemetry::RCStatus rc_status) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_rc_status_response = reused->response;
 
-        _telemetry.rc_status_async(
-            [&writer, &rc_status_mutex](mavsdk::Telemetry::RCStatus rc_status) {
-                auto rpc_rc_status = new mavsdk::rpc::telemetry::RcStatus();
+                auto rpc_rc_status = rpc_rc_status_response.mutable_rc_status();
                 rpc_rc_status->set_was_available_once(rc_status.available_once);
                 rpc_rc_status->set_is_available(rc_status.available);
                 rpc_rc_status->set_signal_strength_percent(rc_status.signal_strength_percent);
 
-                mavsdk::rpc::telemetry::RcStatusResponse rpc_rc_status_response;
-                rpc_rc_status_response.set_allocated_rc_status(rpc_rc_status);
+                write(rpc_rc_status_response);
+            });
+    }
+
+    grpc::Status SubscribeRcStatus(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeRcStatusRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::RcStatusResponse>* writer) override
+    {
+        std::mutex rc_status_mutex{};
 
+        const auto handle = subscribe_rc_status(
+            [&writer, &rc_status_mutex](const rpc::telemetry::RcStatusResponse& response) {
                 std::lock_guard<std::mutex> lock(rc_status_mutex);
-                writer->Write(rpc_rc_status_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeActuatorControlTarget(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeActuatorControlTargetRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::ActuatorControlTargetResponse>* writer) override
+    SubscriptionHandle subscribe_actuator_control_target(
+        const response_writer_t<rpc::telemetry::ActuatorControlTargetResponse>& write)
     {
-        std::mutex actuator_control_target_mutex{};
+        auto reused =
+            std::make_shared<ReusedResponse<rpc::telemetry::ActuatorControlTargetResponse>>();
+        return _telemetry.subscribe_actuator_control_target(
+            [write, reused](mavsdk::Telemetry::ActuatorControlTarget actuator_control_target) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_actuator_control_target_response = reused->response;
 
-        _telemetry.actuator_control_target_async(
-            [&writer, &actuator_control_target_mutex](
-                mavsdk::Telemetry::ActuatorControlTarget actuator_control_target) {
                 auto rpc_actuator_control_target =
-                    new mavsdk::rpc::telemetry::ActuatorControlTarget();
+                    rpc_actuator_control_target_response.mutable_actuator_control_target();
                 rpc_actuator_control_target->set_group(actuator_control_target.group);
+                rpc_actuator_control_target->clear_controls();
                 for (int i = 0; i < 8; i++) {
                     rpc_actuator_control_target->add_controls(actuator_control_target.controls[i]);
                 }
 
-                mavsdk::rpc::telemetry::ActuatorControlTargetResponse
-                    rpc_actuator_control_target_response;
-                rpc_actuator_control_target_response.set_allocated_actuator_control_target(
-                    rpc_actuator_control_target);
+                write(rpc_actuator_control_target_response);
+            });
+    }
 
+    grpc::Status SubscribeActuatorControlTarget(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeActuatorControlTargetRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::ActuatorControlTargetResponse>* writer) override
+    {
+        std::mutex actuator_control_target_mutex{};
+
+        const auto handle = subscribe_actuator_control_target(
+            [&writer, &actuator_control_target_mutex](
+                const rpc::telemetry::ActuatorControlTargetResponse& response) {
                 std::lock_guard<std::mutex> lock(actuator_control_target_mutex);
-                writer->Write(rpc_actuator_control_target_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
-    grpc::Status SubscribeActuatorOutputStatus(
-        grpc::ServerContext* /* context */,
-        const mavsdk::rpc::telemetry::SubscribeActuatorOutputStatusRequest* /* request */,
-        grpc::ServerWriter<rpc::telemetry::ActuatorOutputStatusResponse>* writer) override
+    SubscriptionHandle subscribe_actuator_output_status(
+        const response_writer_t<rpc::telemetry::ActuatorOutputStatusResponse>& write)
     {
-        std::mutex actuator_output_status_mutex{};
+        auto reused =
+            std::make_shared<ReusedResponse<rpc::telemetry::ActuatorOutputStatusResponse>>();
+        return _telemetry.subscribe_actuator_output_status(
+            [write, reused](mavsdk::Telemetry::ActuatorOutputStatus actuator_output_status) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_actuator_output_status_response = reused->response;
 
-        _telemetry.actuator_output_status_async(
-            [&writer, &actuator_output_status_mutex](
-                mavsdk::Telemetry::ActuatorOutputStatus actuator_output_status) {
                 auto rpc_actuator_output_status =
-                    new mavsdk::rpc::telemetry::ActuatorOutputStatus();
+                    rpc_actuator_output_status_response.mutable_actuator_output_status();
                 rpc_actuator_output_status->set_active(actuator_output_status.active);
+                rpc_actuator_output_status->clear_actuator();
                 for (unsigned i = 0; i < actuator_output_status.active; i++) {
                     rpc_actuator_output_status->add_actuator(actuator_output_status.actuator[i]);
                 }
 
-                mavsdk::rpc::telemetry::ActuatorOutputStatusResponse
-                    rpc_actuator_output_status_response;
-                rpc_actuator_output_status_response.set_allocated_actuator_output_status(
-                    rpc_actuator_output_status);
+                write(rpc_actuator_output_status_response);
+            });
+    }
+
+    grpc::Status SubscribeActuatorOutputStatus(
+        grpc::ServerContext* /* context */,
+        const mavsdk::rpc::telemetry::SubscribeActuatorOutputStatusRequest* /* request */,
+        grpc::ServerWriter<rpc::telemetry::ActuatorOutputStatusResponse>* writer) override
+    {
+        std::mutex actuator_output_status_mutex{};
 
+        const auto handle = subscribe_actuator_output_status(
+            [&writer, &actuator_output_status_mutex](
+                const rpc::telemetry::ActuatorOutputStatusResponse& response) {
                 std::lock_guard<std::mutex> lock(actuator_output_status_mutex);
-                writer->Write(rpc_actuator_output_status_response);
+                writer->Write(response);
             });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
@@ -594,6 +824,60 @@ public:
         }
     }
 
+    SubscriptionHandle subscribe_odometry(
+        const response_writer_t<rpc::telemetry::OdometryResponse>& write)
+    {
+        auto reused = std::make_shared<ReusedResponse<rpc::telemetry::OdometryResponse>>();
+        return _telemetry.subscribe_odometry(
+            [this, write, reused](mavsdk::Telemetry::Odometry odometry) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_odometry_response = reused->response;
+
+                auto rpc_odometry = rpc_odometry_response.mutable_odometry();
+                rpc_odometry->set_time_usec(odometry.time_usec);
+
+                rpc_odometry->set_frame_id(translateFrameId(odometry.frame_id));
+                rpc_odometry->set_child_frame_id(translateFrameId(odometry.child_frame_id));
+
+                auto rpc_position_body = rpc_odometry->mutable_position_body();
+                rpc_position_body->set_x_m(odometry.position_body.x_m);
+                rpc_position_body->set_y_m(odometry.position_body.y_m);
+                rpc_position_body->set_z_m(odometry.position_body.z_m);
+
+                auto rpc_q = rpc_odometry->mutable_q();
+                rpc_q->set_w(odometry.q.w);
+                rpc_q->set_x(odometry.q.x);
+                rpc_q->set_y(odometry.q.y);
+                rpc_q->set_z(odometry.q.z);
+
+                auto rpc_speed_body = rpc_odometry->mutable_speed_body();
+                rpc_speed_body->set_velocity_x_m_s(odometry.velocity_body.x_m_s);
+                rpc_speed_body->set_velocity_y_m_s(odometry.velocity_body.y_m_s);
+                rpc_speed_body->set_velocity_z_m_s(odometry.velocity_body.z_m_s);
+
+                auto rpc_angular_velocity_body = rpc_odometry->mutable_angular_velocity_body();
+                rpc_angular_velocity_body->set_roll_rad_s(
+                    odometry.angular_velocity_body.roll_rad_s);
+                rpc_angular_velocity_body->set_pitch_rad_s(
+                    odometry.angular_velocity_body.pitch_rad_s);
+                rpc_angular_velocity_body->set_yaw_rad_s(odometry.angular_velocity_body.yaw_rad_s);
+
+                auto pose_covariance = rpc_odometry->mutable_pose_covariance();
+                pose_covariance->clear_covariance_matrix();
+                for (int i = 0; i < 21; i++) {
+                    pose_covariance->add_covariance_matrix(odometry.pose_covariance[i]);
+                }
+
+                auto velocity_covariance = rpc_odometry->mutable_velocity_covariance();
+                velocity_covariance->clear_covariance_matrix();
+                for (int i = 0; i < 21; i++) {
+                    velocity_covariance->add_covariance_matrix(odometry.velocity_covariance[i]);
+                }
+
+                write(rpc_odometry_response);
+            });
+    }
+
     grpc::Status SubscribeOdometry(
         grpc::ServerContext* /* context */,
         const mavsdk::rpc::telemetry::SubscribeOdometryRequest* /* request */,
@@ -601,65 +885,212 @@ public:
     {
         std::mutex odometry_mutex{};
 
-        _telemetry.odometry_async([this, &writer, &odometry_mutex](
-                                      mavsdk::Telemetry::Odometry odometry) {
-            auto rpc_odometry = new mavsdk::rpc::telemetry::Odometry();
-            rpc_odometry->set_time_usec(odometry.time_usec);
-
-            rpc_odometry->set_frame_id(translateFrameId(odometry.frame_id));
-            rpc_odometry->set_child_frame_id(translateFrameId(odometry.child_frame_id));
-
-            auto rpc_position_body = new mavsdk::rpc::telemetry::PositionBody();
-            rpc_position_body->set_x_m(odometry.position_body.x_m);
-            rpc_position_body->set_y_m(odometry.position_body.y_m);
-            rpc_position_body->set_z_m(odometry.position_body.z_m);
-            rpc_odometry->set_allocated_position_body(rpc_position_body);
-
-            auto rpc_q = new mavsdk::rpc::telemetry::Quaternion();
-            rpc_q->set_w(odometry.q.w);
-            rpc_q->set_x(odometry.q.x);
-            rpc_q->set_y(odometry.q.y);
-            rpc_q->set_z(odometry.q.z);
-            rpc_odometry->set_allocated_q(rpc_q);
-
-            auto rpc_speed_body = new mavsdk::rpc::telemetry::SpeedBody();
-            rpc_speed_body->set_velocity_x_m_s(odometry.velocity_body.x_m_s);
-            rpc_speed_body->set_velocity_y_m_s(odometry.velocity_body.y_m_s);
-            rpc_speed_body->set_velocity_z_m_s(odometry.velocity_body.z_m_s);
-            rpc_odometry->set_allocated_speed_body(rpc_speed_body);
-
-            auto rpc_angular_velocity_body = new mavsdk::rpc::telemetry::AngularVelocityBody();
-            rpc_angular_velocity_body->set_roll_rad_s(odometry.angular_velocity_body.roll_rad_s);
-            rpc_angular_velocity_body->set_pitch_rad_s(odometry.angular_velocity_body.pitch_rad_s);
-            rpc_angular_velocity_body->set_yaw_rad_s(odometry.angular_velocity_body.yaw_rad_s);
-            rpc_odometry->set_allocated_angular_velocity_body(rpc_angular_velocity_body);
-
-            auto pose_covariance = new mavsdk::rpc::telemetry::Covariance();
-            for (int i = 0; i < 21; i++) {
-                pose_covariance->add_covariance_matrix(odometry.pose_covariance[i]);
-            }
-            rpc_odometry->set_allocated_pose_covariance(pose_covariance);
-
-            auto velocity_covariance = new mavsdk::rpc::telemetry::Covariance();
-            for (int i = 0; i < 21; i++) {
-                velocity_covariance->add_covariance_matrix(odometry.velocity_covariance[i]);
-            }
-            rpc_odometry->set_allocated_velocity_covariance(velocity_covariance);
-
-            mavsdk::rpc::telemetry::OdometryResponse rpc_odometry_response;
-            rpc_odometry_response.set_allocated_odometry(rpc_odometry);
-
-            std::lock_guard<std::mutex> lock(odometry_mutex);
-            writer->Write(rpc_odometry_response);
-        });
+        const auto handle = subscribe_odometry(
+            [&writer, &odometry_mutex](const rpc::telemetry::OdometryResponse& response) {
+                std::lock_guard<std::mutex> lock(odometry_mutex);
+                writer->Write(response);
+            });
+
+        _stop_future.wait();
+        unsubscribe(handle);
+        return grpc::Status::OK;
+    }
+
+    void get_telemetry_snapshot(
+        const rpc::telemetry::GetTelemetrySnapshotRequest& request,
+        rpc::telemetry::GetTelemetrySnapshotResponse* response)
+    {
+        const auto snapshot = _telemetry.snapshot(translateSnapshotFields(request.fields()));
+        translateTelemetrySnapshot(snapshot, response->mutable_telemetry_snapshot());
+    }
+
+    grpc::Status GetTelemetrySnapshot(
+        grpc::ServerContext* /* context */,
+        const rpc::telemetry::GetTelemetrySnapshotRequest* request,
+        rpc::telemetry::GetTelemetrySnapshotResponse* response) override
+    {
+        if (request != nullptr && response != nullptr) {
+            get_telemetry_snapshot(*request, response);
+        }
+
+        return grpc::Status::OK;
+    }
+
+    // Streams which take parameters check them before subscribing, the others
+    // accept any request.
+    template<typename Request> static grpc::Status check_request(const Request& /* request */)
+    {
+        return grpc::Status::OK;
+    }
+
+    static grpc::Status
+    check_request(const rpc::telemetry::SubscribeTelemetrySnapshotRequest& request)
+    {
+        if (!(request.rate_hz() > 0.0)) {
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "Rate needs to be positive");
+        }
+        return grpc::Status::OK;
+    }
+
+    SubscriptionHandle subscribe_telemetry_snapshot(
+        const rpc::telemetry::SubscribeTelemetrySnapshotRequest& request,
+        const response_writer_t<rpc::telemetry::TelemetrySnapshotResponse>& write)
+    {
+        auto reused =
+            std::make_shared<ReusedResponse<rpc::telemetry::TelemetrySnapshotResponse>>();
+        return _telemetry.subscribe_snapshot(
+            translateSnapshotFields(request.fields()),
+            request.rate_hz(),
+            [this, write, reused](mavsdk::Telemetry::Snapshot snapshot) {
+                std::lock_guard<std::mutex> lock(reused->mutex);
+                auto& rpc_snapshot_response = reused->response;
+
+                translateTelemetrySnapshot(
+                    snapshot, rpc_snapshot_response.mutable_telemetry_snapshot());
+
+                write(rpc_snapshot_response);
+            });
+    }
+
+    grpc::Status SubscribeTelemetrySnapshot(
+        grpc::ServerContext* /* context */,
+        const rpc::telemetry::SubscribeTelemetrySnapshotRequest* request,
+        grpc::ServerWriter<rpc::telemetry::TelemetrySnapshotResponse>* writer) override
+    {
+        const auto& snapshot_request =
+            request != nullptr ?
+                *request :
+                rpc::telemetry::SubscribeTelemetrySnapshotRequest::default_instance();
+
+        const auto status = check_request(snapshot_request);
+        if (!status.ok()) {
+            return status;
+        }
+
+        std::mutex snapshot_mutex{};
+
+        const auto handle = subscribe_telemetry_snapshot(
+            snapshot_request,
+            [&writer, &snapshot_mutex](const rpc::telemetry::TelemetrySnapshotResponse& response) {
+                std::lock_guard<std::mutex> lock(snapshot_mutex);
+                writer->Write(response);
+            });
 
         _stop_future.wait();
+        unsubscribe(handle);
         return grpc::Status::OK;
     }
 
+    // The fields TelemetrySnapshot has in the proto. No fields in the request (the proto
+    // default) selects all of them.
+    static mavsdk::Telemetry::SnapshotField translateSnapshotFields(const uint32_t fields)
+    {
+        typedef mavsdk::Telemetry::SnapshotField Field;
+
+        const Field rpc_fields =
+            Field::ALL & ~(Field::ATTITUDE_QUATERNION | Field::ATTITUDE_ANGULAR_VELOCITY_BODY);
+        if (fields == 0) {
+            return rpc_fields;
+        }
+        return static_cast<Field>(fields) & rpc_fields;
+    }
+
+    // Only the fields in the snapshot are set, the others are left as they are. The
+    // fields of a subscription don't change, so a reused message has no stale values.
+    void translateTelemetrySnapshot(
+        const mavsdk::Telemetry::Snapshot& snapshot,
+        rpc::telemetry::TelemetrySnapshot* rpc_snapshot) const
+    {
+        typedef mavsdk::Telemetry::SnapshotField Field;
+
+        rpc_snapshot->set_timestamp_us(snapshot.timestamp_us);
+        rpc_snapshot->set_fields(static_cast<uint32_t>(snapshot.fields));
+
+        if (has_snapshot_field(snapshot.fields, Field::POSITION)) {
+            translatePosition(snapshot.position, rpc_snapshot->mutable_position());
+        }
+        if (has_snapshot_field(snapshot.fields, Field::HOME_POSITION)) {
+            translatePosition(snapshot.home_position, rpc_snapshot->mutable_home_position());
+        }
+        if (has_snapshot_field(snapshot.fields, Field::IN_AIR)) {
+            rpc_snapshot->set_in_air(snapshot.in_air);
+        }
+        if (has_snapshot_field(snapshot.fields, Field::ARMED)) {
+            rpc_snapshot->set_armed(snapshot.armed);
+        }
+        if (has_snapshot_field(snapshot.fields, Field::LANDED_STATE)) {
+            rpc_snapshot->set_landed_state(translateLandedState(snapshot.landed_state));
+        }
+        if (has_snapshot_field(snapshot.fields, Field::FLIGHT_MODE)) {
+            rpc_snapshot->set_flight_mode(translateFlightMode(snapshot.flight_mode));
+        }
+        if (has_snapshot_field(snapshot.fields, Field::ATTITUDE_EULER_ANGLE)) {
+            auto rpc_euler_angle = rpc_snapshot->mutable_attitude_euler_angle();
+            rpc_euler_angle->set_roll_deg(snapshot.attitude_euler_angle.roll_deg);
+            rpc_euler_angle->set_pitch_deg(snapshot.attitude_euler_angle.pitch_deg);
+            rpc_euler_angle->set_yaw_deg(snapshot.attitude_euler_angle.yaw_deg);
+        }
+        if (has_snapshot_field(snapshot.fields, Field::GROUND_SPEED_NED)) {
+            auto rpc_ground_speed = rpc_snapshot->mutable_ground_speed_ned();
+            rpc_ground_speed->set_velocity_north_m_s(snapshot.ground_speed_ned.velocity_north_m_s);
+            rpc_ground_speed->set_velocity_east_m_s(snapshot.ground_speed_ned.velocity_east_m_s);
+            rpc_ground_speed->set_velocity_down_m_s(snapshot.ground_speed_ned.velocity_down_m_s);
+        }
+        if (has_snapshot_field(snapshot.fields, Field::GPS_INFO)) {
+            auto rpc_gps_info = rpc_snapshot->mutable_gps_info();
+            rpc_gps_info->set_num_satellites(snapshot.gps_info.num_satellites);
+            rpc_gps_info->set_fix_type(translateGpsFixType(snapshot.gps_info.fix_type));
+        }
+        if (has_snapshot_field(snapshot.fields, Field::BATTERY)) {
+            auto rpc_battery = rpc_snapshot->mutable_battery();
+            rpc_battery->set_voltage_v(snapshot.battery.voltage_v);
+            rpc_battery->set_remaining_percent(snapshot.battery.remaining_percent);
+        }
+        if (has_snapshot_field(snapshot.fields, Field::HEALTH)) {
+            const auto& health = snapshot.health;
+            auto rpc_health = rpc_snapshot->mutable_health();
+            rpc_health->set_is_gyrometer_calibration_ok(health.gyrometer_calibration_ok);
+            rpc_health->set_is_accelerometer_calibration_ok(health.accelerometer_calibration_ok);
+            rpc_health->set_is_magnetometer_calibration_ok(health.magnetometer_calibration_ok);
+            rpc_health->set_is_level_calibration_ok(health.level_calibration_ok);
+            rpc_health->set_is_local_position_ok(health.local_position_ok);
+            rpc_health->set_is_global_position_ok(health.global_position_ok);
+            rpc_health->set_is_home_position_ok(health.home_position_ok);
+        }
+        if (has_snapshot_field(snapshot.fields, Field::RC_STATUS)) {
+            auto rpc_rc_status = rpc_snapshot->mutable_rc_status();
+            rpc_rc_status->set_was_available_once(snapshot.rc_status.available_once);
+            rpc_rc_status->set_is_available(snapshot.rc_status.available);
+            rpc_rc_status->set_signal_strength_percent(
+                snapshot.rc_status.signal_strength_percent);
+        }
+        if (has_snapshot_field(snapshot.fields, Field::STATUS_TEXT)) {
+            auto rpc_status_text = rpc_snapshot->mutable_status_text();
+            rpc_status_text->set_text(snapshot.status_text.text);
+            rpc_status_text->set_type(translateStatusTextType(snapshot.status_text.type));
+        }
+    }
+
+    static void translatePosition(
+        const mavsdk::Telemetry::Position& position, rpc::telemetry::Position* rpc_position)
+    {
+        rpc_position->set_latitude_deg(position.latitude_deg);
+        rpc_position->set_longitude_deg(position.longitude_deg);
+        rpc_position->set_relative_altitude_m(position.relative_altitude_m);
+        rpc_position->set_absolute_altitude_m(position.absolute_altitude_m);
+    }
+
     void stop() { _stop_promise.set_value(); }
 
 private:
+    // Response filled in place for every update of a subscription, so the nested
+    // messages are only allocated once instead of for every sample. The callbacks
+    // of one stream can run on several threads at the same time.
+    template<typename Response> struct ReusedResponse {
+        std::mutex mutex{};
+        Response response{};
+    };
+
     Telemetry& _telemetry;
     std::promise<void> _stop_promise;
     std::future<void> _stop_future;
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/status.h>
+
+#include "mavsdk.h"
+
+namespace mavsdk {
+namespace backend {
+
+/*
+ * The instances of one plugin for the systems served, e.g. one Action per vehicle.
+ *
+ * Clients select the system of a call by sending its UUID as metadata, e.g.
+ * `mavsdk-system-uuid: 5283920058631409231`. Calls without it go to the first
+ * system discovered, as before.
+ *
+ * A plugin is only created once a call for its system comes in, so systems no
+ * client talks to don't cost anything. Plugins stay around until the server is
+ * destroyed, so references to them can be kept for the duration of a call. Calls
+ * for a system which is not discovered fail without creating a plugin.
+ */
+template<class Plugin> class SystemPlugins {
+public:
+    static constexpr const char* system_uuid_key = "mavsdk-system-uuid";
+
+    // Always returns the given plugin, e.g. for tests.
+    explicit SystemPlugins(Plugin& plugin) : _fixed_plugin(&plugin) {}
+
+    // Creates plugins for the systems of `mavsdk` when first needed.
+    explicit SystemPlugins(Mavsdk& mavsdk) :
+        _mavsdk(&mavsdk),
+        _create_plugin(
+            [](System& system) { return std::unique_ptr<Plugin>(new Plugin(system)); })
+    {}
+
+    ~SystemPlugins() = default;
+
+    // The plugin for the system the call is for, nullptr if that system is not
+    // (yet) discovered. Such calls are failed with no_system_status().
+    Plugin* get(const grpc::ServerContext* context)
+    {
+        if (_fixed_plugin != nullptr) {
+            return _fixed_plugin;
+        }
+
+        const std::vector<uint64_t> uuids = _mavsdk->system_uuids();
+        uint64_t uuid = 0;
+        bool known = false;
+
+        if (context != nullptr && requested_uuid(*context, uuid)) {
+            for (const auto known_uuid : uuids) {
+                known = known || known_uuid == uuid;
+            }
+        } else if (!uuids.empty()) {
+            // Same as Mavsdk::system(), which returns the first system.
+            uuid = uuids.front();
+            known = true;
+        }
+
+        // No plugin is created for unknown systems: looking them up in Mavsdk would
+        // add a placeholder system, which then takes the place of the first one.
+        if (!known) {
+            return nullptr;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        auto& plugin = _plugins[uuid];
+        if (!plugin) {
+            plugin = _create_plugin(_mavsdk->system(uuid));
+        }
+        return plugin.get();
+    }
+
+    // Non-copyable
+    SystemPlugins(const SystemPlugins&) = delete;
+    const SystemPlugins& operator=(const SystemPlugins&) = delete;
+
+private:
+    // A UUID which can't be parsed is taken as 0, which no system has.
+    static bool requested_uuid(const grpc::ServerContext& context, uint64_t& uuid)
+    {
+        const auto& metadata = context.client_metadata();
+        auto it = metadata.find(system_uuid_key);
+        if (it == metadata.end()) {
+            return false;
+        }
+
+        const std::string value(it->second.data(), it->second.size());
+        char* end = nullptr;
+        uuid = std::strtoull(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || value[0] == '-') {
+            uuid = 0;
+        }
+        return true;
+    }
+
+    Plugin* _fixed_plugin{nullptr};
+    Mavsdk* _mavsdk{nullptr};
+    std::function<std::unique_ptr<Plugin>(System&)> _create_plugin{};
+
+    std::mutex _mutex{};
+    std::map<uint64_t, std::unique_ptr<Plugin>> _plugins{};
+};
+
+// What calls for a system which is not discovered fail with.
+inline grpc::Status no_system_status()
+{
+    return grpc::Status(grpc::StatusCode::NOT_FOUND, "System not discovered");
+}
+
+} // namespace backend
+} // namespace mavsdk
@@ -12,7 +12,6 @@
 namespace {
 
 using testing::_;
-using testing::DoDefault;
 using testing::NiceMock;
 using testing::Return;
 
@@ -42,6 +41,7 @@ static constexpr auto ARBITRARY_SETTING_DESCRIPTION = "Twenty-three b four hundr
 static constexpr auto ARBITRARY_OPTION_ID = "small";
 static constexpr auto ARBITRARY_OPTION_DESCRIPTION = "Bigger";
 static constexpr auto ARBITRARY_CAMERA_RESULT = mavsdk::Camera::Result::SUCCESS;
+static constexpr mavsdk::Camera::SubscriptionHandle ARBITRARY_SUBSCRIPTION_HANDLE = 42;
 
 std::vector<InputPair> generateInputPairs();
 
@@ -158,6 +158,7 @@ ACTION_P2(SaveResult, callback, callback_saved_promise)
 {
     *callback = arg0;
     callback_saved_promise->set_value();
+    return ARBITRARY_SUBSCRIPTION_HANDLE;
 }
 
 TEST_P(CameraServiceImplTest, takePhotoResultIsTranslatedCorrectly)
@@ -360,10 +361,9 @@ TEST_F(CameraServiceImplTest, setModeSetsVideoMode)
 TEST_F(CameraServiceImplTest, registersToCameraMode)
 {
     mavsdk::Camera::subscribe_mode_callback_t mode_callback;
-    EXPECT_CALL(_camera, subscribe_mode(_))
-        .Times(2)
-        .WillOnce(SaveResult(&mode_callback, &_callback_saved_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_mode_subscriber(_))
+        .WillOnce(SaveResult(&mode_callback, &_callback_saved_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
     std::vector<mavsdk::Camera::Mode> mode_events;
     auto context = std::make_shared<grpc::ClientContext>();
 
@@ -406,10 +406,9 @@ void CameraServiceImplTest::checkSendsModes(const std::vector<mavsdk::Camera::Mo
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Camera::subscribe_mode_callback_t mode_callback;
     auto context = std::make_shared<grpc::ClientContext>();
-    EXPECT_CALL(_camera, subscribe_mode(_))
-        .Times(2)
-        .WillOnce(SaveResult(&mode_callback, &subscription_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_mode_subscriber(_))
+        .WillOnce(SaveResult(&mode_callback, &subscription_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
 
     std::vector<mavsdk::Camera::Mode> received_modes;
     auto mode_events_future = subscribeModeAsync(received_modes, context);
@@ -461,10 +460,9 @@ TEST_F(CameraServiceImplTest, registersToVideoStreamInfo)
     const auto expected_video_stream_info =
         CameraServiceImpl::translateRPCVideoStreamInfo(*rpc_video_stream_info);
     mavsdk::Camera::subscribe_video_stream_info_callback_t video_info_callback;
-    EXPECT_CALL(_camera, subscribe_video_stream_info(_))
-        .Times(2)
-        .WillOnce(SaveResult(&video_info_callback, &_callback_saved_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_video_stream_info_subscriber(_))
+        .WillOnce(SaveResult(&video_info_callback, &_callback_saved_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
     std::vector<mavsdk::Camera::VideoStreamInfo> video_info_events;
     auto context = std::make_shared<grpc::ClientContext>();
 
@@ -521,10 +519,9 @@ void CameraServiceImplTest::checkSendsVideoStreamInfo(
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Camera::subscribe_video_stream_info_callback_t video_info_callback;
     auto context = std::make_shared<grpc::ClientContext>();
-    EXPECT_CALL(_camera, subscribe_video_stream_info(_))
-        .Times(2)
-        .WillOnce(SaveResult(&video_info_callback, &subscription_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_video_stream_info_subscriber(_))
+        .WillOnce(SaveResult(&video_info_callback, &subscription_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
 
     std::vector<mavsdk::Camera::VideoStreamInfo> received_video_info_events;
     auto video_info_events_future =
@@ -551,10 +548,9 @@ TEST_F(CameraServiceImplTest, registersToCaptureInfo)
     const auto expected_capture_info =
         CameraServiceImpl::translateRPCCaptureInfo(*rpc_capture_info);
     mavsdk::Camera::capture_info_callback_t capture_info_callback;
-    EXPECT_CALL(_camera, subscribe_capture_info(_))
-        .Times(2)
-        .WillOnce(SaveResult(&capture_info_callback, &_callback_saved_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_capture_info_subscriber(_))
+        .WillOnce(SaveResult(&capture_info_callback, &_callback_saved_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
     std::vector<mavsdk::Camera::CaptureInfo> capture_info_events;
     auto context = std::make_shared<grpc::ClientContext>();
 
@@ -659,10 +655,9 @@ void CameraServiceImplTest::checkSendsCaptureInfo(
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Camera::capture_info_callback_t capture_info_callback;
     auto context = std::make_shared<grpc::ClientContext>();
-    EXPECT_CALL(_camera, subscribe_capture_info(_))
-        .Times(2)
-        .WillOnce(SaveResult(&capture_info_callback, &subscription_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_capture_info_subscriber(_))
+        .WillOnce(SaveResult(&capture_info_callback, &subscription_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
 
     std::vector<mavsdk::Camera::CaptureInfo> received_capture_info_events;
     auto capture_info_events_future =
@@ -731,10 +726,9 @@ TEST_F(CameraServiceImplTest, registersToCameraStatus)
     const auto expected_camera_status = createCameraStatus(
         false, true, ARBITRARY_CAMERA_STORAGE_STATUS, 3.4f, 12.6f, 16.0f, 0.4f, "100E90HD");
     mavsdk::Camera::subscribe_status_callback_t status_callback;
-    EXPECT_CALL(_camera, subscribe_status(_))
-        .Times(2)
-        .WillOnce(SaveResult(&status_callback, &_callback_saved_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_status_subscriber(_))
+        .WillOnce(SaveResult(&status_callback, &_callback_saved_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
     std::vector<mavsdk::Camera::Status> camera_status_events;
     auto context = std::make_shared<grpc::ClientContext>();
 
@@ -803,10 +797,9 @@ void CameraServiceImplTest::checkSendsCameraStatus(
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Camera::subscribe_status_callback_t camera_status_callback;
     auto context = std::make_shared<grpc::ClientContext>();
-    EXPECT_CALL(_camera, subscribe_status(_))
-        .Times(2)
-        .WillOnce(SaveResult(&camera_status_callback, &subscription_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_status_subscriber(_))
+        .WillOnce(SaveResult(&camera_status_callback, &subscription_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
 
     std::vector<mavsdk::Camera::Status> received_camera_status_events;
     auto camera_status_events_future =
@@ -870,10 +863,9 @@ TEST_F(CameraServiceImplTest, registersToCurrentSettings)
         ARBITRARY_SETTING_DESCRIPTION,
         createOption(ARBITRARY_OPTION_ID, ARBITRARY_OPTION_DESCRIPTION)));
     mavsdk::Camera::subscribe_current_settings_callback_t current_settings_callback;
-    EXPECT_CALL(_camera, subscribe_current_settings(_))
-        .Times(2)
-        .WillOnce(SaveResult(&current_settings_callback, &_callback_saved_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_current_settings_subscriber(_))
+        .WillOnce(SaveResult(&current_settings_callback, &_callback_saved_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
     std::vector<std::vector<mavsdk::Camera::Setting>> current_settings_events;
     auto context = std::make_shared<grpc::ClientContext>();
 
@@ -952,10 +944,9 @@ void CameraServiceImplTest::checkSendsCurrentSettings(
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Camera::subscribe_current_settings_callback_t current_settings_callback;
     auto context = std::make_shared<grpc::ClientContext>();
-    EXPECT_CALL(_camera, subscribe_current_settings(_))
-        .Times(2)
-        .WillOnce(SaveResult(&current_settings_callback, &subscription_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_current_settings_subscriber(_))
+        .WillOnce(SaveResult(&current_settings_callback, &subscription_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
 
     std::vector<std::vector<mavsdk::Camera::Setting>> received_current_settings_events;
     auto current_settings_events_future =
@@ -1029,10 +1020,9 @@ TEST_F(CameraServiceImplTest, registersToPossibleSettings)
     possible_settings.push_back(
         createSettingOptions(ARBITRARY_SETTING_ID, ARBITRARY_SETTING_DESCRIPTION, options));
     mavsdk::Camera::subscribe_possible_setting_options_callback_t possible_settings_callback;
-    EXPECT_CALL(_camera, subscribe_possible_setting_options(_))
-        .Times(2)
-        .WillOnce(SaveResult(&possible_settings_callback, &_callback_saved_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_possible_setting_options_subscriber(_))
+        .WillOnce(SaveResult(&possible_settings_callback, &_callback_saved_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
     std::vector<std::vector<mavsdk::Camera::SettingOptions>> possible_settings_events;
     auto context = std::make_shared<grpc::ClientContext>();
 
@@ -1103,10 +1093,9 @@ void CameraServiceImplTest::checkSendsPossibleSettingOptions(
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Camera::subscribe_possible_setting_options_callback_t possible_setting_options_callback;
     auto context = std::make_shared<grpc::ClientContext>();
-    EXPECT_CALL(_camera, subscribe_possible_setting_options(_))
-        .Times(2)
-        .WillOnce(SaveResult(&possible_setting_options_callback, &subscription_promise))
-        .WillOnce(DoDefault());
+    EXPECT_CALL(_camera, add_possible_setting_options_subscriber(_))
+        .WillOnce(SaveResult(&possible_setting_options_callback, &subscription_promise));
+    EXPECT_CALL(_camera, unsubscribe(ARBITRARY_SUBSCRIPTION_HANDLE));
 
     std::vector<std::vector<mavsdk::Camera::SettingOptions>>
         received_possible_setting_options_events;
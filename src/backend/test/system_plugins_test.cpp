@@ -0,0 +1,34 @@
+#include <gmock/gmock.h>
+#include <grpcpp/server_context.h>
+
+#include "action/action_service_impl.h"
+#include "mavsdk.h"
+#include "plugins/action/action.h"
+#include "system_plugins.h"
+
+namespace {
+
+using ActionServiceImpl = mavsdk::backend::ActionServiceImpl<mavsdk::Action>;
+
+TEST(SystemPlugins, returnsNoPluginWithoutSystem)
+{
+    mavsdk::Mavsdk mavsdk;
+    mavsdk::backend::SystemPlugins<mavsdk::Action> actions(mavsdk);
+
+    EXPECT_EQ(nullptr, actions.get(nullptr));
+}
+
+TEST(SystemPlugins, failsCallsWithoutSystem)
+{
+    mavsdk::Mavsdk mavsdk;
+    ActionServiceImpl actionService(mavsdk);
+    grpc::ServerContext context;
+    mavsdk::rpc::action::ArmResponse response;
+
+    const auto status = actionService.Arm(&context, nullptr, &response);
+
+    EXPECT_EQ(grpc::StatusCode::NOT_FOUND, status.error_code());
+    EXPECT_FALSE(response.has_action_result());
+}
+
+} // namespace
@@ -0,0 +1,319 @@
+#include <future>
+#include <gmock/gmock.h>
+#include <grpc++/grpc++.h>
+#include <grpc++/server.h>
+#include <grpc++/server_builder.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "telemetry/mocks/telemetry_mock.h"
+#include "telemetry/telemetry_async_service_impl.h"
+
+namespace {
+
+using testing::_;
+using testing::NiceMock;
+
+using MockTelemetry = NiceMock<mavsdk::testing::MockTelemetry>;
+using TelemetryAsyncServiceImpl = mavsdk::backend::TelemetryAsyncServiceImpl<MockTelemetry>;
+using TelemetryService = mavsdk::rpc::telemetry::TelemetryService;
+
+using Position = mavsdk::Telemetry::Position;
+
+class TelemetryAsyncServiceImplTest : public ::testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        _telemetry = std::unique_ptr<MockTelemetry>(new MockTelemetry());
+        _telemetry_service =
+            std::unique_ptr<TelemetryAsyncServiceImpl>(new TelemetryAsyncServiceImpl(*_telemetry));
+
+        grpc::ServerBuilder builder;
+        builder.RegisterService(_telemetry_service.get());
+        _completion_queue = builder.AddCompletionQueue();
+        _server = builder.BuildAndStart();
+
+        _telemetry_service->start(_completion_queue.get());
+        for (int i = 0; i < 2; i++) {
+            _threads.emplace_back([this]() {
+                void* tag = nullptr;
+                bool ok = false;
+                while (_completion_queue->Next(&tag, &ok)) {
+                    static_cast<mavsdk::backend::AsyncTag*>(tag)->proceed(ok);
+                }
+            });
+        }
+
+        grpc::ChannelArguments channel_args;
+        auto channel = _server->InProcessChannel(channel_args);
+        _stub = TelemetryService::NewStub(channel);
+    }
+
+    virtual void TearDown()
+    {
+        _server->Shutdown();
+        _telemetry_service->stop();
+        _completion_queue->Shutdown();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    std::future<void> subscribePositionAsync(
+        std::vector<Position>& positions, const std::string& batch_max_delay_ms = "");
+
+    std::unique_ptr<MockTelemetry> _telemetry{};
+    std::unique_ptr<TelemetryAsyncServiceImpl> _telemetry_service{};
+    std::unique_ptr<grpc::ServerCompletionQueue> _completion_queue{};
+    std::unique_ptr<grpc::Server> _server{};
+    std::unique_ptr<TelemetryService::Stub> _stub{};
+    std::vector<std::thread> _threads{};
+};
+
+ACTION_P2(SaveCallback, callback, callback_promise)
+{
+    *callback = arg0;
+    callback_promise->set_value();
+    return mavsdk::Telemetry::SubscriptionHandle(1);
+}
+
+std::future<void> TelemetryAsyncServiceImplTest::subscribePositionAsync(
+    std::vector<Position>& positions, const std::string& batch_max_delay_ms)
+{
+    return std::async(std::launch::async, [&positions, batch_max_delay_ms, this]() {
+        grpc::ClientContext context;
+        if (!batch_max_delay_ms.empty()) {
+            context.AddMetadata(mavsdk::backend::BatchOptions::max_delay_key, batch_max_delay_ms);
+            context.AddMetadata(mavsdk::backend::BatchOptions::max_messages_key, "10");
+        }
+        mavsdk::rpc::telemetry::SubscribePositionRequest request;
+        auto response_reader = _stub->SubscribePosition(&context, request);
+
+        mavsdk::rpc::telemetry::PositionResponse response;
+        while (response_reader->Read(&response)) {
+            auto position_rpc = response.position();
+
+            Position position;
+            position.latitude_deg = position_rpc.latitude_deg();
+            position.longitude_deg = position_rpc.longitude_deg();
+            position.absolute_altitude_m = position_rpc.absolute_altitude_m();
+            position.relative_altitude_m = position_rpc.relative_altitude_m();
+
+            positions.push_back(position);
+        }
+
+        response_reader->Finish();
+    });
+}
+
+TEST_F(TelemetryAsyncServiceImplTest, sendsPositionsInOrder)
+{
+    std::promise<void> subscription_promise;
+    auto subscription_future = subscription_promise.get_future();
+    mavsdk::Telemetry::position_callback_t position_callback;
+    EXPECT_CALL(*_telemetry, subscribe_position(_))
+        .WillOnce(SaveCallback(&position_callback, &subscription_promise));
+
+    std::vector<Position> positions;
+    for (int i = 0; i < 100; i++) {
+        Position position;
+        position.latitude_deg = 47.0 + i * 0.001;
+        position.longitude_deg = 8.0;
+        position.absolute_altitude_m = 500.0f;
+        position.relative_altitude_m = float(i);
+        positions.push_back(position);
+    }
+
+    std::vector<Position> received_positions;
+    auto position_stream_future = subscribePositionAsync(received_positions);
+    subscription_future.wait();
+    for (const auto& position : positions) {
+        position_callback(position);
+    }
+    _telemetry_service->stop();
+    position_stream_future.wait();
+
+    ASSERT_EQ(positions.size(), received_positions.size());
+    for (size_t i = 0; i < positions.size(); i++) {
+        EXPECT_EQ(positions.at(i), received_positions.at(i));
+    }
+}
+
+TEST_F(TelemetryAsyncServiceImplTest, sendsBatchedPositionsInOrder)
+{
+    std::promise<void> subscription_promise;
+    auto subscription_future = subscription_promise.get_future();
+    mavsdk::Telemetry::position_callback_t position_callback;
+    EXPECT_CALL(*_telemetry, subscribe_position(_))
+        .WillOnce(SaveCallback(&position_callback, &subscription_promise));
+
+    std::vector<Position> positions;
+    for (int i = 0; i < 25; i++) {
+        Position position;
+        position.latitude_deg = 47.0;
+        position.longitude_deg = 8.0 + i * 0.001;
+        position.absolute_altitude_m = 500.0f;
+        position.relative_altitude_m = float(i);
+        positions.push_back(position);
+    }
+
+    std::vector<Position> received_positions;
+    auto position_stream_future = subscribePositionAsync(received_positions, "20");
+    subscription_future.wait();
+
+    // Two full batches and a partial one which is only sent after the delay.
+    for (const auto& position : positions) {
+        position_callback(position);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    _telemetry_service->stop();
+    position_stream_future.wait();
+
+    ASSERT_EQ(positions.size(), received_positions.size());
+    for (size_t i = 0; i < positions.size(); i++) {
+        EXPECT_EQ(positions.at(i), received_positions.at(i));
+    }
+}
+
+TEST_F(TelemetryAsyncServiceImplTest, keepsLatestPositionForSlowClient)
+{
+    std::promise<void> subscription_promise;
+    auto subscription_future = subscription_promise.get_future();
+    mavsdk::Telemetry::position_callback_t position_callback;
+    EXPECT_CALL(*_telemetry, subscribe_position(_))
+        .WillOnce(SaveCallback(&position_callback, &subscription_promise));
+
+    // Holding everything back for a long batch looks like a client not reading.
+    grpc::ClientContext context;
+    context.AddMetadata(mavsdk::backend::BatchOptions::max_delay_key, "10000");
+    context.AddMetadata(mavsdk::backend::QueueOptions::max_waiting_key, "1");
+    mavsdk::rpc::telemetry::SubscribePositionRequest request;
+    auto response_reader = _stub->SubscribePosition(&context, request);
+    subscription_future.wait();
+
+    for (int i = 0; i < 25; i++) {
+        Position position;
+        position.relative_altitude_m = float(i);
+        position_callback(position);
+    }
+    EXPECT_EQ(24u, _telemetry_service->dropped_messages());
+    _telemetry_service->stop();
+
+    std::vector<float> received_altitudes;
+    mavsdk::rpc::telemetry::PositionResponse response;
+    while (response_reader->Read(&response)) {
+        received_altitudes.push_back(response.position().relative_altitude_m());
+    }
+    response_reader->Finish();
+
+    EXPECT_EQ(std::vector<float>({24.0f}), received_altitudes);
+    const auto& trailing_metadata = context.GetServerTrailingMetadata();
+    auto dropped_it = trailing_metadata.find(mavsdk::backend::QueueOptions::dropped_key);
+    ASSERT_NE(trailing_metadata.end(), dropped_it);
+    EXPECT_EQ("24", std::string(dropped_it->second.data(), dropped_it->second.size()));
+}
+
+TEST_F(TelemetryAsyncServiceImplTest, unsubscribesWhenClientCancels)
+{
+    std::promise<void> subscription_promise;
+    auto subscription_future = subscription_promise.get_future();
+    std::promise<void> unsubscription_promise;
+    auto unsubscription_future = unsubscription_promise.get_future();
+
+    mavsdk::Telemetry::position_callback_t position_callback;
+    EXPECT_CALL(*_telemetry, subscribe_position(_))
+        .WillOnce(SaveCallback(&position_callback, &subscription_promise));
+    EXPECT_CALL(*_telemetry, unsubscribe(1))
+        .WillOnce(testing::InvokeWithoutArgs(
+            [&unsubscription_promise]() { unsubscription_promise.set_value(); }));
+
+    grpc::ClientContext context;
+    mavsdk::rpc::telemetry::SubscribePositionRequest request;
+    auto response_reader = _stub->SubscribePosition(&context, request);
+    subscription_future.wait();
+
+    context.TryCancel();
+    EXPECT_EQ(
+        unsubscription_future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+
+    // Updates after the client is gone are dropped.
+    position_callback(Position{});
+    response_reader->Finish();
+}
+
+TEST_F(TelemetryAsyncServiceImplTest, unsubscribesWhenClientCancelsWhileSubscribing)
+{
+    std::promise<void> subscribing_promise;
+    auto subscribing_future = subscribing_promise.get_future();
+    std::promise<void> cancelled_promise;
+    auto cancelled_future = cancelled_promise.get_future().share();
+    std::promise<void> unsubscription_promise;
+    auto unsubscription_future = unsubscription_promise.get_future();
+
+    // The client goes away while the stream is still being set up, so the done
+    // notification arrives before the subscription exists.
+    EXPECT_CALL(*_telemetry, subscribe_position(_))
+        .WillOnce(testing::InvokeWithoutArgs([&subscribing_promise, cancelled_future]() {
+            subscribing_promise.set_value();
+            cancelled_future.wait_for(std::chrono::seconds(1));
+            return mavsdk::Telemetry::SubscriptionHandle(1);
+        }));
+    EXPECT_CALL(*_telemetry, unsubscribe(1))
+        .WillOnce(testing::InvokeWithoutArgs(
+            [&unsubscription_promise]() { unsubscription_promise.set_value(); }));
+
+    grpc::ClientContext context;
+    mavsdk::rpc::telemetry::SubscribePositionRequest request;
+    auto response_reader = _stub->SubscribePosition(&context, request);
+    subscribing_future.wait();
+
+    context.TryCancel();
+    // Gives the other queue thread time to handle the cancellation.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    cancelled_promise.set_value();
+
+    EXPECT_EQ(
+        unsubscription_future.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    response_reader->Finish();
+}
+
+TEST_F(TelemetryAsyncServiceImplTest, sendsPositionsToEveryClient)
+{
+    std::promise<void> first_promise;
+    std::promise<void> second_promise;
+    auto first_future = first_promise.get_future();
+    auto second_future = second_promise.get_future();
+    mavsdk::Telemetry::position_callback_t first_callback;
+    mavsdk::Telemetry::position_callback_t second_callback;
+    EXPECT_CALL(*_telemetry, subscribe_position(_))
+        .WillOnce(SaveCallback(&first_callback, &first_promise))
+        .WillOnce(testing::Invoke(
+            [&second_callback, &second_promise](mavsdk::Telemetry::position_callback_t callback) {
+                second_callback = callback;
+                second_promise.set_value();
+                return mavsdk::Telemetry::SubscriptionHandle(2);
+            }));
+
+    // The second client doesn't take the stream away from the first one.
+    std::vector<Position> first_positions;
+    auto first_stream_future = subscribePositionAsync(first_positions);
+    first_future.wait();
+    std::vector<Position> second_positions;
+    auto second_stream_future = subscribePositionAsync(second_positions);
+    second_future.wait();
+
+    Position position;
+    position.relative_altitude_m = 10.0f;
+    first_callback(position);
+    second_callback(position);
+    _telemetry_service->stop();
+    first_stream_future.wait();
+    second_stream_future.wait();
+
+    EXPECT_EQ(std::vector<Position>({position}), first_positions);
+    EXPECT_EQ(std::vector<Position>({position}), second_positions);
+}
+
+} // namespace
@@ -14,6 +14,7 @@ namespace {
 
 using testing::_;
 using testing::NiceMock;
+using testing::Return;
 
 using MockTelemetry = NiceMock<mavsdk::testing::MockTelemetry>;
 using TelemetryServiceImpl = mavsdk::backend::TelemetryServiceImpl<MockTelemetry>;
@@ -47,6 +48,9 @@ using ActuatorControlTarget = mavsdk::Telemetry::ActuatorControlTarget;
 
 using ActuatorOutputStatus = mavsdk::Telemetry::ActuatorOutputStatus;
 
+using Snapshot = mavsdk::Telemetry::Snapshot;
+using SnapshotField = mavsdk::Telemetry::SnapshotField;
+
 class TelemetryServiceImplTest : public ::testing::Test {
 protected:
     virtual void SetUp()
@@ -174,11 +178,12 @@ ACTION_P2(SaveCallback, callback, callback_promise)
 {
     *callback = arg0;
     callback_promise->set_value();
+    return mavsdk::Telemetry::SubscriptionHandle(1);
 }
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryPositionAsync)
 {
-    EXPECT_CALL(*_telemetry, position_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_position(_)).Times(1);
 
     std::vector<Position> positions;
     auto position_stream_future = subscribePositionAsync(positions);
@@ -235,7 +240,7 @@ void TelemetryServiceImplTest::checkSendsPositions(const std::vector<Position>&
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::position_callback_t position_callback;
-    EXPECT_CALL(*_telemetry, position_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_position(_))
         .WillOnce(SaveCallback(&position_callback, &subscription_promise));
 
     std::vector<Position> received_positions;
@@ -278,7 +283,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultiplePositions)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryHealthAsync)
 {
-    EXPECT_CALL(*_telemetry, health_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_health(_)).Times(1);
 
     std::vector<Health> healths;
     auto health_stream_future = subscribeHealthAsync(healths);
@@ -346,7 +351,7 @@ void TelemetryServiceImplTest::checkSendsHealths(const std::vector<Health>& heal
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::health_callback_t health_callback;
-    EXPECT_CALL(*_telemetry, health_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_health(_))
         .WillOnce(SaveCallback(&health_callback, &subscription_promise));
 
     std::vector<Health> received_healths;
@@ -392,7 +397,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleHealths)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryHomeAsync)
 {
-    EXPECT_CALL(*_telemetry, home_position_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_home_position(_)).Times(1);
 
     std::vector<Position> home_positions;
     auto home_stream_future = subscribeHomeAsync(home_positions);
@@ -451,7 +456,7 @@ void TelemetryServiceImplTest::checkSendsHomePositions(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::position_callback_t home_callback;
-    EXPECT_CALL(*_telemetry, home_position_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_home_position(_))
         .WillOnce(SaveCallback(&home_callback, &subscription_promise));
 
     std::vector<Position> received_home_positions;
@@ -482,7 +487,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleHomePositions)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryInAirAsync)
 {
-    EXPECT_CALL(*_telemetry, in_air_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_in_air(_)).Times(1);
 
     std::vector<bool> in_air_events;
     auto in_air_stream_future = subscribeInAirAsync(in_air_events);
@@ -533,7 +538,7 @@ void TelemetryServiceImplTest::checkSendsInAirEvents(const std::vector<bool>& in
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::in_air_callback_t in_air_callback;
-    EXPECT_CALL(*_telemetry, in_air_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_in_air(_))
         .WillOnce(SaveCallback(&in_air_callback, &subscription_promise));
 
     std::vector<bool> received_in_air_events;
@@ -564,7 +569,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleInAirEvents)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryArmedAsync)
 {
-    EXPECT_CALL(*_telemetry, armed_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_armed(_)).Times(1);
 
     std::vector<bool> armed_events;
     auto armed_stream_future = subscribeArmedAsync(armed_events);
@@ -615,7 +620,7 @@ void TelemetryServiceImplTest::checkSendsArmedEvents(const std::vector<bool>& ar
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::armed_callback_t armed_callback;
-    EXPECT_CALL(*_telemetry, armed_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_armed(_))
         .WillOnce(SaveCallback(&armed_callback, &subscription_promise));
 
     std::vector<bool> received_armed_events;
@@ -646,7 +651,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleArmedEvents)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryGpsInfoAsync)
 {
-    EXPECT_CALL(*_telemetry, gps_info_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_gps_info(_)).Times(1);
 
     std::vector<GpsInfo> gps_info_events;
     auto gps_info_stream_future = subscribeGpsInfoAsync(gps_info_events);
@@ -724,7 +729,7 @@ void TelemetryServiceImplTest::checkSendsGpsInfoEvents(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::gps_info_callback_t gps_info_callback;
-    EXPECT_CALL(*_telemetry, gps_info_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_gps_info(_))
         .WillOnce(SaveCallback(&gps_info_callback, &subscription_promise));
 
     std::vector<GpsInfo> received_gps_info_events;
@@ -768,7 +773,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleGpsInfoEvents)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryBatteryAsync)
 {
-    EXPECT_CALL(*_telemetry, battery_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_battery(_)).Times(1);
 
     std::vector<Battery> battery_events;
     auto battery_stream_future = subscribeBatteryAsync(battery_events);
@@ -835,7 +840,7 @@ void TelemetryServiceImplTest::checkSendsBatteryEvents(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::battery_callback_t battery_callback;
-    EXPECT_CALL(*_telemetry, battery_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_battery(_))
         .WillOnce(SaveCallback(&battery_callback, &subscription_promise));
 
     std::vector<Battery> received_battery_events;
@@ -867,7 +872,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleBatteryEvents)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryFlightModeAsync)
 {
-    EXPECT_CALL(*_telemetry, flight_mode_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_flight_mode(_)).Times(1);
 
     std::vector<FlightMode> flight_mode_events;
     auto flight_mode_stream_future = subscribeFlightModeAsync(flight_mode_events);
@@ -945,7 +950,7 @@ void TelemetryServiceImplTest::checkSendsFlightModeEvents(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::flight_mode_callback_t flight_mode_callback;
-    EXPECT_CALL(*_telemetry, flight_mode_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_flight_mode(_))
         .WillOnce(SaveCallback(&flight_mode_callback, &subscription_promise));
 
     std::vector<FlightMode> received_flight_mode_events;
@@ -981,7 +986,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleFlightModeEvents)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryAttitudeQuaternionAsync)
 {
-    EXPECT_CALL(*_telemetry, attitude_quaternion_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_attitude_quaternion(_)).Times(1);
 
     std::vector<Quaternion> quaternions;
     auto quaternion_stream_future = subscribeAttitudeQuaternionAsync(quaternions);
@@ -992,7 +997,7 @@ TEST_F(TelemetryServiceImplTest, registersToTelemetryAttitudeQuaternionAsync)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryAttitudeAngularVelocityBodyAsync)
 {
-    EXPECT_CALL(*_telemetry, attitude_angular_velocity_body_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_attitude_angular_velocity_body(_)).Times(1);
 
     std::vector<AngularVelocityBody> angular_velocities_body;
     auto angular_velocity_body_stream_future =
@@ -1121,7 +1126,7 @@ void TelemetryServiceImplTest::checkSendsAttitudeQuaternions(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::attitude_quaternion_callback_t attitude_quaternion_callback;
-    EXPECT_CALL(*_telemetry, attitude_quaternion_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_attitude_quaternion(_))
         .WillOnce(SaveCallback(&attitude_quaternion_callback, &subscription_promise));
 
     std::vector<Quaternion> received_quaternions;
@@ -1146,7 +1151,7 @@ void TelemetryServiceImplTest::checkSendsAttitudeAngularVelocitiesBody(
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::attitude_angular_velocity_body_callback_t
         attitude_angular_velocity_body_callback;
-    EXPECT_CALL(*_telemetry, attitude_angular_velocity_body_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_attitude_angular_velocity_body(_))
         .WillOnce(SaveCallback(&attitude_angular_velocity_body_callback, &subscription_promise));
 
     std::vector<AngularVelocityBody> received_angular_velocities_body;
@@ -1187,7 +1192,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleAttitudeAngularVelocityBodys)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryAttitudeEulerAsync)
 {
-    EXPECT_CALL(*_telemetry, attitude_euler_angle_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_attitude_euler_angle(_)).Times(1);
 
     std::vector<EulerAngle> euler_angles;
     auto euler_angle_stream_future = subscribeAttitudeEulerAsync(euler_angles);
@@ -1256,7 +1261,7 @@ void TelemetryServiceImplTest::checkSendsAttitudeEulerAngles(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::attitude_euler_angle_callback_t attitude_euler_angle_callback;
-    EXPECT_CALL(*_telemetry, attitude_euler_angle_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_attitude_euler_angle(_))
         .WillOnce(SaveCallback(&attitude_euler_angle_callback, &subscription_promise));
 
     std::vector<EulerAngle> received_euler_angles;
@@ -1286,7 +1291,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleAttitudeEuler)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryCameraAttitudeQuaternionAsync)
 {
-    EXPECT_CALL(*_telemetry, camera_attitude_quaternion_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_camera_attitude_quaternion(_)).Times(1);
 
     std::vector<Quaternion> quaternions;
     auto quaternion_stream_future = subscribeCameraAttitudeQuaternionAsync(quaternions);
@@ -1345,7 +1350,7 @@ void TelemetryServiceImplTest::checkSendsCameraAttitudeQuaternions(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::attitude_quaternion_callback_t attitude_quaternion_callback;
-    EXPECT_CALL(*_telemetry, camera_attitude_quaternion_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_camera_attitude_quaternion(_))
         .WillOnce(SaveCallback(&attitude_quaternion_callback, &subscription_promise));
 
     std::vector<Quaternion> received_quaternions;
@@ -1375,7 +1380,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleCameraAttitudeQuaternions)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryCameraAttitudeEulerAsync)
 {
-    EXPECT_CALL(*_telemetry, camera_attitude_euler_angle_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_camera_attitude_euler_angle(_)).Times(1);
 
     std::vector<EulerAngle> euler_angles;
     auto euler_angle_stream_future = subscribeCameraAttitudeEulerAsync(euler_angles);
@@ -1433,7 +1438,7 @@ void TelemetryServiceImplTest::checkSendsCameraAttitudeEulerAngles(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::attitude_euler_angle_callback_t attitude_euler_angle_callback;
-    EXPECT_CALL(*_telemetry, camera_attitude_euler_angle_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_camera_attitude_euler_angle(_))
         .WillOnce(SaveCallback(&attitude_euler_angle_callback, &subscription_promise));
 
     std::vector<EulerAngle> received_euler_angles;
@@ -1463,7 +1468,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleCameraAttitudeEuler)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryGroundSpeedNedAsync)
 {
-    EXPECT_CALL(*_telemetry, ground_speed_ned_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_ground_speed_ned(_)).Times(1);
 
     std::vector<GroundSpeedNed> ground_speed_events;
     auto ground_speed_stream_future = subscribeGroundSpeedNedAsync(ground_speed_events);
@@ -1533,7 +1538,7 @@ void TelemetryServiceImplTest::checkSendsGroundSpeedEvents(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::ground_speed_ned_callback_t ground_speed_ned_callback;
-    EXPECT_CALL(*_telemetry, ground_speed_ned_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_ground_speed_ned(_))
         .WillOnce(SaveCallback(&ground_speed_ned_callback, &subscription_promise));
 
     std::vector<GroundSpeedNed> received_ground_speed_events;
@@ -1563,7 +1568,7 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleGroundSpeedEvents)
 
 TEST_F(TelemetryServiceImplTest, registersToTelemetryRcStatusAsync)
 {
-    EXPECT_CALL(*_telemetry, rc_status_async(_)).Times(1);
+    EXPECT_CALL(*_telemetry, subscribe_rc_status(_)).Times(1);
 
     std::vector<RcStatus> rc_status_events;
     auto rc_status_stream_future = subscribeRcStatusAsync(rc_status_events);
@@ -1635,7 +1640,7 @@ void TelemetryServiceImplTest::checkSendsRcStatusEvents(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::rc_status_callback_t rc_status_callback;
-    EXPECT_CALL(*_telemetry, rc_status_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_rc_status(_))
         .WillOnce(SaveCallback(&rc_status_callback, &subscription_promise));
 
     std::vector<RcStatus> received_rc_status_events;
@@ -1744,7 +1749,7 @@ void TelemetryServiceImplTest::checkSendsActuatorControlTargetEvents(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::actuator_control_target_callback_t actuator_control_target_callback;
-    EXPECT_CALL(*_telemetry, actuator_control_target_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_actuator_control_target(_))
         .WillOnce(SaveCallback(&actuator_control_target_callback, &subscription_promise));
 
     std::vector<ActuatorControlTarget> received_actuator_control_target_events;
@@ -1771,7 +1776,7 @@ void TelemetryServiceImplTest::checkSendsActuatorOutputStatusEvents(
     std::promise<void> subscription_promise;
     auto subscription_future = subscription_promise.get_future();
     mavsdk::Telemetry::actuator_output_status_callback_t actuator_output_status_callback;
-    EXPECT_CALL(*_telemetry, actuator_output_status_async(_))
+    EXPECT_CALL(*_telemetry, subscribe_actuator_output_status(_))
         .WillOnce(SaveCallback(&actuator_output_status_callback, &subscription_promise));
 
     std::vector<ActuatorOutputStatus> received_actuator_output_status_events;
@@ -1823,4 +1828,132 @@ TEST_F(TelemetryServiceImplTest, sendsMultipleActuatorOutputStatusEvents)
     checkSendsActuatorOutputStatusEvents(actuator_output_status_events);
 }
 
+ACTION_P2(SaveSnapshotCallback, callback, callback_promise)
+{
+    *callback = arg2;
+    callback_promise->set_value();
+    return mavsdk::Telemetry::SubscriptionHandle(1);
+}
+
+Snapshot createSnapshot()
+{
+    Snapshot snapshot;
+    snapshot.timestamp_us = 1234567;
+    snapshot.fields = SnapshotField::POSITION | SnapshotField::ARMED | SnapshotField::BATTERY;
+    snapshot.position.latitude_deg = 47.3977;
+    snapshot.position.longitude_deg = 8.5456;
+    snapshot.position.absolute_altitude_m = 488.5f;
+    snapshot.position.relative_altitude_m = 10.2f;
+    snapshot.armed = true;
+    snapshot.battery.voltage_v = 15.8f;
+    snapshot.battery.remaining_percent = 0.74f;
+    return snapshot;
+}
+
+void expectSnapshot(
+    const Snapshot& snapshot, const mavsdk::rpc::telemetry::TelemetrySnapshot& rpc_snapshot)
+{
+    EXPECT_EQ(snapshot.timestamp_us, rpc_snapshot.timestamp_us());
+    EXPECT_EQ(static_cast<uint32_t>(snapshot.fields), rpc_snapshot.fields());
+    EXPECT_EQ(snapshot.position.latitude_deg, rpc_snapshot.position().latitude_deg());
+    EXPECT_EQ(snapshot.position.longitude_deg, rpc_snapshot.position().longitude_deg());
+    EXPECT_EQ(
+        snapshot.position.absolute_altitude_m, rpc_snapshot.position().absolute_altitude_m());
+    EXPECT_EQ(
+        snapshot.position.relative_altitude_m, rpc_snapshot.position().relative_altitude_m());
+    EXPECT_EQ(snapshot.armed, rpc_snapshot.armed());
+    EXPECT_EQ(snapshot.battery.voltage_v, rpc_snapshot.battery().voltage_v());
+    EXPECT_EQ(snapshot.battery.remaining_percent, rpc_snapshot.battery().remaining_percent());
+
+    // Fields not in the snapshot are left out.
+    EXPECT_FALSE(rpc_snapshot.has_home_position());
+    EXPECT_FALSE(rpc_snapshot.has_gps_info());
+    EXPECT_FALSE(rpc_snapshot.has_status_text());
+}
+
+TEST_F(TelemetryServiceImplTest, getsTelemetrySnapshotOfAllFieldsByDefault)
+{
+    const auto snapshot = createSnapshot();
+    // Only the fields the RPC has.
+    const auto rpc_fields =
+        SnapshotField::ALL &
+        ~(SnapshotField::ATTITUDE_QUATERNION | SnapshotField::ATTITUDE_ANGULAR_VELOCITY_BODY);
+    EXPECT_CALL(*_telemetry, snapshot(rpc_fields)).WillOnce(Return(snapshot));
+
+    grpc::ClientContext context;
+    mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest request;
+    mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse response;
+    const auto status = _stub->GetTelemetrySnapshot(&context, request, &response);
+
+    EXPECT_TRUE(status.ok());
+    expectSnapshot(snapshot, response.telemetry_snapshot());
+}
+
+TEST_F(TelemetryServiceImplTest, getsTelemetrySnapshotOfRequestedFields)
+{
+    const auto fields = SnapshotField::POSITION | SnapshotField::ARMED;
+    EXPECT_CALL(*_telemetry, snapshot(fields)).WillOnce(Return(Snapshot{}));
+
+    grpc::ClientContext context;
+    mavsdk::rpc::telemetry::GetTelemetrySnapshotRequest request;
+    // Unknown bits and fields the RPC doesn't have are ignored.
+    request.set_fields(
+        static_cast<uint32_t>(fields | SnapshotField::ATTITUDE_QUATERNION) | (1u << 31));
+    mavsdk::rpc::telemetry::GetTelemetrySnapshotResponse response;
+    const auto status = _stub->GetTelemetrySnapshot(&context, request, &response);
+
+    EXPECT_TRUE(status.ok());
+}
+
+TEST_F(TelemetryServiceImplTest, sendsTelemetrySnapshotsAtRequestedRate)
+{
+    std::promise<void> subscription_promise;
+    auto subscription_future = subscription_promise.get_future();
+    mavsdk::Telemetry::snapshot_callback_t snapshot_callback;
+    const auto fields = SnapshotField::POSITION | SnapshotField::ARMED | SnapshotField::BATTERY;
+    EXPECT_CALL(*_telemetry, subscribe_snapshot(fields, 5.0, _))
+        .WillOnce(SaveSnapshotCallback(&snapshot_callback, &subscription_promise));
+
+    std::vector<mavsdk::rpc::telemetry::TelemetrySnapshot> received_snapshots;
+    auto snapshot_stream_future = std::async(std::launch::async, [&]() {
+        grpc::ClientContext context;
+        mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest request;
+        request.set_fields(static_cast<uint32_t>(fields));
+        request.set_rate_hz(5.0);
+        auto response_reader = _stub->SubscribeTelemetrySnapshot(&context, request);
+
+        mavsdk::rpc::telemetry::TelemetrySnapshotResponse response;
+        while (response_reader->Read(&response)) {
+            received_snapshots.push_back(response.telemetry_snapshot());
+        }
+
+        response_reader->Finish();
+    });
+
+    subscription_future.wait();
+    const auto snapshot = createSnapshot();
+    snapshot_callback(snapshot);
+    snapshot_callback(snapshot);
+    _telemetry_service->stop();
+    snapshot_stream_future.wait();
+
+    ASSERT_EQ(2, received_snapshots.size());
+    for (const auto& received_snapshot : received_snapshots) {
+        expectSnapshot(snapshot, received_snapshot);
+    }
+}
+
+TEST_F(TelemetryServiceImplTest, rejectsTelemetrySnapshotSubscriptionWithoutRate)
+{
+    EXPECT_CALL(*_telemetry, subscribe_snapshot(_, _, _)).Times(0);
+
+    grpc::ClientContext context;
+    mavsdk::rpc::telemetry::SubscribeTelemetrySnapshotRequest request;
+    auto response_reader = _stub->SubscribeTelemetrySnapshot(&context, request);
+
+    mavsdk::rpc::telemetry::TelemetrySnapshotResponse response;
+    EXPECT_FALSE(response_reader->Read(&response));
+    EXPECT_EQ(grpc::StatusCode::INVALID_ARGUMENT, response_reader->Finish().error_code());
+}
+
 } // namespace
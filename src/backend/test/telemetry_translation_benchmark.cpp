@@ -0,0 +1,123 @@
+// Measures the translation of telemetry updates to rpc responses, which runs on
+// the callback thread for every sample of every stream.
+//
+// Run without arguments; prints the time per update for the writer used by the
+// synchronous service (writes the response in place) and the one used by the
+// asynchronous service (swaps the response into its queue).
+
+#include <chrono>
+#include <cstdio>
+#include <gmock/gmock.h>
+#include <string>
+
+#include "telemetry/mocks/telemetry_mock.h"
+#include "telemetry/telemetry_service_impl.h"
+
+namespace {
+
+using testing::_;
+using testing::DoAll;
+using testing::NiceMock;
+using testing::Return;
+using testing::SaveArg;
+
+using MockTelemetry = NiceMock<mavsdk::testing::MockTelemetry>;
+using TelemetryServiceImpl = mavsdk::backend::TelemetryServiceImpl<MockTelemetry>;
+
+constexpr int num_updates = 1000000;
+
+template<typename Response> struct Writers {
+    // What the synchronous service does: serialize the response as it is.
+    static void in_place(Response& response, std::string& buffer)
+    {
+        response.SerializeToString(&buffer);
+    }
+
+    // What the asynchronous service does: keep the response for later and give
+    // back one written before.
+    static void swapped(Response& response, Response& spare, std::string& buffer)
+    {
+        spare.Swap(&response);
+        spare.SerializeToString(&buffer);
+    }
+};
+
+template<typename Callback, typename Sample>
+void measure(const std::string& name, const Callback& callback, const Sample& sample)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < num_updates; ++i) {
+        callback(sample);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const double ns_per_update =
+        double(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()) /
+        num_updates;
+    printf("%-40s %8.1f ns/update\n", name.c_str(), ns_per_update);
+}
+
+template<typename Response, typename Callback, typename Sample>
+void measure_stream(
+    const std::string& name,
+    TelemetryServiceImpl& service,
+    TelemetryServiceImpl::SubscriptionHandle (TelemetryServiceImpl::*subscribe)(
+        const TelemetryServiceImpl::response_writer_t<Response>&),
+    const Callback& callback,
+    const Sample& sample)
+{
+    std::string buffer;
+    Response spare;
+
+    (service.*subscribe)(
+        [&buffer](Response& response) { Writers<Response>::in_place(response, buffer); });
+    measure(name + " (in place)", callback, sample);
+
+    (service.*subscribe)([&buffer, &spare](Response& response) {
+        Writers<Response>::swapped(response, spare, buffer);
+    });
+    measure(name + " (swapped)", callback, sample);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+
+    MockTelemetry telemetry;
+    TelemetryServiceImpl service(telemetry);
+
+    mavsdk::Telemetry::position_callback_t position_callback;
+    EXPECT_CALL(telemetry, subscribe_position(_))
+        .WillRepeatedly(DoAll(SaveArg<0>(&position_callback), Return(1)));
+    mavsdk::Telemetry::attitude_quaternion_callback_t quaternion_callback;
+    EXPECT_CALL(telemetry, subscribe_attitude_quaternion(_))
+        .WillRepeatedly(DoAll(SaveArg<0>(&quaternion_callback), Return(2)));
+    mavsdk::Telemetry::odometry_callback_t odometry_callback;
+    EXPECT_CALL(telemetry, subscribe_odometry(_))
+        .WillRepeatedly(DoAll(SaveArg<0>(&odometry_callback), Return(3)));
+
+    measure_stream(
+        "position",
+        service,
+        &TelemetryServiceImpl::subscribe_position,
+        position_callback,
+        mavsdk::Telemetry::Position{47.397742, 8.545594, 488.0f, 10.0f});
+
+    measure_stream(
+        "attitude_quaternion",
+        service,
+        &TelemetryServiceImpl::subscribe_attitude_quaternion,
+        quaternion_callback,
+        mavsdk::Telemetry::Quaternion{1.0f, 0.0f, 0.0f, 0.0f});
+
+    measure_stream(
+        "odometry",
+        service,
+        &TelemetryServiceImpl::subscribe_odometry,
+        odometry_callback,
+        mavsdk::Telemetry::Odometry{});
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+// Compares the transports mavsdk_server can listen on: loopback TCP and a Unix
+// domain socket.
+//
+// Run without arguments; prints the round trip time of a unary call and the
+// throughput of a telemetry stream for each transport.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <future>
+#include <gmock/gmock.h>
+#include <grpc++/grpc++.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "info/info_service_impl.h"
+#include "info/mocks/info_mock.h"
+#include "telemetry/mocks/telemetry_mock.h"
+#include "telemetry/telemetry_async_service_impl.h"
+
+namespace {
+
+using testing::_;
+using testing::NiceMock;
+using testing::Return;
+
+using MockInfo = NiceMock<mavsdk::testing::MockInfo>;
+using MockTelemetry = NiceMock<mavsdk::testing::MockTelemetry>;
+using InfoServiceImpl = mavsdk::backend::InfoServiceImpl<MockInfo>;
+using TelemetryAsyncServiceImpl = mavsdk::backend::TelemetryAsyncServiceImpl<MockTelemetry>;
+
+constexpr int num_calls = 10000;
+constexpr int num_stream_updates = 100000;
+
+double to_us(std::chrono::steady_clock::duration duration)
+{
+    return double(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) /
+           1000.0;
+}
+
+void measure_unary(const std::string& name, const std::shared_ptr<grpc::Channel>& channel)
+{
+    auto stub = mavsdk::rpc::info::InfoService::NewStub(channel);
+
+    std::vector<double> round_trips_us;
+    round_trips_us.reserve(num_calls);
+
+    for (int i = 0; i < num_calls; ++i) {
+        grpc::ClientContext context;
+        mavsdk::rpc::info::GetVersionRequest request;
+        mavsdk::rpc::info::GetVersionResponse response;
+
+        const auto start = std::chrono::steady_clock::now();
+        stub->GetVersion(&context, request, &response);
+        round_trips_us.push_back(to_us(std::chrono::steady_clock::now() - start));
+    }
+
+    std::sort(round_trips_us.begin(), round_trips_us.end());
+    printf(
+        "%-6s unary GetVersion   median %7.1f us, p99 %7.1f us\n",
+        name.c_str(),
+        round_trips_us[round_trips_us.size() / 2],
+        round_trips_us[round_trips_us.size() * 99 / 100]);
+}
+
+void measure_stream(
+    const std::string& name,
+    const std::shared_ptr<grpc::Channel>& channel,
+    MockTelemetry& telemetry)
+{
+    auto stub = mavsdk::rpc::telemetry::TelemetryService::NewStub(channel);
+
+    // Each stream subscribes once and unsubscribes once it is done.
+    std::promise<mavsdk::Telemetry::position_callback_t> subscribed_promise;
+    std::promise<void> unsubscribed_promise;
+    ON_CALL(telemetry, subscribe_position(_))
+        .WillByDefault(
+            testing::Invoke([&subscribed_promise](mavsdk::Telemetry::position_callback_t callback) {
+                subscribed_promise.set_value(callback);
+                return mavsdk::Telemetry::SubscriptionHandle(1);
+            }));
+    ON_CALL(telemetry, unsubscribe(_))
+        .WillByDefault(testing::InvokeWithoutArgs(
+            [&unsubscribed_promise]() { unsubscribed_promise.set_value(); }));
+
+    grpc::ClientContext context;
+    // Measure the transport, not the dropping of messages for slow clients.
+    context.AddMetadata(
+        mavsdk::backend::QueueOptions::max_waiting_key, std::to_string(num_stream_updates));
+    mavsdk::rpc::telemetry::SubscribePositionRequest request;
+    auto reader = stub->SubscribePosition(&context, request);
+    auto position_callback = subscribed_promise.get_future().get();
+
+    const auto start = std::chrono::steady_clock::now();
+    auto received_future = std::async(std::launch::async, [&reader]() {
+        int received = 0;
+        mavsdk::rpc::telemetry::PositionResponse response;
+        while (received < num_stream_updates && reader->Read(&response)) {
+            ++received;
+        }
+        return received;
+    });
+
+    for (int i = 0; i < num_stream_updates; ++i) {
+        position_callback(mavsdk::Telemetry::Position{47.397742, 8.545594, 488.0f, float(i)});
+    }
+    const int received = received_future.get();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    context.TryCancel();
+    reader->Finish();
+    unsubscribed_promise.get_future().wait();
+
+    printf(
+        "%-6s stream position    %9.0f updates/s (%d received)\n",
+        name.c_str(),
+        received / (to_us(elapsed) / 1e6),
+        received);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+
+    MockInfo info;
+    ON_CALL(info, get_version())
+        .WillByDefault(
+            Return(std::make_pair(mavsdk::Info::Result::SUCCESS, mavsdk::Info::Version{})));
+    InfoServiceImpl info_service(info);
+
+    MockTelemetry telemetry;
+    TelemetryAsyncServiceImpl telemetry_service(telemetry);
+
+    const std::string socket_path =
+        "/tmp/mavsdk_transport_benchmark_" + std::to_string(getpid()) + ".sock";
+    const std::string unix_address = "unix://" + socket_path;
+
+    int tcp_port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &tcp_port);
+    builder.AddListeningPort(unix_address, grpc::InsecureServerCredentials());
+    builder.RegisterService(&info_service);
+    builder.RegisterService(&telemetry_service);
+    auto completion_queue = builder.AddCompletionQueue();
+    auto server = builder.BuildAndStart();
+    if (server == nullptr) {
+        printf("Failed to start server\n");
+        return 1;
+    }
+
+    telemetry_service.start(completion_queue.get());
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&completion_queue]() {
+            void* tag = nullptr;
+            bool ok = false;
+            while (completion_queue->Next(&tag, &ok)) {
+                static_cast<mavsdk::backend::AsyncTag*>(tag)->proceed(ok);
+            }
+        });
+    }
+
+    auto tcp_channel = grpc::CreateChannel(
+        "127.0.0.1:" + std::to_string(tcp_port), grpc::InsecureChannelCredentials());
+    auto unix_channel = grpc::CreateChannel(unix_address, grpc::InsecureChannelCredentials());
+
+    measure_unary("tcp", tcp_channel);
+    measure_unary("unix", unix_channel);
+    measure_stream("tcp", tcp_channel, telemetry);
+    measure_stream("unix", unix_channel, telemetry);
+
+    server->Shutdown();
+    telemetry_service.stop();
+    completion_queue->Shutdown();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    unlink(socket_path.c_str());
+
+    return 0;
+}
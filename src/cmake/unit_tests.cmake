@@ -14,8 +14,12 @@ set_target_properties(unit_tests_runner
 target_link_libraries(unit_tests_runner
     mavsdk
     mavsdk_mission
+    mavsdk_telemetry
     mavsdk_camera
     mavsdk_calibration
+    mavsdk_mavlink_ftp
+    mavsdk_log_files
+    mavsdk_logging
     CURL::libcurl
     gtest
     gtest_main
@@ -3,11 +3,18 @@
 #include "mavlink_channels.h"
 #include "global_include.h"
 
+#include <chrono>
+#include <string>
+
 namespace mavsdk {
 
 Connection::Connection(receiver_callback_t receiver_callback) :
     _receiver_callback(receiver_callback),
-    _mavlink_receiver()
+    _mavlink_receiver(),
+    _dispatch_duration(MetricsRegistry::Instance().histogram(
+        "mavsdk_mavlink_dispatch_duration_seconds",
+        "Time taken to handle a received message, including the message handlers.",
+        {0.00001, 0.00005, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05}))
 {}
 
 Connection::~Connection()
@@ -25,6 +32,10 @@ bool Connection::start_mavlink_receiver()
     }
 
     _mavlink_receiver.reset(new MAVLinkReceiver(channel));
+    _messages_received = &MetricsRegistry::Instance().counter(
+        "mavsdk_mavlink_messages_received_total",
+        "Messages received per MAVLink channel, i.e. per connection.",
+        {{"channel", std::to_string(channel)}});
     return true;
 }
 
@@ -40,7 +51,12 @@ void Connection::stop_mavlink_receiver()
 
 void Connection::receive_message(mavlink_message_t& message)
 {
+    _messages_received->increment();
+
+    const auto start = std::chrono::steady_clock::now();
     _receiver_callback(message);
+    _dispatch_duration.observe(
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
 }
 
 } // namespace mavsdk
@@ -2,6 +2,7 @@
 
 #include "mavsdk.h"
 #include "mavlink_receiver.h"
+#include "metrics.h"
 #include <memory>
 
 namespace mavsdk {
@@ -30,6 +31,10 @@ protected:
     receiver_callback_t _receiver_callback{};
     std::unique_ptr<MAVLinkReceiver> _mavlink_receiver;
 
+    // Per channel, set once the receiver is started.
+    MetricsCounter* _messages_received{nullptr};
+    MetricsHistogram& _dispatch_duration;
+
     // void received_mavlink_message(mavlink_message_t &);
 };
 
@@ -3,18 +3,40 @@
 #include <queue>
 #include <mutex>
 #include <memory>
+#include "metrics.h"
 
 namespace mavsdk {
 
 template<class T> class LockedQueue {
 public:
     LockedQueue(){};
-    ~LockedQueue(){};
+    ~LockedQueue()
+    {
+        if (_size_gauge != nullptr) {
+            _size_gauge->add(-static_cast<int64_t>(_queue.size()));
+        }
+    }
+
+    // Non-copyable
+    LockedQueue(const LockedQueue&) = delete;
+    const LockedQueue& operator=(const LockedQueue&) = delete;
+
+    // Keep the gauge moved by the number of items in this queue, e.g. for the
+    // total depth of all queues of one kind.
+    void track_size(MetricsGauge& gauge)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _size_gauge = &gauge;
+        _size_gauge->add(static_cast<int64_t>(_queue.size()));
+    }
 
     void push_back(T item)
     {
         std::lock_guard<std::mutex> lock(_mutex);
         _queue.push_back(std::make_shared<T>(item));
+        if (_size_gauge != nullptr) {
+            _size_gauge->add(1);
+        }
     }
 
     size_t size()
@@ -28,7 +50,13 @@ public:
 
     iterator end() { return _queue.end(); }
 
-    iterator erase(iterator it) { return _queue.erase(it); }
+    iterator erase(iterator it)
+    {
+        if (_size_gauge != nullptr) {
+            _size_gauge->add(-1);
+        }
+        return _queue.erase(it);
+    }
 
     class Guard {
     public:
@@ -54,7 +82,13 @@ public:
             return _locked_queue._queue.front();
         }
 
-        void pop_front() { _locked_queue._queue.pop_front(); }
+        void pop_front()
+        {
+            _locked_queue._queue.pop_front();
+            if (_locked_queue._size_gauge != nullptr) {
+                _locked_queue._size_gauge->add(-1);
+            }
+        }
 
     private:
         LockedQueue<T>& _locked_queue;
@@ -63,6 +97,7 @@ public:
 private:
     std::deque<std::shared_ptr<T>> _queue{};
     std::mutex _mutex{};
+    MetricsGauge* _size_gauge{nullptr};
 };
 
 } // namespace mavsdk
@@ -16,6 +16,9 @@ namespace mavsdk {
 
 MAVLinkCommands::MAVLinkCommands(SystemImpl& parent) : _parent(parent)
 {
+    _work_queue.track_size(MetricsRegistry::Instance().gauge(
+        "mavsdk_command_queue_depth", "Commands queued or waiting for an ack, over all systems."));
+
     _parent.register_mavlink_message_handler(
         MAVLINK_MSG_ID_COMMAND_ACK,
         std::bind(&MAVLinkCommands::receive_command_ack, this, std::placeholders::_1),
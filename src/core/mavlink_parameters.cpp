@@ -7,6 +7,10 @@ namespace mavsdk {
 
 MAVLinkParameters::MAVLinkParameters(SystemImpl& parent) : _parent(parent)
 {
+    _work_queue.track_size(MetricsRegistry::Instance().gauge(
+        "mavsdk_parameter_queue_depth",
+        "Parameter requests queued or in progress, over all systems."));
+
     _parent.register_mavlink_message_handler(
         MAVLINK_MSG_ID_PARAM_VALUE,
         std::bind(&MAVLinkParameters::process_param_value, this, std::placeholders::_1),
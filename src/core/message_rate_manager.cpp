@@ -0,0 +1,189 @@
+#include "message_rate_manager.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace mavsdk {
+
+constexpr double MessageRateManager::BATCH_DELAY_S;
+
+MessageRateManager::MessageRateManager(Time& time, set_rate_function_t set_rate_function) :
+    _time(time),
+    _set_rate_function(set_rate_function)
+{}
+
+void MessageRateManager::request_rate(
+    uint16_t message_id, double rate_hz, const void* cookie, result_callback_t callback)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Any negative rate means off, which only wins if nobody else needs the message.
+    _requests[message_id][cookie] = std::max(rate_hz, -1.0);
+    _requested.insert(message_id);
+    mark_changed_locked(message_id, callback);
+}
+
+void MessageRateManager::remove_request(
+    uint16_t message_id, const void* cookie, result_callback_t callback)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto it = _requests.find(message_id);
+    if (it != _requests.end() && it->second.erase(cookie) > 0 && it->second.empty()) {
+        _requests.erase(it);
+    }
+
+    // Even without a request to remove, the callback is answered from do_work().
+    mark_changed_locked(message_id, callback);
+}
+
+void MessageRateManager::remove_all_requests(const void* cookie)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (auto it = _requests.begin(); it != _requests.end();) {
+        if (it->second.erase(cookie) > 0) {
+            mark_changed_locked(it->first);
+        }
+
+        if (it->second.empty()) {
+            it = _requests.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void MessageRateManager::set_turn_off_unused(bool turn_off_unused)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if (_turn_off_unused == turn_off_unused) {
+        return;
+    }
+    _turn_off_unused = turn_off_unused;
+
+    // Everything requested before might need to be switched now.
+    for (const auto message_id : _requested) {
+        mark_changed_locked(message_id);
+    }
+}
+
+double MessageRateManager::effective_rate(uint16_t message_id) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return effective_rate_locked(message_id);
+}
+
+void MessageRateManager::do_work()
+{
+    struct ToSend {
+        uint16_t message_id;
+        double rate_hz;
+        std::vector<result_callback_t> callbacks;
+    };
+    std::vector<ToSend> to_send;
+    std::vector<result_callback_t> unchanged_callbacks;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (_changed.empty() || _time.elapsed_since_s(_first_change_time) < BATCH_DELAY_S) {
+            return;
+        }
+
+        for (const auto message_id : _changed) {
+            const double rate_hz = effective_rate_locked(message_id);
+            auto sent = _sent_rates.find(message_id);
+
+            std::vector<result_callback_t> callbacks;
+            auto callbacks_it = _callbacks.find(message_id);
+            if (callbacks_it != _callbacks.end()) {
+                callbacks.swap(callbacks_it->second);
+                _callbacks.erase(callbacks_it);
+            }
+
+            // We have never set this message, so we only need to do something if
+            // somebody wants a specific rate, or if it should be turned off. Messages
+            // nobody ever requested are left alone.
+            const bool unchanged =
+                (sent == _sent_rates.end()) ?
+                    (rate_hz == 0.0 || _requested.find(message_id) == _requested.end()) :
+                    (sent->second == rate_hz);
+            if (unchanged) {
+                unchanged_callbacks.insert(
+                    unchanged_callbacks.end(), callbacks.begin(), callbacks.end());
+                continue;
+            }
+
+            _sent_rates[message_id] = rate_hz;
+            to_send.push_back(ToSend{message_id, rate_hz, callbacks});
+        }
+        _changed.clear();
+    }
+
+    // Don't hold the lock while sending, the set rate function can take a while.
+    for (const auto& item : to_send) {
+        const uint16_t message_id = item.message_id;
+        const double rate_hz = item.rate_hz;
+        const auto callbacks = item.callbacks;
+        _set_rate_function(
+            message_id,
+            rate_hz,
+            [this, message_id, rate_hz, callbacks](MAVLinkCommands::Result result) {
+                on_rate_set(message_id, rate_hz, result, callbacks);
+            });
+    }
+
+    for (const auto& callback : unchanged_callbacks) {
+        callback(MAVLinkCommands::Result::SUCCESS);
+    }
+}
+
+void MessageRateManager::on_rate_set(
+    uint16_t message_id,
+    double rate_hz,
+    MAVLinkCommands::Result result,
+    const std::vector<result_callback_t>& callbacks)
+{
+    if (result != MAVLinkCommands::Result::SUCCESS) {
+        // Forget about the failed rate, so that the next change sends it again.
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto sent = _sent_rates.find(message_id);
+        if (sent != _sent_rates.end() && sent->second == rate_hz) {
+            _sent_rates.erase(sent);
+        }
+    }
+
+    for (const auto& callback : callbacks) {
+        callback(result);
+    }
+}
+
+double MessageRateManager::effective_rate_locked(uint16_t message_id) const
+{
+    auto it = _requests.find(message_id);
+    if (it == _requests.end() || it->second.empty()) {
+        return _turn_off_unused ? -1.0 : 0.0;
+    }
+
+    double max_rate_hz = -1.0;
+    for (const auto& request : it->second) {
+        max_rate_hz = std::max(max_rate_hz, request.second);
+    }
+    return max_rate_hz;
+}
+
+void MessageRateManager::mark_changed_locked(uint16_t message_id, result_callback_t callback)
+{
+    if (_changed.empty()) {
+        _first_change_time = _time.steady_time();
+    }
+    _changed.insert(message_id);
+
+    if (callback) {
+        _callbacks[message_id].push_back(callback);
+    }
+}
+
+} // namespace mavsdk
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+#include "global_include.h"
+#include "mavlink_commands.h"
+
+namespace mavsdk {
+
+/*
+ * Keeps track of the message rates requested by the different users (plugins,
+ * subscriptions) of a system and sets the stream rates on the vehicle
+ * accordingly.
+ *
+ * Each user requests a rate for a message id with its cookie. A rate of 0
+ * means that the message is needed at the default rate of the vehicle, -1
+ * that it is not needed at all. The rate set on the vehicle is the maximum of
+ * all requests, so a message is only turned off if nobody else needs it.
+ *
+ * Changes are collected and sent in one go from `do_work()`, so that e.g.
+ * several subscriptions set up at once result in one command per message
+ * and not one per change. Optionally, messages which nobody requests anymore
+ * are turned off. This only applies to messages which have been requested
+ * before: the manager doesn't know which other messages the vehicle streams,
+ * and turning off everything else would include messages like HEARTBEAT which
+ * are needed to stay connected.
+ */
+class MessageRateManager {
+public:
+    // rate_hz: > 0 to set rate, 0 for default rate, -1 to turn the message off.
+    typedef std::function<void(MAVLinkCommands::Result)> result_callback_t;
+    typedef std::function<void(uint16_t message_id, double rate_hz, result_callback_t callback)>
+        set_rate_function_t;
+
+    MessageRateManager(Time& time, set_rate_function_t set_rate_function);
+    ~MessageRateManager() = default;
+
+    // The callback is called once the resulting rate is set on the vehicle, or with
+    // SUCCESS if nothing needs to be sent, e.g. because somebody else needs a higher rate.
+    void request_rate(
+        uint16_t message_id,
+        double rate_hz,
+        const void* cookie,
+        result_callback_t callback = nullptr);
+    void remove_request(
+        uint16_t message_id, const void* cookie, result_callback_t callback = nullptr);
+    void remove_all_requests(const void* cookie);
+
+    // Whether messages without any request are turned off (default false).
+    void set_turn_off_unused(bool turn_off_unused);
+
+    // Rate which is or will be set, 0 for default, -1 for off.
+    double effective_rate(uint16_t message_id) const;
+
+    void do_work();
+
+    // Delay to wait for more changes before sending.
+    static constexpr double BATCH_DELAY_S = 0.1;
+
+    // Non-copyable
+    MessageRateManager(const MessageRateManager&) = delete;
+    const MessageRateManager& operator=(const MessageRateManager&) = delete;
+
+private:
+    double effective_rate_locked(uint16_t message_id) const;
+    void mark_changed_locked(uint16_t message_id, result_callback_t callback = nullptr);
+    void on_rate_set(
+        uint16_t message_id,
+        double rate_hz,
+        MAVLinkCommands::Result result,
+        const std::vector<result_callback_t>& callbacks);
+
+    Time& _time;
+    set_rate_function_t _set_rate_function;
+
+    mutable std::mutex _mutex{};
+    std::map<uint16_t, std::map<const void*, double>> _requests{};
+    std::map<uint16_t, double> _sent_rates{};
+    std::set<uint16_t> _requested{};
+    std::set<uint16_t> _changed{};
+    std::map<uint16_t, std::vector<result_callback_t>> _callbacks{};
+    dl_time_t _first_change_time{};
+    bool _turn_off_unused{false};
+};
+
+} // namespace mavsdk
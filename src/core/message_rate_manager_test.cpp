@@ -0,0 +1,178 @@
+#include "message_rate_manager.h"
+
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+namespace {
+
+typedef std::vector<std::pair<uint16_t, double>> Sent;
+
+struct Fixture {
+    Fixture() :
+        manager(
+            time,
+            [this](
+                uint16_t message_id,
+                double rate_hz,
+                MessageRateManager::result_callback_t callback) {
+                sent.push_back(std::make_pair(message_id, rate_hz));
+                callback(result);
+            })
+    {}
+
+    void advance()
+    {
+        time.sleep_for(std::chrono::milliseconds(200));
+        manager.do_work();
+    }
+
+    FakeTime time{};
+    Sent sent{};
+    MAVLinkCommands::Result result{MAVLinkCommands::Result::SUCCESS};
+    MessageRateManager manager;
+};
+
+int cookie_a = 0;
+int cookie_b = 0;
+
+} // namespace
+
+TEST(MessageRateManager, MaxOfRequests)
+{
+    Fixture f;
+
+    f.manager.request_rate(33, 5.0, &cookie_a);
+    f.manager.request_rate(33, 20.0, &cookie_b);
+    EXPECT_EQ(f.manager.effective_rate(33), 20.0);
+
+    f.advance();
+    EXPECT_EQ(f.sent, Sent({{33, 20.0}}));
+
+    f.manager.remove_request(33, &cookie_b);
+    f.advance();
+    EXPECT_EQ(f.sent, Sent({{33, 20.0}, {33, 5.0}}));
+
+    // Without anyone left it goes back to the default rate.
+    f.manager.remove_request(33, &cookie_a);
+    f.advance();
+    EXPECT_EQ(f.sent, Sent({{33, 20.0}, {33, 5.0}, {33, 0.0}}));
+}
+
+TEST(MessageRateManager, BatchesChanges)
+{
+    Fixture f;
+
+    f.manager.request_rate(30, 10.0, &cookie_a);
+    f.manager.do_work();
+    EXPECT_TRUE(f.sent.empty());
+
+    f.manager.request_rate(30, 50.0, &cookie_a);
+    f.manager.request_rate(31, 1.0, &cookie_a);
+    f.advance();
+
+    // Only the last rate per message is sent.
+    EXPECT_EQ(f.sent, Sent({{30, 50.0}, {31, 1.0}}));
+
+    // No changes, nothing to send.
+    f.manager.request_rate(30, 50.0, &cookie_b);
+    f.advance();
+    EXPECT_EQ(f.sent.size(), 2);
+}
+
+TEST(MessageRateManager, DefaultRateNotSentIfUntouched)
+{
+    Fixture f;
+
+    f.manager.request_rate(24, 0.0, &cookie_a);
+    f.advance();
+    EXPECT_TRUE(f.sent.empty());
+
+    f.manager.remove_request(24, &cookie_a);
+    f.advance();
+    EXPECT_TRUE(f.sent.empty());
+}
+
+TEST(MessageRateManager, TurnOffUnused)
+{
+    Fixture f;
+    f.manager.set_turn_off_unused(true);
+
+    f.manager.request_rate(24, 0.0, &cookie_a);
+    f.manager.request_rate(32, 2.0, &cookie_a);
+    f.advance();
+    EXPECT_EQ(f.sent, Sent({{32, 2.0}}));
+
+    f.manager.remove_all_requests(&cookie_a);
+    f.advance();
+    EXPECT_EQ(f.sent, Sent({{32, 2.0}, {24, -1.0}, {32, -1.0}}));
+
+    // Once turned off, asking for the default rate needs to turn it on again.
+    f.manager.request_rate(24, 0.0, &cookie_b);
+    f.advance();
+    EXPECT_EQ(f.sent.back(), std::make_pair(uint16_t(24), 0.0));
+
+    // Switching the option back restores the default for what we turned off.
+    f.manager.set_turn_off_unused(false);
+    f.advance();
+    EXPECT_EQ(f.sent.back(), std::make_pair(uint16_t(32), 0.0));
+}
+
+TEST(MessageRateManager, OffOnlyIfNobodyElseNeedsIt)
+{
+    Fixture f;
+
+    f.manager.request_rate(30, 0.0, &cookie_a);
+    f.manager.request_rate(30, -1.0, &cookie_b);
+    f.advance();
+    EXPECT_TRUE(f.sent.empty());
+
+    f.manager.remove_request(30, &cookie_a);
+    f.advance();
+    EXPECT_EQ(f.sent, Sent({{30, -1.0}}));
+}
+
+TEST(MessageRateManager, NeverRequestedIsNotTurnedOff)
+{
+    Fixture f;
+    f.manager.set_turn_off_unused(true);
+
+    f.manager.remove_request(0, &cookie_a);
+    f.advance();
+    EXPECT_TRUE(f.sent.empty());
+}
+
+TEST(MessageRateManager, CallsBackWithResult)
+{
+    Fixture f;
+    std::vector<MAVLinkCommands::Result> results;
+    auto callback = [&results](MAVLinkCommands::Result result) { results.push_back(result); };
+
+    f.manager.request_rate(33, 20.0, &cookie_a, callback);
+    f.manager.request_rate(33, 5.0, &cookie_b, callback);
+    EXPECT_TRUE(results.empty());
+    f.advance();
+    EXPECT_EQ(f.sent, Sent({{33, 20.0}}));
+    EXPECT_EQ(results.size(), 2);
+
+    // Nothing to send because the higher rate is still needed.
+    f.manager.request_rate(33, 10.0, &cookie_b, callback);
+    f.advance();
+    EXPECT_EQ(f.sent.size(), 1);
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results.back(), MAVLinkCommands::Result::SUCCESS);
+
+    // A failed rate is sent again with the next change.
+    f.result = MAVLinkCommands::Result::COMMAND_DENIED;
+    f.manager.remove_request(33, &cookie_a, callback);
+    f.advance();
+    EXPECT_EQ(results.back(), MAVLinkCommands::Result::COMMAND_DENIED);
+
+    f.result = MAVLinkCommands::Result::SUCCESS;
+    f.manager.request_rate(33, 10.0, &cookie_b, callback);
+    f.advance();
+    EXPECT_EQ(f.sent, Sent({{33, 20.0}, {33, 10.0}, {33, 10.0}}));
+    EXPECT_EQ(results.back(), MAVLinkCommands::Result::SUCCESS);
+}
@@ -0,0 +1,256 @@
+#include "metrics.h"
+#include "log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace mavsdk {
+
+constexpr unsigned MetricsCounter::num_shards;
+
+unsigned MetricsCounter::shard_index()
+{
+    // Threads get their shard once, in the order in which they first update a metric.
+    static std::atomic<unsigned> next_index{0};
+    static thread_local unsigned index =
+        next_index.fetch_add(1, std::memory_order_relaxed) % num_shards;
+    return index;
+}
+
+uint64_t MetricsCounter::value() const
+{
+    uint64_t sum = 0;
+    for (const auto& shard : _shards) {
+        sum += shard.value.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+MetricsHistogram::MetricsHistogram(const std::vector<double>& upper_bounds) :
+    _upper_bounds(upper_bounds)
+{
+    for (auto& shard : _shards) {
+        // The additional count is for the +Inf bucket.
+        shard.counts.reset(new std::atomic<uint64_t>[_upper_bounds.size() + 1]);
+        for (size_t i = 0; i <= _upper_bounds.size(); ++i) {
+            shard.counts[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void MetricsHistogram::observe(double value)
+{
+    const auto bucket = static_cast<size_t>(
+        std::lower_bound(_upper_bounds.begin(), _upper_bounds.end(), value) -
+        _upper_bounds.begin());
+
+    auto& shard = _shards[MetricsCounter::shard_index()];
+    shard.counts[bucket].fetch_add(1, std::memory_order_relaxed);
+
+    // There is no fetch_add for doubles, but the shard is rarely contended so
+    // this hardly ever loops.
+    double sum = shard.sum.load(std::memory_order_relaxed);
+    while (!shard.sum.compare_exchange_weak(sum, sum + value, std::memory_order_relaxed)) {}
+}
+
+MetricsHistogram::Values MetricsHistogram::values() const
+{
+    Values values;
+    values.upper_bounds = _upper_bounds;
+    values.cumulative_counts.resize(_upper_bounds.size() + 1, 0);
+
+    for (const auto& shard : _shards) {
+        for (size_t i = 0; i <= _upper_bounds.size(); ++i) {
+            values.cumulative_counts[i] += shard.counts[i].load(std::memory_order_relaxed);
+        }
+        values.sum += shard.sum.load(std::memory_order_relaxed);
+    }
+
+    for (size_t i = 1; i < values.cumulative_counts.size(); ++i) {
+        values.cumulative_counts[i] += values.cumulative_counts[i - 1];
+    }
+
+    return values;
+}
+
+MetricsCounter& MetricsRegistry::counter(
+    const std::string& name, const std::string& help, const MetricsLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Family* metrics_family = family(name, help, Type::Counter);
+    if (metrics_family == nullptr) {
+        _unregistered_counters.emplace_back(new MetricsCounter());
+        return *_unregistered_counters.back();
+    }
+
+    auto& counter = metrics_family->counters[format_labels(labels)];
+    if (!counter) {
+        counter.reset(new MetricsCounter());
+    }
+    return *counter;
+}
+
+MetricsGauge& MetricsRegistry::gauge(
+    const std::string& name, const std::string& help, const MetricsLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Family* metrics_family = family(name, help, Type::Gauge);
+    if (metrics_family == nullptr) {
+        _unregistered_gauges.emplace_back(new MetricsGauge());
+        return *_unregistered_gauges.back();
+    }
+
+    auto& gauge = metrics_family->gauges[format_labels(labels)];
+    if (!gauge) {
+        gauge.reset(new MetricsGauge());
+    }
+    return *gauge;
+}
+
+MetricsHistogram& MetricsRegistry::histogram(
+    const std::string& name,
+    const std::string& help,
+    const std::vector<double>& upper_bounds,
+    const MetricsLabels& labels)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    Family* metrics_family = family(name, help, Type::Histogram);
+    if (metrics_family == nullptr) {
+        _unregistered_histograms.emplace_back(new MetricsHistogram(upper_bounds));
+        return *_unregistered_histograms.back();
+    }
+
+    auto& histogram = metrics_family->histograms[format_labels(labels)];
+    if (!histogram) {
+        histogram.reset(new MetricsHistogram(upper_bounds));
+    }
+    return *histogram;
+}
+
+MetricsRegistry::Family*
+MetricsRegistry::family(const std::string& name, const std::string& help, Type type)
+{
+    auto it = _families.find(name);
+    if (it == _families.end()) {
+        Family new_family{type, help, {}, {}, {}};
+        it = _families.insert(std::make_pair(name, std::move(new_family))).first;
+    }
+
+    if (it->second.type != type) {
+        LogErr() << "Metric " << name << " already registered with a different type";
+        return nullptr;
+    }
+
+    return &it->second;
+}
+
+std::string MetricsRegistry::format_labels(const MetricsLabels& labels)
+{
+    std::string formatted;
+    for (const auto& label : labels) {
+        if (!formatted.empty()) {
+            formatted += ',';
+        }
+        formatted += label.first + "=\"";
+        for (const char c : label.second) {
+            switch (c) {
+                case '\\':
+                    formatted += "\\\\";
+                    break;
+                case '"':
+                    formatted += "\\\"";
+                    break;
+                case '\n':
+                    formatted += "\\n";
+                    break;
+                default:
+                    formatted += c;
+                    break;
+            }
+        }
+        formatted += '"';
+    }
+    return formatted;
+}
+
+namespace {
+
+std::string with_labels(const std::string& labels, const std::string& more_labels = "")
+{
+    if (labels.empty() && more_labels.empty()) {
+        return "";
+    }
+    if (labels.empty() || more_labels.empty()) {
+        return "{" + labels + more_labels + "}";
+    }
+    return "{" + labels + "," + more_labels + "}";
+}
+
+std::string format_bound(double bound)
+{
+    std::ostringstream stream;
+    stream << bound;
+    return stream.str();
+}
+
+} // namespace
+
+std::string MetricsRegistry::prometheus_text() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    std::ostringstream text;
+    text.precision(17);
+
+    for (const auto& name_and_family : _families) {
+        const std::string& name = name_and_family.first;
+        const Family& family = name_and_family.second;
+
+        text << "# HELP " << name << ' ' << family.help << '\n';
+
+        switch (family.type) {
+            case Type::Counter:
+                text << "# TYPE " << name << " counter\n";
+                for (const auto& counter : family.counters) {
+                    text << name << with_labels(counter.first) << ' ' << counter.second->value()
+                         << '\n';
+                }
+                break;
+
+            case Type::Gauge:
+                text << "# TYPE " << name << " gauge\n";
+                for (const auto& gauge : family.gauges) {
+                    text << name << with_labels(gauge.first) << ' ' << gauge.second->value()
+                         << '\n';
+                }
+                break;
+
+            case Type::Histogram:
+                text << "# TYPE " << name << " histogram\n";
+                for (const auto& histogram : family.histograms) {
+                    const auto values = histogram.second->values();
+                    for (size_t i = 0; i < values.cumulative_counts.size(); ++i) {
+                        const std::string bound = i < values.upper_bounds.size() ?
+                                                      format_bound(values.upper_bounds[i]) :
+                                                      "+Inf";
+                        text << name << "_bucket"
+                             << with_labels(histogram.first, "le=\"" + bound + "\"") << ' '
+                             << values.cumulative_counts[i] << '\n';
+                    }
+                    text << name << "_sum" << with_labels(histogram.first) << ' ' << values.sum
+                         << '\n';
+                    text << name << "_count" << with_labels(histogram.first) << ' '
+                         << values.cumulative_counts.back() << '\n';
+                }
+                break;
+        }
+    }
+
+    return text.str();
+}
+
+} // namespace mavsdk
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mavsdk {
+
+/*
+ * Counters, gauges and histograms about the internals of MAVSDK, e.g. queue
+ * depths or message rates, which can be exported in the Prometheus text format.
+ *
+ * Updating a metric is cheap enough for hot paths: counters and histograms are
+ * split into shards, and each thread updates its own shard with relaxed atomic
+ * operations, so threads never wait for each other or bounce a cache line
+ * around. The shards are only summed up when the metrics are read, so nothing
+ * is spent on formatting unless someone actually asks for them.
+ */
+
+// Label names and values of one metric, e.g. {{"channel", "0"}}.
+typedef std::vector<std::pair<std::string, std::string>> MetricsLabels;
+
+class MetricsCounter {
+public:
+    MetricsCounter() = default;
+    ~MetricsCounter() = default;
+
+    void increment(uint64_t value = 1)
+    {
+        _shards[shard_index()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const;
+
+    // Non-copyable
+    MetricsCounter(const MetricsCounter&) = delete;
+    const MetricsCounter& operator=(const MetricsCounter&) = delete;
+
+    // The shards are picked per thread, threads beyond this share them.
+    static constexpr unsigned num_shards = 16;
+
+    static unsigned shard_index();
+
+private:
+    // The padding makes sure that no two values share a cache line.
+    struct Shard {
+        std::atomic<uint64_t> value{0};
+        char padding[64]{};
+    };
+
+    Shard _shards[num_shards]{};
+};
+
+// Gauges are set or moved up and down from anywhere, so they are a single value.
+class MetricsGauge {
+public:
+    MetricsGauge() = default;
+    ~MetricsGauge() = default;
+
+    void set(int64_t value) { _value.store(value, std::memory_order_relaxed); }
+    void add(int64_t value) { _value.fetch_add(value, std::memory_order_relaxed); }
+    int64_t value() const { return _value.load(std::memory_order_relaxed); }
+
+    // Non-copyable
+    MetricsGauge(const MetricsGauge&) = delete;
+    const MetricsGauge& operator=(const MetricsGauge&) = delete;
+
+private:
+    std::atomic<int64_t> _value{0};
+};
+
+class MetricsHistogram {
+public:
+    // `upper_bounds` have to be sorted, the +Inf bucket is added implicitly.
+    explicit MetricsHistogram(const std::vector<double>& upper_bounds);
+    ~MetricsHistogram() = default;
+
+    void observe(double value);
+
+    struct Values {
+        std::vector<double> upper_bounds{};
+        // Cumulative counts per upper bound, the last one is for +Inf.
+        std::vector<uint64_t> cumulative_counts{};
+        double sum{0.0};
+    };
+
+    Values values() const;
+
+    // Non-copyable
+    MetricsHistogram(const MetricsHistogram&) = delete;
+    const MetricsHistogram& operator=(const MetricsHistogram&) = delete;
+
+private:
+    struct Shard {
+        // Allocated separately per shard, so shards don't share cache lines.
+        std::unique_ptr<std::atomic<uint64_t>[]> counts{};
+        std::atomic<double> sum{0.0};
+        char padding[64]{};
+    };
+
+    const std::vector<double> _upper_bounds;
+    Shard _shards[MetricsCounter::num_shards]{};
+};
+
+class MetricsRegistry {
+public:
+    static MetricsRegistry& Instance()
+    {
+        // This should be thread-safe in C++11.
+        static MetricsRegistry instance;
+
+        return instance;
+    }
+
+    MetricsRegistry() = default;
+    ~MetricsRegistry() = default;
+
+    // delete copy and move constructors and assign operators
+    MetricsRegistry(MetricsRegistry const&) = delete; // Copy construct
+    MetricsRegistry(MetricsRegistry&&) = delete; // Move construct
+    MetricsRegistry& operator=(MetricsRegistry const&) = delete; // Copy assign
+    MetricsRegistry& operator=(MetricsRegistry&&) = delete; // Move assign
+
+    /**
+     * Get a metric, creating it on first use.
+     *
+     * The same name and labels always give the same metric, which stays valid
+     * for the lifetime of the registry, so keep the reference instead of
+     * looking it up on every update.
+     *
+     * If a name is already used by a different type of metric, an unregistered
+     * metric is returned, which can be updated but is never exported.
+     */
+    MetricsCounter&
+    counter(const std::string& name, const std::string& help, const MetricsLabels& labels = {});
+    MetricsGauge&
+    gauge(const std::string& name, const std::string& help, const MetricsLabels& labels = {});
+    MetricsHistogram& histogram(
+        const std::string& name,
+        const std::string& help,
+        const std::vector<double>& upper_bounds,
+        const MetricsLabels& labels = {});
+
+    // All metrics in the Prometheus text exposition format (version 0.0.4).
+    std::string prometheus_text() const;
+
+private:
+    enum class Type { Counter, Gauge, Histogram };
+
+    struct Family {
+        Type type;
+        std::string help;
+        // Keyed by the formatted labels, e.g. `channel="0"`.
+        std::map<std::string, std::unique_ptr<MetricsCounter>> counters;
+        std::map<std::string, std::unique_ptr<MetricsGauge>> gauges;
+        std::map<std::string, std::unique_ptr<MetricsHistogram>> histograms;
+    };
+
+    Family* family(const std::string& name, const std::string& help, Type type);
+
+    static std::string format_labels(const MetricsLabels& labels);
+
+    mutable std::mutex _mutex{};
+    std::map<std::string, Family> _families{};
+
+    // Metrics of which the name clashed, kept so references stay valid.
+    std::vector<std::unique_ptr<MetricsCounter>> _unregistered_counters{};
+    std::vector<std::unique_ptr<MetricsGauge>> _unregistered_gauges{};
+    std::vector<std::unique_ptr<MetricsHistogram>> _unregistered_histograms{};
+};
+
+} // namespace mavsdk
@@ -0,0 +1,102 @@
+#include "metrics.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+TEST(Metrics, CountsFromManyThreads)
+{
+    MetricsCounter counter;
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < 2 * MetricsCounter::num_shards; ++i) {
+        threads.emplace_back([&counter]() {
+            for (int j = 0; j < 10000; ++j) {
+                counter.increment();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(counter.value(), 2 * MetricsCounter::num_shards * 10000);
+}
+
+TEST(Metrics, MovesGauge)
+{
+    MetricsGauge gauge;
+    gauge.add(3);
+    gauge.add(-1);
+    EXPECT_EQ(gauge.value(), 2);
+
+    gauge.set(-5);
+    EXPECT_EQ(gauge.value(), -5);
+}
+
+TEST(Metrics, SortsIntoBuckets)
+{
+    MetricsHistogram histogram({1.0, 2.0});
+    histogram.observe(0.5);
+    histogram.observe(1.0);
+    histogram.observe(1.5);
+    histogram.observe(10.0);
+
+    const auto values = histogram.values();
+    ASSERT_EQ(values.cumulative_counts.size(), 3);
+    EXPECT_EQ(values.cumulative_counts[0], 2);
+    EXPECT_EQ(values.cumulative_counts[1], 3);
+    EXPECT_EQ(values.cumulative_counts[2], 4);
+    EXPECT_DOUBLE_EQ(values.sum, 13.0);
+}
+
+TEST(Metrics, ReturnsSameMetricForSameLabels)
+{
+    MetricsRegistry registry;
+
+    auto& counter = registry.counter("test_total", "Test.", {{"channel", "0"}});
+    EXPECT_EQ(&counter, &registry.counter("test_total", "Test.", {{"channel", "0"}}));
+    EXPECT_NE(&counter, &registry.counter("test_total", "Test.", {{"channel", "1"}}));
+}
+
+TEST(Metrics, KeepsClashingNameOutOfExport)
+{
+    MetricsRegistry registry;
+
+    registry.counter("test", "Test.").increment();
+    registry.gauge("test", "Test.").set(42);
+
+    const auto text = registry.prometheus_text();
+    EXPECT_NE(text.find("# TYPE test counter"), std::string::npos);
+    EXPECT_EQ(text.find("42"), std::string::npos);
+}
+
+TEST(Metrics, ExportsPrometheusText)
+{
+    MetricsRegistry registry;
+
+    registry.counter("test_messages_total", "Messages.", {{"channel", "0"}}).increment(3);
+    registry.gauge("test_queue_depth", "Queue depth.").set(7);
+    auto& histogram =
+        registry.histogram("test_latency_seconds", "Latency.", {0.5}, {{"name", "a\"b"}});
+    histogram.observe(0.25);
+    histogram.observe(2.0);
+
+    EXPECT_EQ(
+        registry.prometheus_text(),
+        "# HELP test_latency_seconds Latency.\n"
+        "# TYPE test_latency_seconds histogram\n"
+        "test_latency_seconds_bucket{name=\"a\\\"b\",le=\"0.5\"} 1\n"
+        "test_latency_seconds_bucket{name=\"a\\\"b\",le=\"+Inf\"} 2\n"
+        "test_latency_seconds_sum{name=\"a\\\"b\"} 2.25\n"
+        "test_latency_seconds_count{name=\"a\\\"b\"} 2\n"
+        "# HELP test_messages_total Messages.\n"
+        "# TYPE test_messages_total counter\n"
+        "test_messages_total{channel=\"0\"} 3\n"
+        "# HELP test_queue_depth Queue depth.\n"
+        "# TYPE test_queue_depth gauge\n"
+        "test_queue_depth 7\n");
+}
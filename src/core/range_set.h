@@ -0,0 +1,127 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace mavsdk {
+
+/*
+ * Set of half-open ranges [begin, end), e.g. the parts of a file received so
+ * far when the parts can arrive in any order or more than once.
+ *
+ * Overlapping and adjacent ranges are merged, so the set stays as small as the
+ * number of gaps in it.
+ */
+template<class T> class RangeSet {
+public:
+    typedef std::pair<T, T> Range;
+
+    RangeSet() = default;
+    ~RangeSet() = default;
+
+    // Returns how much of [begin, end) was not in the set before.
+    T insert(T begin, T end)
+    {
+        if (!(begin < end)) {
+            return T{};
+        }
+
+        const T inserted_begin = begin;
+        const T inserted_end = end;
+        T added = end - begin;
+
+        // Start with the range before, in case it touches the new one.
+        auto it = _ranges.upper_bound(begin);
+        if (it != _ranges.begin() && !(std::prev(it)->second < begin)) {
+            --it;
+        }
+
+        while (it != _ranges.end() && !(end < it->first)) {
+            const T overlap_begin = std::max(inserted_begin, it->first);
+            const T overlap_end = std::min(inserted_end, it->second);
+            if (overlap_begin < overlap_end) {
+                added -= overlap_end - overlap_begin;
+            }
+            begin = std::min(begin, it->first);
+            end = std::max(end, it->second);
+            it = _ranges.erase(it);
+        }
+
+        _ranges.insert(it, Range(begin, end));
+        _size += added;
+        return added;
+    }
+
+    bool contains(T begin, T end) const
+    {
+        auto it = _ranges.upper_bound(begin);
+        if (it == _ranges.begin()) {
+            return !(begin < end);
+        }
+        --it;
+        return !(it->second < end);
+    }
+
+    // The first part of [begin, end) which is not in the set.
+    bool first_gap(T begin, T end, Range& gap) const
+    {
+        const auto found = gaps(begin, end, 1);
+        if (found.empty()) {
+            return false;
+        }
+        gap = found.front();
+        return true;
+    }
+
+    // The parts of [begin, end) which are not in the set, at most `max_gaps`.
+    std::vector<Range> gaps(T begin, T end, size_t max_gaps = SIZE_MAX) const
+    {
+        std::vector<Range> found;
+        T position = begin;
+
+        auto it = _ranges.upper_bound(begin);
+        if (it != _ranges.begin()) {
+            --it;
+        }
+
+        for (; it != _ranges.end() && position < end && found.size() < max_gaps; ++it) {
+            if (position < it->first) {
+                found.push_back(Range(position, std::min(it->first, end)));
+            }
+            position = std::max(position, it->second);
+        }
+
+        if (position < end && found.size() < max_gaps) {
+            found.push_back(Range(position, end));
+        }
+
+        return found;
+    }
+
+    // Total length of all ranges.
+    T size() const { return _size; }
+
+    bool empty() const { return _ranges.empty(); }
+
+    // End of the last range, or T{} if there is none.
+    T covered_end() const { return _ranges.empty() ? T{} : _ranges.rbegin()->second; }
+
+    const std::map<T, T>& ranges() const { return _ranges; }
+
+    void clear()
+    {
+        _ranges.clear();
+        _size = T{};
+    }
+
+private:
+    // Keyed by begin, the value is the end.
+    std::map<T, T> _ranges{};
+    T _size{};
+};
+
+} // namespace mavsdk
@@ -0,0 +1,69 @@
+#include "range_set.h"
+
+#include <cstdint>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+typedef RangeSet<uint32_t>::Range Range;
+
+TEST(RangeSet, MergesOverlappingAndAdjacentRanges)
+{
+    RangeSet<uint32_t> set;
+    EXPECT_TRUE(set.empty());
+
+    EXPECT_EQ(set.insert(10, 20), 10);
+    EXPECT_EQ(set.insert(30, 40), 10);
+    EXPECT_EQ(set.ranges().size(), 2);
+
+    // Fills the gap and overlaps both sides.
+    EXPECT_EQ(set.insert(15, 35), 10);
+    EXPECT_EQ(set.ranges().size(), 1);
+    EXPECT_EQ(set.size(), 30);
+
+    // Adjacent ranges are merged as well.
+    EXPECT_EQ(set.insert(40, 45), 5);
+    EXPECT_EQ(set.insert(5, 10), 5);
+    EXPECT_EQ(set.ranges().size(), 1);
+    EXPECT_EQ(set.ranges().begin()->first, 5);
+    EXPECT_EQ(set.covered_end(), 45);
+}
+
+TEST(RangeSet, CountsDuplicatesOnce)
+{
+    RangeSet<uint32_t> set;
+
+    EXPECT_EQ(set.insert(0, 239), 239);
+    EXPECT_EQ(set.insert(0, 239), 0);
+    EXPECT_EQ(set.insert(100, 200), 0);
+    EXPECT_EQ(set.insert(5, 5), 0);
+    EXPECT_EQ(set.size(), 239);
+
+    EXPECT_TRUE(set.contains(0, 239));
+    EXPECT_TRUE(set.contains(100, 200));
+    EXPECT_FALSE(set.contains(100, 240));
+}
+
+TEST(RangeSet, FindsGaps)
+{
+    RangeSet<uint32_t> set;
+    set.insert(10, 20);
+    set.insert(30, 40);
+
+    EXPECT_EQ(
+        set.gaps(0, 50), std::vector<Range>({Range(0, 10), Range(20, 30), Range(40, 50)}));
+    EXPECT_EQ(set.gaps(15, 35), std::vector<Range>({Range(20, 30)}));
+    EXPECT_EQ(set.gaps(0, 50, 2), std::vector<Range>({Range(0, 10), Range(20, 30)}));
+    EXPECT_TRUE(set.gaps(10, 20).empty());
+
+    Range gap;
+    ASSERT_TRUE(set.first_gap(10, 50, gap));
+    EXPECT_EQ(gap, Range(20, 30));
+    EXPECT_FALSE(set.first_gap(30, 40, gap));
+
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_EQ(set.size(), 0);
+    EXPECT_EQ(set.gaps(0, 5), std::vector<Range>({Range(0, 5)}));
+}
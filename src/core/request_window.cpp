@@ -0,0 +1,51 @@
+#include "request_window.h"
+
+#include <algorithm>
+
+namespace mavsdk {
+
+void RequestWindow::reset(unsigned count, unsigned window)
+{
+    _received.assign(count, false);
+    _window = std::max(window, 1u);
+    _first_missing = 0;
+    _next_request = 0;
+}
+
+std::vector<unsigned> RequestWindow::take_requests()
+{
+    std::vector<unsigned> requests;
+    const unsigned end = std::min(_first_missing + _window, count());
+    for (; _next_request < end; ++_next_request) {
+        if (!_received[_next_request]) {
+            requests.push_back(_next_request);
+        }
+    }
+    return requests;
+}
+
+std::vector<unsigned> RequestWindow::missing() const
+{
+    std::vector<unsigned> seqs;
+    for (unsigned seq = _first_missing; seq < _next_request; ++seq) {
+        if (!_received[seq]) {
+            seqs.push_back(seq);
+        }
+    }
+    return seqs;
+}
+
+bool RequestWindow::add_received(unsigned seq)
+{
+    if (seq < _first_missing || seq >= _next_request || _received[seq]) {
+        return false;
+    }
+
+    _received[seq] = true;
+    while (_first_missing < count() && _received[_first_missing]) {
+        ++_first_missing;
+    }
+    return true;
+}
+
+} // namespace mavsdk
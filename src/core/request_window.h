@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+namespace mavsdk {
+
+/*
+ * Sequence numbers of a download in which every item is requested on its own,
+ * e.g. the items of a mission.
+ *
+ * Items up to `window` after the first missing one are requested ahead, so a
+ * link with a long round trip time is kept busy. They may arrive in any order,
+ * and after a timeout only the ones missing are requested again. A window of 1
+ * requests one item after the other, for autopilots which only answer requests
+ * in order.
+ */
+class RequestWindow {
+public:
+    RequestWindow() = default;
+    ~RequestWindow() = default;
+
+    void reset(unsigned count, unsigned window);
+
+    // Sequence numbers to request now: not requested yet and within the window.
+    std::vector<unsigned> take_requests();
+
+    // Sequence numbers requested but not received, to request again.
+    std::vector<unsigned> missing() const;
+
+    // Returns false if the item was not requested or received already.
+    bool add_received(unsigned seq);
+
+    bool done() const { return _first_missing == _received.size(); }
+    unsigned count() const { return static_cast<unsigned>(_received.size()); }
+    unsigned window() const { return _window; }
+
+private:
+    std::vector<bool> _received{};
+    unsigned _window{1};
+    unsigned _first_missing{0};
+    unsigned _next_request{0};
+};
+
+} // namespace mavsdk
@@ -0,0 +1,98 @@
+#include "request_window.h"
+
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+typedef std::vector<unsigned> Seqs;
+
+TEST(RequestWindow, RequestsAheadWithinWindow)
+{
+    RequestWindow window;
+    window.reset(10, 4);
+
+    EXPECT_EQ(window.take_requests(), Seqs({0, 1, 2, 3}));
+    EXPECT_EQ(window.take_requests(), Seqs());
+
+    // The window only moves once the first missing item is received.
+    EXPECT_TRUE(window.add_received(1));
+    EXPECT_EQ(window.take_requests(), Seqs());
+    EXPECT_TRUE(window.add_received(0));
+    EXPECT_EQ(window.take_requests(), Seqs({4, 5}));
+
+    for (unsigned seq = 2; seq < 10; ++seq) {
+        EXPECT_FALSE(window.done());
+        EXPECT_TRUE(window.add_received(seq));
+        window.take_requests();
+    }
+    EXPECT_TRUE(window.done());
+    EXPECT_EQ(window.take_requests(), Seqs());
+}
+
+TEST(RequestWindow, RequestsOnlyMissingAgain)
+{
+    RequestWindow window;
+    window.reset(10, 5);
+    EXPECT_EQ(window.take_requests(), Seqs({0, 1, 2, 3, 4}));
+
+    EXPECT_TRUE(window.add_received(0));
+    EXPECT_TRUE(window.add_received(2));
+    EXPECT_TRUE(window.add_received(4));
+    EXPECT_EQ(window.missing(), Seqs({1, 3}));
+    EXPECT_EQ(window.take_requests(), Seqs({5}));
+    EXPECT_EQ(window.missing(), Seqs({1, 3, 5}));
+}
+
+TEST(RequestWindow, IgnoresUnexpectedItems)
+{
+    RequestWindow window;
+    window.reset(10, 2);
+    window.take_requests();
+
+    EXPECT_TRUE(window.add_received(0));
+    EXPECT_FALSE(window.add_received(0));
+    // Not requested yet, e.g. from an earlier download.
+    EXPECT_FALSE(window.add_received(5));
+    EXPECT_FALSE(window.add_received(10));
+    EXPECT_EQ(window.take_requests(), Seqs({2}));
+}
+
+TEST(RequestWindow, RequestsInOrderWithWindowOfOne)
+{
+    RequestWindow window;
+    window.reset(3, 1);
+
+    for (unsigned seq = 0; seq < 3; ++seq) {
+        EXPECT_EQ(window.take_requests(), Seqs({seq}));
+        EXPECT_EQ(window.missing(), Seqs({seq}));
+        EXPECT_TRUE(window.add_received(seq));
+    }
+    EXPECT_TRUE(window.done());
+}
+
+TEST(RequestWindow, IsDoneWithoutItems)
+{
+    RequestWindow window;
+    window.reset(0, 8);
+    EXPECT_TRUE(window.done());
+    EXPECT_EQ(window.take_requests(), Seqs());
+    EXPECT_EQ(window.missing(), Seqs());
+}
+
+TEST(RequestWindow, IgnoresItemsOfDownloadBeforeReset)
+{
+    RequestWindow window;
+    window.reset(10, 4);
+    window.take_requests();
+
+    // Started over, the items requested before may still arrive.
+    window.reset(0, window.window());
+    EXPECT_FALSE(window.add_received(1));
+    EXPECT_EQ(window.missing(), Seqs());
+
+    window.reset(10, window.window());
+    EXPECT_FALSE(window.add_received(1));
+    EXPECT_EQ(window.take_requests(), Seqs({0, 1, 2, 3}));
+    EXPECT_TRUE(window.add_received(1));
+}
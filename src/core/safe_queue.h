@@ -48,6 +48,15 @@ public:
         _condition_var.notify_all();
     }
 
+    // Drops the items which were never dequeued and returns how many there were.
+    size_t clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const size_t dropped = _queue.size();
+        std::queue<T>().swap(_queue);
+        return dropped;
+    }
+
 private:
     std::queue<T> _queue{};
     mutable std::mutex _mutex{};
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+
+namespace mavsdk {
+
+/*
+ * Container for a single value that is written rarely compared to how often it
+ * is read, e.g. the latest telemetry sample.
+ *
+ * Readers never take a lock: they copy the value and retry if a writer was
+ * active at the same time (seqlock). Writers are serialized with a mutex
+ * which is never touched by readers, so any number of readers can poll the
+ * value without ever delaying the receive thread.
+ *
+ * The payload is stored as relaxed atomic words so that the concurrent copy
+ * is not a data race, and the whole object is padded to a cache line so that
+ * neighbouring values don't share one (false sharing).
+ *
+ * Only trivially copyable types can be stored.
+ */
+template<class T> class SeqlockData {
+public:
+    static_assert(
+        std::is_trivially_copyable<T>::value, "SeqlockData requires a trivially copyable type");
+
+    explicit SeqlockData(const T& value) { store_words(value); }
+    ~SeqlockData() = default;
+
+    T get() const
+    {
+        uint64_t buffer[_num_words];
+        unsigned sequence_before;
+        unsigned sequence_after;
+
+        do {
+            sequence_before = _sequence.load(std::memory_order_acquire);
+            while ((sequence_before & 1) != 0) {
+                // A writer is in the middle of an update, it won't take long.
+                std::this_thread::yield();
+                sequence_before = _sequence.load(std::memory_order_acquire);
+            }
+
+            for (size_t i = 0; i < _num_words; ++i) {
+                buffer[i] = _words[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            sequence_after = _sequence.load(std::memory_order_relaxed);
+        } while (sequence_before != sequence_after);
+
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+    void set(const T& value)
+    {
+        std::lock_guard<std::mutex> lock(_write_mutex);
+        write_locked(value);
+    }
+
+    // Read-modify-write for values which are updated field by field from
+    // different places. The function gets a copy of the current value to change.
+    template<class Func> void update(Func func)
+    {
+        std::lock_guard<std::mutex> lock(_write_mutex);
+        T value = read_locked();
+        func(value);
+        write_locked(value);
+    }
+
+    // How many times the value has been written, mainly useful to detect
+    // whether anything arrived since the last poll.
+    unsigned num_writes() const { return _sequence.load(std::memory_order_acquire) / 2; }
+
+    // Non-copyable
+    SeqlockData(const SeqlockData&) = delete;
+    const SeqlockData& operator=(const SeqlockData&) = delete;
+
+private:
+    static constexpr size_t _num_words = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+    static constexpr size_t _cache_line_size = 64;
+
+    void store_words(const T& value)
+    {
+        uint64_t buffer[_num_words]{};
+        std::memcpy(buffer, &value, sizeof(T));
+        for (size_t i = 0; i < _num_words; ++i) {
+            _words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+
+    T read_locked() const
+    {
+        // Only called with the write mutex held, so nobody can change the words.
+        uint64_t buffer[_num_words];
+        for (size_t i = 0; i < _num_words; ++i) {
+            buffer[i] = _words[i].load(std::memory_order_relaxed);
+        }
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+    void write_locked(const T& value)
+    {
+        const unsigned sequence = _sequence.load(std::memory_order_relaxed);
+        _sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        store_words(value);
+
+        _sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    std::atomic<unsigned> _sequence{0};
+    std::atomic<uint64_t> _words[_num_words]{};
+    std::mutex _write_mutex{};
+
+    // Keeps the next member out of the cache line(s) we are writing to.
+    char _padding[_cache_line_size]{};
+};
+
+} // namespace mavsdk
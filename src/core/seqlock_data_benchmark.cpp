@@ -0,0 +1,127 @@
+// Measures how SeqlockData holds up against a std::mutex protected value when
+// several threads keep polling it while one thread writes, like the telemetry
+// getters do while the receive thread updates the values.
+//
+// Run without arguments; prints the reads and writes done in 200 ms for both.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "seqlock_data.h"
+
+namespace {
+
+constexpr unsigned num_readers = 4;
+constexpr auto duration = std::chrono::milliseconds(200);
+
+// Every field carries the same value, so a torn read is easy to spot.
+struct Sample {
+    uint64_t counter;
+    double a;
+    float b;
+    float c;
+    uint32_t d;
+};
+
+Sample make_sample(uint64_t counter)
+{
+    return Sample{counter, double(counter), float(counter), float(counter), uint32_t(counter)};
+}
+
+bool is_consistent(const Sample& sample)
+{
+    return sample.a == double(sample.counter) && sample.b == float(sample.counter) &&
+           sample.c == float(sample.counter) && sample.d == uint32_t(sample.counter);
+}
+
+// Small wrapper with the same interface to compare against what we had before.
+class MutexData {
+public:
+    explicit MutexData(const Sample& sample) : _sample(sample) {}
+
+    Sample get() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _sample;
+    }
+
+    void set(const Sample& sample)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _sample = sample;
+    }
+
+private:
+    mutable std::mutex _mutex{};
+    Sample _sample;
+};
+
+struct ContentionResult {
+    uint64_t reads;
+    uint64_t writes;
+    bool all_consistent;
+};
+
+template<class Data> ContentionResult run_contention()
+{
+    Data data{make_sample(0)};
+    std::atomic<bool> should_exit{false};
+    std::atomic<uint64_t> reads{0};
+    std::atomic<bool> all_consistent{true};
+
+    std::vector<std::thread> readers;
+    for (unsigned i = 0; i < num_readers; ++i) {
+        readers.emplace_back([&data, &should_exit, &reads, &all_consistent]() {
+            uint64_t local_reads = 0;
+            while (!should_exit) {
+                if (!is_consistent(data.get())) {
+                    all_consistent = false;
+                }
+                ++local_reads;
+            }
+            reads += local_reads;
+        });
+    }
+
+    uint64_t writes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < duration) {
+        data.set(make_sample(++writes));
+    }
+    should_exit = true;
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    return ContentionResult{reads, writes, all_consistent};
+}
+
+void print_result(const char* name, const ContentionResult& result)
+{
+    printf(
+        "%-12s %u readers: %12llu reads, %10llu writes%s\n",
+        name,
+        num_readers,
+        static_cast<unsigned long long>(result.reads),
+        static_cast<unsigned long long>(result.writes),
+        result.all_consistent ? "" : " (TORN READS)");
+}
+
+} // namespace
+
+int main()
+{
+    const auto seqlock = run_contention<mavsdk::SeqlockData<Sample>>();
+    const auto mutex = run_contention<MutexData>();
+
+    print_result("SeqlockData", seqlock);
+    print_result("std::mutex", mutex);
+
+    return seqlock.all_consistent && mutex.all_consistent ? 0 : 1;
+}
@@ -0,0 +1,116 @@
+#include "seqlock_data.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+namespace {
+
+// Every field carries the same value, so a torn read is easy to spot.
+struct Sample {
+    uint64_t counter;
+    double a;
+    float b;
+    float c;
+    uint32_t d;
+};
+
+Sample make_sample(uint64_t counter)
+{
+    return Sample{counter, double(counter), float(counter), float(counter), uint32_t(counter)};
+}
+
+bool is_consistent(const Sample& sample)
+{
+    return sample.a == double(sample.counter) && sample.b == float(sample.counter) &&
+           sample.c == float(sample.counter) && sample.d == uint32_t(sample.counter);
+}
+
+} // namespace
+
+TEST(SeqlockData, GetSet)
+{
+    SeqlockData<Sample> data{make_sample(0)};
+    EXPECT_EQ(data.get().counter, 0);
+    EXPECT_EQ(data.num_writes(), 0);
+
+    data.set(make_sample(42));
+    EXPECT_EQ(data.get().counter, 42);
+    EXPECT_TRUE(is_consistent(data.get()));
+    EXPECT_EQ(data.num_writes(), 1);
+}
+
+TEST(SeqlockData, Update)
+{
+    SeqlockData<Sample> data{make_sample(1)};
+
+    data.update([](Sample& sample) { sample.d = 7; });
+
+    const Sample sample = data.get();
+    EXPECT_EQ(sample.counter, 1);
+    EXPECT_EQ(sample.d, 7);
+    EXPECT_EQ(data.num_writes(), 1);
+}
+
+TEST(SeqlockData, OddSize)
+{
+    struct Odd {
+        uint8_t bytes[13];
+    };
+
+    Odd odd{};
+    for (uint8_t i = 0; i < sizeof(odd.bytes); ++i) {
+        odd.bytes[i] = i;
+    }
+
+    SeqlockData<Odd> data{odd};
+    const Odd copy = data.get();
+    for (uint8_t i = 0; i < sizeof(odd.bytes); ++i) {
+        EXPECT_EQ(copy.bytes[i], i);
+    }
+}
+
+TEST(SeqlockData, ConcurrentReadsAreConsistent)
+{
+    const unsigned num_readers = 4;
+    const uint64_t num_writes = 100000;
+
+    SeqlockData<Sample> data{make_sample(0)};
+    std::atomic<bool> should_exit{false};
+    std::atomic<bool> all_consistent{true};
+    std::atomic<bool> monotonic{true};
+
+    std::vector<std::thread> readers;
+    for (unsigned i = 0; i < num_readers; ++i) {
+        readers.emplace_back([&data, &should_exit, &all_consistent, &monotonic]() {
+            uint64_t last_counter = 0;
+            while (!should_exit) {
+                const Sample sample = data.get();
+                if (!is_consistent(sample)) {
+                    all_consistent = false;
+                }
+                if (sample.counter < last_counter) {
+                    monotonic = false;
+                }
+                last_counter = sample.counter;
+            }
+        });
+    }
+
+    for (uint64_t i = 1; i <= num_writes; ++i) {
+        data.set(make_sample(i));
+    }
+    should_exit = true;
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_TRUE(all_consistent);
+    EXPECT_TRUE(monotonic);
+    EXPECT_EQ(data.get().counter, num_writes);
+    EXPECT_EQ(data.num_writes(), num_writes);
+}
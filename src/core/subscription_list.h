@@ -0,0 +1,162 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mavsdk {
+
+// Handles are unique across all lists, so a plugin can offer a single unsubscribe
+// for all of its streams. 0 is never used as a handle.
+inline uint64_t next_subscription_handle()
+{
+    static std::atomic<uint64_t> next_handle{1};
+    return next_handle.fetch_add(1, std::memory_order_relaxed);
+}
+
+/*
+ * Subscribers of one stream of updates, e.g. position updates.
+ *
+ * Any number of callbacks can be subscribed, each identified by the handle
+ * returned. For backwards compatibility, one additional callback can be set
+ * which replaces the one set before, as the plugins' *_async methods do.
+ *
+ * The list of subscribers is copied on write, so dispatching a sample does not
+ * need to copy the callbacks and never blocks subscribing or unsubscribing. The
+ * sample itself is copied once and shared by all subscribers.
+ */
+template<class T> class SubscriptionList {
+public:
+    typedef std::function<void(T)> callback_t;
+
+    SubscriptionList() = default;
+    ~SubscriptionList() = default;
+
+    // Returns the handle to unsubscribe, or 0 if the callback is empty.
+    uint64_t subscribe(const callback_t& callback)
+    {
+        if (!callback) {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        const uint64_t handle = next_subscription_handle();
+        add_locked(handle, callback);
+        return handle;
+    }
+
+    // Returns false if the handle does not belong to this list.
+    bool unsubscribe(uint64_t handle)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return remove_locked(handle);
+    }
+
+    // Replaces the callback set by the previous call, nullptr removes it.
+    void set_single(const callback_t& callback)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (_single_handle != 0) {
+            remove_locked(_single_handle);
+            _single_handle = 0;
+        }
+
+        if (callback) {
+            _single_handle = next_subscription_handle();
+            add_locked(_single_handle, callback);
+        }
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _subscribers.reset();
+        _single_handle = 0;
+        _empty.store(true, std::memory_order_relaxed);
+    }
+
+    // Cheap enough to check before even assembling a sample.
+    bool empty() const { return _empty.load(std::memory_order_relaxed); }
+
+    // Returns the function which calls all current subscribers with the value, to
+    // be handed to the user callback thread. Returns an empty function if there
+    // is nobody to call.
+    std::function<void()> notification(const T& value) const
+    {
+        std::shared_ptr<const Subscribers> subscribers;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            subscribers = _subscribers;
+        }
+
+        if (!subscribers || subscribers->empty()) {
+            return nullptr;
+        }
+
+        std::shared_ptr<const T> sample = std::make_shared<const T>(value);
+        return [subscribers, sample]() {
+            for (const auto& subscriber : *subscribers) {
+                subscriber.callback(*sample);
+            }
+        };
+    }
+
+    // Non-copyable
+    SubscriptionList(const SubscriptionList&) = delete;
+    const SubscriptionList& operator=(const SubscriptionList&) = delete;
+
+private:
+    struct Subscriber {
+        uint64_t handle;
+        callback_t callback;
+    };
+    typedef std::vector<Subscriber> Subscribers;
+
+    void add_locked(uint64_t handle, const callback_t& callback)
+    {
+        std::shared_ptr<Subscribers> subscribers =
+            _subscribers ? std::make_shared<Subscribers>(*_subscribers) :
+                           std::make_shared<Subscribers>();
+        subscribers->push_back(Subscriber{handle, callback});
+        _subscribers = subscribers;
+        _empty.store(false, std::memory_order_relaxed);
+    }
+
+    bool remove_locked(uint64_t handle)
+    {
+        if (!_subscribers) {
+            return false;
+        }
+
+        std::shared_ptr<Subscribers> subscribers = std::make_shared<Subscribers>();
+        subscribers->reserve(_subscribers->size());
+        for (const auto& subscriber : *_subscribers) {
+            if (subscriber.handle != handle) {
+                subscribers->push_back(subscriber);
+            }
+        }
+
+        if (subscribers->size() == _subscribers->size()) {
+            return false;
+        }
+
+        if (handle == _single_handle) {
+            _single_handle = 0;
+        }
+
+        _empty.store(subscribers->empty(), std::memory_order_relaxed);
+        _subscribers = subscribers;
+        return true;
+    }
+
+    mutable std::mutex _mutex{};
+    std::shared_ptr<const Subscribers> _subscribers{};
+    uint64_t _single_handle{0};
+    std::atomic<bool> _empty{true};
+};
+
+} // namespace mavsdk
@@ -0,0 +1,75 @@
+#include "subscription_list.h"
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+TEST(SubscriptionList, CallsAllSubscribers)
+{
+    SubscriptionList<int> list;
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(list.notification(1));
+
+    std::vector<int> first;
+    std::vector<int> second;
+    const uint64_t first_handle = list.subscribe([&first](int value) { first.push_back(value); });
+    const uint64_t second_handle =
+        list.subscribe([&second](int value) { second.push_back(value); });
+    EXPECT_NE(first_handle, 0);
+    EXPECT_NE(first_handle, second_handle);
+    EXPECT_FALSE(list.empty());
+
+    list.notification(42)();
+    EXPECT_EQ(first, std::vector<int>({42}));
+    EXPECT_EQ(second, std::vector<int>({42}));
+
+    EXPECT_TRUE(list.unsubscribe(first_handle));
+    EXPECT_FALSE(list.unsubscribe(first_handle));
+    list.notification(43)();
+    EXPECT_EQ(first, std::vector<int>({42}));
+    EXPECT_EQ(second, std::vector<int>({42, 43}));
+
+    EXPECT_TRUE(list.unsubscribe(second_handle));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.subscribe(nullptr), 0);
+}
+
+TEST(SubscriptionList, SingleReplacesOnlyItself)
+{
+    SubscriptionList<std::string> list;
+
+    int subscribed_calls = 0;
+    int old_single_calls = 0;
+    int new_single_calls = 0;
+    list.subscribe([&subscribed_calls](std::string) { ++subscribed_calls; });
+    list.set_single([&old_single_calls](std::string) { ++old_single_calls; });
+    list.set_single([&new_single_calls](std::string) { ++new_single_calls; });
+
+    list.notification("status")();
+    EXPECT_EQ(subscribed_calls, 1);
+    EXPECT_EQ(old_single_calls, 0);
+    EXPECT_EQ(new_single_calls, 1);
+
+    list.set_single(nullptr);
+    list.notification("status")();
+    EXPECT_EQ(subscribed_calls, 2);
+    EXPECT_EQ(new_single_calls, 1);
+}
+
+TEST(SubscriptionList, NotificationKeepsSubscribersAtTimeOfSample)
+{
+    SubscriptionList<int> list;
+
+    int calls = 0;
+    const uint64_t handle = list.subscribe([&calls](int) { ++calls; });
+
+    // Samples already handed out still reach the subscribers they were made for.
+    auto notification = list.notification(1);
+    list.unsubscribe(handle);
+    notification();
+    EXPECT_EQ(calls, 1);
+
+    EXPECT_FALSE(list.notification(2));
+}
@@ -23,7 +23,26 @@ SystemImpl::SystemImpl(MavsdkImpl& parent, uint8_t system_id, uint8_t comp_id, b
     _commands(*this),
     _timesync(*this),
     _timeout_handler(_time),
-    _call_every_handler(_time)
+    _call_every_handler(_time),
+    _message_rate_manager(
+        _time,
+        [this](
+            uint16_t message_id,
+            double rate_hz,
+            MessageRateManager::result_callback_t callback) {
+            set_msg_rate_async(
+                message_id,
+                rate_hz,
+                [message_id, callback](MAVLinkCommands::Result result, float) {
+                    if (result == MAVLinkCommands::Result::IN_PROGRESS) {
+                        return;
+                    }
+                    if (result != MAVLinkCommands::Result::SUCCESS) {
+                        LogWarn() << "Setting rate of message " << message_id << " failed";
+                    }
+                    callback(result);
+                });
+        })
 {
     if (connected) {
         _always_connected = true;
@@ -226,6 +245,7 @@ void SystemImpl::process_autopilot_version(const mavlink_message_t& message)
 
     _supports_mission_int =
         ((autopilot_version.capabilities & MAV_PROTOCOL_CAPABILITY_MISSION_INT) ? true : false);
+    _supports_ftp = ((autopilot_version.capabilities & MAV_PROTOCOL_CAPABILITY_FTP) ? true : false);
 
     if (_uuid == 0 && autopilot_version.uid != 0) {
         // This is the best case. The system has a UUID and we were able to get it.
@@ -315,6 +335,10 @@ void SystemImpl::system_thread()
         _params.do_work();
         _commands.do_work();
         _timesync.do_work();
+        if (_connected) {
+            // Keep rate changes until there is someone to send them to.
+            _message_rate_manager.do_work();
+        }
 
         if (_connected) {
             // Work fairly fast if we're connected.
@@ -1147,6 +1171,31 @@ void SystemImpl::set_msg_rate_async(
     }
 }
 
+void SystemImpl::register_msg_rate_request(
+    uint16_t message_id,
+    double rate_hz,
+    const void* cookie,
+    MessageRateManager::result_callback_t callback)
+{
+    _message_rate_manager.request_rate(message_id, rate_hz, cookie, callback);
+}
+
+void SystemImpl::unregister_msg_rate_request(
+    uint16_t message_id, const void* cookie, MessageRateManager::result_callback_t callback)
+{
+    _message_rate_manager.remove_request(message_id, cookie, callback);
+}
+
+void SystemImpl::unregister_all_msg_rate_requests(const void* cookie)
+{
+    _message_rate_manager.remove_all_requests(cookie);
+}
+
+void SystemImpl::set_turn_off_unused_msg_rates(bool turn_off_unused)
+{
+    _message_rate_manager.set_turn_off_unused(turn_off_unused);
+}
+
 std::pair<MAVLinkCommands::Result, MAVLinkCommands::CommandLong>
 SystemImpl::make_command_msg_rate(uint16_t message_id, double rate_hz, uint8_t component_id)
 {
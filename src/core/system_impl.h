@@ -6,6 +6,7 @@
 #include "mavlink_commands.h"
 #include "timeout_handler.h"
 #include "call_every_handler.h"
+#include "message_rate_manager.h"
 #include "thread_pool.h"
 #include "timesync.h"
 #include "system.h"
@@ -92,6 +93,21 @@ public:
         command_result_callback_t callback,
         uint8_t component_id = MAV_COMP_ID_AUTOPILOT1);
 
+    // Demand-driven message rates: every user registers the rate it needs with its
+    // cookie (0 for default rate) and the maximum is set on the autopilot.
+    // The callback is called once the resulting rate is set (see MessageRateManager).
+    void register_msg_rate_request(
+        uint16_t message_id,
+        double rate_hz,
+        const void* cookie,
+        MessageRateManager::result_callback_t callback = nullptr);
+    void unregister_msg_rate_request(
+        uint16_t message_id,
+        const void* cookie,
+        MessageRateManager::result_callback_t callback = nullptr);
+    void unregister_all_msg_rate_requests(const void* cookie);
+    void set_turn_off_unused_msg_rates(bool turn_off_unused);
+
     // Adds unique component ids
     void add_new_component(uint8_t component_id);
     size_t total_components() const;
@@ -117,6 +133,7 @@ public:
     uint8_t get_own_mav_type() const;
 
     bool does_support_mission_int() const { return _supports_mission_int; }
+    bool does_support_ftp() const { return _supports_ftp; }
 
     bool is_armed() const { return _armed; }
 
@@ -275,6 +292,7 @@ private:
     std::atomic<bool> _uuid_initialized{false};
 
     bool _supports_mission_int{false};
+    bool _supports_ftp{false};
     std::atomic<bool> _armed{false};
     std::atomic<bool> _hitl_enabled{false};
     bool _always_connected{false};
@@ -305,6 +323,7 @@ private:
 
     TimeoutHandler _timeout_handler;
     CallEveryHandler _call_every_handler;
+    MessageRateManager _message_rate_manager;
 
     Time _time{};
     AutopilotTime _autopilot_time{};
@@ -2,7 +2,13 @@
 
 namespace mavsdk {
 
-ThreadPool::ThreadPool(unsigned num_threads) : _num_threads(num_threads) {}
+ThreadPool::ThreadPool(unsigned num_threads) :
+    _num_threads(num_threads),
+    _queue_depth(MetricsRegistry::Instance().gauge(
+        "mavsdk_thread_pool_queue_depth", "Tasks waiting for a thread of a thread pool.")),
+    _tasks_run(MetricsRegistry::Instance().counter(
+        "mavsdk_thread_pool_tasks_total", "Tasks run by the thread pools."))
+{}
 
 ThreadPool::~ThreadPool()
 {
@@ -29,11 +35,14 @@ bool ThreadPool::stop()
         it->get()->join();
         it = _threads.erase(it);
     }
+    // Tasks which no thread picked up anymore are not waiting any longer either.
+    _queue_depth.add(-static_cast<int64_t>(_work_queue.clear()));
     return true;
 }
 
 void ThreadPool::enqueue(std::function<void()> func)
 {
+    _queue_depth.add(1);
     _work_queue.enqueue(std::move(func));
 }
 
@@ -42,6 +51,8 @@ void ThreadPool::worker()
     while (!_should_stop) {
         auto func = _work_queue.dequeue();
         if (func) {
+            _queue_depth.add(-1);
+            _tasks_run.increment();
             func();
         }
     }
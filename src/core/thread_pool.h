@@ -7,6 +7,7 @@
 #include <thread>
 #include <atomic>
 #include "global_include.h"
+#include "metrics.h"
 #include "safe_queue.h"
 
 namespace mavsdk {
@@ -33,6 +34,10 @@ private:
     const unsigned _num_threads;
     std::vector<std::shared_ptr<std::thread>> _threads{};
     SafeQueue<std::function<void()>> _work_queue{};
+
+    // Shared by all pools.
+    MetricsGauge& _queue_depth;
+    MetricsCounter& _tasks_run;
 };
 
 } // namespace mavsdk
@@ -1,4 +1,5 @@
 #include "thread_pool.h"
+#include "metrics.h"
 #include <gtest/gtest.h>
 #include <atomic>
 
@@ -88,3 +89,31 @@ TEST(ThreadPool, ManyTasks)
         EXPECT_EQ(tasks[i], i);
     }
 }
+
+TEST(ThreadPool, QueueDepthDropsTasksNotRunOnStop)
+{
+    auto& queue_depth = MetricsRegistry::Instance().gauge(
+        "mavsdk_thread_pool_queue_depth", "Tasks waiting for a thread of a thread pool.");
+    const auto depth_before = queue_depth.value();
+
+    {
+        ThreadPool tp(1);
+        ASSERT_TRUE(tp.start());
+
+        std::atomic<bool> blocking{true};
+        tp.enqueue([&blocking]() {
+            while (blocking) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        });
+        for (int i = 0; i < 10; ++i) {
+            tp.enqueue([]() {});
+        }
+
+        our_time.sleep_for(std::chrono::milliseconds(50));
+        blocking = false;
+        tp.stop();
+    }
+
+    EXPECT_EQ(queue_depth.value(), depth_before);
+}
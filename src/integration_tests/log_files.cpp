@@ -1,3 +1,5 @@
+#include <chrono>
+#include <cstdio>
 #include <iostream>
 #include <future>
 #include <sstream>
@@ -5,6 +7,13 @@
 #include "integration_test_helper.h"
 #include "plugins/log_files/log_files.h"
 
+#ifdef ENABLE_MAVLINK_PASSTHROUGH
+#include <random>
+#include "plugins/mavlink_passthrough/mavlink_passthrough.h"
+static std::default_random_engine random_engine;
+static std::uniform_real_distribution<> distribution(0.0, 1.0);
+#endif
+
 using namespace mavsdk;
 
 TEST(HardwareTest, LogFiles)
@@ -45,3 +54,53 @@ TEST(HardwareTest, LogFiles)
         }
     }
 }
+
+TEST(HardwareTest, LogFilesLossy)
+{
+    Mavsdk dc;
+
+    ConnectionResult ret = dc.add_udp_connection();
+    ASSERT_EQ(ret, ConnectionResult::SUCCESS);
+
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+
+    System& system = dc.system();
+    ASSERT_TRUE(system.has_autopilot());
+    auto log_files = std::make_shared<LogFiles>(system);
+
+    std::pair<LogFiles::Result, std::vector<LogFiles::Entry>> entry_result =
+        log_files->get_entries();
+    ASSERT_EQ(entry_result.first, LogFiles::Result::SUCCESS);
+    ASSERT_FALSE(entry_result.second.empty());
+
+#ifdef ENABLE_MAVLINK_PASSTHROUGH
+    // Lose 5% of the log data and of the requests for it.
+    auto mavlink_passthrough = std::make_shared<MavlinkPassthrough>(system);
+    mavlink_passthrough->intercept_incoming_messages_async([this](mavlink_message_t& message) {
+        if (message.msgid != MAVLINK_MSG_ID_LOG_DATA) {
+            return true;
+        }
+        return (distribution(random_engine) > 0.05);
+    });
+    mavlink_passthrough->intercept_outgoing_messages_async([this](mavlink_message_t& message) {
+        if (message.msgid != MAVLINK_MSG_ID_LOG_REQUEST_DATA) {
+            return true;
+        }
+        return (distribution(random_engine) > 0.05);
+    });
+#endif
+
+    const LogFiles::Entry& entry = entry_result.second.back();
+    const std::string file_path = "/tmp/logfile_lossy.ulog";
+
+    auto start = std::chrono::steady_clock::now();
+    LogFiles::Result download_ret = log_files->download_log_file(entry.id, file_path);
+    EXPECT_EQ(download_ret, LogFiles::Result::SUCCESS);
+    const double seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    LogInfo() << "Downloaded " << entry.size_bytes << " bytes in " << seconds << " s ("
+              << entry.size_bytes / seconds / 1024.0 << " KiB/s)";
+
+    remove(file_path.c_str());
+}
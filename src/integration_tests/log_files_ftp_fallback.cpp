@@ -0,0 +1,257 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/stat.h>
+
+#include "integration_test_helper.h"
+#include "global_include.h"
+#include "mavsdk.h"
+#include "system.h"
+#include "plugins/log_files/log_files.h"
+#include "plugins/mavlink_ftp/mavlink_ftp.h"
+#include "plugins/mavlink_passthrough/mavlink_passthrough.h"
+
+using namespace mavsdk;
+
+// 2020-01-20T12:30:01Z, the time PX4 would put into the name of the log.
+static constexpr uint32_t log_time_utc = 1579523401;
+static constexpr unsigned log_size = 10000;
+
+// An autopilot with one log, which answers the log protocol and claims to support
+// MAVLink FTP. Whether there is an FTP server with the log is up to the test.
+class FakeLogAutopilot {
+public:
+    FakeLogAutopilot(System& system, const std::string& log) :
+        _log(log),
+        _passthrough(std::make_shared<MavlinkPassthrough>(system))
+    {
+        _passthrough->subscribe_message_async(
+            MAVLINK_MSG_ID_LOG_REQUEST_LIST, [this](const mavlink_message_t&) {
+                mavlink_message_t message;
+                mavlink_msg_log_entry_pack(
+                    _passthrough->get_our_sysid(),
+                    _passthrough->get_our_compid(),
+                    &message,
+                    0,
+                    1,
+                    0,
+                    log_time_utc,
+                    static_cast<uint32_t>(_log.size()));
+                _passthrough->send_message(message);
+            });
+
+        _passthrough->subscribe_message_async(
+            MAVLINK_MSG_ID_LOG_REQUEST_DATA, [this](const mavlink_message_t& message) {
+                mavlink_log_request_data_t request;
+                mavlink_msg_log_request_data_decode(&message, &request);
+                ++_data_requests;
+                send_data(request.ofs, request.count);
+            });
+    }
+
+    void send_autopilot_version()
+    {
+        mavlink_autopilot_version_t autopilot_version{};
+        autopilot_version.capabilities =
+            MAV_PROTOCOL_CAPABILITY_MISSION_INT | MAV_PROTOCOL_CAPABILITY_FTP;
+
+        mavlink_message_t message;
+        mavlink_msg_autopilot_version_encode(
+            _passthrough->get_our_sysid(),
+            _passthrough->get_our_compid(),
+            &message,
+            &autopilot_version);
+        _passthrough->send_message(message);
+    }
+
+    unsigned data_requests() const { return _data_requests; }
+
+private:
+    void send_data(uint32_t offset, uint32_t count)
+    {
+        const uint32_t end = std::min<uint32_t>(offset + count, _log.size());
+        while (offset < end) {
+            const uint8_t length = static_cast<uint8_t>(std::min<uint32_t>(end - offset, 90));
+            uint8_t data[90]{};
+            std::copy(_log.begin() + offset, _log.begin() + offset + length, data);
+
+            mavlink_message_t message;
+            mavlink_msg_log_data_pack(
+                _passthrough->get_our_sysid(),
+                _passthrough->get_our_compid(),
+                &message,
+                0,
+                offset,
+                length,
+                data);
+            _passthrough->send_message(message);
+            offset += length;
+        }
+    }
+
+    const std::string _log;
+    std::atomic<unsigned> _data_requests{0};
+
+    // Last, so that no more messages arrive while the rest is destroyed.
+    std::shared_ptr<MavlinkPassthrough> _passthrough;
+};
+
+class LogFilesFtpFallbackTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        _mavsdk_gcs.set_configuration(Mavsdk::Configuration::GroundStation);
+        ASSERT_EQ(_mavsdk_gcs.add_udp_connection(24561), ConnectionResult::SUCCESS);
+
+        _mavsdk_autopilot.set_configuration(Mavsdk::Configuration::Autopilot);
+        ASSERT_EQ(
+            _mavsdk_autopilot.setup_udp_remote("127.0.0.1", 24561), ConnectionResult::SUCCESS);
+
+        for (unsigned i = 0; i < 50 && !_mavsdk_gcs.system().has_autopilot(); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        ASSERT_TRUE(_mavsdk_gcs.system().has_autopilot());
+
+        for (unsigned i = 0; i < log_size; ++i) {
+            _log.push_back(static_cast<char>(i * 7 + i / 256));
+        }
+        _autopilot.reset(new FakeLogAutopilot(_mavsdk_autopilot.system(), _log));
+        _autopilot->send_autopilot_version();
+
+        mkdir("log_files_dst", 0755);
+    }
+
+    void TearDown() override
+    {
+        _autopilot.reset();
+        remove("log_files_dst/log.ulg");
+        remove("log_files_dst/12_30_01.ulg");
+        remove("log_files_dst");
+    }
+
+    LogFiles::Result download_log(LogFiles& log_files)
+    {
+        const auto entries = log_files.get_entries();
+        EXPECT_EQ(entries.first, LogFiles::Result::SUCCESS);
+        if (entries.second.size() != 1) {
+            ADD_FAILURE() << "Expected one log entry, got " << entries.second.size();
+            return LogFiles::Result::NO_LOGFILES;
+        }
+        EXPECT_EQ(entries.second[0].date, "2020-01-20T12:30:01Z");
+
+        auto prom = std::make_shared<std::promise<LogFiles::Result>>();
+        auto fut = prom->get_future();
+        log_files.download_log_file_async(
+            entries.second[0].id, "log_files_dst/log.ulg", [prom](LogFiles::Result result, float) {
+                if (result != LogFiles::Result::PROGRESS) {
+                    prom->set_value(result);
+                }
+            });
+
+        if (fut.wait_for(std::chrono::seconds(30)) != std::future_status::ready) {
+            ADD_FAILURE() << "Download did not finish";
+            return LogFiles::Result::UNKNOWN;
+        }
+        return fut.get();
+    }
+
+    static std::string read_file(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    static void write_file(const std::string& path, const std::string& content)
+    {
+        std::ofstream file(path, std::fstream::trunc | std::fstream::binary);
+        file << content;
+    }
+
+    static bool exists(const std::string& path)
+    {
+        struct stat info;
+        return stat(path.c_str(), &info) == 0;
+    }
+
+    Mavsdk _mavsdk_gcs{};
+    Mavsdk _mavsdk_autopilot{};
+    std::string _log{};
+    std::unique_ptr<FakeLogAutopilot> _autopilot{};
+};
+
+TEST_F(LogFilesFtpFallbackTest, UsesLogProtocolWithoutFtpServer)
+{
+    LogFiles log_files(_mavsdk_gcs.system());
+
+    EXPECT_EQ(download_log(log_files), LogFiles::Result::SUCCESS);
+    EXPECT_EQ(read_file("log_files_dst/log.ulg"), _log);
+    EXPECT_GT(_autopilot->data_requests(), 0u);
+    EXPECT_FALSE(exists("log_files_dst/log.ulg.ftp"));
+}
+
+TEST_F(LogFilesFtpFallbackTest, UsesLogProtocolIfLogIsNotOnSdCard)
+{
+    mkdir("log_files_root", 0755);
+    mkdir("log_files_root/fs", 0755);
+    mkdir("log_files_root/fs/microsd", 0755);
+    mkdir("log_files_root/fs/microsd/log", 0755);
+    mkdir("log_files_root/fs/microsd/log/2020-01-20", 0755);
+    // Right name, but not the size of the entry.
+    write_file("log_files_root/fs/microsd/log/2020-01-20/12_30_01.ulg", "not the log");
+
+    auto mavlink_ftp_server = std::make_shared<MavlinkFTP>(_mavsdk_autopilot.system());
+    mavlink_ftp_server->set_root_dir("log_files_root");
+
+    LogFiles log_files(_mavsdk_gcs.system());
+
+    EXPECT_EQ(download_log(log_files), LogFiles::Result::SUCCESS);
+    EXPECT_EQ(read_file("log_files_dst/log.ulg"), _log);
+    EXPECT_GT(_autopilot->data_requests(), 0u);
+    EXPECT_FALSE(exists("log_files_dst/log.ulg.ftp"));
+
+    remove("log_files_root/fs/microsd/log/2020-01-20/12_30_01.ulg");
+    remove("log_files_root/fs/microsd/log/2020-01-20");
+    remove("log_files_root/fs/microsd/log");
+    remove("log_files_root/fs/microsd");
+    remove("log_files_root/fs");
+    remove("log_files_root");
+}
+
+TEST_F(LogFilesFtpFallbackTest, DownloadsOverFtpWithoutTouchingOtherFiles)
+{
+    mkdir("log_files_root", 0755);
+    mkdir("log_files_root/fs", 0755);
+    mkdir("log_files_root/fs/microsd", 0755);
+    mkdir("log_files_root/fs/microsd/log", 0755);
+    mkdir("log_files_root/fs/microsd/log/2020-01-20", 0755);
+    write_file("log_files_root/fs/microsd/log/2020-01-20/12_30_01.ulg", _log);
+
+    // Named like the remote log, it must not be replaced by the download.
+    write_file("log_files_dst/12_30_01.ulg", "unrelated");
+
+    auto mavlink_ftp_server = std::make_shared<MavlinkFTP>(_mavsdk_autopilot.system());
+    mavlink_ftp_server->set_root_dir("log_files_root");
+
+    LogFiles log_files(_mavsdk_gcs.system());
+
+    EXPECT_EQ(download_log(log_files), LogFiles::Result::SUCCESS);
+    EXPECT_EQ(read_file("log_files_dst/log.ulg"), _log);
+    EXPECT_EQ(_autopilot->data_requests(), 0u);
+    EXPECT_EQ(read_file("log_files_dst/12_30_01.ulg"), "unrelated");
+    EXPECT_FALSE(exists("log_files_dst/log.ulg.ftp"));
+
+    remove("log_files_root/fs/microsd/log/2020-01-20/12_30_01.ulg");
+    remove("log_files_root/fs/microsd/log/2020-01-20");
+    remove("log_files_root/fs/microsd/log");
+    remove("log_files_root/fs/microsd");
+    remove("log_files_root/fs");
+    remove("log_files_root");
+}
@@ -1,10 +1,15 @@
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <string>
 #include "mavsdk.h"
 #include "integration_test_helper.h"
 #include "plugins/logging/logging.h"
 
 using namespace mavsdk;
 
+static const char* log_file_path = "logging_test.ulg";
+
 TEST_F(SitlTest, Logging)
 {
     Mavsdk dc;
@@ -16,14 +21,14 @@ TEST_F(SitlTest, Logging)
 
     System& system = dc.system();
     auto logging = std::make_shared<Logging>(system);
-    Logging::Result log_ret = logging->start_logging();
+    Logging::Result log_ret = logging->start_logging(log_file_path);
 
     if (log_ret == Logging::Result::COMMAND_DENIED) {
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
         logging->stop_logging();
         // ASSERT_EQ(log_ret, Logging::Result::SUCCESS);
         std::this_thread::sleep_for(std::chrono::milliseconds(10));
-        log_ret = logging->start_logging();
+        log_ret = logging->start_logging(log_file_path);
     }
 
     ASSERT_EQ(log_ret, Logging::Result::SUCCESS);
@@ -34,4 +39,12 @@ TEST_F(SitlTest, Logging)
 
     log_ret = logging->stop_logging();
     ASSERT_EQ(log_ret, Logging::Result::SUCCESS);
+
+    // The file starts with the ULog magic.
+    std::ifstream file(log_file_path, std::ios::binary);
+    char magic[4]{};
+    file.read(magic, sizeof(magic));
+    EXPECT_EQ(std::string(magic, sizeof(magic)), "ULog");
+    file.close();
+    remove(log_file_path);
 }
@@ -5,6 +5,7 @@
 #include <vector>
 #include <atomic>
 #include <future>
+#include <sys/stat.h>
 
 #include "integration_test_helper.h"
 #include "global_include.h"
@@ -235,6 +236,57 @@ TEST(MavlinkFTPTest, DownloadFile)
     remove("dataman");
 }
 
+TEST(MavlinkFTPTest, DownloadFileBurstVsRead)
+{
+    Mavsdk mavsdk;
+
+    ConnectionResult ret = mavsdk.add_udp_connection();
+    ASSERT_EQ(ret, ConnectionResult::SUCCESS);
+    System& system = mavsdk.system();
+    auto mavlink_ftp = std::make_shared<MavlinkFTP>(system);
+    mavlink_ftp->set_timeout(50);
+    mavlink_ftp->set_retries(10);
+
+    // Wait for system to connect via heartbeat.
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    // Reset server in case there are stale open sessions
+    reset_server(mavlink_ftp);
+
+#ifdef ENABLE_MAVLINK_PASSTHROUGH
+    // Lose 5% in each direction, burst packets lost on the way are re-requested.
+    auto mavlink_passthrough = std::make_shared<MavlinkPassthrough>(system);
+    mavlink_passthrough->intercept_incoming_messages_async([this](mavlink_message_t& message) {
+        if (message.msgid != MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL) {
+            return true;
+        }
+        return (distribution(random_engine) > 0.05);
+    });
+    mavlink_passthrough->intercept_outgoing_messages_async([this](mavlink_message_t& message) {
+        if (message.msgid != MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL) {
+            return true;
+        }
+        return (distribution(random_engine) > 0.05);
+    });
+#endif
+
+    Time time;
+
+    mavlink_ftp->set_burst_download(false);
+    auto start_time = time.steady_time();
+    test_download(mavlink_ftp, "/dataman", ".");
+    const double read_s = time.elapsed_since_s(start_time);
+    remove("dataman");
+
+    mavlink_ftp->set_burst_download(true);
+    start_time = time.steady_time();
+    test_download(mavlink_ftp, "/dataman", ".");
+    const double burst_s = time.elapsed_since_s(start_time);
+    remove("dataman");
+
+    LogInfo() << "Downloaded " << _file_size << " bytes, read: " << read_s
+              << " s, burst: " << burst_s << " s";
+}
+
 TEST(MavlinkFTPTest, UploadFiles)
 {
     Mavsdk mavsdk;
@@ -301,6 +353,65 @@ TEST(MavlinkFTPTest, UploadFiles)
     }
 }
 
+TEST(MavlinkFTPTest, UploadFileWindowedVsSingle)
+{
+    Mavsdk mavsdk;
+
+    ConnectionResult ret = mavsdk.add_udp_connection();
+    ASSERT_EQ(ret, ConnectionResult::SUCCESS);
+    System& system = mavsdk.system();
+    auto mavlink_ftp = std::make_shared<MavlinkFTP>(system);
+    mavlink_ftp->set_timeout(50);
+    mavlink_ftp->set_retries(10);
+
+    // Wait for system to connect via heartbeat.
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    // Reset server in case there are stale open sessions
+    reset_server(mavlink_ftp);
+
+#ifdef ENABLE_MAVLINK_PASSTHROUGH
+    // Lose 5% in each direction, writes lost on the way are sent again.
+    auto mavlink_passthrough = std::make_shared<MavlinkPassthrough>(system);
+    mavlink_passthrough->intercept_incoming_messages_async([this](mavlink_message_t& message) {
+        if (message.msgid != MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL) {
+            return true;
+        }
+        return (distribution(random_engine) > 0.05);
+    });
+    mavlink_passthrough->intercept_outgoing_messages_async([this](mavlink_message_t& message) {
+        if (message.msgid != MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL) {
+            return true;
+        }
+        return (distribution(random_engine) > 0.05);
+    });
+#endif
+
+    test_create_directory(mavlink_ftp, "/test");
+
+    const std::string file_name = "test_file_window";
+    create_test_file(file_name, 100 * 1024);
+
+    Time time;
+
+    mavlink_ftp->set_upload_window(1);
+    auto start_time = time.steady_time();
+    test_upload(mavlink_ftp, file_name, "/test");
+    const double single_s = time.elapsed_since_s(start_time);
+    test_crc32(mavlink_ftp, file_name, "/test/" + file_name);
+
+    mavlink_ftp->set_upload_window(16);
+    start_time = time.steady_time();
+    test_upload(mavlink_ftp, file_name, "/test");
+    const double windowed_s = time.elapsed_since_s(start_time);
+    test_crc32(mavlink_ftp, file_name, "/test/" + file_name);
+
+    LogInfo() << "Uploaded " << _file_size << " bytes, one at a time: " << single_s
+              << " s, windowed: " << windowed_s << " s";
+
+    test_remove_file(mavlink_ftp, "/test/" + file_name);
+    remove(file_name.c_str());
+}
+
 TEST(MavlinkFTPTest, TestServer)
 {
     ConnectionResult ret;
@@ -380,3 +491,199 @@ TEST(MavlinkFTPTest, TestServer)
     result = test_remove_directory(mavlink_ftp_client, "test");
     EXPECT_EQ(result, MavlinkFTP::Result::SUCCESS);
 }
+
+static MavlinkFTP::Result test_sync_directory(
+    std::shared_ptr<MavlinkFTP> mavlink_ftp,
+    const std::string& remote_folder,
+    const std::string& local_folder,
+    uint32_t& bytes_total)
+{
+    auto prom = std::make_shared<std::promise<MavlinkFTP::Result>>();
+    auto future_result = prom->get_future();
+    auto total = std::make_shared<std::atomic<uint32_t>>(0);
+    mavlink_ftp->sync_directory_async(
+        remote_folder,
+        local_folder,
+        [total](uint32_t bytes_transferred, uint32_t total_bytes) {
+            EXPECT_LE(bytes_transferred, total_bytes);
+            *total = total_bytes;
+        },
+        [prom](MavlinkFTP::Result result) { prom->set_value(result); });
+
+    MavlinkFTP::Result result = future_result.get();
+    bytes_total = *total;
+    return result;
+}
+
+TEST(MavlinkFTPTest, SyncDirectory)
+{
+    ConnectionResult ret;
+
+    Mavsdk mavsdk_gcs;
+    mavsdk_gcs.set_configuration(Mavsdk::Configuration::GroundStation);
+    ret = mavsdk_gcs.add_udp_connection(24550);
+    ASSERT_EQ(ret, ConnectionResult::SUCCESS);
+    System& system_gcs = mavsdk_gcs.system();
+
+    Mavsdk mavsdk_cc;
+    mavsdk_cc.set_configuration(Mavsdk::Configuration::CompanionComputer);
+    ret = mavsdk_cc.setup_udp_remote("127.0.0.1", 24550);
+    ASSERT_EQ(ret, ConnectionResult::SUCCESS);
+    System& system_cc = mavsdk_cc.system();
+
+    auto mavlink_ftp_server = std::make_shared<MavlinkFTP>(system_cc);
+    mavlink_ftp_server->set_root_dir(".");
+    uint8_t server_comp_id = mavlink_ftp_server->get_our_compid();
+
+    auto mavlink_ftp_client = std::make_shared<MavlinkFTP>(system_gcs);
+    mavlink_ftp_client->set_target_component_id(server_comp_id);
+    mavlink_ftp_client->set_timeout(50);
+    mavlink_ftp_client->set_retries(10);
+
+    const std::vector<std::string> file_names{
+        "sync_src/file1", "sync_src/file2", "sync_src/sub/file3", "sync_src/sub/file4"};
+    mkdir("sync_src", 0755);
+    mkdir("sync_src/sub", 0755);
+    uint32_t size = 10000;
+    for (const auto& file_name : file_names) {
+        create_test_file(file_name, size);
+        size += 5000;
+    }
+
+    uint32_t bytes_total;
+    EXPECT_EQ(
+        test_sync_directory(mavlink_ftp_client, "sync_src", "sync_dst", bytes_total),
+        MavlinkFTP::Result::SUCCESS);
+    EXPECT_EQ(bytes_total, 10000u + 15000u + 20000u + 25000u);
+
+    for (const auto& file_name : file_names) {
+        const std::string synced_name = "sync_dst" + file_name.substr(std::strlen("sync_src"));
+        uint32_t crc1;
+        EXPECT_EQ(
+            mavlink_ftp_client->calc_local_file_crc32(file_name, crc1),
+            MavlinkFTP::Result::SUCCESS);
+        uint32_t crc2;
+        EXPECT_EQ(
+            mavlink_ftp_client->calc_local_file_crc32(synced_name, crc2),
+            MavlinkFTP::Result::SUCCESS);
+        EXPECT_EQ(crc1, crc2);
+    }
+
+    // Nothing changed, so nothing is downloaded again.
+    EXPECT_EQ(
+        test_sync_directory(mavlink_ftp_client, "sync_src", "sync_dst", bytes_total),
+        MavlinkFTP::Result::SUCCESS);
+    EXPECT_EQ(bytes_total, 0u);
+
+    // Only the file changed is.
+    create_test_file(file_names[2], 12345);
+    EXPECT_EQ(
+        test_sync_directory(mavlink_ftp_client, "sync_src", "sync_dst", bytes_total),
+        MavlinkFTP::Result::SUCCESS);
+    EXPECT_EQ(bytes_total, 12345u);
+
+    for (const auto& file_name : file_names) {
+        remove(file_name.c_str());
+        remove(("sync_dst" + file_name.substr(std::strlen("sync_src"))).c_str());
+    }
+    remove("sync_dst/.mavlink_ftp_sync");
+    remove("sync_src/sub");
+    remove("sync_src");
+    remove("sync_dst/sub");
+    remove("sync_dst");
+}
+
+static MavlinkFTP::Result test_resume_download(
+    std::shared_ptr<MavlinkFTP> mavlink_ftp,
+    const std::string& remote_file,
+    const std::string& local_path,
+    uint32_t& first_progress)
+{
+    auto first = std::make_shared<std::atomic<uint32_t>>(UINT32_MAX);
+    auto prom = std::make_shared<std::promise<MavlinkFTP::Result>>();
+    auto future_result = prom->get_future();
+    mavlink_ftp->download_async(
+        remote_file,
+        local_path,
+        [first](uint32_t bytes_transferred, uint32_t) {
+            uint32_t expected = UINT32_MAX;
+            first->compare_exchange_strong(expected, bytes_transferred);
+        },
+        [prom](MavlinkFTP::Result result) { prom->set_value(result); });
+
+    MavlinkFTP::Result result = future_result.get();
+    first_progress = *first;
+    return result;
+}
+
+static void create_partial_download(
+    const std::string& remote_file, const std::string& local_file, uint32_t size, char fill)
+{
+    std::ofstream of(local_file, std::fstream::trunc | std::fstream::binary);
+    of << std::string(20000, fill);
+    std::ofstream checkpoint(local_file + ".ftp_resume", std::fstream::trunc);
+    checkpoint << remote_file << '\n' << size << '\n' << "0 20000\n";
+}
+
+TEST(MavlinkFTPTest, ResumeDownload)
+{
+    ConnectionResult ret;
+
+    Mavsdk mavsdk_gcs;
+    mavsdk_gcs.set_configuration(Mavsdk::Configuration::GroundStation);
+    ret = mavsdk_gcs.add_udp_connection(24550);
+    ASSERT_EQ(ret, ConnectionResult::SUCCESS);
+    System& system_gcs = mavsdk_gcs.system();
+
+    Mavsdk mavsdk_cc;
+    mavsdk_cc.set_configuration(Mavsdk::Configuration::CompanionComputer);
+    ret = mavsdk_cc.setup_udp_remote("127.0.0.1", 24550);
+    ASSERT_EQ(ret, ConnectionResult::SUCCESS);
+    System& system_cc = mavsdk_cc.system();
+
+    auto mavlink_ftp_server = std::make_shared<MavlinkFTP>(system_cc);
+    mavlink_ftp_server->set_root_dir(".");
+    uint8_t server_comp_id = mavlink_ftp_server->get_our_compid();
+
+    auto mavlink_ftp_client = std::make_shared<MavlinkFTP>(system_gcs);
+    mavlink_ftp_client->set_target_component_id(server_comp_id);
+    mavlink_ftp_client->set_timeout(50);
+    mavlink_ftp_client->set_retries(10);
+
+    mkdir("resume_src", 0755);
+    mkdir("resume_dst", 0755);
+    const std::string remote_file = "resume_src/file";
+    const std::string local_file = "resume_dst/file";
+    create_test_file(remote_file, 50000);
+
+    // The first 20000 bytes are there already, so the download continues after them.
+    uint32_t first_progress;
+    create_partial_download(remote_file, local_file, 50000, 'X');
+    EXPECT_EQ(
+        test_resume_download(mavlink_ftp_client, remote_file, "resume_dst", first_progress),
+        MavlinkFTP::Result::SUCCESS);
+    EXPECT_EQ(first_progress, 20000u);
+    test_crc32(mavlink_ftp_client, local_file, remote_file);
+    EXPECT_FALSE(std::ifstream(local_file + ".ftp_resume").good());
+
+    // The partial file does not match the remote one, so it is downloaded again.
+    create_partial_download(remote_file, local_file, 50000, 'Y');
+    EXPECT_EQ(
+        test_resume_download(mavlink_ftp_client, remote_file, "resume_dst", first_progress),
+        MavlinkFTP::Result::SUCCESS);
+    EXPECT_EQ(first_progress, 0u);
+    test_crc32(mavlink_ftp_client, local_file, remote_file);
+
+    // Neither is a checkpoint of a file with another size.
+    create_partial_download(remote_file, local_file, 40000, 'X');
+    EXPECT_EQ(
+        test_resume_download(mavlink_ftp_client, remote_file, "resume_dst", first_progress),
+        MavlinkFTP::Result::SUCCESS);
+    EXPECT_EQ(first_progress, 0u);
+    test_crc32(mavlink_ftp_client, local_file, remote_file);
+
+    remove(remote_file.c_str());
+    remove(local_file.c_str());
+    remove("resume_src");
+    remove("resume_dst");
+}
@@ -0,0 +1,372 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "integration_test_helper.h"
+#include "global_include.h"
+#include "mavsdk.h"
+#include "system.h"
+#include "plugins/mission/mission.h"
+#include "plugins/mission_raw/mission_raw.h"
+#include "plugins/mavlink_passthrough/mavlink_passthrough.h"
+
+using namespace mavsdk;
+
+// A mission of waypoints only, so that it can be downloaded with Mission as well.
+static constexpr unsigned mission_count = 20;
+
+// Answers mission downloads like an autopilot would. Requests are collected and
+// answered in batches, so that the ones sent ahead of the first missing item
+// can be told apart from the ones sent after the previous item arrived.
+class FakeAutopilot {
+public:
+    enum class Mode {
+        OutOfOrder, ///< Answers the requests of a batch in reverse order
+        InOrderOnly ///< Aborts on a request which is not for the next item, like PX4
+    };
+
+    FakeAutopilot(System& system, Mode mode) :
+        _mode(mode),
+        _passthrough(std::make_shared<MavlinkPassthrough>(system))
+    {
+        _passthrough->subscribe_message_async(
+            MAVLINK_MSG_ID_MISSION_REQUEST_LIST, [this](const mavlink_message_t&) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _downloads.push_back(Download{});
+                _requests.clear();
+                _next_seq = 0;
+                _aborted = false;
+                send_count();
+            });
+
+        _passthrough->subscribe_message_async(
+            MAVLINK_MSG_ID_MISSION_REQUEST_INT, [this](const mavlink_message_t& message) {
+                mavlink_mission_request_int_t request;
+                mavlink_msg_mission_request_int_decode(&message, &request);
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_downloads.empty()) {
+                    return;
+                }
+                ++_downloads.back().requests[request.seq];
+                auto& lost = _downloads.back().lost;
+                if (_lost_seq == request.seq && _downloads.size() <= _lost_downloads &&
+                    lost.insert(request.seq).second) {
+                    return;
+                }
+                _requests.push_back(request.seq);
+            });
+
+        _worker = std::thread([this]() {
+            while (!_should_exit) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                answer_requests();
+            }
+        });
+    }
+
+    ~FakeAutopilot()
+    {
+        _should_exit = true;
+        _worker.join();
+    }
+
+    // The first request for `seq` gets lost during the first `downloads` downloads.
+    void lose_request(unsigned seq, unsigned downloads)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _lost_seq = seq;
+        _lost_downloads = downloads;
+    }
+
+    // How often the download was started, including the restarts.
+    unsigned downloads() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return static_cast<unsigned>(_downloads.size());
+    }
+
+    // Most requests answered at once during a download, 1 if requested in order.
+    unsigned max_batch(unsigned download) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return download < _downloads.size() ? _downloads[download].max_batch : 0;
+    }
+
+    // How often an item was requested during a download, including lost requests.
+    unsigned requests(unsigned download, unsigned seq) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (download >= _downloads.size()) {
+            return 0;
+        }
+        const auto it = _downloads[download].requests.find(seq);
+        return it != _downloads[download].requests.end() ? it->second : 0;
+    }
+
+private:
+    struct Download {
+        unsigned max_batch{0};
+        std::set<unsigned> lost{};
+        std::map<unsigned, unsigned> requests{};
+    };
+
+    void answer_requests()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_requests.empty() || _downloads.empty()) {
+            return;
+        }
+
+        std::vector<unsigned> requests;
+        requests.swap(_requests);
+        auto& download = _downloads.back();
+        download.max_batch =
+            std::max(download.max_batch, static_cast<unsigned>(requests.size()));
+
+        if (_mode == Mode::OutOfOrder) {
+            for (auto it = requests.rbegin(); it != requests.rend(); ++it) {
+                send_item(*it);
+            }
+            return;
+        }
+
+        for (const unsigned seq : requests) {
+            if (_aborted) {
+                return;
+            }
+            if (seq == _next_seq) {
+                send_item(seq);
+                ++_next_seq;
+            } else if (seq + 1 == _next_seq) {
+                // The previous item got lost, it's sent again.
+                send_item(seq);
+            } else {
+                _aborted = true;
+                send_ack(MAV_MISSION_ERROR);
+            }
+        }
+    }
+
+    void send_count()
+    {
+        mavlink_message_t message;
+        mavlink_msg_mission_count_pack(
+            _passthrough->get_our_sysid(),
+            _passthrough->get_our_compid(),
+            &message,
+            _passthrough->get_target_sysid(),
+            _passthrough->get_target_compid(),
+            mission_count,
+            MAV_MISSION_TYPE_MISSION);
+        _passthrough->send_message(message);
+    }
+
+    void send_item(unsigned seq)
+    {
+        mavlink_message_t message;
+        mavlink_msg_mission_item_int_pack(
+            _passthrough->get_our_sysid(),
+            _passthrough->get_our_compid(),
+            &message,
+            _passthrough->get_target_sysid(),
+            _passthrough->get_target_compid(),
+            static_cast<uint16_t>(seq),
+            MAV_FRAME_GLOBAL_RELATIVE_ALT_INT,
+            MAV_CMD_NAV_WAYPOINT,
+            seq == 0 ? 1 : 0,
+            1,
+            0.0f,
+            0.0f,
+            0.0f,
+            NAN,
+            static_cast<int32_t>((47.3977 + seq * 1e-5) * 1e7),
+            static_cast<int32_t>(8.5456 * 1e7),
+            10.0f + seq,
+            MAV_MISSION_TYPE_MISSION);
+        _passthrough->send_message(message);
+    }
+
+    void send_ack(uint8_t type)
+    {
+        mavlink_message_t message;
+        mavlink_msg_mission_ack_pack(
+            _passthrough->get_our_sysid(),
+            _passthrough->get_our_compid(),
+            &message,
+            _passthrough->get_target_sysid(),
+            _passthrough->get_target_compid(),
+            type,
+            MAV_MISSION_TYPE_MISSION);
+        _passthrough->send_message(message);
+    }
+
+    const Mode _mode;
+
+    mutable std::mutex _mutex{};
+    std::vector<Download> _downloads{};
+    std::vector<unsigned> _requests{};
+    unsigned _next_seq{0};
+    bool _aborted{false};
+    unsigned _lost_seq{0};
+    unsigned _lost_downloads{0};
+
+    std::atomic<bool> _should_exit{false};
+    std::thread _worker{};
+
+    // Last, so that no more messages arrive while the rest is destroyed.
+    std::shared_ptr<MavlinkPassthrough> _passthrough;
+};
+
+class MissionDownloadWindowTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        _mavsdk_gcs.set_configuration(Mavsdk::Configuration::GroundStation);
+        ASSERT_EQ(_mavsdk_gcs.add_udp_connection(24560), ConnectionResult::SUCCESS);
+
+        _mavsdk_autopilot.set_configuration(Mavsdk::Configuration::Autopilot);
+        ASSERT_EQ(
+            _mavsdk_autopilot.setup_udp_remote("127.0.0.1", 24560), ConnectionResult::SUCCESS);
+
+        for (unsigned i = 0; i < 50 && !_mavsdk_gcs.system().has_autopilot(); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        ASSERT_TRUE(_mavsdk_gcs.system().has_autopilot());
+    }
+
+    std::vector<std::shared_ptr<MissionItem>> download_mission(Mission::Result& result)
+    {
+        Mission mission(_mavsdk_gcs.system());
+        // Only shared state is captured, the callback may come after we gave up waiting.
+        auto prom = std::make_shared<std::promise<
+            std::pair<Mission::Result, std::vector<std::shared_ptr<MissionItem>>>>>();
+        auto fut = prom->get_future();
+
+        mission.download_mission_async(
+            [prom](Mission::Result result_, std::vector<std::shared_ptr<MissionItem>> items) {
+                prom->set_value(std::make_pair(result_, items));
+            });
+
+        if (fut.wait_for(std::chrono::seconds(20)) != std::future_status::ready) {
+            ADD_FAILURE() << "Mission download did not finish";
+            result = Mission::Result::TIMEOUT;
+            return {};
+        }
+        const auto downloaded = fut.get();
+        result = downloaded.first;
+        return downloaded.second;
+    }
+
+    static void expect_mission(const std::vector<std::shared_ptr<MissionItem>>& mission_items)
+    {
+        ASSERT_EQ(mission_items.size(), mission_count);
+        for (unsigned seq = 0; seq < mission_count; ++seq) {
+            EXPECT_NEAR(mission_items[seq]->get_latitude_deg(), 47.3977 + seq * 1e-5, 1e-6);
+            EXPECT_FLOAT_EQ(mission_items[seq]->get_relative_altitude_m(), 10.0f + seq);
+        }
+    }
+
+    Mavsdk _mavsdk_gcs{};
+    Mavsdk _mavsdk_autopilot{};
+};
+
+TEST_F(MissionDownloadWindowTest, DownloadsItemsAnsweredOutOfOrder)
+{
+    FakeAutopilot autopilot(_mavsdk_autopilot.system(), FakeAutopilot::Mode::OutOfOrder);
+
+    Mission::Result result = Mission::Result::UNKNOWN;
+    const auto mission_items = download_mission(result);
+
+    EXPECT_EQ(result, Mission::Result::SUCCESS);
+    expect_mission(mission_items);
+    // Items were requested ahead and the download never started over.
+    EXPECT_EQ(autopilot.downloads(), 1u);
+    EXPECT_GT(autopilot.max_batch(0), 1u);
+}
+
+TEST_F(MissionDownloadWindowTest, RequestsOnlyMissingItemAgain)
+{
+    // Like ArduPilot, which answers requests in any order and does not abort.
+    FakeAutopilot autopilot(_mavsdk_autopilot.system(), FakeAutopilot::Mode::OutOfOrder);
+    autopilot.lose_request(3, 1);
+
+    Mission::Result result = Mission::Result::UNKNOWN;
+    const auto mission_items = download_mission(result);
+
+    EXPECT_EQ(result, Mission::Result::SUCCESS);
+    expect_mission(mission_items);
+    // Neither started over, nor were the items received requested again.
+    EXPECT_EQ(autopilot.downloads(), 1u);
+    EXPECT_GT(autopilot.max_batch(0), 1u);
+    for (unsigned seq = 0; seq < mission_count; ++seq) {
+        EXPECT_EQ(autopilot.requests(0, seq), seq == 3 ? 2u : 1u) << "seq " << seq;
+    }
+}
+
+TEST_F(MissionDownloadWindowTest, KeepsWindowAfterRejectedRequest)
+{
+    FakeAutopilot autopilot(_mavsdk_autopilot.system(), FakeAutopilot::Mode::InOrderOnly);
+    autopilot.lose_request(3, 1);
+
+    Mission::Result result = Mission::Result::UNKNOWN;
+    const auto mission_items = download_mission(result);
+
+    EXPECT_EQ(result, Mission::Result::SUCCESS);
+    expect_mission(mission_items);
+    // Started over once, still with items requested ahead.
+    EXPECT_EQ(autopilot.downloads(), 2u);
+    EXPECT_GT(autopilot.max_batch(1), 1u);
+}
+
+TEST_F(MissionDownloadWindowTest, DownloadsInOrderAfterRepeatedRejections)
+{
+    FakeAutopilot autopilot(_mavsdk_autopilot.system(), FakeAutopilot::Mode::InOrderOnly);
+    autopilot.lose_request(3, 2);
+
+    Mission::Result result = Mission::Result::UNKNOWN;
+    const auto mission_items = download_mission(result);
+
+    EXPECT_EQ(result, Mission::Result::SUCCESS);
+    expect_mission(mission_items);
+    // The window is kept after the first failure, and dropped after the second.
+    EXPECT_EQ(autopilot.downloads(), 3u);
+    EXPECT_GT(autopilot.max_batch(1), 1u);
+    EXPECT_EQ(autopilot.max_batch(2), 1u);
+}
+
+TEST_F(MissionDownloadWindowTest, MissionRawKeepsWindowAfterRejectedRequest)
+{
+    FakeAutopilot autopilot(_mavsdk_autopilot.system(), FakeAutopilot::Mode::InOrderOnly);
+    autopilot.lose_request(3, 1);
+
+    MissionRaw mission_raw(_mavsdk_gcs.system());
+    typedef std::vector<std::shared_ptr<MissionRaw::MavlinkMissionItemInt>> MissionItems;
+    auto prom = std::make_shared<std::promise<std::pair<MissionRaw::Result, MissionItems>>>();
+    auto fut = prom->get_future();
+
+    mission_raw.download_mission_async(
+        [prom](MissionRaw::Result result, MissionItems items) {
+            prom->set_value(std::make_pair(result, items));
+        });
+    ASSERT_EQ(fut.wait_for(std::chrono::seconds(20)), std::future_status::ready);
+
+    const auto downloaded = fut.get();
+    const MissionRaw::Result result = downloaded.first;
+    const MissionItems& mission_items = downloaded.second;
+    EXPECT_EQ(result, MissionRaw::Result::SUCCESS);
+    ASSERT_EQ(mission_items.size(), mission_count);
+    for (unsigned seq = 0; seq < mission_count; ++seq) {
+        EXPECT_EQ(mission_items[seq]->seq, seq);
+    }
+    EXPECT_EQ(autopilot.downloads(), 2u);
+    EXPECT_GT(autopilot.max_batch(1), 1u);
+}
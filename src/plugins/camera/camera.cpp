@@ -87,6 +87,12 @@ void Camera::subscribe_video_stream_info(const subscribe_video_stream_info_callb
     _impl->subscribe_video_stream_info(callback);
 }
 
+Camera::SubscriptionHandle
+Camera::add_video_stream_info_subscriber(const subscribe_video_stream_info_callback_t& callback)
+{
+    return _impl->add_video_stream_info_subscriber(callback);
+}
+
 void Camera::stop_video_async(const result_callback_t& callback)
 {
     _impl->stop_video_async(callback);
@@ -107,11 +113,21 @@ void Camera::get_mode_async(const mode_callback_t& callback)
     _impl->get_mode_async(callback);
 }
 
+void Camera::unsubscribe(SubscriptionHandle handle)
+{
+    _impl->unsubscribe(handle);
+}
+
 void Camera::subscribe_mode(const subscribe_mode_callback_t callback)
 {
     _impl->subscribe_mode(callback);
 }
 
+Camera::SubscriptionHandle Camera::add_mode_subscriber(const subscribe_mode_callback_t& callback)
+{
+    return _impl->add_mode_subscriber(callback);
+}
+
 void Camera::get_status_async(get_status_callback_t callback)
 {
     _impl->get_status_async(callback);
@@ -122,11 +138,23 @@ void Camera::subscribe_status(const Camera::subscribe_status_callback_t callback
     _impl->subscribe_status(callback);
 }
 
+Camera::SubscriptionHandle
+Camera::add_status_subscriber(const subscribe_status_callback_t& callback)
+{
+    return _impl->add_status_subscriber(callback);
+}
+
 void Camera::subscribe_capture_info(capture_info_callback_t callback)
 {
     _impl->subscribe_capture_info(callback);
 }
 
+Camera::SubscriptionHandle
+Camera::add_capture_info_subscriber(const capture_info_callback_t& callback)
+{
+    return _impl->add_capture_info_subscriber(callback);
+}
+
 void Camera::set_option_async(
     const result_callback_t& callback, const std::string& setting_id, const Option& option)
 {
@@ -164,12 +192,24 @@ void Camera::subscribe_current_settings(const subscribe_current_settings_callbac
     _impl->subscribe_current_settings(callback);
 }
 
+Camera::SubscriptionHandle
+Camera::add_current_settings_subscriber(const subscribe_current_settings_callback_t& callback)
+{
+    return _impl->add_current_settings_subscriber(callback);
+}
+
 void Camera::subscribe_possible_setting_options(
     const subscribe_possible_setting_options_callback_t& callback)
 {
     _impl->subscribe_possible_setting_options(callback);
 }
 
+Camera::SubscriptionHandle Camera::add_possible_setting_options_subscriber(
+    const subscribe_possible_setting_options_callback_t& callback)
+{
+    return _impl->add_possible_setting_options_subscriber(callback);
+}
+
 Camera::Result Camera::format_storage()
 {
     return _impl->format_storage();
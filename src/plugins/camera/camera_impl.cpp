@@ -68,31 +68,31 @@ void CameraImpl::init()
 void CameraImpl::deinit()
 {
     _parent->remove_call_every(_check_connection_status_call_every_cookie);
-    _parent->remove_call_every(_status.call_every_cookie);
     _parent->unregister_all_mavlink_message_handlers(this);
     _parent->cancel_all_param(this);
 
     {
         std::lock_guard<std::mutex> lock(_status.mutex);
         _status.status_callback = nullptr;
-        _status.subscription_callback = nullptr;
+        _status.subscriptions.clear();
+        _parent->remove_call_every(_status.call_every_cookie);
+        _status.call_every_cookie = nullptr;
     }
 
     {
         std::lock_guard<std::mutex> lock(_mode.mutex);
         _mode.callback = nullptr;
-        _mode.subscription_callback = nullptr;
+        _mode.subscriptions.clear();
     }
 
-    {
-        std::lock_guard<std::mutex> lock(_capture_info.mutex);
-        _capture_info.callback = nullptr;
-    }
+    _capture_info_subscriptions.clear();
 
     {
         std::lock_guard<std::mutex> lock(_video_stream_info.mutex);
         _video_stream_info.callback = nullptr;
-        _video_stream_info.subscription_callback = nullptr;
+        _video_stream_info.subscriptions.clear();
+        _parent->remove_call_every(_video_stream_info.call_every_cookie);
+        _video_stream_info.call_every_cookie = nullptr;
     }
 
     {
@@ -100,15 +100,8 @@ void CameraImpl::deinit()
         //_information.callback = nullptr;
     }
 
-    {
-        std::lock_guard<std::mutex> lock(_subscribe_current_settings.mutex);
-        _subscribe_current_settings.callback = nullptr;
-    }
-
-    {
-        std::lock_guard<std::mutex> lock(_subscribe_possible_setting_options.mutex);
-        _subscribe_possible_setting_options.callback = nullptr;
-    }
+    _subscribe_current_settings.subscriptions.clear();
+    _subscribe_possible_setting_options.subscriptions.clear();
 
     _camera_found = false;
 }
@@ -557,17 +550,34 @@ void CameraImpl::get_video_stream_info_timeout()
 
 void CameraImpl::subscribe_video_stream_info(
     const Camera::subscribe_video_stream_info_callback_t callback)
+{
+    _video_stream_info.subscriptions.set_single(callback);
+    update_video_stream_info_polling();
+}
+
+uint64_t CameraImpl::add_video_stream_info_subscriber(
+    const Camera::subscribe_video_stream_info_callback_t& callback)
+{
+    const uint64_t handle = _video_stream_info.subscriptions.subscribe(callback);
+    update_video_stream_info_polling();
+    return handle;
+}
+
+void CameraImpl::update_video_stream_info_polling()
 {
     std::lock_guard<std::mutex> lock(_video_stream_info.mutex);
 
-    _video_stream_info.subscription_callback = callback;
-    if (callback) {
+    if (!_video_stream_info.subscriptions.empty() &&
+        _video_stream_info.call_every_cookie == nullptr) {
         _parent->add_call_every(
             [this]() { get_video_stream_info_async(nullptr); },
             1.0,
             &_video_stream_info.call_every_cookie);
-    } else {
+    } else if (
+        _video_stream_info.subscriptions.empty() &&
+        _video_stream_info.call_every_cookie != nullptr) {
         _parent->remove_call_every(_video_stream_info.call_every_cookie);
+        _video_stream_info.call_every_cookie = nullptr;
     }
 }
 
@@ -669,8 +679,12 @@ void CameraImpl::get_mode_async(Camera::mode_callback_t callback)
 
 void CameraImpl::subscribe_mode(const Camera::subscribe_mode_callback_t callback)
 {
-    std::lock_guard<std::mutex> lock(_mode.mutex);
-    _mode.subscription_callback = callback;
+    _mode.subscriptions.set_single(callback);
+}
+
+uint64_t CameraImpl::add_mode_subscriber(const Camera::subscribe_mode_callback_t& callback)
+{
+    return _mode.subscriptions.subscribe(callback);
 }
 
 bool CameraImpl::interval_valid(float interval_s)
@@ -720,16 +734,48 @@ void CameraImpl::get_status_async(Camera::get_status_callback_t callback)
 }
 
 void CameraImpl::subscribe_status(const Camera::subscribe_status_callback_t callback)
+{
+    _status.subscriptions.set_single(callback);
+    update_status_polling();
+}
+
+uint64_t CameraImpl::add_status_subscriber(const Camera::subscribe_status_callback_t& callback)
+{
+    const uint64_t handle = _status.subscriptions.subscribe(callback);
+    update_status_polling();
+    return handle;
+}
+
+void CameraImpl::update_status_polling()
 {
     std::lock_guard<std::mutex> lock(_status.mutex);
 
-    _status.subscription_callback = callback;
-    if (callback) {
+    if (!_status.subscriptions.empty() && _status.call_every_cookie == nullptr) {
         _parent->add_call_every(
             [this]() { get_status_async(nullptr); }, 1.0, &_status.call_every_cookie);
-    } else {
+    } else if (_status.subscriptions.empty() && _status.call_every_cookie != nullptr) {
         _parent->remove_call_every(_status.call_every_cookie);
+        _status.call_every_cookie = nullptr;
+    }
+}
+
+void CameraImpl::unsubscribe(uint64_t handle)
+{
+    if (_video_stream_info.subscriptions.unsubscribe(handle)) {
+        update_video_stream_info_polling();
+        return;
     }
+
+    if (_status.subscriptions.unsubscribe(handle)) {
+        update_status_polling();
+        return;
+    }
+
+    // Handles are unique, so at most one of these lists knows it.
+    _mode.subscriptions.unsubscribe(handle);
+    _capture_info_subscriptions.unsubscribe(handle);
+    _subscribe_current_settings.subscriptions.unsubscribe(handle);
+    _subscribe_possible_setting_options.subscriptions.unsubscribe(handle);
 }
 
 void CameraImpl::receive_camera_capture_status_result(MAVLinkCommands::Result result)
@@ -756,8 +802,12 @@ void CameraImpl::receive_camera_capture_status_result(MAVLinkCommands::Result re
 
 void CameraImpl::subscribe_capture_info(Camera::capture_info_callback_t callback)
 {
-    std::lock_guard<std::mutex> lock(_capture_info.mutex);
-    _capture_info.callback = callback;
+    _capture_info_subscriptions.set_single(callback);
+}
+
+uint64_t CameraImpl::add_capture_info_subscriber(const Camera::capture_info_callback_t& callback)
+{
+    return _capture_info_subscriptions.subscribe(callback);
 }
 
 void CameraImpl::process_camera_capture_status(const mavlink_message_t& message)
@@ -806,31 +856,27 @@ void CameraImpl::process_camera_image_captured(const mavlink_message_t& message)
     mavlink_camera_image_captured_t image_captured;
     mavlink_msg_camera_image_captured_decode(&message, &image_captured);
 
-    {
-        std::lock_guard<std::mutex> lock(_capture_info.mutex);
-
-        if (_capture_info.callback) {
-            Camera::CaptureInfo capture_info = {};
-            capture_info.position.latitude_deg = image_captured.lat / 1e7;
-            capture_info.position.longitude_deg = image_captured.lon / 1e7;
-            capture_info.position.absolute_altitude_m = image_captured.alt / 1e3f;
-            capture_info.position.relative_altitude_m = image_captured.relative_alt / 1e3f;
-            capture_info.time_utc_us = image_captured.time_utc;
-            capture_info.attitude_quaternion.w = image_captured.q[0];
-            capture_info.attitude_quaternion.x = image_captured.q[1];
-            capture_info.attitude_quaternion.y = image_captured.q[2];
-            capture_info.attitude_quaternion.z = image_captured.q[3];
-            capture_info.attitude_euler_angle =
-                to_euler_angle_from_quaternion(capture_info.attitude_quaternion);
-            capture_info.file_url = std::string(image_captured.file_url);
-            capture_info.success = (image_captured.capture_result == 1);
-            capture_info.index = image_captured.image_index;
-
-            const auto temp_callback = _capture_info.callback;
-            _parent->call_user_callback(
-                [temp_callback, capture_info]() { temp_callback(capture_info); });
-        }
+    if (_capture_info_subscriptions.empty()) {
+        return;
     }
+
+    Camera::CaptureInfo capture_info = {};
+    capture_info.position.latitude_deg = image_captured.lat / 1e7;
+    capture_info.position.longitude_deg = image_captured.lon / 1e7;
+    capture_info.position.absolute_altitude_m = image_captured.alt / 1e3f;
+    capture_info.position.relative_altitude_m = image_captured.relative_alt / 1e3f;
+    capture_info.time_utc_us = image_captured.time_utc;
+    capture_info.attitude_quaternion.w = image_captured.q[0];
+    capture_info.attitude_quaternion.x = image_captured.q[1];
+    capture_info.attitude_quaternion.y = image_captured.q[2];
+    capture_info.attitude_quaternion.z = image_captured.q[3];
+    capture_info.attitude_euler_angle =
+        to_euler_angle_from_quaternion(capture_info.attitude_quaternion);
+    capture_info.file_url = std::string(image_captured.file_url);
+    capture_info.success = (image_captured.capture_result == 1);
+    capture_info.index = image_captured.image_index;
+
+    notify(_capture_info_subscriptions, capture_info);
 }
 
 Camera::CaptureInfo::EulerAngle
@@ -1003,11 +1049,7 @@ void CameraImpl::process_flight_information(const mavlink_message_t& message)
 void CameraImpl::notify_video_stream_info()
 {
     std::lock_guard<std::mutex> lock(_video_stream_info.mutex);
-    if (_video_stream_info.subscription_callback) {
-        const auto temp_callback = _video_stream_info.subscription_callback;
-        const auto temp_info = _video_stream_info.info;
-        _parent->call_user_callback([temp_callback, temp_info]() { temp_callback(temp_info); });
-    }
+    notify(_video_stream_info.subscriptions, _video_stream_info.info);
 }
 
 void CameraImpl::check_status()
@@ -1025,11 +1067,7 @@ void CameraImpl::check_status()
             _parent->unregister_timeout_handler(_status.timeout_cookie);
         }
 
-        if (_status.subscription_callback) {
-            const auto temp_callback = _status.subscription_callback;
-            const auto temp_data = _status.data;
-            _parent->call_user_callback([temp_callback, temp_data]() { temp_callback(temp_data); });
-        }
+        notify(_status.subscriptions, _status.data);
 
         _status.received_camera_capture_status = false;
         _status.received_storage_information = false;
@@ -1116,14 +1154,7 @@ void CameraImpl::receive_set_mode_command_result(
 
 void CameraImpl::notify_mode(const Camera::Mode mode)
 {
-    // Make a copy because it is passed to the thread pool
-    const auto temp_callback = _mode.subscription_callback;
-
-    if (temp_callback == nullptr) {
-        return;
-    }
-
-    _parent->call_user_callback([mode, temp_callback]() { temp_callback(mode); });
+    notify(_mode.subscriptions, mode);
 }
 
 void CameraImpl::receive_get_mode_command_result(MAVLinkCommands::Result command_result)
@@ -1417,41 +1448,103 @@ void CameraImpl::get_option_async(
 void CameraImpl::subscribe_current_settings(
     const Camera::subscribe_current_settings_callback_t& callback)
 {
-    {
-        std::lock_guard<std::mutex> lock(_subscribe_current_settings.mutex);
-        _subscribe_current_settings.callback = callback;
-    }
-    notify_current_settings();
+    _subscribe_current_settings.subscriptions.set_single(callback);
+    send_current_settings(callback);
+}
+
+uint64_t CameraImpl::add_current_settings_subscriber(
+    const Camera::subscribe_current_settings_callback_t& callback)
+{
+    const uint64_t handle = _subscribe_current_settings.subscriptions.subscribe(callback);
+    send_current_settings(callback);
+    return handle;
 }
 
 void CameraImpl::subscribe_possible_setting_options(
     const Camera::subscribe_possible_setting_options_callback_t& callback)
 {
-    {
-        std::lock_guard<std::mutex> lock(_subscribe_possible_setting_options.mutex);
-        _subscribe_possible_setting_options.callback = callback;
+    _subscribe_possible_setting_options.subscriptions.set_single(callback);
+    send_possible_setting_options(callback);
+}
+
+uint64_t CameraImpl::add_possible_setting_options_subscriber(
+    const Camera::subscribe_possible_setting_options_callback_t& callback)
+{
+    const uint64_t handle = _subscribe_possible_setting_options.subscriptions.subscribe(callback);
+    send_possible_setting_options(callback);
+    return handle;
+}
+
+void CameraImpl::send_current_settings(
+    const Camera::subscribe_current_settings_callback_t& callback)
+{
+    // Only the new subscriber gets the current state, the others already have it.
+    std::vector<Camera::Setting> current_settings{};
+    if (!callback || !get_current_settings(current_settings)) {
+        return;
     }
-    notify_possible_setting_options();
+
+    // We create a function object in order to move be able to move the settings into it.
+    // FIXME: Use C++14 where this is not necessary anymore.
+    _parent->call_user_callback(std::bind(
+        [callback](const std::vector<Camera::Setting>& settings) { callback(settings); },
+        std::move(current_settings)));
+}
+
+void CameraImpl::send_possible_setting_options(
+    const Camera::subscribe_possible_setting_options_callback_t& callback)
+{
+    std::vector<Camera::SettingOptions> setting_options{};
+    if (!callback || !get_setting_options(setting_options)) {
+        return;
+    }
+
+    // We create a function object in order to move be able to move the settings into it.
+    // FIXME: Use C++14 where this is not necessary anymore.
+    _parent->call_user_callback(std::bind(
+        [callback](const std::vector<Camera::SettingOptions>& options) { callback(options); },
+        std::move(setting_options)));
 }
 
 void CameraImpl::notify_current_settings()
 {
     std::lock_guard<std::mutex> lock(_subscribe_current_settings.mutex);
 
-    if (!_subscribe_current_settings.callback) {
+    if (_subscribe_current_settings.subscriptions.empty()) {
+        return;
+    }
+
+    std::vector<Camera::Setting> current_settings{};
+    if (get_current_settings(current_settings)) {
+        notify(_subscribe_current_settings.subscriptions, current_settings);
+    }
+}
+
+void CameraImpl::notify_possible_setting_options()
+{
+    std::lock_guard<std::mutex> lock(_subscribe_possible_setting_options.mutex);
+
+    if (_subscribe_possible_setting_options.subscriptions.empty()) {
         return;
     }
 
+    std::vector<Camera::SettingOptions> setting_options{};
+    if (get_setting_options(setting_options)) {
+        notify(_subscribe_possible_setting_options.subscriptions, setting_options);
+    }
+}
+
+bool CameraImpl::get_current_settings(std::vector<Camera::Setting>& current_settings)
+{
     if (!_camera_definition) {
         LogErr() << "notify_current_settings has no camera definition";
-        return;
+        return false;
     }
 
-    std::vector<Camera::Setting> current_settings{};
     std::vector<std::string> possible_setting_options{};
     if (!get_possible_setting_options(possible_setting_options)) {
         LogErr() << "Could not get possible settings in current options subscription.";
-        return;
+        return false;
     }
 
     for (auto& possible_setting : possible_setting_options) {
@@ -1472,55 +1565,31 @@ void CameraImpl::notify_current_settings()
             current_settings.push_back(setting);
         }
     }
-
-    const auto temp_callback = _subscribe_current_settings.callback;
-
-    // We create a function object in order to move be able to move the settings into it.
-    // FIXME: Use C++14 where this is not necessary anymore.
-    _parent->call_user_callback(std::bind(
-        [temp_callback](const std::vector<Camera::Setting>& settings) { temp_callback(settings); },
-        std::move(current_settings)));
+    return true;
 }
 
-void CameraImpl::notify_possible_setting_options()
+bool CameraImpl::get_setting_options(std::vector<Camera::SettingOptions>& setting_options)
 {
-    std::lock_guard<std::mutex> lock(_subscribe_possible_setting_options.mutex);
-
-    if (!_subscribe_possible_setting_options.callback) {
-        return;
-    }
-
     if (!_camera_definition) {
         LogErr() << "notify_possible_setting_options has no camera definition";
-        return;
+        return false;
     }
 
-    std::vector<Camera::SettingOptions> possible_setting_options{};
-
     std::vector<std::string> possible_settings{};
     if (!get_possible_setting_options(possible_settings)) {
         LogErr() << "Could not get possible settings in possible options subscription.";
-        return;
+        return false;
     }
 
     for (auto& possible_setting : possible_settings) {
-        Camera::SettingOptions setting_options{};
-        setting_options.setting_id = possible_setting;
-        setting_options.is_range = _camera_definition->is_setting_range(possible_setting);
-        get_setting_str(setting_options.setting_id, setting_options.setting_description);
-        get_possible_options(possible_setting, setting_options.options);
-        possible_setting_options.push_back(setting_options);
+        Camera::SettingOptions options{};
+        options.setting_id = possible_setting;
+        options.is_range = _camera_definition->is_setting_range(possible_setting);
+        get_setting_str(options.setting_id, options.setting_description);
+        get_possible_options(possible_setting, options.options);
+        setting_options.push_back(options);
     }
-
-    const auto temp_callback = _subscribe_possible_setting_options.callback;
-
-    // We create a function object in order to move be able to move the settings into it.
-    // FIXME: Use C++14 where this is not necessary anymore.
-    _parent->call_user_callback(std::bind(
-        [temp_callback](const std::vector<Camera::SettingOptions>& options) {
-            temp_callback(options);
-        },
-        std::move(possible_setting_options)));
+    return true;
 }
 
 void CameraImpl::refresh_params()
@@ -4,6 +4,7 @@
 #include "mavlink_include.h"
 #include "plugins/camera/camera.h"
 #include "plugin_impl_base.h"
+#include "subscription_list.h"
 #include "system.h"
 
 namespace mavsdk {
@@ -40,6 +41,8 @@ public:
     Camera::Result get_video_stream_info(Camera::VideoStreamInfo& info);
     void get_video_stream_info_async(const Camera::get_video_stream_info_callback_t callback);
     void subscribe_video_stream_info(const Camera::subscribe_video_stream_info_callback_t callback);
+    uint64_t add_video_stream_info_subscriber(
+        const Camera::subscribe_video_stream_info_callback_t& callback);
 
     Camera::Result start_video_streaming();
     Camera::Result stop_video_streaming();
@@ -48,11 +51,16 @@ public:
     void set_mode_async(const Camera::Mode mode, const Camera::mode_callback_t& callback);
     void get_mode_async(Camera::mode_callback_t callback);
     void subscribe_mode(const Camera::subscribe_mode_callback_t callback);
+    uint64_t add_mode_subscriber(const Camera::subscribe_mode_callback_t& callback);
 
     void subscribe_capture_info(Camera::capture_info_callback_t callback);
+    uint64_t add_capture_info_subscriber(const Camera::capture_info_callback_t& callback);
 
     void get_status_async(Camera::get_status_callback_t callback);
     void subscribe_status(const Camera::subscribe_status_callback_t callback);
+    uint64_t add_status_subscriber(const Camera::subscribe_status_callback_t& callback);
+
+    void unsubscribe(uint64_t handle);
 
     void set_option_async(
         const std::string& setting_id,
@@ -73,8 +81,12 @@ public:
         const std::string& setting_id, const std::string& option_id, std::string& description);
 
     void subscribe_current_settings(const Camera::subscribe_current_settings_callback_t& callback);
+    uint64_t
+    add_current_settings_subscriber(const Camera::subscribe_current_settings_callback_t& callback);
     void subscribe_possible_setting_options(
         const Camera::subscribe_possible_setting_options_callback_t& callback);
+    uint64_t add_possible_setting_options_subscriber(
+        const Camera::subscribe_possible_setting_options_callback_t& callback);
 
     Camera::Result format_storage();
     void format_storage_async(Camera::result_callback_t callback);
@@ -118,11 +130,29 @@ private:
     Camera::CaptureInfo::EulerAngle
     to_euler_angle_from_quaternion(Camera::CaptureInfo::Quaternion quaternion);
 
+    template<class T> void notify(const SubscriptionList<T>& subscriptions, const T& value)
+    {
+        auto notification = subscriptions.notification(value);
+        if (notification) {
+            _parent->call_user_callback(notification);
+        }
+    }
+
     void notify_mode(const Camera::Mode mode);
     void notify_video_stream_info();
     void notify_current_settings();
     void notify_possible_setting_options();
 
+    bool get_current_settings(std::vector<Camera::Setting>& current_settings);
+    bool get_setting_options(std::vector<Camera::SettingOptions>& setting_options);
+    void send_current_settings(const Camera::subscribe_current_settings_callback_t& callback);
+    void send_possible_setting_options(
+        const Camera::subscribe_possible_setting_options_callback_t& callback);
+
+    // Polling only runs while anyone is subscribed.
+    void update_video_stream_info_polling();
+    void update_status_polling();
+
     void check_status();
 
     void status_timeout_happened();
@@ -174,7 +204,7 @@ private:
         bool received_storage_information{false};
         void* timeout_cookie{nullptr};
 
-        Camera::subscribe_status_callback_t subscription_callback{nullptr};
+        SubscriptionList<Camera::Status> subscriptions{};
         void* call_every_cookie{nullptr};
     } _status{};
 
@@ -185,7 +215,7 @@ private:
         Camera::mode_callback_t callback{nullptr};
         void* timeout_cookie{nullptr};
 
-        Camera::subscribe_mode_callback_t subscription_callback{nullptr};
+        SubscriptionList<Camera::Mode> subscriptions{};
     } _mode{};
 
     struct {
@@ -193,10 +223,7 @@ private:
         int sequence = 1; // The MAVLink spec says the sequence starts at 1.
     } _capture{};
 
-    struct {
-        std::mutex mutex{};
-        Camera::capture_info_callback_t callback{nullptr};
-    } _capture_info{};
+    SubscriptionList<Camera::CaptureInfo> _capture_info_subscriptions{};
 
     struct {
         std::mutex mutex{};
@@ -205,7 +232,7 @@ private:
         Camera::get_video_stream_info_callback_t callback{nullptr};
         void* timeout_cookie{nullptr};
 
-        Camera::subscribe_video_stream_info_callback_t subscription_callback{nullptr};
+        SubscriptionList<Camera::VideoStreamInfo> subscriptions{};
         void* call_every_cookie{nullptr};
     } _video_stream_info{};
 
@@ -216,12 +243,12 @@ private:
 
     struct {
         std::mutex mutex{};
-        Camera::subscribe_current_settings_callback_t callback{nullptr};
+        SubscriptionList<std::vector<Camera::Setting>> subscriptions{};
     } _subscribe_current_settings{};
 
     struct {
         std::mutex mutex{};
-        Camera::subscribe_possible_setting_options_callback_t callback{nullptr};
+        SubscriptionList<std::vector<Camera::SettingOptions>> subscriptions{};
     } _subscribe_possible_setting_options{};
 };
 
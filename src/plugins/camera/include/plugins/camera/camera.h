@@ -243,6 +243,20 @@ public:
      */
     void get_mode_async(const mode_callback_t& callback);
 
+    /**
+     * @brief Handle identifying a subscription added using one of the add_*_subscriber methods.
+     */
+    typedef uint64_t SubscriptionHandle;
+
+    /**
+     * @brief Remove a subscription added using one of the add_*_subscriber methods.
+     *
+     * Updates which are already on their way can still arrive after this returns.
+     *
+     * @param handle Handle returned when subscribing.
+     */
+    void unsubscribe(SubscriptionHandle handle);
+
     /**
      * @brief Callback type for camera mode subscription.
      */
@@ -255,6 +269,16 @@ public:
      */
     void subscribe_mode(const subscribe_mode_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for camera mode updates (asynchronous).
+     *
+     * Unlike subscribe_mode, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with camera mode updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle add_mode_subscriber(const subscribe_mode_callback_t& callback);
+
     /**
      * @brief Information about a picture just captured.
      */
@@ -374,6 +398,17 @@ public:
      */
     void subscribe_video_stream_info(const subscribe_video_stream_info_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for video stream info updates (asynchronous).
+     *
+     * Unlike subscribe_video_stream_info, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with video stream updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle
+    add_video_stream_info_subscriber(const subscribe_video_stream_info_callback_t& callback);
+
     /**
      * @brief Starts video streaming (synchronous).
      *
@@ -408,6 +443,16 @@ public:
      */
     void subscribe_capture_info(capture_info_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for capture info updates (asynchronous).
+     *
+     * Unlike subscribe_capture_info, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle add_capture_info_subscriber(const capture_info_callback_t& callback);
+
     /**
      * @brief Information about camera status.
      */
@@ -454,6 +499,16 @@ public:
      */
     void subscribe_status(const subscribe_status_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for status updates (asynchronous).
+     *
+     * Unlike subscribe_status, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with status update.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle add_status_subscriber(const subscribe_status_callback_t& callback);
+
     /**
      * @brief Type to represent a setting option.
      *
@@ -566,6 +621,17 @@ public:
      */
     void subscribe_current_settings(const subscribe_current_settings_callback_t& callback);
 
+    /**
+     * @brief Add a subscriber for currently selected settings (asynchronous).
+     *
+     * Unlike subscribe_current_settings, this does not replace any other subscriber.
+     *
+     * @param callback Function to call when current options have been updated.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle
+    add_current_settings_subscriber(const subscribe_current_settings_callback_t& callback);
+
     /**
      * @brief Subscribe to all possible setting options (asynchronous).
      *
@@ -574,6 +640,17 @@ public:
     void subscribe_possible_setting_options(
         const subscribe_possible_setting_options_callback_t& callback);
 
+    /**
+     * @brief Add a subscriber for all possible setting options (asynchronous).
+     *
+     * Unlike subscribe_possible_setting_options, this does not replace any other subscriber.
+     *
+     * @param callback Function to call when possible options have been updated.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle add_possible_setting_options_subscriber(
+        const subscribe_possible_setting_options_callback_t& callback);
+
     /**
      * @brief Format storage (e.g. SD card) in camera (asynchronous).
      *
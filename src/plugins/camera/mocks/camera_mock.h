@@ -26,6 +26,23 @@ public:
     MOCK_CONST_METHOD1(
         subscribe_possible_setting_options,
         void(Camera::subscribe_possible_setting_options_callback_t)){};
+    MOCK_CONST_METHOD1(
+        add_mode_subscriber, Camera::SubscriptionHandle(Camera::subscribe_mode_callback_t)){};
+    MOCK_CONST_METHOD1(
+        add_video_stream_info_subscriber,
+        Camera::SubscriptionHandle(Camera::subscribe_video_stream_info_callback_t)){};
+    MOCK_CONST_METHOD1(
+        add_capture_info_subscriber,
+        Camera::SubscriptionHandle(Camera::capture_info_callback_t)){};
+    MOCK_CONST_METHOD1(
+        add_status_subscriber, Camera::SubscriptionHandle(Camera::subscribe_status_callback_t)){};
+    MOCK_CONST_METHOD1(
+        add_current_settings_subscriber,
+        Camera::SubscriptionHandle(Camera::subscribe_current_settings_callback_t)){};
+    MOCK_CONST_METHOD1(
+        add_possible_setting_options_subscriber,
+        Camera::SubscriptionHandle(Camera::subscribe_possible_setting_options_callback_t)){};
+    MOCK_CONST_METHOD1(unsubscribe, void(Camera::SubscriptionHandle)){};
     MOCK_CONST_METHOD3(
         set_option_async,
         void(Camera::result_callback_t, const std::string&, const Camera::Option)){};
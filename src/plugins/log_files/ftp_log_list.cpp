@@ -0,0 +1,144 @@
+#include "ftp_log_list.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace mavsdk {
+
+namespace {
+
+// Seconds since the epoch of a "YYYY-MM-DDTHH:MM:SSZ" date.
+bool date_seconds(const std::string& date, int64_t& seconds)
+{
+    unsigned year, month, day, hour, minute, second;
+    if (sscanf(
+            date.c_str(),
+            "%4u-%2u-%2uT%2u:%2u:%2uZ",
+            &year,
+            &month,
+            &day,
+            &hour,
+            &minute,
+            &second) != 6 ||
+        month < 1 || month > 12 || day < 1 || day > 31) {
+        return false;
+    }
+
+    // Days since 1970-01-01 in the proleptic Gregorian calendar, with the year
+    // starting in March so that the leap day comes last.
+    const int64_t y = int64_t(year) - (month <= 2 ? 1 : 0);
+    const int64_t era = y / 400;
+    const int64_t year_of_era = y - era * 400;
+    const int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int64_t day_of_era =
+        year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    const int64_t days = era * 146097 + day_of_era - 719468;
+
+    seconds = days * 86400 + hour * 3600 + minute * 60 + second;
+    return true;
+}
+
+} // namespace
+
+std::string ftp_entry_name(const std::string& entry)
+{
+    const auto tab_pos = entry.find('\t');
+    std::string name = entry.substr(1, tab_pos == std::string::npos ? tab_pos : tab_pos - 1);
+    const auto slash_pos = name.rfind('/');
+    if (slash_pos != std::string::npos) {
+        name = name.substr(slash_pos + 1);
+    }
+    return name;
+}
+
+// PX4 names logs "<YYYY-MM-DD>/<HH_MM_SS>.ulg" after the UTC time they were started.
+std::string ftp_log_date(const std::string& directory, const std::string& name)
+{
+    unsigned year, month, day, hour, minute, second;
+    if (sscanf(directory.c_str(), "%4u-%2u-%2u", &year, &month, &day) != 3 ||
+        sscanf(name.c_str(), "%2u_%2u_%2u.ulg", &hour, &minute, &second) != 3) {
+        return {};
+    }
+
+    char buf[sizeof "2018-08-31T20:50:42Z"];
+    snprintf(
+        buf,
+        sizeof buf,
+        "%04u-%02u-%02uT%02u:%02u:%02uZ",
+        year % 10000,
+        month % 100,
+        day % 100,
+        hour % 100,
+        minute % 100,
+        second % 100);
+    return buf;
+}
+
+std::vector<std::string>
+FtpLogList::add(const std::string& directory, const std::vector<std::string>& entries)
+{
+    const auto slash_pos = directory.rfind('/');
+    const std::string directory_name =
+        (slash_pos == std::string::npos) ? directory : directory.substr(slash_pos + 1);
+
+    std::vector<std::string> directories;
+    for (const auto& entry : entries) {
+        if (entry.size() < 2) {
+            continue;
+        }
+
+        const std::string name = ftp_entry_name(entry);
+        if (name.empty() || name == "." || name == "..") {
+            continue;
+        }
+
+        const std::string path = directory + "/" + name;
+        if (entry[0] == 'D') {
+            directories.push_back(path);
+        } else if (entry[0] == 'F' && name.size() > 4 && name.substr(name.size() - 4) == ".ulg") {
+            const auto tab_pos = entry.find('\t');
+            const unsigned size =
+                (tab_pos == std::string::npos) ?
+                    0 :
+                    unsigned(std::strtoul(entry.c_str() + tab_pos + 1, nullptr, 10));
+            _logs.push_back(Log{path, ftp_log_date(directory_name, name), size});
+        }
+    }
+    return directories;
+}
+
+std::string FtpLogList::find(const LogFiles::Entry& entry) const
+{
+    int64_t entry_seconds = 0;
+    const bool entry_dated = date_seconds(entry.date, entry_seconds);
+
+    std::string dated_path;
+    int64_t dated_difference = TIME_TOLERANCE_S + 1;
+    std::string undated_path;
+    unsigned undated_matches = 0;
+    for (const auto& log : _logs) {
+        if (log.size != entry.size_bytes) {
+            continue;
+        }
+
+        int64_t log_seconds;
+        if (date_seconds(log.date, log_seconds)) {
+            // The closest one, if there are several.
+            const int64_t difference = std::llabs(log_seconds - entry_seconds);
+            if (entry_dated && difference < dated_difference) {
+                dated_path = log.path;
+                dated_difference = difference;
+            }
+        } else {
+            undated_path = log.path;
+            ++undated_matches;
+        }
+    }
+
+    if (!dated_path.empty()) {
+        return dated_path;
+    }
+    return (undated_matches == 1) ? undated_path : std::string{};
+}
+
+} // namespace mavsdk
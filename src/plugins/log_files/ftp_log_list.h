@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "plugins/log_files/log_files.h"
+
+namespace mavsdk {
+
+// Name of a "F<name>\t<size>" or "D<name>" MAVLink FTP directory entry, without
+// the path some servers put in front.
+std::string ftp_entry_name(const std::string& entry);
+
+// Date of a log like in LogFiles::Entry, from the directory and the name PX4 gives
+// it, empty if they don't contain one.
+std::string ftp_log_date(const std::string& directory, const std::string& name);
+
+/*
+ * The log files on the SD card of an autopilot, as listed over MAVLink FTP, to
+ * look up the file of a LogFiles::Entry.
+ *
+ * A log with a date in its path is the one of an entry with the same size and a
+ * time which differs by TIME_TOLERANCE_S at most. PX4 takes the time of an entry
+ * from the name of its log, the tolerance is for autopilots taking it from the
+ * file instead. Logs without a date are matched by size, as long as no other one
+ * has the same.
+ */
+class FtpLogList {
+public:
+    // Adds the logs among the entries listed in `directory` and returns the
+    // directories among them, which may contain more logs.
+    std::vector<std::string>
+    add(const std::string& directory, const std::vector<std::string>& entries);
+
+    // Remote path of the log of an entry, empty if there is none or it's ambiguous.
+    std::string find(const LogFiles::Entry& entry) const;
+
+    void clear() { _logs.clear(); }
+
+    static constexpr int64_t TIME_TOLERANCE_S = 5;
+
+private:
+    struct Log {
+        std::string path;
+        std::string date; ///< As in LogFiles::Entry, empty if the path has none
+        unsigned size;
+    };
+
+    std::vector<Log> _logs{};
+};
+
+} // namespace mavsdk
@@ -0,0 +1,134 @@
+#include "ftp_log_list.h"
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+namespace {
+
+LogFiles::Entry make_entry(const std::string& date, unsigned size_bytes)
+{
+    LogFiles::Entry entry;
+    entry.id = 0;
+    entry.date = date;
+    entry.size_bytes = size_bytes;
+    return entry;
+}
+
+} // namespace
+
+TEST(FtpLogList, EntryName)
+{
+    EXPECT_EQ(ftp_entry_name("F12_30_01.ulg\t4096"), "12_30_01.ulg");
+    EXPECT_EQ(ftp_entry_name("D2020-01-20"), "2020-01-20");
+    // Some servers put the path in front.
+    EXPECT_EQ(ftp_entry_name("F/fs/microsd/log/2020-01-20/12_30_01.ulg\t4096"), "12_30_01.ulg");
+    EXPECT_EQ(ftp_entry_name("D/fs/microsd/log/sess001"), "sess001");
+}
+
+TEST(FtpLogList, LogDate)
+{
+    EXPECT_EQ(ftp_log_date("2020-01-20", "12_30_01.ulg"), "2020-01-20T12:30:01Z");
+    EXPECT_EQ(ftp_log_date("2020-1-2", "1_2_3.ulg"), "2020-01-02T01:02:03Z");
+    // Logged without GPS time.
+    EXPECT_EQ(ftp_log_date("sess001", "log001.ulg"), "");
+    EXPECT_EQ(ftp_log_date("2020-01-20", "log001.ulg"), "");
+    EXPECT_EQ(ftp_log_date("log", "12_30_01.ulg"), "");
+}
+
+TEST(FtpLogList, AddReturnsDirectoriesAndKeepsLogsOnly)
+{
+    FtpLogList list;
+    const auto directories = list.add(
+        "/fs/microsd/log",
+        {"D2020-01-20", "Dsess001", "D.", "D..", "Fnotes.txt\t12", "F12_30_01.ulg\t100", "F"});
+
+    ASSERT_EQ(directories.size(), 2u);
+    EXPECT_EQ(directories[0], "/fs/microsd/log/2020-01-20");
+    EXPECT_EQ(directories[1], "/fs/microsd/log/sess001");
+
+    // Only the .ulg file was added, without a date as the directory has none.
+    EXPECT_EQ(list.find(make_entry("2020-01-20T12:30:01Z", 100)), "/fs/microsd/log/12_30_01.ulg");
+    EXPECT_EQ(list.find(make_entry("2020-01-20T12:30:01Z", 12)), "");
+}
+
+TEST(FtpLogList, FindsDatedLogBySizeAndDate)
+{
+    FtpLogList list;
+    list.add("/fs/microsd/log/2020-01-20", {"F12_30_01.ulg\t100", "F13_00_00.ulg\t100"});
+
+    EXPECT_EQ(
+        list.find(make_entry("2020-01-20T12:30:01Z", 100)),
+        "/fs/microsd/log/2020-01-20/12_30_01.ulg");
+    EXPECT_EQ(
+        list.find(make_entry("2020-01-20T13:00:00Z", 100)),
+        "/fs/microsd/log/2020-01-20/13_00_00.ulg");
+    // Right date, other size.
+    EXPECT_EQ(list.find(make_entry("2020-01-20T12:30:01Z", 101)), "");
+    // Right size, other date.
+    EXPECT_EQ(list.find(make_entry("2020-01-21T12:30:01Z", 100)), "");
+}
+
+TEST(FtpLogList, FindsDatedLogWithinTimeTolerance)
+{
+    FtpLogList list;
+    list.add("/fs/microsd/log/2020-01-20", {"F23_59_58.ulg\t100", "F12_00_00.ulg\t200"});
+
+    // Also across midnight.
+    EXPECT_EQ(
+        list.find(make_entry("2020-01-21T00:00:01Z", 100)),
+        "/fs/microsd/log/2020-01-20/23_59_58.ulg");
+    EXPECT_EQ(
+        list.find(make_entry("2020-01-20T11:59:55Z", 200)),
+        "/fs/microsd/log/2020-01-20/12_00_00.ulg");
+    EXPECT_EQ(list.find(make_entry("2020-01-20T11:59:54Z", 200)), "");
+    EXPECT_EQ(list.find(make_entry("2020-01-20T12:00:06Z", 200)), "");
+}
+
+TEST(FtpLogList, FindsClosestDatedLog)
+{
+    FtpLogList list;
+    list.add("/fs/microsd/log/2020-02-29", {"F10_00_00.ulg\t100", "F10_00_04.ulg\t100"});
+
+    EXPECT_EQ(
+        list.find(make_entry("2020-02-29T10:00:03Z", 100)),
+        "/fs/microsd/log/2020-02-29/10_00_04.ulg");
+    EXPECT_EQ(
+        list.find(make_entry("2020-02-29T10:00:01Z", 100)),
+        "/fs/microsd/log/2020-02-29/10_00_00.ulg");
+}
+
+TEST(FtpLogList, FindsUndatedLogByUniqueSize)
+{
+    FtpLogList list;
+    list.add("/fs/microsd/log/sess001", {"Flog001.ulg\t100", "Flog002.ulg\t200"});
+    list.add("/fs/microsd/log/sess002", {"Flog001.ulg\t200"});
+
+    EXPECT_EQ(
+        list.find(make_entry("1970-01-01T00:00:00Z", 100)),
+        "/fs/microsd/log/sess001/log001.ulg");
+    // Two logs of that size, it's not known which one it is.
+    EXPECT_EQ(list.find(make_entry("1970-01-01T00:00:00Z", 200)), "");
+}
+
+TEST(FtpLogList, PrefersDatedLogOverUndated)
+{
+    FtpLogList list;
+    list.add("/fs/microsd/log/sess001", {"Flog001.ulg\t100"});
+    list.add("/fs/microsd/log/2020-01-20", {"F12_30_01.ulg\t100"});
+
+    EXPECT_EQ(
+        list.find(make_entry("2020-01-20T12:30:01Z", 100)),
+        "/fs/microsd/log/2020-01-20/12_30_01.ulg");
+}
+
+TEST(FtpLogList, ClearRemovesLogs)
+{
+    FtpLogList list;
+    list.add("/fs/microsd/log/2020-01-20", {"F12_30_01.ulg\t100"});
+    list.clear();
+
+    EXPECT_EQ(list.find(make_entry("2020-01-20T12:30:01Z", 100)), "");
+}
@@ -105,6 +105,10 @@ public:
     /**
      * @brief Download log file (asynchronous).
      *
+     * If the autopilot supports MAVLink FTP, the log is looked up on its SD card
+     * (in `/fs/microsd/log` like PX4 keeps them) and downloaded over FTP, which is
+     * a lot faster. Otherwise, or if it is not found there, the log protocol is used.
+     *
      * @param id Entry id of log file to download.
      * @param file_path File path where to download file to.
      * @param callback Callback to get result and progress.
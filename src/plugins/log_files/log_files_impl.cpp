@@ -1,13 +1,117 @@
 #include "global_include.h"
 #include "log_files_impl.h"
 #include "mavsdk_impl.h"
-#include <fstream>
+#include "plugins/mavlink_ftp/mavlink_ftp.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <ctime>
 #include <cstring>
+#include <fcntl.h>
+#if defined(WINDOWS)
+#include <direct.h>
+#include <io.h>
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace mavsdk {
 
-LogFilesImpl::LogFilesImpl(System& system) : PluginImplBase(system)
+namespace {
+
+bool write_at(int fd, const uint8_t* buffer, unsigned size, unsigned offset)
+{
+#if defined(WINDOWS)
+    return lseek(fd, offset, SEEK_SET) >= 0 && ::write(fd, buffer, size) == static_cast<int>(size);
+#else
+    return ::pwrite(fd, buffer, size, offset) == static_cast<ssize_t>(size);
+#endif
+}
+
+// Returns 0 on success, the error otherwise.
+int preallocate(int fd, unsigned size)
+{
+#if defined(LINUX)
+    // Reserving the blocks makes a full disk show up now instead of half way.
+    // posix_fallocate returns its error, it does not set errno.
+    const int error = posix_fallocate(fd, 0, size);
+    if (error == 0 || error == ENOSPC) {
+        return error;
+    }
+    // Not supported by the file system, just set the size then.
+#endif
+#if defined(WINDOWS)
+    return _chsize(fd, static_cast<long>(size)) == 0 ? 0 : errno;
+#else
+    return ftruncate(fd, size) == 0 ? 0 : errno;
+#endif
+}
+
+// Where PX4 keeps its logs, in a directory per day, or per boot without GPS time.
+const std::string ftp_log_directory = "/fs/microsd/log";
+
+#if defined(WINDOWS)
+const std::string path_separator = "\\";
+#else
+const std::string path_separator = "/";
+#endif
+
+bool move_file(const std::string& from_path, const std::string& to_path)
+{
+    // rename() does not replace an existing file on Windows.
+    std::remove(to_path.c_str());
+    return std::rename(from_path.c_str(), to_path.c_str()) == 0;
+}
+
+// Creates a new folder next to `file_path` and returns it, empty if that failed.
+std::string create_download_folder(const std::string& file_path)
+{
+    for (unsigned i = 0; i < 100; ++i) {
+        const std::string folder = file_path + ".ftp" + (i > 0 ? std::to_string(i) : "");
+#if defined(WINDOWS)
+        const int ret = _mkdir(folder.c_str());
+#else
+        const int ret = mkdir(folder.c_str(), 0755);
+#endif
+        if (ret == 0) {
+            return folder;
+        }
+        if (errno != EEXIST) {
+            break;
+        }
+    }
+    return {};
+}
+
+void remove_download_folder(const std::string& folder)
+{
+#if defined(WINDOWS)
+    _rmdir(folder.c_str());
+#else
+    rmdir(folder.c_str());
+#endif
+}
+
+// Gaps looked at for the next request.
+constexpr size_t MAX_GAPS = 64;
+// Chunks at the start of a request which may get lost before it counts as answered.
+constexpr unsigned ANSWER_CHUNKS = 4;
+
+constexpr double MIN_TIMEOUT_S = 0.1;
+constexpr double MAX_TIMEOUT_S = 3.0;
+
+// Timeouts in a row, without any data in between, before giving up.
+constexpr unsigned MAX_RETRIES = 10;
+
+// Interval over which the data rate is measured.
+constexpr double RATE_INTERVAL_S = 0.1;
+
+} // namespace
+
+LogFilesImpl::LogFilesImpl(System& system) : PluginImplBase(system), _system(system)
 {
     _parent->register_plugin(this);
 }
@@ -34,6 +138,9 @@ void LogFilesImpl::init()
 void LogFilesImpl::deinit()
 {
     _parent->unregister_all_mavlink_message_handlers(this);
+
+    std::lock_guard<std::mutex> lock(_data.mutex);
+    close_log_file();
 }
 
 void LogFilesImpl::enable() {}
@@ -73,6 +180,11 @@ void LogFilesImpl::get_entries_async(LogFiles::get_entries_callback_t callback)
         _entries.max_list_id = 0;
         _entries.retries = 0;
     }
+    {
+        // The logs on the SD card may have changed as well.
+        std::lock_guard<std::mutex> lock(_ftp.mutex);
+        _ftp.listed = false;
+    }
 
     _parent->register_timeout_handler(
         std::bind(&LogFilesImpl::list_timeout, this), 3.0, &_entries.cookie);
@@ -188,7 +300,7 @@ LogFiles::Result LogFilesImpl::download_log_file(unsigned id, const std::string&
 void LogFilesImpl::download_log_file_async(
     unsigned id, const std::string& file_path, LogFiles::download_log_file_callback_t callback)
 {
-    unsigned bytes_to_get;
+    LogFiles::Entry entry;
     {
         std::lock_guard<std::mutex> lock(_entries.mutex);
 
@@ -198,39 +310,196 @@ void LogFilesImpl::download_log_file_async(
             return;
         }
 
-        bytes_to_get = _entries.entry_map[id].size_bytes;
+        entry = it->second;
     }
 
-    {
-        std::lock_guard<std::mutex> lock(_data.mutex);
-
-        // TODO: check for busy
-        _data.rerequesting = false;
-        _data.id = id;
-        _data.bytes.resize(bytes_to_get);
-        _data.file_path = file_path;
-        _data.callback = callback;
-        _data.last_progress_percentage = 0;
-        _data.chunks_to_rerequest_initially = 0;
-        _data.time_started = _time.steady_time();
-
-        unsigned num_chunks = bytes_to_get / CHUNK_SIZE;
-        if (bytes_to_get % CHUNK_SIZE) {
-            ++num_chunks;
-        }
-        _data.chunks_received.resize(num_chunks);
+    if (_parent->does_support_ftp()) {
+        download_log_file_ftp(entry, file_path, callback);
+    } else {
+        start_log_data_download(entry.id, entry.size_bytes, file_path, callback);
+    }
+}
 
-        _parent->register_timeout_handler(
-            std::bind(&LogFilesImpl::data_timeout, this), 0.2, &_data.cookie);
+void LogFilesImpl::start_log_data_download(
+    unsigned id,
+    unsigned size,
+    const std::string& file_path,
+    LogFiles::download_log_file_callback_t callback)
+{
+    std::lock_guard<std::mutex> lock(_data.mutex);
 
-        if (_data.callback) {
-            LogFiles::download_log_file_callback_t tmp_callback = _data.callback;
+    // TODO: check for busy
+    close_log_file();
+
+#if defined(WINDOWS)
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_BINARY;
+#else
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#endif
+    _data.fd = ::open(file_path.c_str(), flags, 0644);
+    const int error = _data.fd < 0 ? errno : preallocate(_data.fd, size);
+    if (error != 0) {
+        LogErr() << "Could not create " << file_path << ": " << strerror(error);
+        close_log_file();
+        if (callback) {
             _parent->call_user_callback(
-                [tmp_callback]() { tmp_callback(LogFiles::Result::PROGRESS, 0.0f); });
+                [callback]() { callback(LogFiles::Result::UNKNOWN, 0.0f); });
+        }
+        return;
+    }
+
+    _data.id = id;
+    _data.size = size;
+    _data.window.resize(WINDOW_SIZE);
+    _data.window_offset = 0;
+    _data.window_end = 0;
+    _data.file_path = file_path;
+    _data.callback = callback;
+    _data.last_progress_percentage = 0;
+    _data.time_started = _time.steady_time();
+    _data.received.clear();
+    _data.bytes_received = 0;
+    _data.retries = 0;
+
+    if (_data.callback) {
+        LogFiles::download_log_file_callback_t tmp_callback = _data.callback;
+        _parent->call_user_callback(
+            [tmp_callback]() { tmp_callback(LogFiles::Result::PROGRESS, 0.0f); });
+    }
+
+    // The whole log is requested first, gaps left by lost messages after.
+    send_log_request(0, size);
+}
+
+void LogFilesImpl::download_log_file_ftp(
+    const LogFiles::Entry& entry,
+    const std::string& file_path,
+    LogFiles::download_log_file_callback_t callback)
+{
+    list_ftp_logs([this, entry, file_path, callback]() {
+        const std::string remote_path = find_ftp_log(entry);
+        if (remote_path.empty()) {
+            LogDebug() << "Log entry " << entry.id << " not found over FTP";
+            start_log_data_download(entry.id, entry.size_bytes, file_path, callback);
+            return;
+        }
+
+        // The FTP download names the file like the remote one. It goes to a folder of
+        // its own, so that it can't replace an unrelated file, and is moved after.
+        const std::string local_folder = create_download_folder(file_path);
+        if (local_folder.empty()) {
+            LogWarn() << "Could not create a folder next to " << file_path
+                      << ", downloading log entry " << entry.id << " with the log protocol";
+            start_log_data_download(entry.id, entry.size_bytes, file_path, callback);
+            return;
+        }
+        const std::string downloaded_path =
+            local_folder + path_separator + remote_path.substr(remote_path.rfind('/') + 1);
+
+        LogDebug() << "Downloading log entry " << entry.id << " from " << remote_path;
+
+        // Only report every 1%, like the log protocol.
+        auto last_percentage = std::make_shared<unsigned>(0);
+        _ftp.client->download_async(
+            remote_path,
+            local_folder,
+            [callback, last_percentage](uint32_t bytes_read, uint32_t total_bytes) {
+                const unsigned percentage =
+                    total_bytes > 0 ? unsigned(100.0 * double(bytes_read) / total_bytes) : 0;
+                if (callback && percentage != *last_percentage) {
+                    *last_percentage = percentage;
+                    callback(LogFiles::Result::PROGRESS, percentage / 100.0f);
+                }
+            },
+            [this, entry, file_path, remote_path, local_folder, downloaded_path, callback](
+                MavlinkFTP::Result result) {
+                if (result == MavlinkFTP::Result::SUCCESS &&
+                    move_file(downloaded_path, file_path)) {
+                    remove_download_folder(local_folder);
+                    if (callback) {
+                        callback(LogFiles::Result::SUCCESS, 1.0f);
+                    }
+                    return;
+                }
+
+                LogWarn() << "Downloading log entry " << entry.id
+                          << " over FTP failed, using the log protocol";
+                // Neither the partial file nor its checkpoint would be used again.
+                _ftp.client->discard_download(remote_path, local_folder);
+                remove_download_folder(local_folder);
+                start_log_data_download(entry.id, entry.size_bytes, file_path, callback);
+            });
+    });
+}
+
+void LogFilesImpl::list_ftp_logs(std::function<void()> callback)
+{
+    bool listed;
+    {
+        std::lock_guard<std::mutex> lock(_ftp.mutex);
+        if (!_ftp.client) {
+            // Not serving requests, that is done by the MavlinkFTP plugin.
+            _ftp.client.reset(new MavlinkFTP(_system, false));
         }
+        listed = _ftp.listed;
+    }
+    if (listed) {
+        callback();
+        return;
     }
 
-    request_log_data(id, 0, bytes_to_get);
+    _ftp.client->list_directory_async(
+        ftp_log_directory,
+        [this, callback](MavlinkFTP::Result result, std::vector<std::string> entries) {
+            auto directories = std::make_shared<std::vector<std::string>>();
+            {
+                std::lock_guard<std::mutex> lock(_ftp.mutex);
+                _ftp.logs.clear();
+                // Not listed again before the entries are, also if it failed,
+                // so that a missing FTP server costs one timeout only.
+                _ftp.listed = true;
+            }
+            if (result == MavlinkFTP::Result::SUCCESS) {
+                *directories = add_ftp_logs(ftp_log_directory, entries);
+            }
+            list_ftp_log_directories(directories, callback);
+        });
+}
+
+void LogFilesImpl::list_ftp_log_directories(
+    std::shared_ptr<std::vector<std::string>> directories, std::function<void()> callback)
+{
+    // One after the other, the FTP client does one operation at a time.
+    if (directories->empty()) {
+        callback();
+        return;
+    }
+
+    const std::string directory = directories->back();
+    directories->pop_back();
+
+    _ftp.client->list_directory_async(
+        directory,
+        [this, directory, directories, callback](
+            MavlinkFTP::Result result, std::vector<std::string> entries) {
+            if (result == MavlinkFTP::Result::SUCCESS) {
+                add_ftp_logs(directory, entries);
+            }
+            list_ftp_log_directories(directories, callback);
+        });
+}
+
+std::vector<std::string>
+LogFilesImpl::add_ftp_logs(const std::string& directory, const std::vector<std::string>& entries)
+{
+    std::lock_guard<std::mutex> lock(_ftp.mutex);
+    return _ftp.logs.add(directory, entries);
+}
+
+std::string LogFilesImpl::find_ftp_log(const LogFiles::Entry& entry)
+{
+    std::lock_guard<std::mutex> lock(_ftp.mutex);
+    return _ftp.logs.find(entry);
 }
 
 void LogFilesImpl::process_log_data(const mavlink_message_t& message)
@@ -247,133 +516,175 @@ void LogFilesImpl::process_log_data(const mavlink_message_t& message)
     }
 #endif
 
-    {
-        std::lock_guard<std::mutex> lock(_data.mutex);
-
-        _parent->refresh_timeout_handler(_data.cookie);
+    std::lock_guard<std::mutex> lock(_data.mutex);
 
-        // LogDebug() << "Received log data id: " << int(log_data.id) << ", ofs: " <<
-        // int(log_data.ofs)
-        //            << ", count: " << int(log_data.count);
+    if (_data.fd < 0) {
+        // No download going on, or it failed.
+        return;
+    }
 
-        static int previous_ofs = 0;
-        if (log_data.ofs != previous_ofs + CHUNK_SIZE) {
-            LogDebug() << "skipped: " << (log_data.ofs - (previous_ofs + CHUNK_SIZE)) / CHUNK_SIZE;
-        }
+    _parent->refresh_timeout_handler(_data.cookie);
 
-        previous_ofs = log_data.ofs;
+    // LogDebug() << "Received log data id: " << int(log_data.id) << ", ofs: " <<
+    // int(log_data.ofs)
+    //            << ", count: " << int(log_data.count);
 
-        if (log_data.count > CHUNK_SIZE) {
-            LogErr() << "Ignoring wrong count";
-            return;
-        }
+    if (log_data.count > CHUNK_SIZE) {
+        LogErr() << "Ignoring wrong count";
+        return;
+    }
 
-        if (log_data.ofs / CHUNK_SIZE >= _data.chunks_received.size()) {
-            LogErr() << "Ignoring wrong offset";
-            return;
-        }
+    if (log_data.ofs + log_data.count > _data.size) {
+        LogErr() << "Ignoring wrong offset";
+        return;
+    }
 
-        std::memcpy(&_data.bytes[log_data.ofs], log_data.data, log_data.count);
-        _data.chunks_received[log_data.ofs / CHUNK_SIZE] = true;
-        _data.bytes_received += log_data.count;
-
-        // Don't report if already re-requesting, progress is handled already.
-        if (!_data.rerequesting) {
-            // We leave the last 10% for retransmissions, that's just a guess.
-            unsigned new_percentage =
-                unsigned((float(log_data.ofs) / float(_data.bytes.size())) * 100.0f * 0.9f);
-
-            // Only report every 1%
-            if (new_percentage != _data.last_progress_percentage) {
-                _data.last_progress_percentage = new_percentage;
-                if (_data.callback) {
-                    LogFiles::download_log_file_callback_t tmp_callback = _data.callback;
-                    float progress = _data.last_progress_percentage / 100.0f;
-                    _parent->call_user_callback([tmp_callback, progress]() {
-                        tmp_callback(LogFiles::Result::PROGRESS, progress);
-                    });
-                }
+    if (!store_log_data(log_data.ofs, log_data.data, log_data.count)) {
+        LogErr() << "Could not write " << _data.file_path << ": " << strerror(errno);
+        fail_download(LogFiles::Result::UNKNOWN);
+        return;
+    }
+    _data.received.insert(log_data.ofs, log_data.ofs + log_data.count);
+    _data.bytes_received += log_data.count;
+    _data.retries = 0;
+
+    Request& request = _data.request;
+    // Data of the request before can still be on its way, the answer to this
+    // one starts at its offset, or shortly after if the first chunks got lost.
+    if (!request.answered && log_data.ofs >= request.offset &&
+        log_data.ofs < request.offset + ANSWER_CHUNKS * CHUNK_SIZE) {
+        request.answered = true;
+        request.rate_time = _time.steady_time();
+        update_timeout(_time.elapsed_since_s(request.sent));
+    } else if (request.answered && log_data.ofs >= request.offset && log_data.ofs < request.end) {
+        request.rate_bytes += log_data.count;
+        update_rate();
+    }
+    if (request.answered && log_data.ofs < request.end) {
+        request.next = std::max(request.next, log_data.ofs + log_data.count);
+    }
 
-                const float kib_s = float(_data.bytes_received) /
-                                    float(_time.elapsed_since_s(_data.time_started)) / 1024.0f;
+    const unsigned new_percentage =
+        unsigned(100.0 * double(_data.received.size()) / double(_data.size));
 
-                LogDebug() << _data.bytes_received << " B of " << _data.bytes.size() << " B ("
-                           << kib_s << " kiB/s)";
-            }
+    // Only report every 1%
+    if (new_percentage != _data.last_progress_percentage) {
+        _data.last_progress_percentage = new_percentage;
+        if (_data.callback) {
+            LogFiles::download_log_file_callback_t tmp_callback = _data.callback;
+            float progress = _data.last_progress_percentage / 100.0f;
+            _parent->call_user_callback([tmp_callback, progress]() {
+                tmp_callback(LogFiles::Result::PROGRESS, progress);
+            });
         }
 
-        if (log_data.ofs / CHUNK_SIZE + 1 == _data.chunks_received.size()) {
-            _data.rerequesting = true;
-        }
+        const float kib_s = float(_data.bytes_received) /
+                            float(_time.elapsed_since_s(_data.time_started)) / 1024.0f;
+
+        LogDebug() << _data.received.size() << " B of " << _data.size << " B (" << kib_s
+                   << " kiB/s)";
+    }
+
+    if (_data.received.size() == _data.size) {
+        finish_download();
+        return;
     }
 
-    check_missing_log_data();
+    // The server answers one request at a time and drops it for the next one.
+    // So the next request is sent once the rest of this one arrives in less
+    // than a round trip, and gets there about when the server is done.
+    if (request.answered &&
+        double(request.end - request.next) <= _data.rate_bytes_s * _data.rtt_s) {
+        request_missing_log_data(request.next, request.end);
+    }
 }
 
-void LogFilesImpl::check_missing_log_data()
+void LogFilesImpl::request_missing_log_data(unsigned pending_begin, unsigned pending_end)
 {
-    LogFiles::download_log_file_callback_t tmp_callback;
-    {
-        std::lock_guard<std::mutex> lock(_data.mutex);
+    // Data of [pending_begin, pending_end) is still on its way.
+    auto gaps = _data.received.gaps(0, pending_begin, MAX_GAPS);
+    if (gaps.size() < MAX_GAPS) {
+        const auto after = _data.received.gaps(pending_end, _data.size, MAX_GAPS - gaps.size());
+        gaps.insert(gaps.end(), after.begin(), after.end());
+    }
+    if (gaps.empty()) {
+        return;
+    }
 
-        if (!_data.rerequesting) {
-            return;
-        }
+    // Gaps close to each other go into one request, getting data again which
+    // arrived already between them is cheaper than a round trip for each.
+    const unsigned max_between =
+        std::max(unsigned(_data.rate_bytes_s * _data.rtt_s), unsigned{CHUNK_SIZE});
+    const unsigned begin = gaps.front().first;
+    unsigned end = gaps.front().second;
+    for (size_t i = 1; i < gaps.size() && gaps[i].first - end <= max_between; ++i) {
+        end = gaps[i].second;
+    }
 
-        unsigned num_missing = 0;
-        unsigned id_to_get = 0;
-        unsigned ofs_to_get = 0;
-        unsigned bytes_to_get = 0;
-
-        // LogDebug() << "Checking if we received all log data";
-        for (unsigned i = 0; i < _data.chunks_received.size(); ++i) {
-            if (!_data.chunks_received[i]) {
-                if (num_missing == 0) {
-                    bytes_to_get = CHUNK_SIZE;
-                    if (i + 1 == _data.chunks_received.size()) {
-                        bytes_to_get = static_cast<unsigned>(
-                            _data.bytes.size() - (_data.chunks_received.size() * CHUNK_SIZE - 1));
-                    }
+    LogDebug() << "Re-requesting log data " << begin << " to " << end;
+    send_log_request(begin, end);
+}
 
-                    id_to_get = _data.id;
-                    ofs_to_get = i * CHUNK_SIZE;
-                }
-                ++num_missing;
-            }
-        }
+void LogFilesImpl::send_log_request(unsigned begin, unsigned end)
+{
+    _data.request = Request{begin, end, begin, _time.steady_time(), false, {}, 0};
 
-        // We need to estimate the progress percentage for the chunks which need to
-        // get re-requested and we use the last 10% for this.
-        if (_data.chunks_to_rerequest_initially == 0) {
-            _data.chunks_to_rerequest_initially = num_missing;
-        }
+    // Registered again, as the timeout may have changed since.
+    _parent->unregister_timeout_handler(_data.cookie);
+    _parent->register_timeout_handler(
+        std::bind(&LogFilesImpl::data_timeout, this), _data.timeout_s, &_data.cookie);
 
-        if (_data.callback && num_missing > 0) {
-            unsigned new_progress = unsigned(
-                90.0f + 10.0f * float(_data.chunks_to_rerequest_initially - num_missing) /
-                            float(_data.chunks_to_rerequest_initially));
+    request_log_data(_data.id, begin, end - begin);
+}
 
-            if (new_progress != _data.last_progress_percentage) {
-                tmp_callback = _data.callback;
-                _data.last_progress_percentage = new_progress;
-                _parent->call_user_callback([tmp_callback, new_progress]() {
-                    tmp_callback(LogFiles::Result::PROGRESS, new_progress / 100.0f);
-                });
-            }
-        }
+void LogFilesImpl::update_timeout(double rtt_s)
+{
+    // Like TCP's retransmission timeout (RFC 6298).
+    if (_data.rtt_s <= 0.0) {
+        _data.rtt_s = rtt_s;
+        _data.rtt_var_s = rtt_s / 2.0;
+    } else {
+        _data.rtt_var_s = 0.75 * _data.rtt_var_s + 0.25 * std::fabs(_data.rtt_s - rtt_s);
+        _data.rtt_s = 0.875 * _data.rtt_s + 0.125 * rtt_s;
+    }
+    _data.timeout_s =
+        std::min(std::max(_data.rtt_s + 4.0 * _data.rtt_var_s, MIN_TIMEOUT_S), MAX_TIMEOUT_S);
+}
 
-        if (num_missing > 0) {
-            LogDebug() << "Re-requesting log data " << ofs_to_get;
-            request_log_data(id_to_get, ofs_to_get, bytes_to_get);
-            return;
-        }
+void LogFilesImpl::update_rate()
+{
+    // Measured while the server streams the answer to a request only, the
+    // round trips between requests would make the link look slower than it is.
+    Request& request = _data.request;
+    const double elapsed_s = _time.elapsed_since_s(request.rate_time);
+    if (elapsed_s < RATE_INTERVAL_S) {
+        return;
+    }
+    const double rate_bytes_s = double(request.rate_bytes) / elapsed_s;
+    _data.rate_bytes_s = (_data.rate_bytes_s <= 0.0) ?
+                             rate_bytes_s :
+                             0.5 * _data.rate_bytes_s + 0.5 * rate_bytes_s;
+    request.rate_time = _time.steady_time();
+    request.rate_bytes = 0;
+}
 
-        _parent->unregister_timeout_handler(_data.cookie);
-        tmp_callback = _data.callback;
+void LogFilesImpl::finish_download()
+{
+    if (!close_log_file()) {
+        LogErr() << "Could not write " << _data.file_path << ": " << strerror(errno);
+        fail_download(LogFiles::Result::UNKNOWN);
+        return;
     }
-    write_log_data_to_disk();
+
+    _parent->unregister_timeout_handler(_data.cookie);
+
+    const float kib_s = float(_data.bytes_received) /
+                        float(_time.elapsed_since_s(_data.time_started)) / 1024.0f;
+    LogDebug() << "Downloaded " << _data.size << " B, " << _data.bytes_received << " B received ("
+               << kib_s << " kiB/s)";
 
     if (_data.callback) {
+        LogFiles::download_log_file_callback_t tmp_callback = _data.callback;
         _parent->call_user_callback(
             [tmp_callback]() { tmp_callback(LogFiles::Result::SUCCESS, 1.0f); });
     }
@@ -396,22 +707,81 @@ void LogFilesImpl::request_log_data(unsigned id, unsigned chunk_id, unsigned byt
 
 void LogFilesImpl::data_timeout()
 {
-    {
-        std::lock_guard<std::mutex> lock(_data.mutex);
-        _parent->register_timeout_handler(
-            std::bind(&LogFilesImpl::data_timeout, this), 0.2, &_data.cookie);
+    std::lock_guard<std::mutex> lock(_data.mutex);
+
+    if (_data.fd < 0) {
+        return;
+    }
+
+    if (++_data.retries > MAX_RETRIES) {
+        LogWarn() << "Too many log data retries, giving up.";
+        fail_download(LogFiles::Result::TOO_MANY_RETRIES);
+        return;
     }
-    check_missing_log_data();
+
+    // Backing off in case the link is slower than measured, like TCP does.
+    _data.timeout_s = std::min(_data.timeout_s * 2.0, MAX_TIMEOUT_S);
+    request_missing_log_data(_data.size, _data.size);
 }
 
-void LogFilesImpl::write_log_data_to_disk()
+bool LogFilesImpl::store_log_data(unsigned offset, const uint8_t* data, unsigned count)
 {
-    std::lock_guard<std::mutex> lock(_data.mutex);
+    // Chunks re-requested for gaps behind the window are written right away.
+    if (offset < _data.window_offset) {
+        return write_at(_data.fd, data, count, offset);
+    }
+
+    // Chunks beyond it move the window on once what it holds is written. Chunks
+    // and thus the window start at multiples of CHUNK_SIZE, so none straddles
+    // the end of the window and is partly in the file already.
+    if (offset + count > _data.window_offset + WINDOW_SIZE) {
+        if (!flush_log_data()) {
+            return false;
+        }
+        _data.window_offset = offset;
+        _data.window_end = offset;
+    }
+
+    std::memcpy(&_data.window[offset - _data.window_offset], data, count);
+    _data.window_end = std::max(_data.window_end, offset + count);
+    return true;
+}
 
-    std::ofstream out_file;
-    out_file.open(_data.file_path, std::ios::out | std::ios::binary);
-    out_file.write(reinterpret_cast<char*>(_data.bytes.data()), _data.bytes.size());
-    out_file.close();
+bool LogFilesImpl::flush_log_data()
+{
+    // Parts of the window not received yet are written as well, they are
+    // overwritten once re-requested.
+    const unsigned size = _data.window_end - _data.window_offset;
+    if (size > 0 && !write_at(_data.fd, _data.window.data(), size, _data.window_offset)) {
+        return false;
+    }
+    _data.window_end = _data.window_offset;
+    return true;
+}
+
+bool LogFilesImpl::close_log_file()
+{
+    if (_data.fd < 0) {
+        return true;
+    }
+    bool success = flush_log_data();
+    success = (::close(_data.fd) == 0) && success;
+    _data.fd = -1;
+    _data.window.clear();
+    _data.window.shrink_to_fit();
+    return success;
+}
+
+void LogFilesImpl::fail_download(LogFiles::Result result)
+{
+    close_log_file();
+    _parent->unregister_timeout_handler(_data.cookie);
+    request_end();
+
+    if (_data.callback) {
+        LogFiles::download_log_file_callback_t tmp_callback = _data.callback;
+        _parent->call_user_callback([tmp_callback, result]() { tmp_callback(result, 0.0f); });
+    }
 }
 
 } // namespace mavsdk
@@ -1,12 +1,22 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ftp_log_list.h"
 #include "mavlink_include.h"
 #include "plugins/log_files/log_files.h"
 #include "plugin_impl_base.h"
+#include "range_set.h"
 #include "system.h"
 
 namespace mavsdk {
 
+class MavlinkFTP;
+
 class LogFilesImpl : public PluginImplBase {
 public:
     LogFilesImpl(System& system);
@@ -34,10 +44,33 @@ private:
 
     void request_list_entry(int entry_id);
 
-    void check_missing_log_data();
+    void start_log_data_download(
+        unsigned id,
+        unsigned size,
+        const std::string& file_path,
+        LogFiles::download_log_file_callback_t callback);
+    void download_log_file_ftp(
+        const LogFiles::Entry& entry,
+        const std::string& file_path,
+        LogFiles::download_log_file_callback_t callback);
+    void list_ftp_logs(std::function<void()> callback);
+    void list_ftp_log_directories(
+        std::shared_ptr<std::vector<std::string>> directories, std::function<void()> callback);
+    std::vector<std::string>
+    add_ftp_logs(const std::string& directory, const std::vector<std::string>& entries);
+    std::string find_ftp_log(const LogFiles::Entry& entry);
+
+    void request_missing_log_data(unsigned pending_begin, unsigned pending_end);
+    void send_log_request(unsigned begin, unsigned end);
     void request_log_data(unsigned id, unsigned offset, unsigned bytes_to_get);
     void data_timeout();
-    void write_log_data_to_disk();
+    void update_timeout(double rtt_s);
+    void update_rate();
+    void finish_download();
+    bool store_log_data(unsigned offset, const uint8_t* data, unsigned count);
+    bool flush_log_data();
+    bool close_log_file();
+    void fail_download(LogFiles::Result result);
 
     Time _time{};
 
@@ -50,23 +83,59 @@ private:
         void* cookie{nullptr};
     } _entries{};
 
+    // A LOG_REQUEST_DATA sent. The server answers one at a time, a new request
+    // replaces the one it was answering.
+    struct Request {
+        unsigned offset;
+        unsigned end;
+        unsigned next; ///< Offset after the data received for it so far
+        dl_time_t sent;
+        bool answered;
+        // Data received for it since, to measure the rate the server streams at.
+        dl_time_t rate_time;
+        unsigned rate_bytes;
+    };
+
     struct {
         unsigned id{0};
         std::mutex mutex{};
-        std::vector<uint8_t> bytes{};
-        std::vector<bool> chunks_received{};
+        unsigned size{0};
+        // The log is written to the file as it arrives. Only the most recent
+        // chunks are buffered, so that data arriving in order is written in
+        // larger pieces.
+        int fd{-1};
+        std::vector<uint8_t> window{};
+        unsigned window_offset{0};
+        unsigned window_end{0};
+        RangeSet<unsigned> received{};
+        Request request{};
+        // Round trip time and data rate of the link, measured during downloads.
+        double rtt_s{0.0};
+        double rtt_var_s{0.0};
+        double timeout_s{0.5};
+        double rate_bytes_s{0.0};
         unsigned retries{0};
-        bool rerequesting{false};
         void* cookie{nullptr};
         std::string file_path{};
         LogFiles::download_log_file_callback_t callback{nullptr};
         unsigned last_progress_percentage{0};
-        unsigned chunks_to_rerequest_initially{0};
-        unsigned bytes_received{};
+        unsigned bytes_received{}; ///< Including data received more than once
         dl_time_t time_started{};
     } _data{};
 
+    // Logs are downloaded over MAVLink FTP instead if the autopilot supports it,
+    // which is a lot faster.
+    struct {
+        std::mutex mutex{};
+        std::unique_ptr<MavlinkFTP> client{};
+        bool listed{false};
+        FtpLogList logs{};
+    } _ftp{};
+
+    System& _system;
+
     static constexpr unsigned CHUNK_SIZE = 90;
+    static constexpr unsigned WINDOW_SIZE = 512 * CHUNK_SIZE;
 };
 
 } // namespace mavsdk
@@ -2,8 +2,9 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 
-#include <mavsdk/plugin_base.h>
+#include "plugin_base.h"
 
 namespace mavsdk {
 
@@ -13,7 +14,8 @@ class System;
 /**
  * @brief The Logging class allows log data using logger and log streaming from the vehicle.
  *
- * **This feature is not yet implemented**.
+ * The log is streamed in the ULog format and written to a file while it arrives, ULogReader
+ * reads it afterwards.
  */
 class Logging : public PluginBase {
 public:
@@ -45,6 +47,7 @@ public:
         BUSY, /**< @brief %System busy. */
         COMMAND_DENIED, /**< @brief Command denied. */
         TIMEOUT, /**< @brief Timeout. */
+        FILE_OPEN_FAILED, /**< @brief File to write log to could not be opened. */
         UNKNOWN /**< @brief Unknown error. */
     };
 
@@ -62,36 +65,35 @@ public:
     typedef std::function<void(Result)> result_callback_t;
 
     /**
-     * @brief Start logging (synchronous).
+     * @brief Start log streaming (synchronous).
      *
-     * **This feature is not yet implemented**.
+     * The log is written to the file as it is streamed, messages lost on the way
+     * are marked as dropouts in it.
      *
+     * @param file_path File to write the log to, replaced if it exists.
      * @return Result of request.
      */
-    Result start_logging() const;
+    Result start_logging(const std::string& file_path);
 
     /**
-     * @brief Stop logging (synchronous).
+     * @brief Stop log streaming (synchronous).
      *
-     * **This feature is not yet implemented**.
+     * The log file is complete once this returns.
      *
      * @return Result of request.
      */
-    Result stop_logging() const;
+    Result stop_logging();
 
     /**
-     * @brief Start logging (asynchronous).
-     *
-     * **This feature is not yet implemented**.
+     * @brief Start log streaming (asynchronous).
      *
+     * @param file_path File to write the log to, replaced if it exists.
      * @param callback Callback to get result of request.
      */
-    void start_logging_async(result_callback_t callback);
+    void start_logging_async(const std::string& file_path, result_callback_t callback);
 
     /**
-     * @brief Stop logging (asynchronous).
-     *
-     * **This feature is not yet implemented**.
+     * @brief Stop log streaming (asynchronous).
      *
      * @param callback Callback to get result of request.
      */
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mavsdk {
+
+class ULogReaderImpl;
+
+/**
+ * @brief The ULogReader class reads ULog files, e.g. the ones downloaded with LogFiles or
+ * written by Logging.
+ *
+ * The file is memory mapped and indexed in one pass when it is opened. Messages are then
+ * accessed in place, without being copied, by topic and time range.
+ */
+class ULogReader {
+public:
+    /**
+     * @brief Constructor.
+     */
+    ULogReader();
+
+    /**
+     * @brief Destructor, closes the file.
+     */
+    ~ULogReader();
+
+    /**
+     * @brief Possible results returned when opening a file.
+     */
+    enum class Result {
+        SUCCESS = 0, /**< @brief File opened and indexed. */
+        FILE_OPEN_FAILED, /**< @brief File could not be opened or mapped. */
+        INVALID_FILE, /**< @brief File is not a ULog file. */
+        UNSUPPORTED /**< @brief File uses ULog features which are not supported. */
+    };
+
+    /**
+     * @brief Returns a human-readable English string for `ULogReader::Result`.
+     *
+     * @param result The enum value for which a human readable string is required.
+     * @return Human readable string for the `ULogReader::Result`.
+     */
+    static const char* result_str(Result result);
+
+    /**
+     * @brief Map the file and build the index of its messages.
+     *
+     * A file that was already open is closed. A file cut off in the middle of a message, e.g.
+     * because the logger was stopped, is read up to that message.
+     *
+     * @param file_path ULog file to read.
+     * @return Result of opening the file.
+     */
+    Result open(const std::string& file_path);
+
+    /**
+     * @brief Unmap the file, messages accessed before are invalid after this.
+     */
+    void close();
+
+    /**
+     * @brief Field of a message format.
+     */
+    struct Field {
+        /**
+         * @brief Type of a field.
+         */
+        enum class Type {
+            INT8,
+            UINT8,
+            INT16,
+            UINT16,
+            INT32,
+            UINT32,
+            INT64,
+            UINT64,
+            FLOAT,
+            DOUBLE,
+            BOOL,
+            CHAR,
+            NESTED /**< @brief Another format, named by `type_name`. */
+        };
+
+        Type type; /**< @brief Type of the field. */
+        std::string type_name; /**< @brief Type as named in the file, e.g. `float`. */
+        std::string name; /**< @brief Name of the field. */
+        unsigned array_size; /**< @brief Number of elements, 0 if not an array. */
+        unsigned offset; /**< @brief Offset of the field from the start of the message. */
+        unsigned size; /**< @brief Size of one element in bytes. */
+    };
+
+    /**
+     * @brief Format of the messages of a topic.
+     */
+    struct Format {
+        std::string name; /**< @brief Name of the format. */
+        std::vector<Field> fields; /**< @brief Fields, including padding ones. */
+        unsigned size; /**< @brief Size of a message in bytes. */
+
+        /**
+         * @brief Find a field by name.
+         *
+         * @param field_name Name of the field.
+         * @return The field or `nullptr` if there is none of that name.
+         */
+        const Field* field(const std::string& field_name) const;
+    };
+
+    /**
+     * @brief A topic logged, one of possibly several instances of a format.
+     */
+    struct Topic {
+        std::string name; /**< @brief Name of the format logged. */
+        uint8_t multi_id; /**< @brief Instance of the topic, 0 for the first one. */
+        size_t message_count; /**< @brief Number of messages logged. */
+        uint64_t first_timestamp_us; /**< @brief Timestamp of the first message. */
+        uint64_t last_timestamp_us; /**< @brief Timestamp of the last message. */
+    };
+
+    /**
+     * @brief A logged message, pointing into the mapped file.
+     */
+    class Message {
+    public:
+        /**
+         * @brief Constructor (internal use only).
+         */
+        Message(const uint8_t* data, size_t size) : _data(data), _size(size) {}
+
+        /**
+         * @brief Timestamp of the message, the first field of every message.
+         */
+        uint64_t timestamp_us() const { return get<uint64_t>(0); }
+
+        /**
+         * @brief Message as logged, laid out as described by its format.
+         */
+        const uint8_t* data() const { return _data; }
+
+        /**
+         * @brief Size of the message in bytes.
+         */
+        size_t size() const { return _size; }
+
+        /**
+         * @brief Read the value of a field.
+         *
+         * Fields are not aligned in the file, so only the value read is copied.
+         *
+         * @param field Field of the format of this message.
+         * @param index Element to read if the field is an array.
+         * @return The value, 0 if `T` does not match the size of the field.
+         */
+        template<typename T> T get(const Field& field, unsigned index = 0) const
+        {
+            if (sizeof(T) != field.size) {
+                return T{};
+            }
+            return get<T>(field.offset + index * field.size);
+        }
+
+        /**
+         * @brief Read a value at an offset from the start of the message.
+         *
+         * @param offset Offset in bytes.
+         * @return The value, 0 if it is not within the message.
+         */
+        template<typename T> T get(size_t offset) const
+        {
+            T value{};
+            if (offset + sizeof(T) <= _size) {
+                memcpy(&value, _data + offset, sizeof(T));
+            }
+            return value;
+        }
+
+    private:
+        const uint8_t* _data;
+        size_t _size;
+    };
+
+    /**
+     * @brief A string logged, e.g. a warning shown to the pilot.
+     */
+    struct LoggedString {
+        uint8_t log_level; /**< @brief Level as in syslog, '0' (emergency) to '7' (debug). */
+        uint64_t timestamp_us; /**< @brief Time the string was logged. */
+        std::string message; /**< @brief The string. */
+    };
+
+    /**
+     * @brief Topics logged in the file, ordered by name and instance.
+     */
+    std::vector<Topic> topics() const;
+
+    /**
+     * @brief Find a message format by name.
+     *
+     * @param name Name of the format, e.g. `vehicle_attitude`.
+     * @return The format or `nullptr` if there is none of that name.
+     */
+    const Format* format(const std::string& name) const;
+
+    /**
+     * @brief Read a string information, e.g. `sys_name` or `ver_sw`.
+     *
+     * @param key Name of the information.
+     * @param value Set to the value if found.
+     * @return true if a string information of that name was found.
+     */
+    bool info(const std::string& key, std::string& value) const;
+
+    /**
+     * @brief Strings logged, in the order logged.
+     */
+    const std::vector<LoggedString>& logged_strings() const;
+
+    /**
+     * @brief Callback type for messages, returns false to stop iterating.
+     */
+    typedef std::function<bool(const Message&)> message_callback_t;
+
+    /**
+     * @brief Iterate over the messages of a topic in a time range.
+     *
+     * The start of the range is found with a binary search in the index, only the messages of
+     * the range are accessed.
+     *
+     * @param topic_name Name of the topic.
+     * @param multi_id Instance of the topic.
+     * @param callback Called for every message, in the order logged.
+     * @param start_us Timestamp of the first message to include.
+     * @param end_us Timestamp after the last message to include.
+     * @return Number of messages the callback was called with.
+     */
+    size_t for_each_message(
+        const std::string& topic_name,
+        uint8_t multi_id,
+        const message_callback_t& callback,
+        uint64_t start_us = 0,
+        uint64_t end_us = UINT64_MAX) const;
+
+    // Non-copyable
+    ULogReader(const ULogReader&) = delete;
+    const ULogReader& operator=(const ULogReader&) = delete;
+
+private:
+    std::unique_ptr<ULogReaderImpl> _impl;
+};
+
+} // namespace mavsdk
@@ -1,4 +1,4 @@
-#include "logging.h"
+#include "plugins/logging/logging.h"
 #include "logging_impl.h"
 
 namespace mavsdk {
@@ -7,19 +7,19 @@ Logging::Logging(System& system) : PluginBase(), _impl{new LoggingImpl(system)}
 
 Logging::~Logging() {}
 
-Logging::Result Logging::start_logging() const
+Logging::Result Logging::start_logging(const std::string& file_path)
 {
-    return _impl->start_logging();
+    return _impl->start_logging(file_path);
 }
 
-Logging::Result Logging::stop_logging() const
+Logging::Result Logging::stop_logging()
 {
     return _impl->stop_logging();
 }
 
-void Logging::start_logging_async(result_callback_t callback)
+void Logging::start_logging_async(const std::string& file_path, result_callback_t callback)
 {
-    _impl->start_logging_async(callback);
+    _impl->start_logging_async(file_path, callback);
 }
 
 void Logging::stop_logging_async(result_callback_t callback)
@@ -42,6 +42,8 @@ const char* Logging::result_str(Result result)
             return "Command denied";
         case Result::TIMEOUT:
             return "Timeout";
+        case Result::FILE_OPEN_FAILED:
+            return "File open failed";
         case Result::UNKNOWN:
         default:
             return "Unknown";
@@ -31,24 +31,34 @@ void LoggingImpl::init()
 void LoggingImpl::deinit()
 {
     _parent->unregister_all_mavlink_message_handlers(this);
+    close_log_file();
 }
 
 void LoggingImpl::enable() {}
 
 void LoggingImpl::disable() {}
 
-Logging::Result LoggingImpl::start_logging() const
+Logging::Result LoggingImpl::start_logging(const std::string& file_path)
 {
+    // The file is opened before the stream starts, the header comes first.
+    if (!_writer.open(file_path)) {
+        return Logging::Result::FILE_OPEN_FAILED;
+    }
+
     MAVLinkCommands::CommandLong command{};
 
     command.command = MAV_CMD_LOGGING_START;
     MAVLinkCommands::CommandLong::set_as_reserved(command.params, 0.f);
     command.target_component_id = _parent->get_autopilot_id();
 
-    return logging_result_from_command_result(_parent->send_command(command));
+    const auto result = logging_result_from_command_result(_parent->send_command(command));
+    if (result != Logging::Result::SUCCESS) {
+        _writer.close();
+    }
+    return result;
 }
 
-Logging::Result LoggingImpl::stop_logging() const
+Logging::Result LoggingImpl::stop_logging()
 {
     MAVLinkCommands::CommandLong command{};
 
@@ -56,19 +66,37 @@ Logging::Result LoggingImpl::stop_logging() const
     MAVLinkCommands::CommandLong::set_as_reserved(command.params, 0.f);
     command.target_component_id = _parent->get_autopilot_id();
 
-    return logging_result_from_command_result(_parent->send_command(command));
+    const auto result = logging_result_from_command_result(_parent->send_command(command));
+    close_log_file();
+    return result;
 }
 
-void LoggingImpl::start_logging_async(const Logging::result_callback_t& callback)
+void LoggingImpl::start_logging_async(
+    const std::string& file_path, const Logging::result_callback_t& callback)
 {
+    if (!_writer.open(file_path)) {
+        if (callback) {
+            _parent->call_user_callback(
+                [callback]() { callback(Logging::Result::FILE_OPEN_FAILED); });
+        }
+        return;
+    }
+
     MAVLinkCommands::CommandLong command{};
 
     command.command = MAV_CMD_LOGGING_START;
     MAVLinkCommands::CommandLong::set_as_reserved(command.params, 0.f);
     command.target_component_id = _parent->get_autopilot_id();
 
-    _parent->send_command_async(
-        command, std::bind(&LoggingImpl::command_result_callback, std::placeholders::_1, callback));
+    _parent->send_command_async(command, [this, callback](MAVLinkCommands::Result result, float) {
+        if (result == MAVLinkCommands::Result::IN_PROGRESS) {
+            return;
+        }
+        if (result != MAVLinkCommands::Result::SUCCESS) {
+            _writer.close();
+        }
+        command_result_callback(result, callback);
+    });
 }
 
 void LoggingImpl::stop_logging_async(const Logging::result_callback_t& callback)
@@ -79,14 +107,25 @@ void LoggingImpl::stop_logging_async(const Logging::result_callback_t& callback)
     MAVLinkCommands::CommandLong::set_as_reserved(command.params, 0.f);
     command.target_component_id = _parent->get_autopilot_id();
 
-    _parent->send_command_async(
-        command, std::bind(&LoggingImpl::command_result_callback, std::placeholders::_1, callback));
+    _parent->send_command_async(command, [this, callback](MAVLinkCommands::Result result, float) {
+        if (result == MAVLinkCommands::Result::IN_PROGRESS) {
+            return;
+        }
+        close_log_file();
+        command_result_callback(result, callback);
+    });
 }
 
 void LoggingImpl::process_logging_data(const mavlink_message_t& message)
 {
     mavlink_logging_data_t logging_data;
     mavlink_msg_logging_data_decode(&message, &logging_data);
+
+    _writer.add_data(
+        logging_data.sequence,
+        logging_data.first_message_offset,
+        logging_data.data,
+        logging_data.length);
 }
 
 void LoggingImpl::process_logging_data_acked(const mavlink_message_t& message)
@@ -94,10 +133,16 @@ void LoggingImpl::process_logging_data_acked(const mavlink_message_t& message)
     mavlink_logging_data_acked_t logging_data_acked;
     mavlink_msg_logging_data_acked_decode(&message, &logging_data_acked);
 
+    _writer.add_data(
+        logging_data_acked.sequence,
+        logging_data_acked.first_message_offset,
+        logging_data_acked.data,
+        logging_data_acked.length);
+
     mavlink_message_t answer;
     mavlink_msg_logging_ack_pack(
-        GCSClient::system_id,
-        GCSClient::component_id,
+        _parent->get_own_system_id(),
+        _parent->get_own_component_id(),
         &answer,
         _parent->get_system_id(),
         _parent->get_autopilot_id(),
@@ -106,6 +151,22 @@ void LoggingImpl::process_logging_data_acked(const mavlink_message_t& message)
     _parent->send_message(answer);
 }
 
+void LoggingImpl::close_log_file()
+{
+    if (!_writer.is_open()) {
+        return;
+    }
+    _writer.close();
+
+    const auto stats = _writer.stats();
+    LogInfo() << "Log stream: " << stats.bytes_written << " bytes written, "
+              << stats.packets_lost << " of "
+              << stats.packets_received + stats.packets_lost << " packets lost";
+    if (stats.write_error) {
+        LogErr() << "Log file is incomplete, writing failed";
+    }
+}
+
 Logging::Result LoggingImpl::logging_result_from_command_result(MAVLinkCommands::Result result)
 {
     switch (result) {
@@ -1,9 +1,12 @@
 #pragma once
 
-#include "logging.h"
+#include <string>
+
 #include "mavlink_include.h"
+#include "plugins/logging/logging.h"
 #include "plugin_impl_base.h"
 #include "system.h"
+#include "ulog_stream_writer.h"
 
 namespace mavsdk {
 
@@ -18,20 +21,25 @@ public:
     void enable() override;
     void disable() override;
 
-    Logging::Result start_logging() const;
-    Logging::Result stop_logging() const;
+    Logging::Result start_logging(const std::string& file_path);
+    Logging::Result stop_logging();
 
-    void start_logging_async(const Logging::result_callback_t& callback);
+    void start_logging_async(
+        const std::string& file_path, const Logging::result_callback_t& callback);
     void stop_logging_async(const Logging::result_callback_t& callback);
 
 private:
     void process_logging_data(const mavlink_message_t& message);
     void process_logging_data_acked(const mavlink_message_t& message);
 
+    void close_log_file();
+
     static Logging::Result logging_result_from_command_result(MAVLinkCommands::Result result);
 
     static void command_result_callback(
         MAVLinkCommands::Result command_result, const Logging::result_callback_t& callback);
+
+    ULogStreamWriter _writer{};
 };
 
 } // namespace mavsdk
@@ -0,0 +1,76 @@
+#include "plugins/logging/ulog_reader.h"
+#include "ulog_reader_impl.h"
+
+namespace mavsdk {
+
+ULogReader::ULogReader() : _impl{new ULogReaderImpl()} {}
+
+ULogReader::~ULogReader() {}
+
+ULogReader::Result ULogReader::open(const std::string& file_path)
+{
+    return _impl->open(file_path);
+}
+
+void ULogReader::close()
+{
+    _impl->close();
+}
+
+std::vector<ULogReader::Topic> ULogReader::topics() const
+{
+    return _impl->topics();
+}
+
+const ULogReader::Format* ULogReader::format(const std::string& name) const
+{
+    return _impl->format(name);
+}
+
+bool ULogReader::info(const std::string& key, std::string& value) const
+{
+    return _impl->info(key, value);
+}
+
+const std::vector<ULogReader::LoggedString>& ULogReader::logged_strings() const
+{
+    return _impl->logged_strings();
+}
+
+size_t ULogReader::for_each_message(
+    const std::string& topic_name,
+    uint8_t multi_id,
+    const message_callback_t& callback,
+    uint64_t start_us,
+    uint64_t end_us) const
+{
+    return _impl->for_each_message(topic_name, multi_id, callback, start_us, end_us);
+}
+
+const ULogReader::Field* ULogReader::Format::field(const std::string& field_name) const
+{
+    for (const auto& it : fields) {
+        if (it.name == field_name) {
+            return &it;
+        }
+    }
+    return nullptr;
+}
+
+const char* ULogReader::result_str(Result result)
+{
+    switch (result) {
+        case Result::SUCCESS:
+            return "Success";
+        case Result::FILE_OPEN_FAILED:
+            return "File open failed";
+        case Result::INVALID_FILE:
+            return "Invalid file";
+        case Result::UNSUPPORTED:
+            return "Unsupported";
+        default:
+            return "Unknown";
+    }
+}
+
+} // namespace mavsdk
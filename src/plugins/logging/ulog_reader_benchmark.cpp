@@ -0,0 +1,226 @@
+// Measures how fast ULogReader indexes and reads a large log.
+//
+// Run with the path of a ULog file, or without arguments to write a 2 GB log
+// with a mix of topics like PX4 logs first (removed again afterwards). Prints
+// GB/s of building the index and MB/s of reading a topic completely and in a
+// time range. The file is read from the page cache once it was written, drop
+// the caches to measure reading from disk.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "plugins/logging/ulog_reader.h"
+
+using namespace mavsdk;
+
+namespace {
+
+constexpr uint64_t generated_size = 2ull * 1024 * 1024 * 1024;
+const char* generated_path = "ulog_reader_benchmark.ulg";
+
+struct GeneratedTopic {
+    const char* name;
+    unsigned floats;
+    unsigned interval_us;
+};
+
+// Sizes and rates roughly like a PX4 log with the high rate profile.
+const GeneratedTopic generated_topics[] = {{"sensor_gyro", 4, 1000},
+                                           {"sensor_accel", 4, 1000},
+                                           {"vehicle_attitude", 10, 2000},
+                                           {"vehicle_local_position", 30, 5000},
+                                           {"actuator_outputs", 17, 2500},
+                                           {"battery_status", 40, 100000}};
+
+class Output {
+public:
+    explicit Output(FILE* file) : _file(file) {}
+
+    template<typename T> void add(T value)
+    {
+        uint8_t bytes[sizeof(T)];
+        memcpy(bytes, &value, sizeof(T));
+        _buffer.insert(_buffer.end(), bytes, bytes + sizeof(T));
+    }
+
+    void add(const std::string& text) { _buffer.insert(_buffer.end(), text.begin(), text.end()); }
+
+    void add_message(char type, const std::vector<uint8_t>& payload)
+    {
+        add(uint16_t(payload.size()));
+        add(type);
+        _buffer.insert(_buffer.end(), payload.begin(), payload.end());
+        if (_buffer.size() > 1024 * 1024) {
+            flush();
+        }
+    }
+
+    void flush()
+    {
+        _written += fwrite(_buffer.data(), 1, _buffer.size(), _file);
+        _buffer.clear();
+    }
+
+    uint64_t written() const { return _written + _buffer.size(); }
+
+    // Non-copyable
+    Output(const Output&) = delete;
+    const Output& operator=(const Output&) = delete;
+
+private:
+    FILE* _file;
+    std::vector<uint8_t> _buffer{};
+    uint64_t _written{0};
+};
+
+bool generate(const char* path)
+{
+    FILE* file = fopen(path, "wb");
+    if (!file) {
+        return false;
+    }
+
+    Output output(file);
+    output.add(std::string("ULog\x01\x12\x35\x01", 8));
+    output.add(uint64_t(0));
+
+    uint16_t msg_id = 0;
+    for (const auto& topic : generated_topics) {
+        std::string format = std::string(topic.name) + ":uint64_t timestamp;";
+        for (unsigned i = 0; i < topic.floats; ++i) {
+            format += "float f" + std::to_string(i) + ";";
+        }
+        output.add_message('F', std::vector<uint8_t>(format.begin(), format.end()));
+
+        std::vector<uint8_t> subscription{0, uint8_t(msg_id), uint8_t(msg_id >> 8)};
+        subscription.insert(subscription.end(), topic.name, topic.name + strlen(topic.name));
+        output.add_message('A', subscription);
+        ++msg_id;
+    }
+
+    std::vector<uint8_t> payload;
+    for (uint64_t time_us = 0; output.written() < generated_size; time_us += 1000) {
+        msg_id = 0;
+        for (const auto& topic : generated_topics) {
+            if (time_us % topic.interval_us == 0) {
+                payload.assign({uint8_t(msg_id), uint8_t(msg_id >> 8)});
+                for (unsigned i = 0; i < 8; ++i) {
+                    payload.push_back(uint8_t(time_us >> (8 * i)));
+                }
+                for (unsigned i = 0; i < topic.floats; ++i) {
+                    const float value = float(time_us % 1000000) * 1e-6f + float(i);
+                    uint8_t bytes[sizeof(value)];
+                    memcpy(bytes, &value, sizeof(value));
+                    payload.insert(payload.end(), bytes, bytes + sizeof(value));
+                }
+                output.add_message('D', payload);
+            }
+            ++msg_id;
+        }
+    }
+
+    output.flush();
+    return fclose(file) == 0;
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool generated = (argc < 2);
+    const char* path = generated ? generated_path : argv[1];
+
+    if (generated) {
+        printf("Writing %s...\n", path);
+        if (!generate(path)) {
+            printf("Could not write %s\n", path);
+            return 1;
+        }
+    }
+
+    ULogReader reader;
+    auto start = std::chrono::steady_clock::now();
+    const auto result = reader.open(path);
+    const double index_s = seconds_since(start);
+    if (result != ULogReader::Result::SUCCESS) {
+        printf("Could not open %s: %s\n", path, ULogReader::result_str(result));
+        return 1;
+    }
+
+    FILE* file = fopen(path, "rb");
+    fseek(file, 0, SEEK_END);
+    const double file_size = double(ftell(file));
+    fclose(file);
+
+    size_t messages = 0;
+    ULogReader::Topic largest{};
+    for (const auto& topic : reader.topics()) {
+        messages += topic.message_count;
+        if (topic.message_count > largest.message_count) {
+            largest = topic;
+        }
+    }
+    printf(
+        "index:      %6.2f GB/s (%.1f GB, %zu messages in %.2f s)\n",
+        file_size / index_s / 1e9,
+        file_size / 1e9,
+        messages,
+        index_s);
+
+    // All messages of the topic logged most, touching every byte of them.
+    uint64_t checksum = 0;
+    uint64_t bytes = 0;
+    start = std::chrono::steady_clock::now();
+    const size_t read = reader.for_each_message(
+        largest.name, largest.multi_id, [&](const ULogReader::Message& message) {
+            for (size_t i = 0; i < message.size(); ++i) {
+                checksum += message.data()[i];
+            }
+            bytes += message.size();
+            return true;
+        });
+    const double read_s = seconds_since(start);
+    printf(
+        "topic:      %6.0f MB/s, %6.1f M messages/s (%s, %zu messages)\n",
+        double(bytes) / read_s / 1e6,
+        double(read) / read_s / 1e6,
+        largest.name.c_str(),
+        read);
+
+    // The middle tenth of the log, found in the index.
+    const uint64_t duration_us = largest.last_timestamp_us - largest.first_timestamp_us;
+    const uint64_t range_start_us = largest.first_timestamp_us + duration_us / 2;
+    start = std::chrono::steady_clock::now();
+    const size_t range_read = reader.for_each_message(
+        largest.name,
+        largest.multi_id,
+        [&](const ULogReader::Message& message) {
+            checksum += message.timestamp_us();
+            return true;
+        },
+        range_start_us,
+        range_start_us + duration_us / 10);
+    const double range_s = seconds_since(start);
+    printf(
+        "time range: %6.1f M messages/s (%zu messages in %.3f s)\n",
+        double(range_read) / range_s / 1e6,
+        range_read,
+        range_s);
+
+    printf("(checksum %llu)\n", static_cast<unsigned long long>(checksum));
+
+    reader.close();
+    if (generated) {
+        remove(path);
+    }
+    return 0;
+}
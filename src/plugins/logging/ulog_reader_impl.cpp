@@ -0,0 +1,527 @@
+#include "ulog_reader_impl.h"
+#include "log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <tuple>
+#if defined(WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mavsdk {
+
+namespace {
+
+// File header: magic, version and timestamp.
+constexpr size_t HEADER_SIZE = 16;
+constexpr uint8_t MAGIC[] = {'U', 'L', 'o', 'g', 0x01, 0x12, 0x35};
+
+// Messages start with their payload size and type.
+constexpr size_t MESSAGE_HEADER_SIZE = 3;
+constexpr uint8_t MESSAGE_TYPE_FLAG_BITS = 'B';
+constexpr uint8_t MESSAGE_TYPE_FORMAT = 'F';
+constexpr uint8_t MESSAGE_TYPE_INFO = 'I';
+constexpr uint8_t MESSAGE_TYPE_ADD_LOGGED = 'A';
+constexpr uint8_t MESSAGE_TYPE_DATA = 'D';
+constexpr uint8_t MESSAGE_TYPE_LOGGING = 'L';
+constexpr uint8_t MESSAGE_TYPE_LOGGING_TAGGED = 'C';
+
+// Data messages start with the msg_id, followed by the timestamp.
+constexpr size_t MSG_ID_SIZE = 2;
+constexpr size_t MIN_DATA_SIZE = MSG_ID_SIZE + sizeof(uint64_t);
+
+// Incompatible flag of files with data appended at the offsets given.
+constexpr uint8_t INCOMPAT_FLAG_DATA_APPENDED = 0x01;
+constexpr unsigned APPENDED_OFFSETS = 3;
+
+// Formats nested deeper than this are taken as a loop.
+constexpr unsigned MAX_NESTING = 8;
+
+template<typename T> T read(const uint8_t* data)
+{
+    T value;
+    memcpy(&value, data, sizeof(T));
+    return value;
+}
+
+bool parse_type(const std::string& type_name, ULogReader::Field& field)
+{
+    static const struct {
+        const char* name;
+        ULogReader::Field::Type type;
+        unsigned size;
+    } types[] = {{"int8_t", ULogReader::Field::Type::INT8, 1},
+                 {"uint8_t", ULogReader::Field::Type::UINT8, 1},
+                 {"int16_t", ULogReader::Field::Type::INT16, 2},
+                 {"uint16_t", ULogReader::Field::Type::UINT16, 2},
+                 {"int32_t", ULogReader::Field::Type::INT32, 4},
+                 {"uint32_t", ULogReader::Field::Type::UINT32, 4},
+                 {"int64_t", ULogReader::Field::Type::INT64, 8},
+                 {"uint64_t", ULogReader::Field::Type::UINT64, 8},
+                 {"float", ULogReader::Field::Type::FLOAT, 4},
+                 {"double", ULogReader::Field::Type::DOUBLE, 8},
+                 {"bool", ULogReader::Field::Type::BOOL, 1},
+                 {"char", ULogReader::Field::Type::CHAR, 1}};
+
+    // Arrays are written as e.g. `float[3]`.
+    const auto bracket = type_name.find('[');
+    field.type_name = type_name.substr(0, bracket);
+    field.array_size = 0;
+    if (bracket != std::string::npos) {
+        field.array_size = unsigned(strtoul(type_name.c_str() + bracket + 1, nullptr, 10));
+        if (field.array_size == 0) {
+            return false;
+        }
+    }
+
+    for (const auto& type : types) {
+        if (field.type_name == type.name) {
+            field.type = type.type;
+            field.size = type.size;
+            return true;
+        }
+    }
+    // The size of another format is known once all of them are read.
+    field.type = ULogReader::Field::Type::NESTED;
+    field.size = 0;
+    return !field.type_name.empty();
+}
+
+} // namespace
+
+ULogReaderImpl::~ULogReaderImpl()
+{
+    close();
+}
+
+ULogReader::Result ULogReaderImpl::open(const std::string& file_path)
+{
+    close();
+
+    if (!map_file(file_path)) {
+        return ULogReader::Result::FILE_OPEN_FAILED;
+    }
+
+    const auto result = build_index();
+    if (result != ULogReader::Result::SUCCESS) {
+        close();
+    }
+    return result;
+}
+
+void ULogReaderImpl::close()
+{
+    unmap_file();
+    _formats.clear();
+    _subscriptions.clear();
+    _info.clear();
+    _logged_strings.clear();
+}
+
+bool ULogReaderImpl::map_file(const std::string& file_path)
+{
+#if defined(WINDOWS)
+    HANDLE file = CreateFileA(
+        file_path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_FLAG_SEQUENTIAL_SCAN,
+        nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LogErr() << "Could not open " << file_path;
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        LogErr() << "Could not map " << file_path;
+        return false;
+    }
+
+    // The view keeps the mapping and the file open.
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (mapping) {
+        CloseHandle(mapping);
+    }
+    CloseHandle(file);
+    if (!data) {
+        LogErr() << "Could not map " << file_path;
+        return false;
+    }
+
+    _data = static_cast<const uint8_t*>(data);
+    _size = size_t(size.QuadPart);
+#else
+    const int fd = ::open(file_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LogErr() << "Could not open " << file_path << ": " << strerror(errno);
+        return false;
+    }
+
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        ::close(fd);
+        LogErr() << "Could not map " << file_path;
+        return false;
+    }
+
+    // The mapping keeps the file open.
+    const size_t size = size_t(file_stat.st_size);
+    void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        LogErr() << "Could not map " << file_path << ": " << strerror(errno);
+        return false;
+    }
+
+    _data = static_cast<const uint8_t*>(data);
+    _size = size;
+#endif
+    return true;
+}
+
+void ULogReaderImpl::unmap_file()
+{
+    if (!_data) {
+        return;
+    }
+#if defined(WINDOWS)
+    UnmapViewOfFile(_data);
+#else
+    munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+}
+
+ULogReader::Result ULogReaderImpl::build_index()
+{
+    if (_size < HEADER_SIZE || memcmp(_data, MAGIC, sizeof(MAGIC)) != 0) {
+        return ULogReader::Result::INVALID_FILE;
+    }
+
+#if !defined(WINDOWS)
+    // Read once from start to end, pages are read ahead and can go again.
+    posix_madvise(const_cast<uint8_t*>(_data), _size, POSIX_MADV_SEQUENTIAL);
+#endif
+
+    // Without appended data the messages go up to the end of the file. With it, a message may
+    // be cut off where the appended data starts.
+    std::vector<uint64_t> appended;
+    size_t end = _size;
+    size_t offset = HEADER_SIZE;
+
+    while (true) {
+        if (offset + MESSAGE_HEADER_SIZE > end ||
+            offset + MESSAGE_HEADER_SIZE + read<uint16_t>(_data + offset) > end) {
+            if (offset < end) {
+                LogWarn() << "ULog message cut off at offset " << offset;
+            }
+            if (appended.empty()) {
+                break;
+            }
+            offset = size_t(appended.front());
+            appended.erase(appended.begin());
+            end = appended.empty() ? _size : size_t(appended.front());
+            continue;
+        }
+
+        const uint8_t* message = _data + offset;
+        const size_t size = read<uint16_t>(message);
+        const uint8_t type = message[2];
+        const uint8_t* payload = message + MESSAGE_HEADER_SIZE;
+
+        if (type == MESSAGE_TYPE_DATA) {
+            // Too short to even hold the msg_id, which would be read past the message.
+            if (size >= MIN_DATA_SIZE) {
+                const uint16_t msg_id = read<uint16_t>(payload);
+                if (msg_id < _subscriptions.size() && !_subscriptions[msg_id].name.empty()) {
+                    _subscriptions[msg_id].offsets.push_back(offset);
+                }
+            }
+        } else if (type == MESSAGE_TYPE_FLAG_BITS) {
+            // Only the first message can be the flag bits.
+            if (offset == HEADER_SIZE) {
+                if (!read_flag_bits(payload, size, appended)) {
+                    return ULogReader::Result::UNSUPPORTED;
+                }
+                if (!appended.empty()) {
+                    end = size_t(appended.front());
+                }
+            }
+        } else if (type == MESSAGE_TYPE_FORMAT) {
+            add_format(payload, size);
+        } else if (type == MESSAGE_TYPE_INFO) {
+            add_info(payload, size);
+        } else if (type == MESSAGE_TYPE_ADD_LOGGED) {
+            add_subscription(payload, size);
+        } else if (type == MESSAGE_TYPE_LOGGING) {
+            add_logged_string(payload, size, false);
+        } else if (type == MESSAGE_TYPE_LOGGING_TAGGED) {
+            add_logged_string(payload, size, true);
+        }
+        // Other messages, e.g. parameters or dropouts, are not needed to read the data.
+
+        offset += MESSAGE_HEADER_SIZE + size;
+    }
+
+#if !defined(WINDOWS)
+    posix_madvise(const_cast<uint8_t*>(_data), _size, POSIX_MADV_NORMAL);
+#endif
+
+    for (auto& it : _formats) {
+        if (!resolve_format(it.second, 0)) {
+            LogWarn() << "ULog format " << it.first << " refers to an unknown format";
+        }
+    }
+
+    return ULogReader::Result::SUCCESS;
+}
+
+bool ULogReaderImpl::read_flag_bits(
+    const uint8_t* payload, size_t size, std::vector<uint64_t>& appended)
+{
+    // Compatible flags, incompatible flags and the appended offsets.
+    constexpr size_t FLAGS_SIZE = 8;
+    if (size < 2 * FLAGS_SIZE + APPENDED_OFFSETS * sizeof(uint64_t)) {
+        return true;
+    }
+
+    const uint8_t* incompat_flags = payload + FLAGS_SIZE;
+    if ((incompat_flags[0] & ~INCOMPAT_FLAG_DATA_APPENDED) != 0 ||
+        std::any_of(incompat_flags + 1, incompat_flags + FLAGS_SIZE, [](uint8_t flags) {
+            return flags != 0;
+        })) {
+        LogErr() << "ULog file uses unknown incompatible flags";
+        return false;
+    }
+
+    if (incompat_flags[0] & INCOMPAT_FLAG_DATA_APPENDED) {
+        uint64_t last = HEADER_SIZE;
+        for (unsigned i = 0; i < APPENDED_OFFSETS; ++i) {
+            const uint64_t appended_offset =
+                read<uint64_t>(payload + 2 * FLAGS_SIZE + i * sizeof(uint64_t));
+            if (appended_offset <= last || appended_offset > _size) {
+                break;
+            }
+            appended.push_back(appended_offset);
+            last = appended_offset;
+        }
+    }
+    return true;
+}
+
+void ULogReaderImpl::add_format(const uint8_t* payload, size_t size)
+{
+    // Written as `name:type field;type field;`.
+    const std::string text(reinterpret_cast<const char*>(payload), size);
+    const auto colon = text.find(':');
+    if (colon == std::string::npos || colon == 0) {
+        return;
+    }
+
+    ULogReader::Format format{text.substr(0, colon), {}, 0};
+    size_t start = colon + 1;
+    while (start < text.size()) {
+        auto stop = text.find(';', start);
+        if (stop == std::string::npos) {
+            stop = text.size();
+        }
+        const std::string declaration = text.substr(start, stop - start);
+        start = stop + 1;
+
+        const auto space = declaration.find(' ');
+        if (space == std::string::npos) {
+            continue;
+        }
+        ULogReader::Field field{};
+        if (!parse_type(declaration.substr(0, space), field)) {
+            LogWarn() << "ULog format " << format.name << " has an invalid field";
+            return;
+        }
+        field.name = declaration.substr(space + 1);
+        format.fields.push_back(field);
+    }
+
+    _formats.erase(format.name);
+    _formats.emplace(format.name, format);
+}
+
+void ULogReaderImpl::add_info(const uint8_t* payload, size_t size)
+{
+    // The key declares the type of the value, e.g. `char[10] sys_name`.
+    if (size < 1 || size < 1u + payload[0]) {
+        return;
+    }
+    const std::string key(reinterpret_cast<const char*>(payload) + 1, payload[0]);
+    const auto space = key.find(' ');
+    if (space == std::string::npos || key.compare(0, 5, "char[") != 0) {
+        return;
+    }
+    _info[key.substr(space + 1)] =
+        std::string(reinterpret_cast<const char*>(payload) + 1 + payload[0], size - 1 - payload[0]);
+}
+
+void ULogReaderImpl::add_subscription(const uint8_t* payload, size_t size)
+{
+    // multi_id, msg_id and the format name.
+    if (size <= 3) {
+        return;
+    }
+    const uint16_t msg_id = read<uint16_t>(payload + 1);
+    if (msg_id >= _subscriptions.size()) {
+        _subscriptions.resize(size_t(msg_id) + 1);
+    }
+    Subscription& subscription = _subscriptions[msg_id];
+    subscription.name.assign(reinterpret_cast<const char*>(payload) + 3, size - 3);
+    subscription.multi_id = payload[0];
+    subscription.offsets.clear();
+}
+
+void ULogReaderImpl::add_logged_string(const uint8_t* payload, size_t size, bool tagged)
+{
+    // Log level, tag if tagged, timestamp and the string.
+    const size_t header_size = 1 + (tagged ? 2 : 0) + sizeof(uint64_t);
+    if (size < header_size) {
+        return;
+    }
+    _logged_strings.push_back(ULogReader::LoggedString{
+        payload[0],
+        read<uint64_t>(payload + header_size - sizeof(uint64_t)),
+        std::string(reinterpret_cast<const char*>(payload) + header_size, size - header_size)});
+}
+
+bool ULogReaderImpl::resolve_format(ULogReader::Format& format, unsigned depth)
+{
+    unsigned offset = 0;
+    bool resolved = true;
+    for (auto& field : format.fields) {
+        if (field.type == ULogReader::Field::Type::NESTED) {
+            auto nested = _formats.find(field.type_name);
+            if (depth < MAX_NESTING && nested != _formats.end() &&
+                resolve_format(nested->second, depth + 1)) {
+                field.size = nested->second.size;
+            } else {
+                field.size = 0;
+                resolved = false;
+            }
+        }
+        field.offset = offset;
+        offset += field.size * std::max(field.array_size, 1u);
+    }
+    format.size = offset;
+    return resolved;
+}
+
+std::vector<ULogReader::Topic> ULogReaderImpl::topics() const
+{
+    std::vector<ULogReader::Topic> topics;
+    for (const auto& subscription : _subscriptions) {
+        if (subscription.name.empty()) {
+            continue;
+        }
+        ULogReader::Topic topic{subscription.name, subscription.multi_id, 0, 0, 0};
+        topic.message_count = subscription.offsets.size();
+        if (!subscription.offsets.empty()) {
+            topic.first_timestamp_us = message_at(subscription.offsets.front()).timestamp_us();
+            topic.last_timestamp_us = message_at(subscription.offsets.back()).timestamp_us();
+        }
+        topics.push_back(topic);
+    }
+
+    std::sort(
+        topics.begin(),
+        topics.end(),
+        [](const ULogReader::Topic& lhs, const ULogReader::Topic& rhs) {
+            return std::tie(lhs.name, lhs.multi_id) < std::tie(rhs.name, rhs.multi_id);
+        });
+    return topics;
+}
+
+const ULogReader::Format* ULogReaderImpl::format(const std::string& name) const
+{
+    auto it = _formats.find(name);
+    return (it != _formats.end()) ? &it->second : nullptr;
+}
+
+bool ULogReaderImpl::info(const std::string& key, std::string& value) const
+{
+    auto it = _info.find(key);
+    if (it == _info.end()) {
+        return false;
+    }
+    value = it->second;
+    return true;
+}
+
+const std::vector<ULogReader::LoggedString>& ULogReaderImpl::logged_strings() const
+{
+    return _logged_strings;
+}
+
+size_t ULogReaderImpl::for_each_message(
+    const std::string& topic_name,
+    uint8_t multi_id,
+    const ULogReader::message_callback_t& callback,
+    uint64_t start_us,
+    uint64_t end_us) const
+{
+    const Subscription* subscription = find_subscription(topic_name, multi_id);
+    if (!subscription || !callback) {
+        return 0;
+    }
+
+    // Messages of a topic are logged in the order of their timestamps.
+    const auto& offsets = subscription->offsets;
+    auto it = offsets.begin();
+    if (start_us > 0) {
+        it = std::lower_bound(
+            offsets.begin(), offsets.end(), start_us, [this](uint64_t offset, uint64_t time_us) {
+                return message_at(offset).timestamp_us() < time_us;
+            });
+    }
+
+    size_t count = 0;
+    for (; it != offsets.end(); ++it) {
+        const ULogReader::Message message = message_at(*it);
+        if (message.timestamp_us() >= end_us) {
+            break;
+        }
+        ++count;
+        if (!callback(message)) {
+            break;
+        }
+    }
+    return count;
+}
+
+const ULogReaderImpl::Subscription*
+ULogReaderImpl::find_subscription(const std::string& name, uint8_t multi_id) const
+{
+    for (const auto& subscription : _subscriptions) {
+        if (subscription.multi_id == multi_id && subscription.name == name) {
+            return &subscription;
+        }
+    }
+    return nullptr;
+}
+
+ULogReader::Message ULogReaderImpl::message_at(uint64_t offset) const
+{
+    const uint8_t* message = _data + offset;
+    return ULogReader::Message(
+        message + MESSAGE_HEADER_SIZE + MSG_ID_SIZE, read<uint16_t>(message) - MSG_ID_SIZE);
+}
+
+} // namespace mavsdk
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "plugins/logging/ulog_reader.h"
+
+namespace mavsdk {
+
+class ULogReaderImpl {
+public:
+    ULogReaderImpl() = default;
+    ~ULogReaderImpl();
+
+    ULogReader::Result open(const std::string& file_path);
+    void close();
+
+    std::vector<ULogReader::Topic> topics() const;
+    const ULogReader::Format* format(const std::string& name) const;
+    bool info(const std::string& key, std::string& value) const;
+    const std::vector<ULogReader::LoggedString>& logged_strings() const;
+
+    size_t for_each_message(
+        const std::string& topic_name,
+        uint8_t multi_id,
+        const ULogReader::message_callback_t& callback,
+        uint64_t start_us,
+        uint64_t end_us) const;
+
+    // Non-copyable
+    ULogReaderImpl(const ULogReaderImpl&) = delete;
+    const ULogReaderImpl& operator=(const ULogReaderImpl&) = delete;
+
+private:
+    // A topic instance logged, its data messages refer to it by msg_id.
+    struct Subscription {
+        std::string name{};
+        uint8_t multi_id{0};
+        std::vector<uint64_t> offsets{}; ///< Offsets of the data messages in the file
+    };
+
+    bool map_file(const std::string& file_path);
+    void unmap_file();
+
+    ULogReader::Result build_index();
+    bool read_flag_bits(const uint8_t* payload, size_t size, std::vector<uint64_t>& appended);
+    void add_format(const uint8_t* payload, size_t size);
+    void add_info(const uint8_t* payload, size_t size);
+    void add_subscription(const uint8_t* payload, size_t size);
+    void add_logged_string(const uint8_t* payload, size_t size, bool tagged);
+    bool resolve_format(ULogReader::Format& format, unsigned depth);
+
+    const Subscription* find_subscription(const std::string& name, uint8_t multi_id) const;
+    ULogReader::Message message_at(uint64_t offset) const;
+
+    const uint8_t* _data{nullptr};
+    size_t _size{0};
+
+    std::map<std::string, ULogReader::Format> _formats{};
+    std::vector<Subscription> _subscriptions{}; ///< Indexed by msg_id
+    std::map<std::string, std::string> _info{};
+    std::vector<ULogReader::LoggedString> _logged_strings{};
+};
+
+} // namespace mavsdk
@@ -0,0 +1,299 @@
+#include "plugins/logging/ulog_reader.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+namespace {
+
+const char* file_path = "ulog_reader_test.ulg";
+
+// Assembles a ULog file message by message.
+class ULogBuilder {
+public:
+    ULogBuilder() : _data{'U', 'L', 'o', 'g', 0x01, 0x12, 0x35, 0x01}
+    {
+        _data.resize(16, 0);
+    }
+
+    void add_message(char type, const std::vector<uint8_t>& payload)
+    {
+        append<uint16_t>(uint16_t(payload.size()));
+        _data.push_back(uint8_t(type));
+        _data.insert(_data.end(), payload.begin(), payload.end());
+    }
+
+    void add_format(const std::string& format)
+    {
+        add_message('F', std::vector<uint8_t>(format.begin(), format.end()));
+    }
+
+    void add_info(const std::string& key, const std::string& value)
+    {
+        std::vector<uint8_t> payload{uint8_t(key.size())};
+        payload.insert(payload.end(), key.begin(), key.end());
+        payload.insert(payload.end(), value.begin(), value.end());
+        add_message('I', payload);
+    }
+
+    void add_subscription(uint8_t multi_id, uint16_t msg_id, const std::string& name)
+    {
+        std::vector<uint8_t> payload{multi_id, uint8_t(msg_id & 0xff), uint8_t(msg_id >> 8)};
+        payload.insert(payload.end(), name.begin(), name.end());
+        add_message('A', payload);
+    }
+
+    // `sensor` data: timestamp, float[3] values and uint8_t count.
+    void add_sensor(uint16_t msg_id, uint64_t timestamp_us, float value)
+    {
+        std::vector<uint8_t> payload;
+        push(payload, msg_id);
+        push(payload, timestamp_us);
+        for (unsigned i = 0; i < 3; ++i) {
+            push(payload, value + float(i));
+        }
+        payload.push_back(uint8_t(timestamp_us & 0xff));
+        add_message('D', payload);
+    }
+
+    void add_logged_string(uint8_t level, uint64_t timestamp_us, const std::string& text)
+    {
+        std::vector<uint8_t> payload{level};
+        push(payload, timestamp_us);
+        payload.insert(payload.end(), text.begin(), text.end());
+        add_message('L', payload);
+    }
+
+    template<typename T> void append(T value) { push(_data, value); }
+
+    template<typename T> static void push(std::vector<uint8_t>& data, T value)
+    {
+        uint8_t bytes[sizeof(T)];
+        memcpy(bytes, &value, sizeof(T));
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    std::vector<uint8_t>& data() { return _data; }
+
+    void write(size_t size = SIZE_MAX) const
+    {
+        std::ofstream file(file_path, std::ios::binary);
+        file.write(
+            reinterpret_cast<const char*>(_data.data()),
+            std::streamsize(std::min(size, _data.size())));
+    }
+
+private:
+    std::vector<uint8_t> _data;
+};
+
+// Two instances of `sensor` at 100 Hz and 50 Hz for a second.
+ULogBuilder create_log()
+{
+    ULogBuilder builder;
+    builder.add_format("vec3:float x;float y;float z;");
+    builder.add_format("sensor:uint64_t timestamp;float[3] values;uint8_t count;");
+    builder.add_format("nested:uint64_t timestamp;uint8_t id;vec3[2] vectors;bool valid;");
+    builder.add_info("char[6] sys_name", "PX4");
+    builder.add_subscription(0, 0, "sensor");
+    builder.add_subscription(1, 1, "sensor");
+
+    for (uint64_t time_us = 0; time_us < 1000000; time_us += 10000) {
+        builder.add_sensor(0, time_us, float(time_us) / 1e6f);
+        if (time_us % 20000 == 0) {
+            builder.add_sensor(1, time_us + 1, -float(time_us) / 1e6f);
+        }
+        if (time_us == 500000) {
+            builder.add_logged_string('4', time_us, "Halfway");
+        }
+    }
+    return builder;
+}
+
+} // namespace
+
+TEST(ULogReader, IndexesTopics)
+{
+    create_log().write();
+
+    ULogReader reader;
+    ASSERT_EQ(reader.open(file_path), ULogReader::Result::SUCCESS);
+
+    const auto topics = reader.topics();
+    ASSERT_EQ(topics.size(), 2u);
+    EXPECT_EQ(topics[0].name, "sensor");
+    EXPECT_EQ(topics[0].multi_id, 0);
+    EXPECT_EQ(topics[0].message_count, 100u);
+    EXPECT_EQ(topics[0].first_timestamp_us, 0u);
+    EXPECT_EQ(topics[0].last_timestamp_us, 990000u);
+    EXPECT_EQ(topics[1].multi_id, 1);
+    EXPECT_EQ(topics[1].message_count, 50u);
+    EXPECT_EQ(topics[1].last_timestamp_us, 980001u);
+
+    std::string sys_name;
+    EXPECT_TRUE(reader.info("sys_name", sys_name));
+    EXPECT_EQ(sys_name, "PX4");
+    EXPECT_FALSE(reader.info("ver_sw", sys_name));
+
+    ASSERT_EQ(reader.logged_strings().size(), 1u);
+    EXPECT_EQ(reader.logged_strings()[0].log_level, '4');
+    EXPECT_EQ(reader.logged_strings()[0].timestamp_us, 500000u);
+    EXPECT_EQ(reader.logged_strings()[0].message, "Halfway");
+    remove(file_path);
+}
+
+TEST(ULogReader, DescribesFormats)
+{
+    create_log().write();
+
+    ULogReader reader;
+    ASSERT_EQ(reader.open(file_path), ULogReader::Result::SUCCESS);
+
+    const ULogReader::Format* sensor = reader.format("sensor");
+    ASSERT_NE(sensor, nullptr);
+    EXPECT_EQ(sensor->size, 21u);
+    const ULogReader::Field* values = sensor->field("values");
+    ASSERT_NE(values, nullptr);
+    EXPECT_EQ(values->type, ULogReader::Field::Type::FLOAT);
+    EXPECT_EQ(values->array_size, 3u);
+    EXPECT_EQ(values->offset, 8u);
+    EXPECT_EQ(sensor->field("unknown"), nullptr);
+
+    // Nested formats are laid out in place.
+    const ULogReader::Format* nested = reader.format("nested");
+    ASSERT_NE(nested, nullptr);
+    EXPECT_EQ(nested->size, 8u + 1u + 24u + 1u);
+    const ULogReader::Field* vectors = nested->field("vectors");
+    ASSERT_NE(vectors, nullptr);
+    EXPECT_EQ(vectors->type, ULogReader::Field::Type::NESTED);
+    EXPECT_EQ(vectors->type_name, "vec3");
+    EXPECT_EQ(vectors->size, 12u);
+    EXPECT_EQ(nested->field("valid")->offset, 33u);
+    remove(file_path);
+}
+
+TEST(ULogReader, ReadsMessagesInTimeRange)
+{
+    create_log().write();
+
+    ULogReader reader;
+    ASSERT_EQ(reader.open(file_path), ULogReader::Result::SUCCESS);
+    const ULogReader::Field* values = reader.format("sensor")->field("values");
+    const ULogReader::Field* count = reader.format("sensor")->field("count");
+
+    std::vector<uint64_t> timestamps;
+    const size_t messages = reader.for_each_message(
+        "sensor",
+        0,
+        [&](const ULogReader::Message& message) {
+            timestamps.push_back(message.timestamp_us());
+            EXPECT_EQ(message.size(), 21u);
+            EXPECT_FLOAT_EQ(
+                message.get<float>(*values, 2), float(message.timestamp_us()) / 1e6f + 2);
+            EXPECT_EQ(message.get<uint8_t>(*count), uint8_t(message.timestamp_us() & 0xff));
+            // The type has to match the field.
+            EXPECT_EQ(message.get<double>(*values), 0.0);
+            return true;
+        },
+        250000,
+        300000);
+
+    EXPECT_EQ(messages, 5u);
+    EXPECT_EQ(timestamps, std::vector<uint64_t>({250000, 260000, 270000, 280000, 290000}));
+
+    // Stopped by the callback.
+    EXPECT_EQ(
+        reader.for_each_message("sensor", 1, [](const ULogReader::Message&) { return false; }), 1u);
+    EXPECT_EQ(
+        reader.for_each_message("other", 0, [](const ULogReader::Message&) { return true; }), 0u);
+    remove(file_path);
+}
+
+TEST(ULogReader, ReadsFileCutOff)
+{
+    auto builder = create_log();
+    // The last message is cut in half.
+    builder.write(builder.data().size() - 10);
+
+    ULogReader reader;
+    ASSERT_EQ(reader.open(file_path), ULogReader::Result::SUCCESS);
+    const auto topics = reader.topics();
+    ASSERT_EQ(topics.size(), 2u);
+    EXPECT_EQ(topics[0].message_count, 99u);
+    EXPECT_EQ(topics[1].message_count, 50u);
+    remove(file_path);
+}
+
+TEST(ULogReader, SkipsTooShortDataMessages)
+{
+    auto builder = create_log();
+    // Data messages without a complete header, the last one at the very end of the file.
+    builder.add_message('D', {0x00});
+    builder.add_sensor(0, 1000000, 1.f);
+    builder.add_message('D', {});
+    builder.write();
+
+    ULogReader reader;
+    ASSERT_EQ(reader.open(file_path), ULogReader::Result::SUCCESS);
+    const auto topics = reader.topics();
+    ASSERT_EQ(topics.size(), 2u);
+    EXPECT_EQ(topics[0].message_count, 101u);
+    EXPECT_EQ(topics[1].message_count, 50u);
+    remove(file_path);
+}
+
+TEST(ULogReader, ReadsAppendedData)
+{
+    ULogBuilder builder;
+    std::vector<uint8_t> flag_bits(40, 0);
+    flag_bits[8] = 0x01; // Data appended
+    builder.add_message('B', flag_bits);
+    builder.add_format("sensor:uint64_t timestamp;float[3] values;uint8_t count;");
+    builder.add_subscription(0, 0, "sensor");
+    builder.add_sensor(0, 1000, 1.f);
+    builder.add_sensor(0, 2000, 2.f);
+    // Logging stopped in the middle of a message.
+    builder.data().resize(builder.data().size() - 5);
+
+    const uint64_t appended_offset = builder.data().size();
+    memcpy(&builder.data()[16 + 3 + 16], &appended_offset, sizeof(appended_offset));
+    builder.add_sensor(0, 3000, 3.f);
+    builder.write();
+
+    ULogReader reader;
+    ASSERT_EQ(reader.open(file_path), ULogReader::Result::SUCCESS);
+    std::vector<uint64_t> timestamps;
+    reader.for_each_message("sensor", 0, [&](const ULogReader::Message& message) {
+        timestamps.push_back(message.timestamp_us());
+        return true;
+    });
+    EXPECT_EQ(timestamps, std::vector<uint64_t>({1000, 3000}));
+    remove(file_path);
+}
+
+TEST(ULogReader, RejectsInvalidFiles)
+{
+    ULogReader reader;
+    EXPECT_EQ(reader.open("does_not_exist.ulg"), ULogReader::Result::FILE_OPEN_FAILED);
+
+    auto builder = create_log();
+    builder.data()[0] = 'X';
+    builder.write();
+    EXPECT_EQ(reader.open(file_path), ULogReader::Result::INVALID_FILE);
+    EXPECT_TRUE(reader.topics().empty());
+
+    ULogBuilder unsupported;
+    std::vector<uint8_t> flag_bits(40, 0);
+    flag_bits[8] = 0x02;
+    unsupported.add_message('B', flag_bits);
+    unsupported.write();
+    EXPECT_EQ(reader.open(file_path), ULogReader::Result::UNSUPPORTED);
+    remove(file_path);
+}
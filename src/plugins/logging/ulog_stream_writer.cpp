@@ -0,0 +1,340 @@
+#include "ulog_stream_writer.h"
+#include "log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#if defined(WINDOWS)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace mavsdk {
+
+namespace {
+
+// File header: magic, version and timestamp.
+constexpr unsigned ULOG_HEADER_SIZE = 16;
+constexpr uint8_t ULOG_MAGIC[] = {'U', 'L', 'o', 'g', 0x01, 0x12, 0x35};
+
+// Messages start with their payload size and type.
+constexpr size_t MESSAGE_HEADER_SIZE = 3;
+constexpr uint8_t MESSAGE_TYPE_DROPOUT = 'O';
+
+// The buffer is written once this much is in it, or after the interval.
+constexpr size_t WRITE_SIZE = 64 * 1024;
+constexpr auto WRITE_INTERVAL = std::chrono::milliseconds(100);
+
+size_t message_size(const uint8_t* message)
+{
+    return MESSAGE_HEADER_SIZE + (message[0] | (message[1] << 8));
+}
+
+bool write_all(int fd, const uint8_t* data, size_t size)
+{
+    while (size > 0) {
+#if defined(WINDOWS)
+        const int written = ::write(fd, data, static_cast<unsigned>(size));
+#else
+        const ssize_t written = ::write(fd, data, size);
+#endif
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+} // namespace
+
+ULogStreamWriter::~ULogStreamWriter()
+{
+    close();
+}
+
+bool ULogStreamWriter::open(const std::string& file_path)
+{
+    close();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+#if defined(WINDOWS)
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC | O_BINARY;
+#else
+    const int flags = O_WRONLY | O_CREAT | O_TRUNC;
+#endif
+    _fd = ::open(file_path.c_str(), flags, 0644);
+    if (_fd < 0) {
+        LogErr() << "Could not create " << file_path << ": " << strerror(errno);
+        return false;
+    }
+
+    // Allocated and touched up front, so that receiving doesn't page fault.
+    _buffer.assign(BUFFER_SIZE, 0);
+    _buffer.clear();
+    _write_buffer.assign(BUFFER_SIZE, 0);
+    _write_buffer.clear();
+    _message.clear();
+    _message.reserve(MESSAGE_HEADER_SIZE + UINT16_MAX);
+
+    for (auto& packet : _packets) {
+        packet.valid = false;
+    }
+    _started = false;
+    _header_left = ULOG_HEADER_SIZE;
+    _header_valid = true;
+    _in_gap = false;
+    _dropout_pending = false;
+    _dropout_ms = 0;
+    _stats = Stats{};
+    _closing = false;
+
+    _thread = std::thread(&ULogStreamWriter::write_thread, this);
+    return true;
+}
+
+void ULogStreamWriter::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_fd < 0) {
+            return;
+        }
+
+        // Packets still waiting for one missing before them are written now.
+        while (std::any_of(_packets.begin(), _packets.end(), [](const Packet& packet) {
+            return packet.valid;
+        })) {
+            skip_expected();
+        }
+        _closing = true;
+    }
+
+    _buffer_cv.notify_one();
+    _thread.join();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ::close(_fd);
+    _fd = -1;
+}
+
+bool ULogStreamWriter::is_open() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _fd >= 0 && !_closing;
+}
+
+void ULogStreamWriter::add_data(
+    uint16_t sequence, uint8_t first_message_offset, const uint8_t* data, uint8_t length)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_fd < 0 || _closing) {
+        return;
+    }
+
+    if (!_started) {
+        _started = true;
+        _expected = sequence;
+        _last_data_time = _time.steady_time();
+    }
+
+    // Sequence numbers wrap around, the ones just before the expected one were
+    // written or given up already.
+    if (uint16_t(sequence - _expected) >= 0x8000) {
+        return;
+    }
+
+    while (uint16_t(sequence - _expected) >= REORDER_WINDOW) {
+        skip_expected();
+    }
+
+    Packet& packet = _packets[sequence % REORDER_WINDOW];
+    if (packet.valid) {
+        // Received twice, e.g. an acked packet sent again.
+        return;
+    }
+    packet.valid = true;
+    packet.sequence = sequence;
+    packet.first_message_offset = first_message_offset;
+    packet.length = std::min(length, uint8_t(sizeof(packet.data)));
+    memcpy(packet.data, data, packet.length);
+    ++_stats.packets_received;
+
+    while (_packets[_expected % REORDER_WINDOW].valid) {
+        skip_expected();
+    }
+}
+
+ULogStreamWriter::Stats ULogStreamWriter::stats() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _stats;
+}
+
+void ULogStreamWriter::skip_expected()
+{
+    Packet& packet = _packets[_expected % REORDER_WINDOW];
+    if (packet.valid) {
+        process(packet);
+        packet.valid = false;
+    } else {
+        ++_stats.packets_lost;
+        if (!_in_gap) {
+            _in_gap = true;
+            _gap_time = _last_data_time;
+        }
+    }
+    ++_expected;
+}
+
+void ULogStreamWriter::process(const Packet& packet)
+{
+    const uint8_t* data = packet.data;
+    size_t length = packet.length;
+
+    if (_in_gap) {
+        // The message cut by the gap is incomplete, writing continues with
+        // the first message starting after it.
+        _message.clear();
+        if (packet.first_message_offset == NO_MESSAGE_START ||
+            packet.first_message_offset >= length) {
+            return;
+        }
+        data += packet.first_message_offset;
+        length -= packet.first_message_offset;
+
+        _in_gap = false;
+        _dropout_pending = true;
+        _dropout_ms = uint16_t(std::min(_time.elapsed_since_s(_gap_time) * 1000.0, 65535.0));
+        if (_header_left > 0) {
+            _header_valid = false;
+        }
+    }
+    _last_data_time = _time.steady_time();
+
+    parse(data, length);
+}
+
+void ULogStreamWriter::parse(const uint8_t* data, size_t length)
+{
+    if (_header_left > 0 && _header_valid) {
+        const size_t size = std::min(size_t{_header_left}, length);
+        const size_t offset = ULOG_HEADER_SIZE - _header_left;
+        for (size_t i = 0; i < size && offset + i < sizeof(ULOG_MAGIC); ++i) {
+            if (data[i] != ULOG_MAGIC[offset + i]) {
+                _header_valid = false;
+            }
+        }
+        if (_header_valid) {
+            append(data, size);
+            _header_left -= unsigned(size);
+            data += size;
+            length -= size;
+        }
+    }
+
+    if (!_header_valid) {
+        if (_header_left > 0) {
+            LogErr() << "Log stream does not start with a ULog header, ignoring it";
+            _header_left = 0;
+        }
+        return;
+    }
+
+    while (length > 0) {
+        // Messages within the packet are taken from it directly.
+        if (_message.empty() && length >= MESSAGE_HEADER_SIZE && length >= message_size(data)) {
+            const size_t size = message_size(data);
+            add_message(data, size);
+            data += size;
+            length -= size;
+            continue;
+        }
+
+        const size_t needed = (_message.size() < MESSAGE_HEADER_SIZE) ?
+                                  MESSAGE_HEADER_SIZE :
+                                  message_size(_message.data());
+        const size_t size = std::min(needed - _message.size(), length);
+        _message.insert(_message.end(), data, data + size);
+        data += size;
+        length -= size;
+
+        if (_message.size() >= MESSAGE_HEADER_SIZE &&
+            _message.size() == message_size(_message.data())) {
+            add_message(_message.data(), _message.size());
+            _message.clear();
+        }
+    }
+}
+
+void ULogStreamWriter::add_message(const uint8_t* message, size_t size)
+{
+    if (_dropout_pending) {
+        const uint8_t dropout[] = {2,
+                                   0,
+                                   MESSAGE_TYPE_DROPOUT,
+                                   uint8_t(_dropout_ms & 0xff),
+                                   uint8_t(_dropout_ms >> 8)};
+        if (!append(dropout, sizeof(dropout))) {
+            return;
+        }
+        _dropout_pending = false;
+        _dropout_ms = 0;
+        ++_stats.dropouts;
+    }
+
+    if (!append(message, size)) {
+        _dropout_pending = true;
+    }
+}
+
+bool ULogStreamWriter::append(const uint8_t* data, size_t size)
+{
+    if (_buffer.size() + size > BUFFER_SIZE) {
+        return false;
+    }
+    _buffer.insert(_buffer.end(), data, data + size);
+    if (_buffer.size() >= WRITE_SIZE) {
+        _buffer_cv.notify_one();
+    }
+    return true;
+}
+
+void ULogStreamWriter::write_thread()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _buffer_cv.wait_for(
+            lock, WRITE_INTERVAL, [this]() { return _closing || _buffer.size() >= WRITE_SIZE; });
+        if (_buffer.empty()) {
+            if (_closing) {
+                break;
+            }
+            continue;
+        }
+
+        // Written without the lock, data keeps coming into the other buffer.
+        _buffer.swap(_write_buffer);
+        lock.unlock();
+        const bool written = write_all(_fd, _write_buffer.data(), _write_buffer.size());
+        lock.lock();
+
+        if (written) {
+            _stats.bytes_written += _write_buffer.size();
+        } else if (!_stats.write_error) {
+            LogErr() << "Could not write log: " << strerror(errno);
+            _stats.write_error = true;
+        }
+        _write_buffer.clear();
+    }
+}
+
+} // namespace mavsdk
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "global_include.h"
+
+namespace mavsdk {
+
+/*
+ * Writes a ULog streamed with LOGGING_DATA and LOGGING_DATA_ACKED to a file.
+ *
+ * The stream has to start with the ULog header, which PX4 sends acked before
+ * anything else. Packets are put back in order by their sequence number,
+ * waiting for a few packets at most before one is given up as lost. After a
+ * gap the message cut by it is dropped and writing continues at the first
+ * message starting in a packet, with a ULog dropout message in between, so the
+ * file stays valid.
+ *
+ * Complete messages are copied into a preallocated buffer which a thread of its
+ * own writes to the file, the thread receiving the stream never waits for the
+ * disk. If the disk can't keep up and the buffer fills up, messages are dropped
+ * like lost ones.
+ */
+class ULogStreamWriter {
+public:
+    ULogStreamWriter() = default;
+    ~ULogStreamWriter();
+
+    bool open(const std::string& file_path);
+    void close();
+    bool is_open() const;
+
+    void add_data(
+        uint16_t sequence, uint8_t first_message_offset, const uint8_t* data, uint8_t length);
+
+    struct Stats {
+        uint64_t bytes_written; ///< Including the dropout messages added
+        unsigned packets_received;
+        unsigned packets_lost;
+        unsigned dropouts;
+        bool write_error;
+    };
+    Stats stats() const;
+
+    // `first_message_offset` of a packet with no message starting in it.
+    static constexpr uint8_t NO_MESSAGE_START = 255;
+    // Packets a missing one is waited for before it is given up.
+    static constexpr uint16_t REORDER_WINDOW = 32;
+    static constexpr size_t BUFFER_SIZE = 1024 * 1024;
+
+    // Non-copyable
+    ULogStreamWriter(const ULogStreamWriter&) = delete;
+    const ULogStreamWriter& operator=(const ULogStreamWriter&) = delete;
+
+private:
+    struct Packet {
+        bool valid;
+        uint16_t sequence;
+        uint8_t first_message_offset;
+        uint8_t length;
+        uint8_t data[249];
+    };
+
+    void process(const Packet& packet);
+    void skip_expected();
+    void parse(const uint8_t* data, size_t length);
+    void add_message(const uint8_t* message, size_t size);
+    bool append(const uint8_t* data, size_t size);
+    void write_thread();
+
+    mutable std::mutex _mutex{};
+    std::condition_variable _buffer_cv{};
+    std::thread _thread{};
+    int _fd{-1};
+    bool _closing{false};
+
+    // Filled while receiving and swapped with the other one to be written.
+    std::vector<uint8_t> _buffer{};
+    std::vector<uint8_t> _write_buffer{};
+
+    std::array<Packet, REORDER_WINDOW> _packets{};
+    bool _started{false};
+    uint16_t _expected{0};
+
+    unsigned _header_left{0};
+    bool _header_valid{true};
+    std::vector<uint8_t> _message{}; ///< Begin of a message continued in the next packet
+    bool _in_gap{false};
+    dl_time_t _last_data_time{};
+    dl_time_t _gap_time{}; ///< Last data before the gap
+    bool _dropout_pending{false};
+    uint16_t _dropout_ms{0};
+
+    Stats _stats{};
+    Time _time{};
+};
+
+} // namespace mavsdk
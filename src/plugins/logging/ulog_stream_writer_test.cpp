@@ -0,0 +1,236 @@
+#include "ulog_stream_writer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+namespace {
+
+const char* file_path = "ulog_stream_writer_test.ulg";
+
+struct StreamPacket {
+    uint16_t sequence;
+    uint8_t first_message_offset;
+    std::vector<uint8_t> data;
+};
+
+// A ULog header followed by `count` data messages of different sizes. The
+// payload of each starts with its index.
+std::vector<uint8_t> create_stream(unsigned count, std::vector<size_t>& message_offsets)
+{
+    std::vector<uint8_t> stream = {'U', 'L', 'o', 'g', 0x01, 0x12, 0x35, 0x01};
+    stream.resize(16, 0);
+
+    for (unsigned i = 0; i < count; ++i) {
+        message_offsets.push_back(stream.size());
+        const unsigned payload_size = 2 + (i * 37) % 400;
+        stream.push_back(uint8_t(payload_size & 0xff));
+        stream.push_back(uint8_t(payload_size >> 8));
+        stream.push_back('D');
+        stream.push_back(uint8_t(i & 0xff));
+        stream.push_back(uint8_t(i >> 8));
+        for (unsigned j = 2; j < payload_size; ++j) {
+            stream.push_back(uint8_t(i + j));
+        }
+    }
+    return stream;
+}
+
+// Cuts the stream into LOGGING_DATA packets.
+std::vector<StreamPacket> packetize(
+    const std::vector<uint8_t>& stream,
+    const std::vector<size_t>& message_offsets,
+    uint16_t first_sequence = 0)
+{
+    std::vector<StreamPacket> packets;
+    for (size_t offset = 0; offset < stream.size(); offset += 249) {
+        const size_t end = std::min(offset + 249, stream.size());
+        StreamPacket packet{};
+        packet.sequence = uint16_t(first_sequence + packets.size());
+        packet.first_message_offset = ULogStreamWriter::NO_MESSAGE_START;
+        auto it = std::lower_bound(message_offsets.begin(), message_offsets.end(), offset);
+        if (it != message_offsets.end() && *it < end) {
+            packet.first_message_offset = uint8_t(*it - offset);
+        }
+        packet.data.assign(stream.begin() + long(offset), stream.begin() + long(end));
+        packets.push_back(packet);
+    }
+    return packets;
+}
+
+void write(const std::vector<StreamPacket>& packets)
+{
+    ULogStreamWriter writer;
+    ASSERT_TRUE(writer.open(file_path));
+    for (const auto& packet : packets) {
+        writer.add_data(
+            packet.sequence,
+            packet.first_message_offset,
+            packet.data.data(),
+            uint8_t(packet.data.size()));
+    }
+    writer.close();
+}
+
+std::vector<uint8_t> read_file()
+{
+    std::ifstream file(file_path, std::ios::binary);
+    return std::vector<uint8_t>(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+// Indices of the data messages in the file, -1 for a dropout. Fails the test
+// if a message is not intact.
+std::vector<int> parse_file(const std::vector<uint8_t>& file)
+{
+    std::vector<int> messages;
+    EXPECT_GE(file.size(), 16u);
+    size_t offset = 16;
+    while (offset + 3 <= file.size()) {
+        const unsigned payload_size = file[offset] | (file[offset + 1] << 8);
+        const uint8_t type = file[offset + 2];
+        if (offset + 3 + payload_size > file.size()) {
+            ADD_FAILURE() << "Message at " << offset << " cut off";
+            break;
+        }
+        const uint8_t* payload = &file[offset + 3];
+        if (type == 'O') {
+            EXPECT_EQ(payload_size, 2u);
+            messages.push_back(-1);
+        } else {
+            EXPECT_EQ(type, 'D');
+            const unsigned index = payload[0] | (payload[1] << 8);
+            EXPECT_EQ(payload_size, 2 + (index * 37) % 400);
+            for (unsigned j = 2; j < payload_size; ++j) {
+                EXPECT_EQ(payload[j], uint8_t(index + j));
+            }
+            messages.push_back(int(index));
+        }
+        offset += 3 + payload_size;
+    }
+    EXPECT_EQ(offset, file.size());
+    return messages;
+}
+
+} // namespace
+
+TEST(ULogStreamWriter, InOrder)
+{
+    std::vector<size_t> message_offsets;
+    const auto stream = create_stream(500, message_offsets);
+    write(packetize(stream, message_offsets));
+
+    EXPECT_EQ(read_file(), stream);
+    remove(file_path);
+}
+
+TEST(ULogStreamWriter, Reordered)
+{
+    std::vector<size_t> message_offsets;
+    const auto stream = create_stream(500, message_offsets);
+    auto packets = packetize(stream, message_offsets);
+
+    // Shuffled within groups smaller than the reorder window. The first packet
+    // with the header stays first, PX4 waits for it to be acked.
+    std::default_random_engine random_engine(42);
+    for (size_t i = 1; i < packets.size(); i += 8) {
+        std::shuffle(
+            packets.begin() + long(i),
+            packets.begin() + long(std::min(i + 8, packets.size())),
+            random_engine);
+    }
+    write(packets);
+
+    EXPECT_EQ(read_file(), stream);
+    remove(file_path);
+}
+
+TEST(ULogStreamWriter, Duplicates)
+{
+    std::vector<size_t> message_offsets;
+    const auto stream = create_stream(100, message_offsets);
+    const auto packets = packetize(stream, message_offsets);
+
+    std::vector<StreamPacket> duplicated;
+    for (const auto& packet : packets) {
+        duplicated.push_back(packet);
+        duplicated.push_back(packet);
+    }
+    write(duplicated);
+
+    EXPECT_EQ(read_file(), stream);
+    remove(file_path);
+}
+
+TEST(ULogStreamWriter, SequenceWrapsAround)
+{
+    std::vector<size_t> message_offsets;
+    const auto stream = create_stream(500, message_offsets);
+    write(packetize(stream, message_offsets, 65500));
+
+    EXPECT_EQ(read_file(), stream);
+    remove(file_path);
+}
+
+TEST(ULogStreamWriter, LostPackets)
+{
+    std::vector<size_t> message_offsets;
+    const auto stream = create_stream(500, message_offsets);
+    auto packets = packetize(stream, message_offsets);
+
+    // One packet and a few in a row lost.
+    packets.erase(packets.begin() + 100, packets.begin() + 103);
+    packets.erase(packets.begin() + 50);
+    write(packets);
+
+    const auto messages = parse_file(read_file());
+    EXPECT_EQ(std::count(messages.begin(), messages.end(), -1), 2);
+
+    // What is left is in order, only messages around the gaps are missing.
+    std::vector<int> indices;
+    std::copy_if(messages.begin(), messages.end(), std::back_inserter(indices), [](int index) {
+        return index >= 0;
+    });
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    EXPECT_EQ(std::adjacent_find(indices.begin(), indices.end()), indices.end());
+    EXPECT_GT(indices.size(), 400u);
+    EXPECT_LT(indices.size(), 500u);
+    EXPECT_EQ(indices.front(), 0);
+    EXPECT_EQ(indices.back(), 499);
+    remove(file_path);
+}
+
+TEST(ULogStreamWriter, GivesUpOnPacketAfterReorderWindow)
+{
+    std::vector<size_t> message_offsets;
+    const auto stream = create_stream(500, message_offsets);
+    auto packets = packetize(stream, message_offsets);
+
+    // Arriving too late to be put back in its place.
+    const StreamPacket late = packets[20];
+    packets.erase(packets.begin() + 20);
+    packets.insert(packets.begin() + 20 + ULogStreamWriter::REORDER_WINDOW + 1, late);
+    write(packets);
+
+    const auto messages = parse_file(read_file());
+    EXPECT_EQ(std::count(messages.begin(), messages.end(), -1), 1);
+    remove(file_path);
+}
+
+TEST(ULogStreamWriter, IgnoresStreamWithoutHeader)
+{
+    std::vector<size_t> message_offsets;
+    const auto stream = create_stream(100, message_offsets);
+    auto packets = packetize(stream, message_offsets);
+    packets.erase(packets.begin());
+    write(packets);
+
+    EXPECT_TRUE(read_file().empty());
+    remove(file_path);
+}
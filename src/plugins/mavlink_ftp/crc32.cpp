@@ -36,6 +36,8 @@
 
 #include "crc32.h"
 
+#include <cstring>
+
 namespace mavsdk {
 
 static const uint32_t crc32_tab[] = {
@@ -72,12 +74,66 @@ static const uint32_t crc32_tab[] = {
     0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6, 0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
     0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d};
 
-uint32_t Crc32::add(const uint8_t* src, uint32_t len)
+namespace {
+
+// Slice-by-8: table k holds the CRC of a byte followed by k zero bytes, so
+// eight bytes can be folded in at once with independent lookups.
+struct SliceTables {
+    uint32_t tab[8][256];
+
+    SliceTables() : tab()
+    {
+        for (unsigned i = 0; i < 256; ++i) {
+            tab[0][i] = crc32_tab[i];
+        }
+        for (unsigned k = 1; k < 8; ++k) {
+            for (unsigned i = 0; i < 256; ++i) {
+                tab[k][i] = (tab[k - 1][i] >> 8) ^ crc32_tab[tab[k - 1][i] & 0xff];
+            }
+        }
+    }
+};
+
+const SliceTables& slice_tables()
+{
+    static const SliceTables tables;
+    return tables;
+}
+
+uint32_t add_bytewise(uint32_t crc, const uint8_t* src, uint32_t len)
 {
     for (uint32_t i = 0; i < len; i++) {
-        val = crc32_tab[(val ^ src[i]) & 0xff] ^ (val >> 8);
+        crc = crc32_tab[(crc ^ src[i]) & 0xff] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+} // namespace
+
+uint32_t Crc32::add(const uint8_t* src, uint32_t len)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    // The words below are assumed to be little endian.
+    val = add_bytewise(val, src, len);
+#else
+    const auto& tab = slice_tables().tab;
+
+    uint32_t crc = val;
+    while (len >= 8) {
+        uint32_t low;
+        uint32_t high;
+        memcpy(&low, src, sizeof(low));
+        memcpy(&high, src + 4, sizeof(high));
+        low ^= crc;
+        crc = tab[7][low & 0xff] ^ tab[6][(low >> 8) & 0xff] ^ tab[5][(low >> 16) & 0xff] ^
+              tab[4][low >> 24] ^ tab[3][high & 0xff] ^ tab[2][(high >> 8) & 0xff] ^
+              tab[1][(high >> 16) & 0xff] ^ tab[0][high >> 24];
+        src += 8;
+        len -= 8;
     }
+    val = add_bytewise(crc, src, len);
+#endif
     return val;
 }
 
-} // namespace mavsdk
\ No newline at end of file
+} // namespace mavsdk
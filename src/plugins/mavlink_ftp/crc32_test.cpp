@@ -0,0 +1,61 @@
+#include "crc32.h"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+namespace {
+
+// Straight from the polynomial, one bit at a time.
+uint32_t reference_crc32(uint32_t crc, const uint8_t* src, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= src[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xedb88320 : 0);
+        }
+    }
+    return crc;
+}
+
+} // namespace
+
+TEST(Crc32, MatchesReferenceForAllLengthsAndAlignments)
+{
+    std::vector<uint8_t> data(100);
+    std::mt19937 random_engine(42);
+    for (auto& byte : data) {
+        byte = static_cast<uint8_t>(random_engine());
+    }
+
+    for (size_t start = 0; start < 8; ++start) {
+        for (size_t len = 0; start + len <= data.size(); ++len) {
+            Crc32 checksum;
+            EXPECT_EQ(
+                checksum.add(&data[start], static_cast<uint32_t>(len)),
+                reference_crc32(0, &data[start], len));
+        }
+    }
+}
+
+TEST(Crc32, AddsUpInPieces)
+{
+    std::vector<uint8_t> data(4096);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(i * 7 + i / 251);
+    }
+
+    Crc32 whole;
+    whole.add(data.data(), static_cast<uint32_t>(data.size()));
+
+    Crc32 pieces;
+    pieces.add(data.data(), 3);
+    pieces.add(data.data() + 3, 1000);
+    pieces.add(data.data() + 1003, static_cast<uint32_t>(data.size() - 1003));
+
+    EXPECT_EQ(whole.get(), pieces.get());
+    EXPECT_EQ(static_cast<uint32_t>(whole.get()), reference_crc32(0, data.data(), data.size()));
+}
@@ -0,0 +1,536 @@
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "directory_sync.h"
+#include "fs.h"
+#include "log.h"
+#include "mavlink_ftp_impl.h"
+
+namespace mavsdk {
+
+namespace {
+
+// Attempts per file or directory before the sync gives up on it.
+constexpr unsigned max_attempts = 3;
+
+} // namespace
+
+DirectorySync::DirectorySync(
+    const std::vector<MavlinkFTPImpl*>& workers,
+    const std::string& remote_folder,
+    const std::string& local_folder,
+    MavlinkFTP::progress_callback_t progress_callback,
+    MavlinkFTP::result_callback_t result_callback,
+    dispatch_t dispatch) :
+    _workers(workers),
+    _remote_folder(remote_folder),
+    _local_folder(local_folder),
+    _progress_callback(progress_callback),
+    _result_callback(result_callback),
+    _dispatch(dispatch)
+{
+    _busy.resize(_workers.size(), false);
+    _bytes_in_progress.resize(_workers.size(), 0);
+    _max_busy = _workers.size();
+
+    // Without a trailing separator, so that paths can be appended to both.
+    while (_remote_folder.size() > 1 && _remote_folder.back() == '/') {
+        _remote_folder.pop_back();
+    }
+    while (_local_folder.size() > 1 && _local_folder.back() == path_separator.back()) {
+        _local_folder.pop_back();
+    }
+}
+
+DirectorySync::~DirectorySync()
+{
+    _stop_hashing();
+}
+
+void DirectorySync::start()
+{
+    if (_workers.empty() || _remote_folder.empty()) {
+        _finish(MavlinkFTP::Result::INVALID_PARAMETER);
+        return;
+    }
+    if (!_create_local_directory("")) {
+        LogErr() << "Could not create " << _local_folder;
+        _finish(MavlinkFTP::Result::FILE_IO_ERROR);
+        return;
+    }
+
+    _read_manifest();
+
+    auto self = shared_from_this();
+    _hasher = std::thread([self]() { self->_hash_thread(); });
+
+    Launches launches;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _tasks.push_back(Task{Task::Type::List, "", 0, 0});
+        launches = _schedule();
+    }
+    _launch(launches);
+}
+
+void DirectorySync::cancel()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _cancelled = true;
+    }
+    _stop_hashing();
+}
+
+void DirectorySync::_stop_hashing()
+{
+    _hash_queue.stop();
+    if (!_hasher.joinable()) {
+        return;
+    }
+    if (_hasher.get_id() == std::this_thread::get_id()) {
+        // The thread is dropping the last reference to us on its way out.
+        _hasher.detach();
+    } else {
+        _hasher.join();
+    }
+}
+
+void DirectorySync::_hash_thread()
+{
+    while (auto func = _hash_queue.dequeue()) {
+        func();
+    }
+}
+
+bool DirectorySync::finished()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _finished || _cancelled;
+}
+
+DirectorySync::Launches DirectorySync::_schedule()
+{
+    Launches launches;
+    if (_cancelled || _finished) {
+        return launches;
+    }
+
+    size_t busy = std::count(_busy.begin(), _busy.end(), true);
+    for (size_t i = 0; i < _workers.size() && busy < _max_busy && !_tasks.empty(); ++i) {
+        if (_busy[i]) {
+            continue;
+        }
+        _busy[i] = true;
+        ++busy;
+        launches.emplace_back(i, _tasks.front());
+        _tasks.pop_front();
+    }
+
+    if (busy == 0 && _tasks.empty()) {
+        _finished = true;
+    }
+    return launches;
+}
+
+void DirectorySync::_launch(const Launches& launches)
+{
+    if (!launches.empty()) {
+        // Not right here: workers failing a request right away call back while
+        // still holding their lock, and we might be in such a callback.
+        auto self = shared_from_this();
+        _dispatch([self, launches]() {
+            for (const auto& launch : launches) {
+                if (self->finished()) {
+                    return;
+                }
+                self->_launch(launch.first, launch.second);
+            }
+        });
+        return;
+    }
+
+    // Nothing left to launch, report the result if this was the last task.
+    MavlinkFTP::Result result;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_finished || _cancelled || !_result_callback) {
+            return;
+        }
+        if (!_write_manifest() && _result == MavlinkFTP::Result::SUCCESS) {
+            _result = MavlinkFTP::Result::FILE_IO_ERROR;
+        }
+        result = _result;
+    }
+    _finish(result);
+}
+
+void DirectorySync::_finish(MavlinkFTP::Result result)
+{
+    MavlinkFTP::result_callback_t temp_callback;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _finished = true;
+        std::swap(temp_callback, _result_callback);
+    }
+    // Nothing is downloaded anymore, let the thread hashing the downloads exit.
+    _hash_queue.stop();
+    if (temp_callback) {
+        temp_callback(result);
+    }
+}
+
+void DirectorySync::_launch(size_t worker, const Task& task)
+{
+    auto self = shared_from_this();
+    const std::string remote_path = _remote_path(task.path);
+
+    switch (task.type) {
+        case Task::Type::List:
+            _workers[worker]->list_directory_async(
+                remote_path,
+                [self, worker, task](
+                    MavlinkFTP::Result result, std::vector<std::string> entries) {
+                    self->_on_listed(worker, task, result, entries);
+                });
+            break;
+
+        case Task::Type::Check:
+            _workers[worker]->calc_file_crc32_async(
+                remote_path, [self, worker, task](MavlinkFTP::Result result, uint32_t crc32) {
+                    self->_on_checked(worker, task, result, crc32);
+                });
+            break;
+
+        case Task::Type::Download: {
+            const auto slash_pos = task.path.rfind('/');
+            const std::string local_folder =
+                _local_path(slash_pos == std::string::npos ? "" : task.path.substr(0, slash_pos));
+            _workers[worker]->download_async(
+                remote_path,
+                local_folder,
+                [self, worker](uint32_t bytes_transferred, uint32_t) {
+                    self->_on_progress(worker, bytes_transferred);
+                },
+                [self, worker, task](MavlinkFTP::Result result) {
+                    self->_on_downloaded(worker, task, result);
+                });
+            break;
+        }
+    }
+}
+
+void DirectorySync::_on_listed(
+    size_t worker,
+    const Task& task,
+    MavlinkFTP::Result result,
+    const std::vector<std::string>& entries)
+{
+    Launches launches;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_cancelled) {
+            return;
+        }
+
+        if (result != MavlinkFTP::Result::SUCCESS) {
+            _retry_or_fail(task, result);
+        }
+
+        for (size_t i = 0; result == MavlinkFTP::Result::SUCCESS && i < entries.size(); ++i) {
+            const std::string& entry = entries[i];
+            if (entry.size() < 2) {
+                continue;
+            }
+
+            // Entries are "F<name>\t<size>" or "D<name>", with the name
+            // relative to the server root for some servers.
+            const char type = entry[0];
+            const auto tab_pos = entry.find('\t');
+            std::string name =
+                entry.substr(1, tab_pos == std::string::npos ? tab_pos : tab_pos - 1);
+            const auto slash_pos = name.rfind('/');
+            if (slash_pos != std::string::npos) {
+                name = name.substr(slash_pos + 1);
+            }
+            if (name.empty() || name == "." || name == ".." ||
+                (task.path.empty() && name == manifest_name)) {
+                continue;
+            }
+
+            const std::string path = task.path.empty() ? name : task.path + "/" + name;
+
+            if (type == 'D') {
+                if (!_create_local_directory(path)) {
+                    LogErr() << "Could not create " << _local_path(path);
+                    _result = MavlinkFTP::Result::FILE_IO_ERROR;
+                    continue;
+                }
+                // Listing first finds the work for the other workers sooner.
+                _tasks.push_front(Task{Task::Type::List, path, 0, 0});
+
+            } else if (type == 'F') {
+                const uint32_t size = tab_pos == std::string::npos ?
+                                          0 :
+                                          static_cast<uint32_t>(std::strtoul(
+                                              entry.c_str() + tab_pos + 1, nullptr, 10));
+                _add_file(path, size);
+            }
+        }
+
+        _done(worker);
+        launches = _schedule();
+    }
+    _launch(launches);
+}
+
+void DirectorySync::_add_file(const std::string& path, uint32_t size)
+{
+    const auto it = _manifest.find(path);
+    const std::string local_path = _local_path(path);
+
+    if (it != _manifest.end() && it->second.size == size && fs_exists(local_path) &&
+        fs_file_size(local_path) == size) {
+        _tasks.push_back(Task{Task::Type::Check, path, size, 0});
+        return;
+    }
+
+    _bytes_total += size;
+    _tasks.push_back(Task{Task::Type::Download, path, size, 0});
+}
+
+void DirectorySync::_on_checked(
+    size_t worker, const Task& task, MavlinkFTP::Result result, uint32_t crc32)
+{
+    Launches launches;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_cancelled) {
+            return;
+        }
+
+        const auto it = _manifest.find(task.path);
+
+        if (result == MavlinkFTP::Result::SUCCESS && it != _manifest.end() &&
+            it->second.crc32 == crc32) {
+            _synced[task.path] = it->second;
+
+        } else if (
+            result == MavlinkFTP::Result::SUCCESS || result == MavlinkFTP::Result::UNSUPPORTED ||
+            task.attempts + 1 >= max_attempts) {
+            // Changed, or we can't tell, so fetch it again.
+            _bytes_total += task.size;
+            _tasks.push_back(Task{Task::Type::Download, task.path, task.size, 0});
+
+        } else {
+            _retry_or_fail(task, result);
+        }
+
+        _done(worker);
+        launches = _schedule();
+    }
+    _launch(launches);
+}
+
+void DirectorySync::_on_downloaded(size_t worker, const Task& task, MavlinkFTP::Result result)
+{
+    // The hash thread holds a reference to us for as long as it runs.
+    _hash_queue.enqueue([this, worker, task, result]() { _hash_downloaded(worker, task, result); });
+}
+
+void DirectorySync::_hash_downloaded(size_t worker, const Task& task, MavlinkFTP::Result result)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_cancelled) {
+            return;
+        }
+    }
+
+    // Hash without holding the lock, the other workers' callbacks would wait on it
+    // for as long as it takes to read the whole file.
+    ManifestEntry entry{0, 0};
+    bool hashed = false;
+    if (result == MavlinkFTP::Result::SUCCESS) {
+        const std::string local_path = _local_path(task.path);
+        entry.size = fs_file_size(local_path);
+        hashed = _workers[worker]->calc_local_file_crc32(local_path, entry.crc32) ==
+                 MavlinkFTP::Result::SUCCESS;
+    }
+
+    Launches launches;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_cancelled) {
+            return;
+        }
+
+        _bytes_in_progress[worker] = 0;
+
+        if (result == MavlinkFTP::Result::SUCCESS) {
+            // The file may have grown since it was listed.
+            _bytes_total += entry.size;
+            _bytes_total -= task.size;
+            _bytes_done += entry.size;
+            if (hashed) {
+                _synced[task.path] = entry;
+            }
+
+        } else if (result == MavlinkFTP::Result::FILE_DOES_NOT_EXIST) {
+            // Removed since it was listed.
+            _bytes_total -= task.size;
+
+        } else {
+            _retry_or_fail(task, result);
+            if (task.attempts + 1 >= max_attempts) {
+                _bytes_total -= task.size;
+            }
+        }
+
+        _done(worker);
+        launches = _schedule();
+    }
+
+    // The user's callbacks are called from the dispatching threads only.
+    auto self = shared_from_this();
+    _dispatch([self, worker, launches]() {
+        self->_on_progress(worker, 0);
+        self->_launch(launches);
+    });
+}
+
+void DirectorySync::_on_progress(size_t worker, uint32_t bytes_transferred)
+{
+    uint64_t bytes_done;
+    uint64_t bytes_total;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_cancelled || !_progress_callback) {
+            return;
+        }
+        if (bytes_transferred > 0) {
+            _bytes_in_progress[worker] = bytes_transferred;
+        }
+        bytes_done = _bytes_done;
+        for (const auto bytes : _bytes_in_progress) {
+            bytes_done += bytes;
+        }
+        bytes_total = _bytes_total;
+    }
+
+    // The callback counts in 32 bits, larger syncs are reported scaled down.
+    while (bytes_total > std::numeric_limits<uint32_t>::max()) {
+        bytes_total >>= 1;
+        bytes_done >>= 1;
+    }
+    if (bytes_total > 0) {
+        _progress_callback(
+            static_cast<uint32_t>(std::min(bytes_done, bytes_total)),
+            static_cast<uint32_t>(bytes_total));
+    }
+}
+
+void DirectorySync::_retry_or_fail(const Task& task, MavlinkFTP::Result result)
+{
+    if (task.attempts + 1 < max_attempts) {
+        // Failing while others run suggests the server is out of sessions,
+        // continue with fewer at once.
+        const size_t busy = std::count(_busy.begin(), _busy.end(), true);
+        if (busy > 1 && _max_busy > 1) {
+            _max_busy = busy - 1;
+            LogWarn() << "Continuing directory sync with " << _max_busy << " sessions";
+        }
+        Task retry = task;
+        ++retry.attempts;
+        _tasks.push_front(retry);
+        return;
+    }
+
+    LogErr() << "Could not sync " << _remote_path(task.path) << ": "
+             << static_cast<int>(result);
+    if (_result == MavlinkFTP::Result::SUCCESS) {
+        _result = result;
+    }
+}
+
+void DirectorySync::_done(size_t worker)
+{
+    _busy[worker] = false;
+}
+
+std::string DirectorySync::_remote_path(const std::string& path) const
+{
+    if (path.empty()) {
+        return _remote_folder;
+    }
+    return _remote_folder + (_remote_folder.back() == '/' ? "" : "/") + path;
+}
+
+std::string DirectorySync::_local_path(const std::string& path) const
+{
+    std::string local_path = _local_folder;
+    if (!path.empty()) {
+        local_path += path_separator + path;
+    }
+    if (path_separator != "/") {
+        std::replace(local_path.begin(), local_path.end(), '/', path_separator.back());
+    }
+    return local_path;
+}
+
+bool DirectorySync::_create_local_directory(const std::string& path) const
+{
+    const std::string local_path = _local_path(path);
+    return fs_exists(local_path) || fs_create_directory(local_path);
+}
+
+void DirectorySync::_read_manifest()
+{
+    std::ifstream file(_local_path(manifest_name));
+    std::string line;
+
+    // One file per line: "<crc32 in hex> <size> <path>"
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        ManifestEntry entry{};
+        std::string path;
+        if (!(stream >> std::hex >> entry.crc32 >> std::dec >> entry.size) ||
+            stream.get() != ' ' || !std::getline(stream, path) || path.empty()) {
+            continue;
+        }
+        _manifest[path] = entry;
+    }
+}
+
+bool DirectorySync::_write_manifest() const
+{
+    const std::string manifest_path = _local_path(manifest_name);
+    const std::string temp_path = manifest_path + ".tmp";
+
+    {
+        std::ofstream file(temp_path, std::fstream::trunc);
+        for (const auto& synced : _synced) {
+            file << std::hex << synced.second.crc32 << std::dec << ' ' << synced.second.size
+                 << ' ' << synced.first << '\n';
+        }
+        if (!file.flush()) {
+            LogErr() << "Could not write " << temp_path;
+            return false;
+        }
+    }
+
+#if defined(WINDOWS)
+    // rename() does not replace existing files there.
+    fs_remove(manifest_path);
+#endif
+    if (!fs_rename(temp_path, manifest_path)) {
+        LogErr() << "Could not replace " << manifest_path;
+        return false;
+    }
+    return true;
+}
+
+} // namespace mavsdk
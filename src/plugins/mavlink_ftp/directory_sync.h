@@ -0,0 +1,129 @@
+#pragma once
+
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "plugins/mavlink_ftp/mavlink_ftp.h"
+#include "safe_queue.h"
+
+namespace mavsdk {
+
+class MavlinkFTPImpl;
+
+/*
+ * Mirrors a remote directory tree into a local folder.
+ *
+ * The tree is listed and the files are downloaded by several MavlinkFTPImpl
+ * workers at once, each with its own session on the server. A manifest in the
+ * local folder remembers size and CRC32 of every file synced, files which still
+ * match it on the remote side are not downloaded again.
+ *
+ * Downloaded files are hashed for the manifest on a thread of the sync's own,
+ * the threads calling back into user code are not held up reading them.
+ */
+class DirectorySync : public std::enable_shared_from_this<DirectorySync> {
+public:
+    // Runs a function on another thread, e.g. SystemImpl::call_user_callback.
+    typedef std::function<void(const std::function<void()>&)> dispatch_t;
+
+    DirectorySync(
+        const std::vector<MavlinkFTPImpl*>& workers,
+        const std::string& remote_folder,
+        const std::string& local_folder,
+        MavlinkFTP::progress_callback_t progress_callback,
+        MavlinkFTP::result_callback_t result_callback,
+        dispatch_t dispatch);
+    ~DirectorySync();
+
+    void start();
+
+    // Stops using the workers, e.g. because they are about to be destroyed.
+    void cancel();
+
+    bool finished();
+
+    static constexpr auto manifest_name = ".mavlink_ftp_sync";
+
+    // Non-copyable
+    DirectorySync(const DirectorySync&) = delete;
+    const DirectorySync& operator=(const DirectorySync&) = delete;
+
+private:
+    struct ManifestEntry {
+        uint32_t size;
+        uint32_t crc32;
+    };
+
+    struct Task {
+        enum class Type { List, Check, Download } type;
+        std::string path; ///< Relative to the folders synced, '/' separated
+        uint32_t size;
+        unsigned attempts;
+    };
+
+    typedef std::vector<std::pair<size_t, Task>> Launches;
+
+    Launches _schedule();
+    void _launch(const Launches& launches);
+    void _launch(size_t worker, const Task& task);
+
+    void _on_listed(
+        size_t worker,
+        const Task& task,
+        MavlinkFTP::Result result,
+        const std::vector<std::string>& entries);
+    void _on_checked(size_t worker, const Task& task, MavlinkFTP::Result result, uint32_t crc32);
+    void _on_downloaded(size_t worker, const Task& task, MavlinkFTP::Result result);
+    void _hash_downloaded(size_t worker, const Task& task, MavlinkFTP::Result result);
+    void _hash_thread();
+    void _on_progress(size_t worker, uint32_t bytes_transferred);
+
+    void _add_file(const std::string& path, uint32_t size);
+    void _retry_or_fail(const Task& task, MavlinkFTP::Result result);
+    void _done(size_t worker);
+    void _finish(MavlinkFTP::Result result);
+    void _stop_hashing();
+
+    std::string _remote_path(const std::string& path) const;
+    std::string _local_path(const std::string& path) const;
+    bool _create_local_directory(const std::string& path) const;
+
+    void _read_manifest();
+    bool _write_manifest() const;
+
+    std::vector<MavlinkFTPImpl*> _workers;
+    std::string _remote_folder;
+    std::string _local_folder;
+    MavlinkFTP::progress_callback_t _progress_callback;
+    MavlinkFTP::result_callback_t _result_callback;
+    dispatch_t _dispatch;
+
+    std::mutex _mutex{};
+    std::deque<Task> _tasks{};
+    std::vector<bool> _busy{};
+    // Lowered when a task fails while others run, the server may be out of sessions.
+    size_t _max_busy{0};
+    bool _cancelled{false};
+    bool _finished{false};
+    MavlinkFTP::Result _result{MavlinkFTP::Result::SUCCESS};
+
+    std::map<std::string, ManifestEntry> _manifest{};
+    std::map<std::string, ManifestEntry> _synced{};
+
+    uint64_t _bytes_total{0};
+    uint64_t _bytes_done{0};
+    std::vector<uint32_t> _bytes_in_progress{};
+
+    // Runs until the sync finishes or is cancelled, keeping the sync alive until then.
+    std::thread _hasher{};
+    SafeQueue<std::function<void()>> _hash_queue{};
+};
+
+} // namespace mavsdk
@@ -33,6 +33,17 @@ public:
      */
     explicit MavlinkFTP(System& system);
 
+    /**
+     * @brief Constructor for a client which leaves the FTP requests of the system unanswered.
+     *
+     * Meant for other plugins transferring files of their own, next to a plugin created as
+     * shown above which answers the requests.
+     *
+     * @param system The specific system associated with this plugin.
+     * @param serve_requests false to only act as a client.
+     */
+    MavlinkFTP(System& system, bool serve_requests);
+
     /**
      * @brief Destructor (internal use only).
      */
@@ -93,6 +104,10 @@ public:
     /**
      * @brief Downloads a file to local folder (asynchronous).
      *
+     * A download which fails half way leaves the partial file and a checkpoint
+     * next to it (`<file>.ftp_resume`). Downloading the same file again continues
+     * from there, provided the remote file still matches the data received.
+     *
      * @param remote_file_path Remote file to download
      * @param local_folder Local folder where downloaded file will be stored
      * @param progress_callback Callback to receive progress of this request.
@@ -104,6 +119,19 @@ public:
         progress_callback_t progress_callback,
         result_callback_t result_callback);
 
+    /**
+     * @brief Removes what a failed download left behind.
+     *
+     * Deletes the partial file and its checkpoint, so that the next download of the file
+     * starts from scratch.
+     *
+     * @param remote_file_path Remote file which was downloaded
+     * @param local_folder Local folder the file was downloaded to
+     * @return Result of the operation
+     */
+    MavlinkFTP::Result
+    discard_download(const std::string& remote_file_path, const std::string& local_folder);
+
     /**
      * @brief Uploads local file to remote folder (asynchronous).
      *
@@ -178,6 +206,26 @@ public:
      */
     MavlinkFTP::Result calc_local_file_crc32(const std::string& path, uint32_t& checksum);
 
+    /**
+     * @brief Mirrors a remote directory tree into a local folder (asynchronous).
+     *
+     * The tree is listed and the files are downloaded over several sessions at once, see
+     * `set_sync_sessions()`. Size and CRC32 of the files synced are kept in a manifest in the
+     * local folder, files which did not change since the last sync are not downloaded again.
+     * Local files which are gone on the remote side are left alone.
+     *
+     * @param remote_folder Remote folder to sync
+     * @param local_folder Local folder to sync into, created if it does not exist.
+     * @param progress_callback Callback to receive progress of the downloads, the total grows
+     * while the tree is listed.
+     * @param result_callback Callback to receive result of this request.
+     */
+    void sync_directory_async(
+        const std::string& remote_folder,
+        const std::string& local_folder,
+        progress_callback_t progress_callback,
+        result_callback_t result_callback);
+
     /**
      * @brief Set timeout for Mavlink FTP operation.
      *
@@ -192,6 +240,39 @@ public:
      */
     void set_retries(uint32_t retries);
 
+    /**
+     * @brief Enable or disable burst reads for downloads, enabled by default.
+     *
+     * With burst reads the server streams the file without waiting for a request per
+     * chunk, which is a lot faster on links with high latency. Chunks lost on the way
+     * are requested again individually. Servers without burst support are detected and
+     * read from chunk by chunk anyway, so this is mostly useful to compare the two.
+     *
+     * @param enabled true to use burst reads.
+     */
+    void set_burst_download(bool enabled);
+
+    /**
+     * @brief Set how many writes an upload may have in flight at most, 16 by default.
+     *
+     * The window actually used adapts to the loss seen on the link, shrinking when
+     * writes get lost and growing again while they don't. 1 sends one chunk after the
+     * other, waiting for each to be acked.
+     *
+     * @param max_writes Maximum number of writes not acked yet.
+     */
+    void set_upload_window(unsigned max_writes);
+
+    /**
+     * @brief Set how many sessions a directory sync uses at most, 4 by default.
+     *
+     * Servers with fewer sessions available, like PX4 which has only one, are
+     * detected and used with fewer.
+     *
+     * @param sessions Maximum number of transfers at the same time.
+     */
+    void set_sync_sessions(unsigned sessions);
+
     /**
      * @brief Set root dir for Mavlink FTP server.
      *
@@ -199,6 +280,15 @@ public:
      */
     void set_root_dir(const std::string& root_dir);
 
+    /**
+     * @brief Set the rate at which the Mavlink FTP server streams burst reads.
+     *
+     * Bursts of all clients share this rate.
+     *
+     * @param bytes_per_second Rate of file data sent, 100 KiB/s by default.
+     */
+    void set_burst_rate(uint32_t bytes_per_second);
+
     /**
      * @brief Set target component id. By default it is the autopilot
      *
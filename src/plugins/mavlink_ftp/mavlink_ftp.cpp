@@ -5,6 +5,11 @@ namespace mavsdk {
 
 MavlinkFTP::MavlinkFTP(System& system) : PluginBase(), _impl{new MavlinkFTPImpl(system)} {}
 
+MavlinkFTP::MavlinkFTP(System& system, bool serve_requests) :
+    PluginBase(),
+    _impl{new MavlinkFTPImpl(system, serve_requests)}
+{}
+
 MavlinkFTP::~MavlinkFTP() {}
 
 std::string MavlinkFTP::result_str(Result result)
@@ -45,11 +50,31 @@ void MavlinkFTP::set_retries(uint32_t retries)
     _impl->set_retries(retries);
 }
 
+void MavlinkFTP::set_burst_download(bool enabled)
+{
+    _impl->set_burst_download(enabled);
+}
+
+void MavlinkFTP::set_upload_window(unsigned max_writes)
+{
+    _impl->set_upload_window(max_writes);
+}
+
+void MavlinkFTP::set_sync_sessions(unsigned sessions)
+{
+    _impl->set_sync_sessions(sessions);
+}
+
 void MavlinkFTP::set_root_dir(const std::string& root_dir)
 {
     _impl->set_root_dir(root_dir);
 }
 
+void MavlinkFTP::set_burst_rate(uint32_t bytes_per_second)
+{
+    _impl->set_burst_rate(bytes_per_second);
+}
+
 void MavlinkFTP::set_target_component_id(uint8_t component_id)
 {
     _impl->set_target_component_id(component_id);
@@ -74,6 +99,12 @@ void MavlinkFTP::download_async(
     _impl->download_async(remote_file_path, local_folder, progress_callback, result_callback);
 }
 
+MavlinkFTP::Result
+MavlinkFTP::discard_download(const std::string& remote_file_path, const std::string& local_folder)
+{
+    return _impl->discard_download(remote_file_path, local_folder);
+}
+
 void MavlinkFTP::upload_async(
     const std::string& local_file_path,
     const std::string& remote_folder,
@@ -121,4 +152,13 @@ MavlinkFTP::Result MavlinkFTP::calc_local_file_crc32(const std::string& path, ui
     return _impl->calc_local_file_crc32(path, checksum);
 }
 
+void MavlinkFTP::sync_directory_async(
+    const std::string& remote_folder,
+    const std::string& local_folder,
+    progress_callback_t progress_callback,
+    result_callback_t result_callback)
+{
+    _impl->sync_directory_async(remote_folder, local_folder, progress_callback, result_callback);
+}
+
 } // namespace mavsdk
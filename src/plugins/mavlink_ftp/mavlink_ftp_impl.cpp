@@ -1,5 +1,8 @@
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iostream>
+#include <vector>
 
 #if defined(WINDOWS)
 #include "tronkko_dirent.h"
@@ -12,6 +15,7 @@
 #include <sys/stat.h>
 
 #include "crc32.h"
+#include "directory_sync.h"
 #include "fs.h"
 #include "mavlink_ftp_impl.h"
 #include "system.h"
@@ -21,13 +25,81 @@ namespace mavsdk {
 
 using namespace std::placeholders; // for `_1`
 
-MavlinkFTPImpl::MavlinkFTPImpl(System& system) : PluginImplBase(system)
+namespace {
+
+// Sequence numbers wrap around, so compare them by distance.
+bool seq_before(uint16_t a, uint16_t b)
+{
+    return static_cast<uint16_t>(b - a) != 0 && static_cast<uint16_t>(b - a) < 0x8000;
+}
+
+// Reading and writing at an offset doesn't touch the file position, so a
+// session can't be thrown off by a seek done for another request.
+ssize_t read_at(int fd, uint8_t* buffer, size_t size, uint32_t offset)
+{
+#if defined(WINDOWS)
+    if (lseek(fd, offset, SEEK_SET) < 0) {
+        return -1;
+    }
+    return ::read(fd, buffer, size);
+#else
+    return ::pread(fd, buffer, size, offset);
+#endif
+}
+
+ssize_t write_at(int fd, const uint8_t* buffer, size_t size, uint32_t offset)
+{
+#if defined(WINDOWS)
+    if (lseek(fd, offset, SEEK_SET) < 0) {
+        return -1;
+    }
+    return ::write(fd, buffer, size);
+#else
+    return ::pwrite(fd, buffer, size, offset);
+#endif
+}
+
+// Files are checksummed in chunks of this size.
+constexpr size_t crc32_read_size = 1024 * 1024;
+
+// Appended to the local path of a download for its checkpoint.
+constexpr auto resume_suffix = ".ftp_resume";
+
+// Received data after which a download is checkpointed again, besides when it fails.
+constexpr uint32_t resume_checkpoint_interval = 64 * 1024;
+
+// Chunks of a partial file compared with the remote file before resuming.
+constexpr unsigned resume_checks = 4;
+
+// Shared by all instances, so that each can tell the replies to its requests
+// apart from those to the requests of others talking to the same server.
+std::atomic<uint16_t> next_seq_number{0};
+
+} // namespace
+
+MavlinkFTPImpl::MavlinkFTPImpl(System& system) : MavlinkFTPImpl(system, true) {}
+
+MavlinkFTPImpl::MavlinkFTPImpl(System& system, bool serve_requests) :
+    PluginImplBase(system),
+    _system(system),
+    _serve_requests(serve_requests)
 {
     _parent->register_plugin(this);
 }
 
 MavlinkFTPImpl::~MavlinkFTPImpl()
 {
+    _hash_queue.stop();
+    if (_hasher.joinable()) {
+        _hasher.join();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_sync_mutex);
+        if (_sync) {
+            _sync->cancel();
+        }
+    }
     _parent->unregister_plugin(this);
 }
 
@@ -39,15 +111,59 @@ void MavlinkFTPImpl::init()
         this);
 }
 
-void MavlinkFTPImpl::deinit() {}
+void MavlinkFTPImpl::deinit()
+{
+    _parent->unregister_all_mavlink_message_handlers(this);
+
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+    if (_stream_cookie != nullptr) {
+        _parent->remove_call_every(_stream_cookie);
+        _stream_cookie = nullptr;
+    }
+
+    for (auto& session : _sessions) {
+        if (session.fd >= 0) {
+            close(session.fd);
+        }
+        session = SessionInfo{};
+    }
+}
 
 void MavlinkFTPImpl::enable() {}
 
 void MavlinkFTPImpl::disable() {}
 
+bool MavlinkFTPImpl::_is_reply_to_us(PayloadHeader* payload)
+{
+    if (payload->req_opcode == CMD_BURST_READ_FILE && _curr_op == CMD_BURST_READ_FILE) {
+        // Burst data counts up its own sequence numbers.
+        return payload->session == _session;
+    }
+
+    // Burst data of others can carry the sequence number expected here as well.
+    const uint16_t request_seq = payload->seq_number - 1;
+    if (request_seq == _last_request_seq && payload->req_opcode == _last_request_opcode) {
+        return true;
+    }
+
+    if (_curr_op == CMD_WRITE_FILE && payload->req_opcode == CMD_WRITE_FILE) {
+        for (const auto& write : _writes_in_flight) {
+            if (write.second.seq_number == request_seq) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 void MavlinkFTPImpl::_process_ack(PayloadHeader* payload)
 {
     std::lock_guard<std::mutex> lock(_curr_op_mutex);
+    if (!_is_reply_to_us(payload)) {
+        return;
+    }
+
     switch (_curr_op) {
         case CMD_NONE:
             LogWarn() << "Received ACK without active operation";
@@ -57,21 +173,55 @@ void MavlinkFTPImpl::_process_ack(PayloadHeader* payload)
             _curr_op = CMD_NONE;
             _session_valid = true;
             _session = payload->session;
-            _bytes_transferred = 0;
             _file_size = *(reinterpret_cast<uint32_t*>(payload->data));
-            _call_op_progress_callback(_bytes_transferred, _file_size);
-            _read();
+            if (_resume_state != ResumeState::Checking) {
+                _start_download();
+            } else if (_file_size != _resume_file_size) {
+                LogWarn() << "Remote file changed, downloading it again";
+                _restart_download();
+            } else {
+                _plan_resume_checks();
+                _check_resume_next();
+            }
+            break;
+
+        case CMD_BURST_READ_FILE:
+            // Data of a burst, or of a read filling a gap, possibly from an
+            // earlier request answered late.
+            if (payload->session != _session) {
+                break;
+            }
+            if (payload->req_opcode == CMD_BURST_READ_FILE) {
+                _burst_supported = true;
+            }
+            if (payload->size > 0 && !_burst_write(payload)) {
+                _session_result = ServerResult::ERR_FILE_IO_ERROR;
+                _end_read_session();
+                return;
+            }
+            if (payload->req_opcode == CMD_BURST_READ_FILE && payload->burst_complete == 0) {
+                // More of this burst to come.
+                _reset_timer();
+                break;
+            }
+            _burst_read_next();
             break;
 
         case CMD_READ_FILE:
+            if (_resume_state == ResumeState::Checking) {
+                _check_resumed_chunk(payload);
+                break;
+            }
             _ofstream->write(reinterpret_cast<const char*>(payload->data), payload->size);
             if (!*_ofstream) {
                 _session_result = ServerResult::ERR_FILE_IO_ERROR;
                 _end_read_session();
                 return;
             }
+            _received.insert(_bytes_transferred, _bytes_transferred + payload->size);
             _bytes_transferred += payload->size;
             _call_op_progress_callback(_bytes_transferred, _file_size);
+            _checkpoint_download();
             _read();
             break;
 
@@ -80,20 +230,24 @@ void MavlinkFTPImpl::_process_ack(PayloadHeader* payload)
             _session_valid = true;
             _session = payload->session;
             _bytes_transferred = 0;
+            _writes_in_flight.clear();
+            _next_write_offset = 0;
+            _write_window = std::max(_max_write_window / 2, 1u);
+            _write_window_acks = 0;
+            _write_recovery_seq = next_seq_number;
             _call_op_progress_callback(_bytes_transferred, _file_size);
             _write();
             break;
 
         case CMD_WRITE_FILE:
-            _call_op_progress_callback(_bytes_transferred, _file_size);
-            _write();
+            _write_acked(payload);
             break;
 
         case CMD_TERMINATE_SESSION:
             _curr_op = CMD_NONE;
             _session_valid = false;
             _stop_timer();
-            _call_op_result_callback(_session_result);
+            _session_terminated();
             break;
 
         case CMD_LIST_DIRECTORY: {
@@ -122,9 +276,17 @@ void MavlinkFTPImpl::_process_ack(PayloadHeader* payload)
         }
 
         case CMD_CALC_FILE_CRC32: {
-            _curr_op = CMD_NONE;
             uint32_t checksum = *reinterpret_cast<uint32_t*>(payload->data);
             _stop_timer();
+            if (_resume_state == ResumeState::Hashing) {
+                // A duplicate of the answer being checked already.
+                break;
+            }
+            if (_resume_state == ResumeState::Verifying) {
+                _hash_resumed_download(checksum);
+                break;
+            }
+            _curr_op = CMD_NONE;
             _call_crc32_result_callback(ServerResult::SUCCESS, checksum);
             break;
         }
@@ -145,13 +307,15 @@ void MavlinkFTPImpl::_process_nak(PayloadHeader* payload)
         if (sr == ServerResult::ERR_FAIL_ERRNO && payload->data[1] == ENOENT) {
             sr = ServerResult::ERR_FAIL_FILE_DOES_NOT_EXIST;
         }
-        _process_nak(sr);
+        std::lock_guard<std::mutex> lock(_curr_op_mutex);
+        if (_is_reply_to_us(payload)) {
+            _handle_nak(sr);
+        }
     }
 }
 
-void MavlinkFTPImpl::_process_nak(ServerResult result)
+void MavlinkFTPImpl::_handle_nak(ServerResult result)
 {
-    std::lock_guard<std::mutex> lock(_curr_op_mutex);
     switch (_curr_op) {
         case CMD_NONE:
             LogWarn() << "Received NAK without active operation";
@@ -159,10 +323,46 @@ void MavlinkFTPImpl::_process_nak(ServerResult result)
 
         case CMD_OPEN_FILE_RO:
         case CMD_READ_FILE:
+            if (_curr_op == CMD_READ_FILE && _resume_state == ResumeState::Checking &&
+                _session_valid && result != ServerResult::ERR_TIMEOUT) {
+                // The remote file is shorter than the data received before.
+                LogWarn() << "Remote file changed, downloading it again";
+                _restart_download();
+                return;
+            }
             _session_result = result;
             if (_session_valid) {
+                // The terminate request sent is the operation now.
                 _end_read_session();
+                return;
             } else {
+                _close_download();
+                _stop_timer();
+                _call_op_result_callback(_session_result);
+            }
+            break;
+
+        case CMD_BURST_READ_FILE:
+            if (result == ServerResult::ERR_EOF) {
+                // The file ended before the size it had when opened, so there is
+                // nothing to get after the data received last.
+                _file_size = std::min(_file_size, _received.covered_end());
+                _burst_read_next();
+                return;
+            }
+            if (!_burst_supported && (result == ServerResult::ERR_UNKOWN_COMMAND ||
+                                      result == ServerResult::ERR_TIMEOUT)) {
+                // Servers without burst support either refuse it or never answer.
+                _fall_back_to_read();
+                return;
+            }
+            _session_result = result;
+            if (_session_valid) {
+                // The terminate request sent is the operation now.
+                _end_read_session();
+                return;
+            } else {
+                _close_download();
                 _stop_timer();
                 _call_op_result_callback(_session_result);
             }
@@ -172,7 +372,9 @@ void MavlinkFTPImpl::_process_nak(ServerResult result)
         case CMD_WRITE_FILE:
             _session_result = result;
             if (_session_valid) {
+                // The terminate request sent is the operation now.
                 _end_write_session();
+                return;
             } else {
                 _stop_timer();
                 _call_op_result_callback(_session_result);
@@ -180,10 +382,12 @@ void MavlinkFTPImpl::_process_nak(ServerResult result)
             break;
 
         case CMD_TERMINATE_SESSION:
+            _curr_op = CMD_NONE;
             _session_valid = false;
             _stop_timer();
-            _call_op_result_callback(_session_result);
-            break;
+            // May verify a resumed download, which is the operation then.
+            _session_terminated();
+            return;
 
         case CMD_LIST_DIRECTORY:
             _stop_timer();
@@ -196,6 +400,17 @@ void MavlinkFTPImpl::_process_nak(ServerResult result)
 
         case CMD_CALC_FILE_CRC32:
             _stop_timer();
+            if (_resume_state == ResumeState::Hashing) {
+                // The checksum arrived already and is being compared.
+                return;
+            }
+            if (_resume_state == ResumeState::Verifying) {
+                // Servers without checksums only get the chunks compared before resuming.
+                LogWarn() << "Could not verify resumed download";
+                _resume_state = ResumeState::None;
+                _call_op_result_callback(ServerResult::SUCCESS);
+                break;
+            }
             _call_crc32_result_callback(result, 0);
             break;
 
@@ -276,7 +491,7 @@ void MavlinkFTPImpl::reset_async(MavlinkFTP::result_callback_t callback)
 
     uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
-    payload->seq_number = _seq_number++;
+    payload->seq_number = next_seq_number++;
     payload->session = _session;
     payload->opcode = _curr_op = CMD_RESET_SESSIONS;
     payload->offset = 0;
@@ -297,11 +512,17 @@ void MavlinkFTPImpl::download_async(
         return;
     }
 
-    std::string local_path = local_folder + path_separator + fs_filename(remote_path);
+    _remote_path = remote_path;
+    _local_path = local_folder + path_separator + fs_filename(remote_path);
+    _resume_state = _load_resume_checkpoint() ? ResumeState::Checking : ResumeState::None;
 
-    _ofstream =
-        std::make_shared<std::ofstream>(local_path, std::fstream::trunc | std::fstream::binary);
+    // A partial file to resume is opened without truncating it.
+    const auto mode = (_resume_state == ResumeState::Checking) ?
+                          (std::fstream::in | std::fstream::out | std::fstream::binary) :
+                          (std::fstream::trunc | std::fstream::binary);
+    _ofstream = std::make_shared<std::ofstream>(_local_path, mode);
     if (!*_ofstream) {
+        _session_result = ServerResult::ERR_FILE_IO_ERROR;
         _end_read_session();
         result_callback(MavlinkFTP::Result::FILE_IO_ERROR);
         return;
@@ -311,14 +532,270 @@ void MavlinkFTPImpl::download_async(
     _generic_command_async(CMD_OPEN_FILE_RO, 0, remote_path, result_callback);
 }
 
+MavlinkFTP::Result
+MavlinkFTPImpl::discard_download(const std::string& remote_path, const std::string& local_folder)
+{
+    std::lock_guard<std::mutex> lock(_curr_op_mutex);
+    const std::string local_path = local_folder + path_separator + fs_filename(remote_path);
+    if (_curr_op != CMD_NONE && local_path == _local_path) {
+        return MavlinkFTP::Result::IN_PROGRESS;
+    }
+
+    fs_remove(local_path + resume_suffix);
+    if (fs_exists(local_path) && !fs_remove(local_path)) {
+        return MavlinkFTP::Result::FILE_IO_ERROR;
+    }
+    return MavlinkFTP::Result::SUCCESS;
+}
+
 void MavlinkFTPImpl::_end_read_session()
 {
     _curr_op = CMD_NONE;
-    if (_ofstream) {
-        _ofstream->close();
+    _close_download();
+    _terminate_session();
+}
+
+void MavlinkFTPImpl::_close_download()
+{
+    if (!_ofstream) {
+        return;
+    }
+    if (_session_result == ServerResult::SUCCESS) {
+        fs_remove(_local_path + resume_suffix);
+    } else {
+        // What arrived so far is picked up by the next download of the file.
+        _save_resume_checkpoint();
+    }
+    _ofstream->close();
+    _ofstream = nullptr;
+}
+
+void MavlinkFTPImpl::_start_download()
+{
+    _resume_state = _received.empty() ? ResumeState::None : ResumeState::Resumed;
+    _checkpoint_bytes = _received.size();
+    _write_offset = 0;
+    if (_burst_download_enabled) {
+        _burst_supported = false;
+        _bytes_transferred = _received.size();
+        _call_op_progress_callback(_bytes_transferred, _file_size);
+        _burst_read_next();
+    } else {
+        _read_from_prefix();
+    }
+}
+
+void MavlinkFTPImpl::_restart_download()
+{
+    _resume_checks.clear();
+    _received.clear();
+    fs_remove(_local_path + resume_suffix);
+
+    _ofstream->close();
+    _ofstream->open(_local_path, std::fstream::trunc | std::fstream::binary);
+    if (!*_ofstream) {
+        _session_result = ServerResult::ERR_FILE_IO_ERROR;
+        _end_read_session();
+        return;
+    }
+    _start_download();
+}
+
+bool MavlinkFTPImpl::_load_resume_checkpoint()
+{
+    _received.clear();
+    _resume_checks.clear();
+
+    // "<remote path>", "<file size>", then one "<begin> <end>" line per range received.
+    std::ifstream file(_local_path + resume_suffix);
+    std::string path;
+    if (!std::getline(file, path) || path != _remote_path || !(file >> _resume_file_size)) {
+        return false;
+    }
+    uint32_t begin;
+    uint32_t end;
+    while (file >> begin >> end) {
+        if (begin < end && end <= _resume_file_size) {
+            _received.insert(begin, end);
+        }
+    }
+
+    // The partial file has to hold everything the checkpoint claims.
+    if (_received.empty() || fs_file_size(_local_path) < _received.covered_end()) {
+        _received.clear();
+        return false;
+    }
+    return true;
+}
+
+void MavlinkFTPImpl::_save_resume_checkpoint()
+{
+    // Only data which made it into the file may be recorded.
+    if (_received.empty() || !_ofstream->flush()) {
+        return;
+    }
+
+    const std::string checkpoint_path = _local_path + resume_suffix;
+    const std::string temp_path = checkpoint_path + ".tmp";
+    {
+        std::ofstream file(temp_path, std::fstream::trunc);
+        file << _remote_path << '\n' << _file_size << '\n';
+        for (const auto& range : _received.ranges()) {
+            file << range.first << ' ' << range.second << '\n';
+        }
+        if (!file.flush()) {
+            LogWarn() << "Could not write " << temp_path;
+            return;
+        }
+    }
+
+#if defined(WINDOWS)
+    // rename() does not replace existing files there.
+    fs_remove(checkpoint_path);
+#endif
+    if (!fs_rename(temp_path, checkpoint_path)) {
+        LogWarn() << "Could not replace " << checkpoint_path;
+        return;
+    }
+    _checkpoint_bytes = _received.size();
+}
+
+void MavlinkFTPImpl::_checkpoint_download()
+{
+    if (_received.size() - _checkpoint_bytes >= resume_checkpoint_interval) {
+        _save_resume_checkpoint();
+    }
+}
+
+void MavlinkFTPImpl::_plan_resume_checks()
+{
+    // MAVLink FTP can only checksum whole files, so the data received before is
+    // compared with the remote file at a few places instead, including the end,
+    // which was written last.
+    _resume_checks.clear();
+    const auto& ranges = _received.ranges();
+    const uint32_t last = _received.covered_end() - 1;
+    for (unsigned i = 0; i <= resume_checks; ++i) {
+        const uint32_t target =
+            static_cast<uint32_t>(static_cast<uint64_t>(last) * i / resume_checks);
+        auto range = ranges.upper_bound(target);
+        if (range != ranges.begin() && std::prev(range)->second > target) {
+            --range;
+        }
+        if (range == ranges.end()) {
+            continue;
+        }
+        const uint32_t length = std::min<uint32_t>(max_data_length, range->second - range->first);
+        const uint32_t offset = std::max(range->first, std::min(target, range->second - length));
+        if (_resume_checks.empty() || _resume_checks.back().first != offset) {
+            _resume_checks.emplace_back(offset, length);
+        }
+    }
+}
+
+void MavlinkFTPImpl::_check_resume_next()
+{
+    if (_resume_checks.empty()) {
+        _start_download();
+        return;
+    }
+
+    uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
+    PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
+    payload->seq_number = next_seq_number++;
+    payload->session = _session;
+    payload->opcode = _curr_op = CMD_READ_FILE;
+    payload->offset = _resume_checks.front().first;
+    payload->size = 0;
+    _send_mavlink_ftp_message(raw_payload);
+}
+
+void MavlinkFTPImpl::_check_resumed_chunk(PayloadHeader* payload)
+{
+    const auto check = _resume_checks.front();
+    _resume_checks.erase(_resume_checks.begin());
+
+    std::vector<uint8_t> local(check.second);
+    std::ifstream file(_local_path, std::fstream::binary);
+    file.seekg(check.first);
+    file.read(reinterpret_cast<char*>(local.data()), check.second);
+
+    if (!file || payload->size < check.second ||
+        !std::equal(local.begin(), local.end(), payload->data)) {
+        LogWarn() << "Remote file changed, downloading it again";
+        _restart_download();
+        return;
+    }
+    _check_resume_next();
+}
+
+void MavlinkFTPImpl::_session_terminated()
+{
+    if (_resume_state != ResumeState::Resumed || _session_result != ServerResult::SUCCESS) {
+        _resume_state = ResumeState::None;
+        _call_op_result_callback(_session_result);
+        return;
+    }
+
+    // Only a few chunks were compared before resuming, the checksum of the
+    // whole file tells whether the remote file changed anywhere else.
+    uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
+    PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
+    payload->seq_number = next_seq_number++;
+    payload->session = 0;
+    payload->opcode = _curr_op = CMD_CALC_FILE_CRC32;
+    payload->offset = 0;
+    strncpy(reinterpret_cast<char*>(payload->data), _remote_path.c_str(), max_data_length - 1);
+    payload->size = _remote_path.length() + 1;
+    _resume_state = ResumeState::Verifying;
+    _send_mavlink_ftp_message(raw_payload);
+}
+
+void MavlinkFTPImpl::_hash_resumed_download(uint32_t remote_crc32)
+{
+    // Reading the whole file takes a while for big ones, so it is done on a thread of
+    // our own, neither the receive thread nor the user callbacks wait for it. The
+    // download stays the current operation until it's done.
+    _resume_state = ResumeState::Hashing;
+    if (!_hasher.joinable()) {
+        _hasher = std::thread([this]() {
+            while (auto func = _hash_queue.dequeue()) {
+                func();
+            }
+        });
+    }
+    const std::string local_path = _local_path;
+    _hash_queue.enqueue([this, local_path, remote_crc32]() {
+        uint32_t local_crc32;
+        const bool matches =
+            calc_local_file_crc32(local_path, local_crc32) == MavlinkFTP::Result::SUCCESS &&
+            local_crc32 == remote_crc32;
+
+        std::lock_guard<std::mutex> lock(_curr_op_mutex);
+        _check_resumed_download(matches);
+    });
+}
+
+void MavlinkFTPImpl::_check_resumed_download(bool matches)
+{
+    _curr_op = CMD_NONE;
+    _resume_state = ResumeState::None;
+
+    if (matches) {
+        _call_op_result_callback(ServerResult::SUCCESS);
+        return;
+    }
+
+    LogWarn() << "Resumed download does not match remote file, downloading it again";
+    _received.clear();
+    _ofstream =
+        std::make_shared<std::ofstream>(_local_path, std::fstream::trunc | std::fstream::binary);
+    if (!*_ofstream) {
         _ofstream = nullptr;
+        _call_op_result_callback(ServerResult::ERR_FILE_IO_ERROR);
+        return;
     }
-    _terminate_session();
+    _generic_command_async(CMD_OPEN_FILE_RO, 0, _remote_path, _curr_op_result_callback);
 }
 
 void MavlinkFTPImpl::_read()
@@ -331,7 +808,7 @@ void MavlinkFTPImpl::_read()
 
     uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
-    payload->seq_number = _seq_number++;
+    payload->seq_number = next_seq_number++;
     payload->session = _session;
     payload->opcode = _curr_op = CMD_READ_FILE;
     payload->offset = _bytes_transferred;
@@ -339,6 +816,78 @@ void MavlinkFTPImpl::_read()
     _send_mavlink_ftp_message(raw_payload);
 }
 
+bool MavlinkFTPImpl::_prepare_burst_read(uint8_t* raw_payload)
+{
+    RangeSet<uint32_t>::Range gap;
+    if (!_received.first_gap(0, _file_size, gap)) {
+        return false;
+    }
+
+    // The rest of the file is streamed in bursts, single missing chunks before
+    // it are read one by one so that data already received isn't sent again.
+    PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
+    payload->seq_number = next_seq_number++;
+    payload->session = _session;
+    payload->opcode = (gap.second >= _file_size) ? CMD_BURST_READ_FILE : CMD_READ_FILE;
+    payload->offset = gap.first;
+    payload->size = 0;
+    _curr_op = CMD_BURST_READ_FILE;
+    return true;
+}
+
+void MavlinkFTPImpl::_burst_read_next()
+{
+    uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
+    if (!_prepare_burst_read(raw_payload)) {
+        _session_result = ServerResult::SUCCESS;
+        _end_read_session();
+        return;
+    }
+    _send_mavlink_ftp_message(raw_payload);
+}
+
+bool MavlinkFTPImpl::_burst_write(PayloadHeader* payload)
+{
+    if (payload->offset >= _file_size) {
+        return true;
+    }
+    const uint32_t size = std::min<uint32_t>(payload->size, _file_size - payload->offset);
+
+    if (payload->offset != _write_offset) {
+        _ofstream->seekp(payload->offset);
+    }
+    _ofstream->write(reinterpret_cast<const char*>(payload->data), size);
+    if (!*_ofstream) {
+        return false;
+    }
+    _write_offset = payload->offset + size;
+
+    const uint32_t added = _received.insert(payload->offset, payload->offset + size);
+    if (added > 0) {
+        _bytes_transferred += added;
+        _call_op_progress_callback(_bytes_transferred, _file_size);
+        _checkpoint_download();
+    }
+    return true;
+}
+
+void MavlinkFTPImpl::_fall_back_to_read()
+{
+    LogWarn() << "Burst download not supported, reading chunk by chunk";
+    _session_valid = true;
+    _read_from_prefix();
+}
+
+void MavlinkFTPImpl::_read_from_prefix()
+{
+    // Reads go in order, so anything received after the first gap is read again.
+    RangeSet<uint32_t>::Range gap;
+    _bytes_transferred = _received.first_gap(0, _file_size, gap) ? gap.first : _file_size;
+    _ofstream->seekp(_bytes_transferred);
+    _call_op_progress_callback(_bytes_transferred, _file_size);
+    _read();
+}
+
 void MavlinkFTPImpl::upload_async(
     const std::string& local_file_path,
     const std::string& remote_folder,
@@ -382,27 +931,118 @@ void MavlinkFTPImpl::_end_write_session()
 
 void MavlinkFTPImpl::_write()
 {
-    if (_bytes_transferred >= _file_size) {
+    if (_writes_in_flight.empty() && _next_write_offset >= _file_size) {
         _session_result = ServerResult::SUCCESS;
         _end_write_session();
         return;
     }
 
+    _curr_op = CMD_WRITE_FILE;
+
+    bool sent = false;
+    while (_next_write_offset < _file_size && _writes_in_flight.size() < _write_window) {
+        const uint8_t size = static_cast<uint8_t>(
+            std::min<uint32_t>(max_data_length, _file_size - _next_write_offset));
+        if (!_send_write(_next_write_offset, size)) {
+            _session_result = ServerResult::ERR_FILE_IO_ERROR;
+            _end_write_session();
+            return;
+        }
+        _next_write_offset += size;
+        sent = true;
+    }
+
+    if (sent) {
+        _start_timer();
+    }
+}
+
+bool MavlinkFTPImpl::_send_write(uint32_t offset, uint8_t size)
+{
     uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
-    payload->seq_number = _seq_number++;
+    payload->seq_number = next_seq_number++;
     payload->session = _session;
-    payload->opcode = _curr_op = CMD_WRITE_FILE;
-    payload->offset = _bytes_transferred;
-    int bytes_read = _ifstream->readsome(reinterpret_cast<char*>(payload->data), max_data_length);
+    payload->opcode = CMD_WRITE_FILE;
+    payload->offset = offset;
+    payload->size = size;
+
+    _ifstream->seekg(offset);
+    _ifstream->read(reinterpret_cast<char*>(payload->data), size);
     if (!*_ifstream) {
-        _end_write_session();
-        _call_op_result_callback(ServerResult::ERR_FILE_IO_ERROR);
+        return false;
+    }
+
+    _writes_in_flight[offset] = WriteInFlight{payload->seq_number, size, 0};
+    _pack_mavlink_ftp_message(raw_payload);
+    _parent->send_message(_last_command);
+    return true;
+}
+
+void MavlinkFTPImpl::_write_acked(PayloadHeader* payload)
+{
+    const auto acked = _writes_in_flight.find(payload->offset);
+    if (acked == _writes_in_flight.end()) {
+        // Late ack of a write which was sent twice.
         return;
     }
-    payload->size = bytes_read;
-    _bytes_transferred += bytes_read;
-    _send_mavlink_ftp_message(raw_payload);
+
+    // The ack carries the sequence number of the request plus one, which tells
+    // which of the writes sent for this offset got through.
+    const uint16_t acked_seq = payload->seq_number - 1;
+    _bytes_transferred += acked->second.size;
+    _writes_in_flight.erase(acked);
+    _call_op_progress_callback(_bytes_transferred, _file_size);
+
+    // Writes sent before the acked one are most likely lost once two later ones
+    // got through, one is allowed for reordering on the way.
+    std::vector<std::pair<uint32_t, uint8_t>> lost;
+    bool new_loss = false;
+    for (auto& write : _writes_in_flight) {
+        if (seq_before(write.second.seq_number, acked_seq) && ++write.second.overtaken >= 2) {
+            lost.emplace_back(write.first, write.second.size);
+            new_loss = new_loss || !seq_before(write.second.seq_number, _write_recovery_seq);
+        }
+    }
+
+    // Additive increase, multiplicative decrease, like TCP. Losses of writes sent
+    // before the last decrease don't count again.
+    if (new_loss) {
+        _write_window = std::max(_write_window / 2, 1u);
+        _write_window_acks = 0;
+        _write_recovery_seq = next_seq_number;
+    } else if (++_write_window_acks >= _write_window) {
+        _write_window = std::min(_write_window + 1, _max_write_window);
+        _write_window_acks = 0;
+    }
+
+    for (const auto& write : lost) {
+        if (!_send_write(write.first, write.second)) {
+            _session_result = ServerResult::ERR_FILE_IO_ERROR;
+            _end_write_session();
+            return;
+        }
+    }
+
+    _reset_timer();
+    _write();
+}
+
+void MavlinkFTPImpl::_resend_writes()
+{
+    // Nothing came back for a while, start over slowly with what is missing.
+    _write_window = 1;
+    _write_window_acks = 0;
+    _write_recovery_seq = next_seq_number;
+
+    // Copied because sending replaces the entries.
+    const auto writes = _writes_in_flight;
+    for (const auto& write : writes) {
+        if (!_send_write(write.first, write.second.size)) {
+            // Reported with the timeout once the retries are used up.
+            return;
+        }
+    }
 }
 
 void MavlinkFTPImpl::_terminate_session()
@@ -412,7 +1052,7 @@ void MavlinkFTPImpl::_terminate_session()
     }
     uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
-    payload->seq_number = _seq_number++;
+    payload->seq_number = next_seq_number++;
     payload->session = _session;
     payload->opcode = _curr_op = CMD_TERMINATE_SESSION;
     payload->offset = 0;
@@ -444,7 +1084,7 @@ void MavlinkFTPImpl::_list_directory(uint32_t offset)
 {
     uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
-    payload->seq_number = _seq_number++;
+    payload->seq_number = next_seq_number++;
     payload->session = 0;
     payload->opcode = _curr_op = CMD_LIST_DIRECTORY;
     payload->offset = offset;
@@ -471,7 +1111,7 @@ void MavlinkFTPImpl::_generic_command_async(
 
     uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
-    payload->seq_number = _seq_number++;
+    payload->seq_number = next_seq_number++;
     payload->session = 0;
     payload->opcode = _curr_op = opcode;
     payload->offset = offset;
@@ -520,7 +1160,7 @@ void MavlinkFTPImpl::rename_async(
 
     uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
-    payload->seq_number = _seq_number++;
+    payload->seq_number = next_seq_number++;
     payload->session = 0;
     payload->opcode = _curr_op = CMD_RENAME;
     payload->offset = 0;
@@ -550,7 +1190,7 @@ void MavlinkFTPImpl::calc_file_crc32_async(
 
     uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
-    payload->seq_number = _seq_number++;
+    payload->seq_number = next_seq_number++;
     payload->session = 0;
     payload->opcode = _curr_op = CMD_CALC_FILE_CRC32;
     payload->offset = 0;
@@ -560,8 +1200,54 @@ void MavlinkFTPImpl::calc_file_crc32_async(
     _send_mavlink_ftp_message(raw_payload);
 }
 
-void MavlinkFTPImpl::_send_mavlink_ftp_message(uint8_t* raw_payload)
+void MavlinkFTPImpl::sync_directory_async(
+    const std::string& remote_folder,
+    const std::string& local_folder,
+    MavlinkFTP::progress_callback_t progress_callback,
+    MavlinkFTP::result_callback_t result_callback)
 {
+    std::unique_lock<std::mutex> lock(_sync_mutex);
+    if (_sync && !_sync->finished()) {
+        lock.unlock();
+        result_callback(MavlinkFTP::Result::IN_PROGRESS);
+        return;
+    }
+
+    // Workers are kept for the next sync, each is one session on the server.
+    while (_sync_workers.size() < _sync_sessions) {
+        _sync_workers.emplace_back(new MavlinkFTPImpl(_system, false));
+    }
+
+    std::vector<MavlinkFTPImpl*> workers;
+    for (unsigned i = 0; i < _sync_sessions; ++i) {
+        MavlinkFTPImpl* worker = _sync_workers[i].get();
+        worker->set_timeout(_last_command_timeout);
+        worker->set_retries(_max_last_command_retries);
+        worker->set_burst_download(_burst_download_enabled);
+        if (_target_component_id_set) {
+            worker->set_target_component_id(_target_component_id);
+        }
+        workers.push_back(worker);
+    }
+
+    auto parent = _parent;
+    _sync = std::make_shared<DirectorySync>(
+        workers,
+        remote_folder,
+        local_folder,
+        progress_callback,
+        result_callback,
+        [parent](const std::function<void()>& func) { parent->call_user_callback(func); });
+    auto sync = _sync;
+    lock.unlock();
+
+    sync->start();
+}
+
+void MavlinkFTPImpl::_pack_mavlink_ftp_message(uint8_t* raw_payload)
+{
+    _last_request_seq = reinterpret_cast<PayloadHeader*>(raw_payload)->seq_number;
+    _last_request_opcode = reinterpret_cast<PayloadHeader*>(raw_payload)->opcode;
     mavlink_msg_file_transfer_protocol_pack(
         _parent->get_own_system_id(),
         _parent->get_own_component_id(),
@@ -570,21 +1256,40 @@ void MavlinkFTPImpl::_send_mavlink_ftp_message(uint8_t* raw_payload)
         _parent->get_system_id(),
         _get_target_component_id(),
         raw_payload);
+}
+
+void MavlinkFTPImpl::_send_mavlink_ftp_message(uint8_t* raw_payload)
+{
+    _pack_mavlink_ftp_message(raw_payload);
     _parent->send_message(_last_command);
+    _start_timer();
+}
 
+void MavlinkFTPImpl::_start_timer()
+{
     _reset_timer();
     std::lock_guard<std::mutex> lock(_timer_mutex);
     if (!_last_command_timer_running) {
         _last_command_timer_running = true;
         _parent->register_timeout_handler(
-            std::bind(&MavlinkFTPImpl::_command_timeout, this),
+            std::bind(&MavlinkFTPImpl::_command_timeout, this, _timer_generation),
             static_cast<double>(_last_command_timeout) / 1000.0,
             &_last_command_timeout_cookie);
     }
 }
 
-void MavlinkFTPImpl::_command_timeout()
+void MavlinkFTPImpl::_command_timeout(unsigned generation)
 {
+    std::lock_guard<std::mutex> lock(_curr_op_mutex);
+    {
+        // A reply may have stopped the timer just before it fired, and the
+        // next request may even have started another one.
+        std::lock_guard<std::mutex> timer_lock(_timer_mutex);
+        if (!_last_command_timer_running || generation != _timer_generation) {
+            return;
+        }
+    }
+
     if (_last_command_retries >= _max_last_command_retries) {
         LogErr() << "Response timeout " << _curr_op;
         _timer_mutex.lock();
@@ -592,13 +1297,23 @@ void MavlinkFTPImpl::_command_timeout()
         _session_result = ServerResult::ERR_TIMEOUT;
         _session_valid = false;
         _timer_mutex.unlock();
-        _process_nak(ServerResult::ERR_TIMEOUT);
+        _handle_nak(ServerResult::ERR_TIMEOUT);
     } else {
         _last_command_retries++;
         LogWarn() << "Response timeout. Retry: " << _last_command_retries;
-        _parent->send_message(_last_command);
+        // A burst may have stopped half way, so ask for what is still missing
+        // instead of repeating the request from where the burst started.
+        uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
+        if (_curr_op == CMD_BURST_READ_FILE && _prepare_burst_read(raw_payload)) {
+            _pack_mavlink_ftp_message(raw_payload);
+            _parent->send_message(_last_command);
+        } else if (_curr_op == CMD_WRITE_FILE && !_writes_in_flight.empty()) {
+            _resend_writes();
+        } else {
+            _parent->send_message(_last_command);
+        }
         _parent->register_timeout_handler(
-            std::bind(&MavlinkFTPImpl::_command_timeout, this),
+            std::bind(&MavlinkFTPImpl::_command_timeout, this, _timer_generation),
             static_cast<double>(_last_command_timeout) / 1000.0,
             &_last_command_timeout_cookie);
     }
@@ -618,6 +1333,7 @@ void MavlinkFTPImpl::_stop_timer()
             return;
         }
         _last_command_timer_running = false;
+        ++_timer_generation;
     }
     _parent->unregister_timeout_handler(_last_command_timeout_cookie);
 }
@@ -638,6 +1354,10 @@ void MavlinkFTPImpl::process_mavlink_ftp_message(const mavlink_message_t& msg)
 
     PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(&ftp_req.payload[0]);
 
+    if (!_serve_requests && payload->opcode != RSP_ACK && payload->opcode != RSP_NAK) {
+        return;
+    }
+
     ServerResult error_code = ServerResult::SUCCESS;
 
     // basic sanity checks; must validate length before use
@@ -650,12 +1370,13 @@ void MavlinkFTPImpl::process_mavlink_ftp_message(const mavlink_message_t& msg)
         payload->seq_number;
         */
 
-        // check the sequence number: if this is a resent request, resend the last response
-        if (_last_reply_valid) {
-            if (payload->seq_number + 1 == _last_reply_seq) {
-                // This is the same request as the one we replied to last.
+        // check the sequence number: if this is a resent request, resend the response
+        for (auto& reply : _sent_replies) {
+            if (reply.valid && msg.sysid == reply.system_id &&
+                msg.compid == reply.component_id && payload->seq_number + 1 == reply.seq_number) {
+                // This is the same request as one we replied to lately.
                 LogWarn() << "Wrong sequence - resend last response";
-                _parent->send_message(_last_reply);
+                _parent->send_message(reply.message);
                 return;
             }
         }
@@ -667,12 +1388,12 @@ void MavlinkFTPImpl::process_mavlink_ftp_message(const mavlink_message_t& msg)
 
             case CMD_TERMINATE_SESSION:
                 LogInfo() << "OPC:CMD_TERMINATE_SESSION";
-                error_code = _work_terminate(payload);
+                error_code = _work_terminate(payload, msg);
                 break;
 
             case CMD_RESET_SESSIONS:
                 LogInfo() << "OPC:CMD_RESET_SESSIONS";
-                error_code = _work_reset(payload);
+                error_code = _work_reset(payload, msg);
                 break;
 
             case CMD_LIST_DIRECTORY:
@@ -682,33 +1403,33 @@ void MavlinkFTPImpl::process_mavlink_ftp_message(const mavlink_message_t& msg)
 
             case CMD_OPEN_FILE_RO:
                 LogInfo() << "OPC:CMD_OPEN_FILE_RO";
-                error_code = _work_open(payload, O_RDONLY);
+                error_code = _work_open(payload, O_RDONLY, msg);
                 break;
 
             case CMD_CREATE_FILE:
                 LogInfo() << "OPC:CMD_CREATE_FILE";
-                error_code = _work_open(payload, O_CREAT | O_WRONLY);
+                error_code = _work_open(payload, O_CREAT | O_WRONLY, msg);
                 break;
 
             case CMD_OPEN_FILE_WO:
                 LogInfo() << "OPC:CMD_OPEN_FILE_WO";
-                error_code = _work_open(payload, O_CREAT | O_WRONLY);
+                error_code = _work_open(payload, O_CREAT | O_WRONLY, msg);
                 break;
 
             case CMD_READ_FILE:
                 LogInfo() << "OPC:CMD_READ_FILE";
-                error_code = _work_read(payload);
+                error_code = _work_read(payload, msg);
                 break;
 
             case CMD_BURST_READ_FILE:
                 LogInfo() << "OPC:CMD_BURST_READ_FILE";
-                error_code = _work_burst(payload);
+                error_code = _work_burst(payload, msg);
                 stream_send = true;
                 break;
 
             case CMD_WRITE_FILE:
                 LogInfo() << "OPC:CMD_WRITE_FILE";
-                error_code = _work_write(payload);
+                error_code = _work_write(payload, msg);
                 break;
 
             case CMD_REMOVE_FILE:
@@ -778,23 +1499,26 @@ void MavlinkFTPImpl::process_mavlink_ftp_message(const mavlink_message_t& msg)
         }
     }
 
-    _last_reply_valid = false;
-
     // Stream download replies are sent through mavlink stream mechanism. Unless we need to Nack.
     if (!stream_send || error_code != ServerResult::SUCCESS) {
-        // keep a copy of the last sent response ((n)ack), so that if it gets lost and the GCS
+        // keep a copy of the sent response ((n)ack), so that if it gets lost and the GCS
         // resends the request, we can simply resend the response.
-        _last_reply_valid = true;
-        _last_reply_seq = payload->seq_number;
+        SentReply& reply = _sent_replies[_next_sent_reply];
+        _next_sent_reply = (_next_sent_reply + 1) % max_sent_replies;
+        reply.valid = true;
+        reply.seq_number = payload->seq_number;
+        reply.system_id = msg.sysid;
+        reply.component_id = msg.compid;
+        // Reply to whoever asked, several clients can share the server.
         mavlink_msg_file_transfer_protocol_pack(
             _parent->get_own_system_id(),
             _parent->get_own_component_id(),
-            &_last_reply,
+            &reply.message,
             _network_id,
-            _parent->get_system_id(),
-            _get_target_component_id(),
+            msg.sysid,
+            msg.compid,
             reinterpret_cast<const uint8_t*>(payload));
-        _parent->send_message(_last_reply);
+        _parent->send_message(reply.message);
     }
 }
 
@@ -892,6 +1616,7 @@ MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_list(PayloadHeader* payload,
             memcpy(&payload->data[offset], entry_s.c_str(), len);
             offset += len;
         }
+        closedir(dfd);
     }
 
     payload->size = offset;
@@ -899,9 +1624,31 @@ MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_list(PayloadHeader* payload,
     return error_code;
 }
 
-MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_open(PayloadHeader* payload, int oflag)
+MavlinkFTPImpl::SessionInfo*
+MavlinkFTPImpl::_find_session(uint8_t session, const mavlink_message_t& msg)
 {
-    if (_session_info.fd >= 0) {
+    if (session >= max_sessions || _sessions[session].fd < 0) {
+        return nullptr;
+    }
+
+    // Sessions are only usable by the client that opened them.
+    SessionInfo& info = _sessions[session];
+    if (info.owner_system_id != msg.sysid || info.owner_component_id != msg.compid) {
+        LogWarn() << "FTP: session " << static_cast<int>(session) << " not owned by "
+                  << static_cast<int>(msg.sysid) << "/" << static_cast<int>(msg.compid);
+        return nullptr;
+    }
+    return &info;
+}
+
+MavlinkFTPImpl::ServerResult
+MavlinkFTPImpl::_work_open(PayloadHeader* payload, int oflag, const mavlink_message_t& msg)
+{
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+
+    const auto free_session = std::find_if(
+        _sessions.begin(), _sessions.end(), [](const SessionInfo& info) { return info.fd < 0; });
+    if (free_session == _sessions.end()) {
         return ServerResult::ERR_NO_SESSIONS_AVAILABLE;
     }
 
@@ -930,105 +1677,128 @@ MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_open(PayloadHeader* payload,
                                    ServerResult::ERR_FAIL;
     }
 
-    _session_info.fd = fd;
-    _session_info.file_size = file_size;
-    _session_info.stream_download = false;
+    *free_session = SessionInfo{};
+    free_session->fd = fd;
+    free_session->file_size = file_size;
+    free_session->owner_system_id = msg.sysid;
+    free_session->owner_component_id = msg.compid;
 
-    payload->session = 0;
+    payload->session = static_cast<uint8_t>(free_session - _sessions.begin());
     payload->size = sizeof(uint32_t);
     memcpy(payload->data, &file_size, payload->size);
 
     return ServerResult::SUCCESS;
 }
 
-MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_read(PayloadHeader* payload)
+MavlinkFTPImpl::ServerResult
+MavlinkFTPImpl::_work_read(PayloadHeader* payload, const mavlink_message_t& msg)
 {
-    if (payload->session != 0 || _session_info.fd < 0) {
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+
+    SessionInfo* session = _find_session(payload->session, msg);
+    if (session == nullptr) {
         return ServerResult::ERR_INVALID_SESSION;
     }
 
-    // We have to test seek past EOF ourselves, lseek will allow seek past EOF
-    if (payload->offset >= _session_info.file_size) {
+    // We have to test seek past EOF ourselves, pread would just return nothing
+    if (payload->offset >= session->file_size) {
         return ServerResult::ERR_EOF;
     }
 
-    if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-        return ServerResult::ERR_FAIL;
-    }
-
-    int bytes_read = ::read(_session_info.fd, &payload->data[0], max_data_length);
+    const auto bytes_read = read_at(session->fd, payload->data, max_data_length, payload->offset);
 
     if (bytes_read < 0) {
         // Negative return indicates error other than eof
         return ServerResult::ERR_FAIL;
     }
 
-    payload->size = bytes_read;
+    payload->size = static_cast<uint8_t>(bytes_read);
 
     return ServerResult::SUCCESS;
 }
 
-MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_burst(PayloadHeader* payload)
+MavlinkFTPImpl::ServerResult
+MavlinkFTPImpl::_work_burst(PayloadHeader* payload, const mavlink_message_t& msg)
 {
-    if (payload->session != 0 && _session_info.fd < 0) {
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+
+    SessionInfo* session = _find_session(payload->session, msg);
+    if (session == nullptr) {
         return ServerResult::ERR_INVALID_SESSION;
     }
 
-    // Setup for streaming sends
-    _session_info.stream_download = true;
-    _session_info.stream_offset = payload->offset;
-    _session_info.stream_chunk_transmitted = 0;
-    _session_info.stream_seq_number = payload->seq_number + 1;
-    _session_info.stream_target_system_id = _parent->get_system_id();
+    if (payload->offset >= session->file_size) {
+        return ServerResult::ERR_EOF;
+    }
+
+    // Setup for streaming sends, a new burst replaces one still going on.
+    session->stream_download = true;
+    session->stream_offset = payload->offset;
+    session->stream_seq_number = payload->seq_number + 1;
+
+    if (_stream_cookie == nullptr) {
+        _burst_last_time = _time.steady_time();
+        _parent->add_call_every(
+            std::bind(&MavlinkFTPImpl::send, this), burst_interval_s, &_stream_cookie);
+    }
 
     return ServerResult::SUCCESS;
 }
 
-MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_write(PayloadHeader* payload)
+MavlinkFTPImpl::ServerResult
+MavlinkFTPImpl::_work_write(PayloadHeader* payload, const mavlink_message_t& msg)
 {
-    if (payload->session != 0 && _session_info.fd < 0) {
-        return ServerResult::ERR_INVALID_SESSION;
-    }
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
 
-    if (lseek(_session_info.fd, payload->offset, SEEK_SET) < 0) {
-        // Unable to see to the specified location
-        return ServerResult::ERR_FAIL;
+    SessionInfo* session = _find_session(payload->session, msg);
+    if (session == nullptr) {
+        return ServerResult::ERR_INVALID_SESSION;
     }
 
-    int bytes_written = ::write(_session_info.fd, &payload->data[0], payload->size);
+    const auto written = write_at(session->fd, payload->data, payload->size, payload->offset);
 
-    if (bytes_written < 0) {
+    if (written < 0) {
         // Negative return indicates error other than eof
         return ServerResult::ERR_FAIL;
     }
 
+    const int bytes_written = static_cast<int>(written);
     payload->size = sizeof(uint32_t);
     memcpy(payload->data, &bytes_written, payload->size);
 
     return ServerResult::SUCCESS;
 }
 
-MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_terminate(PayloadHeader* payload)
+MavlinkFTPImpl::ServerResult
+MavlinkFTPImpl::_work_terminate(PayloadHeader* payload, const mavlink_message_t& msg)
 {
-    if (payload->session != 0 || _session_info.fd < 0) {
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+
+    SessionInfo* session = _find_session(payload->session, msg);
+    if (session == nullptr) {
         return ServerResult::ERR_INVALID_SESSION;
     }
 
-    close(_session_info.fd);
-    _session_info.fd = -1;
-    _session_info.stream_download = false;
+    close(session->fd);
+    *session = SessionInfo{};
 
     payload->size = 0;
 
     return ServerResult::SUCCESS;
 }
 
-MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_reset(PayloadHeader* payload)
+MavlinkFTPImpl::ServerResult
+MavlinkFTPImpl::_work_reset(PayloadHeader* payload, const mavlink_message_t& msg)
 {
-    if (_session_info.fd != -1) {
-        close(_session_info.fd);
-        _session_info.fd = -1;
-        _session_info.stream_download = false;
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+
+    // Only the sessions of the client asking, the others may still be in use.
+    for (auto& session : _sessions) {
+        if (session.fd >= 0 && session.owner_system_id == msg.sysid &&
+            session.owner_component_id == msg.compid) {
+            close(session.fd);
+            session = SessionInfo{};
+        }
     }
 
     payload->size = 0;
@@ -1128,22 +1898,31 @@ MavlinkFTP::Result MavlinkFTPImpl::calc_local_file_crc32(const std::string& path
         return MavlinkFTP::Result::FILE_IO_ERROR;
     }
 
-    // Read whole file in buffer size chunks
+#if defined(LINUX)
+    // Let the kernel read ahead generously, the whole file is read once.
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    // Large reads keep the number of syscalls low for big log files, the
+    // checksum is fast enough that they would otherwise dominate.
     Crc32 checksum;
-    char buffer[18392];
+    std::vector<uint8_t> buffer(crc32_read_size);
     ssize_t bytes_read;
     do {
-        bytes_read = ::read(fd, buffer, sizeof(buffer));
+        bytes_read = ::read(fd, buffer.data(), buffer.size());
 
         if (bytes_read < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
             int r_errno = errno;
             close(fd);
             errno = r_errno;
             return MavlinkFTP::Result::FILE_IO_ERROR;
         }
 
-        checksum.add((uint8_t*)buffer, bytes_read);
-    } while (bytes_read == sizeof(buffer));
+        checksum.add(buffer.data(), static_cast<uint32_t>(bytes_read));
+    } while (bytes_read != 0);
 
     close(fd);
 
@@ -1177,10 +1956,80 @@ MavlinkFTPImpl::ServerResult MavlinkFTPImpl::_work_calc_file_CRC32(PayloadHeader
 
 void MavlinkFTPImpl::send()
 {
-    // Anything to stream?
-    if (!_session_info.stream_download) {
-        return;
+    std::lock_guard<std::mutex> lock(_sessions_mutex);
+
+    // Refill the budget for the time passed, capped so that idling doesn't
+    // allow a flood afterwards.
+    const auto now = _time.steady_time();
+    const double elapsed_s = std::chrono::duration<double>(now - _burst_last_time).count();
+    _burst_last_time = now;
+    _burst_budget = std::min(
+        _burst_budget + elapsed_s * _burst_rate,
+        2.0 * static_cast<double>(burst_interval_s) * _burst_rate);
+
+    // One chunk per streaming session at a time, so they share the rate fairly.
+    bool streaming = true;
+    while (streaming && _burst_budget >= max_data_length) {
+        streaming = false;
+        for (uint8_t i = 0; i < max_sessions && _burst_budget >= max_data_length; ++i) {
+            if (!_sessions[i].stream_download) {
+                continue;
+            }
+            _stream_chunk(i);
+            _burst_budget -= max_data_length;
+            streaming = true;
+        }
+    }
+
+    // Stop ticking once no session is bursting anymore, the next burst starts it again.
+    const bool any_streaming =
+        std::any_of(_sessions.begin(), _sessions.end(), [](const SessionInfo& info) {
+            return info.stream_download;
+        });
+    if (!any_streaming && _stream_cookie != nullptr) {
+        _parent->remove_call_every(_stream_cookie);
+        _stream_cookie = nullptr;
     }
 }
 
+void MavlinkFTPImpl::_stream_chunk(uint8_t session)
+{
+    SessionInfo& info = _sessions[session];
+
+    uint8_t raw_payload[MAVLINK_MSG_FILE_TRANSFER_PROTOCOL_FIELD_PAYLOAD_LEN];
+    PayloadHeader* payload = reinterpret_cast<PayloadHeader*>(raw_payload);
+    payload->seq_number = info.stream_seq_number++;
+    payload->session = session;
+    payload->req_opcode = CMD_BURST_READ_FILE;
+    payload->padding = 0;
+    payload->offset = info.stream_offset;
+
+    const auto bytes_read = read_at(info.fd, payload->data, max_data_length, info.stream_offset);
+    if (bytes_read <= 0) {
+        // The file got shorter since it was opened, or can't be read anymore.
+        payload->opcode = RSP_NAK;
+        payload->size = 1;
+        payload->data[0] = (bytes_read == 0) ? ServerResult::ERR_EOF : ServerResult::ERR_FAIL;
+        payload->burst_complete = 1;
+        info.stream_download = false;
+    } else {
+        payload->opcode = RSP_ACK;
+        payload->size = static_cast<uint8_t>(bytes_read);
+        info.stream_offset += payload->size;
+        info.stream_download = info.stream_offset < info.file_size;
+        payload->burst_complete = info.stream_download ? 0 : 1;
+    }
+
+    mavlink_message_t message;
+    mavlink_msg_file_transfer_protocol_pack(
+        _parent->get_own_system_id(),
+        _parent->get_own_component_id(),
+        &message,
+        _network_id,
+        info.owner_system_id,
+        info.owner_component_id,
+        raw_payload);
+    _parent->send_message(message);
+}
+
 } // namespace mavsdk
@@ -1,12 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <fstream>
+#include <map>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "global_include.h"
 #include "mavlink_include.h"
 #include "plugins/mavlink_ftp/mavlink_ftp.h"
 #include "plugin_impl_base.h"
+#include "range_set.h"
+#include "safe_queue.h"
 
 // As found in
 // https://stackoverflow.com/questions/1537964#answer-3312896
@@ -18,9 +28,12 @@
 
 namespace mavsdk {
 
+class DirectorySync;
+
 class MavlinkFTPImpl : public PluginImplBase {
 public:
     MavlinkFTPImpl(System& system);
+    MavlinkFTPImpl(System& system, bool serve_requests);
     MavlinkFTPImpl(const MavlinkFTPImpl&) = delete;
     const MavlinkFTPImpl& operator=(const MavlinkFTPImpl&) = delete;
 
@@ -40,6 +53,8 @@ public:
         const std::string& local_folder,
         MavlinkFTP::progress_callback_t progress_callback,
         MavlinkFTP::result_callback_t result_callback);
+    MavlinkFTP::Result
+    discard_download(const std::string& remote_path, const std::string& local_folder);
     void upload_async(
         const std::string& local_file_path,
         const std::string& remote_folder,
@@ -59,9 +74,21 @@ public:
     void calc_file_crc32_async(
         const std::string& path, MavlinkFTP::file_crc32_result_callback_t callback);
     MavlinkFTP::Result calc_local_file_crc32(const std::string& path, uint32_t& csum);
+    void sync_directory_async(
+        const std::string& remote_folder,
+        const std::string& local_folder,
+        MavlinkFTP::progress_callback_t progress_callback,
+        MavlinkFTP::result_callback_t result_callback);
     void set_timeout(uint32_t timeout) { _last_command_timeout = timeout; }
     void set_retries(uint32_t retries) { _max_last_command_retries = retries; }
+    void set_burst_download(bool enabled) { _burst_download_enabled = enabled; }
+    void set_upload_window(unsigned max_writes)
+    {
+        _max_write_window = std::max(max_writes, 1u);
+    }
     void set_root_dir(const std::string& root_dir);
+    void set_burst_rate(uint32_t bytes_per_second) { _burst_rate = bytes_per_second; }
+    void set_sync_sessions(unsigned sessions) { _sync_sessions = std::max(sessions, 1u); }
     void set_target_component_id(uint8_t component_id)
     {
         _target_component_id = component_id;
@@ -70,6 +97,10 @@ public:
     uint8_t get_our_compid() { return _parent->get_own_component_id(); };
 
 private:
+    System& _system;
+    // Instances downloading for a directory sync are clients only.
+    const bool _serve_requests;
+
     /// @brief Possible server results returned for requests.
     enum ServerResult : uint8_t {
         SUCCESS,
@@ -139,13 +170,19 @@ private:
     struct SessionInfo {
         int fd{-1};
         uint32_t file_size{0};
+        uint8_t owner_system_id{0};
+        uint8_t owner_component_id{0};
         bool stream_download{false};
         uint32_t stream_offset{0};
         uint16_t stream_seq_number{0};
-        uint8_t stream_target_system_id{0};
-        unsigned stream_chunk_transmitted{0};
     };
-    struct SessionInfo _session_info {}; ///< Session info, fd=-1 for no active session
+
+    /// @brief Maximum number of files open at the same time, by all clients together.
+    static constexpr uint8_t max_sessions = 8;
+
+    /// @brief Sessions by id, fd=-1 for a free one.
+    std::array<SessionInfo, max_sessions> _sessions{};
+    std::mutex _sessions_mutex{};
 
     uint8_t _network_id = 0;
     uint8_t _target_component_id = 0;
@@ -155,12 +192,14 @@ private:
     mavlink_message_t _last_command{};
     void* _last_command_timeout_cookie = nullptr;
     bool _last_command_timer_running{false};
+    unsigned _timer_generation{0};
     std::mutex _timer_mutex{};
     uint32_t _last_command_timeout{200};
     uint32_t _max_last_command_retries{3};
     uint32_t _last_command_retries = 0;
     std::string _last_path{};
-    uint16_t _seq_number = 0;
+    uint16_t _last_request_seq = 0;
+    uint8_t _last_request_opcode = CMD_NONE;
     std::shared_ptr<std::ifstream> _ifstream{};
     std::shared_ptr<std::ofstream> _ofstream{};
     bool _session_valid = false;
@@ -168,15 +207,64 @@ private:
     ServerResult _session_result = ServerResult::SUCCESS;
     uint32_t _bytes_transferred = 0;
     uint32_t _file_size = 0;
+    bool _burst_download_enabled{true};
+    // Parts of the file being downloaded which arrived, in any order.
+    RangeSet<uint32_t> _received{};
+    // Position of _ofstream, to avoid seeking for data arriving in order.
+    uint32_t _write_offset{0};
+    // Set once the server answered a burst, servers without support get reads.
+    bool _burst_supported{false};
+
+    // Downloads are checkpointed next to the partial file so that they can be
+    // resumed after an interruption.
+    std::string _remote_path{};
+    std::string _local_path{};
+    uint32_t _checkpoint_bytes{0}; ///< Size of _received when last checkpointed
+    enum class ResumeState {
+        None,
+        Checking, ///< Comparing the partial file with the remote one
+        Resumed, ///< Downloading the rest, to be verified once complete
+        Verifying, ///< Waiting for the remote CRC32 of the file
+        Hashing ///< Comparing the remote CRC32 with the one of the local file
+    } _resume_state{ResumeState::None};
+    uint32_t _resume_file_size{0};
+    // Chunks of the partial file, as offset and length, compared with the remote
+    // file before resuming.
+    std::vector<std::pair<uint32_t, uint32_t>> _resume_checks{};
+    // Hashes resumed downloads, started with the first one and joined on destruction.
+    std::thread _hasher{};
+    SafeQueue<std::function<void()>> _hash_queue{};
+
+    // A write sent during an upload and not acked yet.
+    struct WriteInFlight {
+        uint16_t seq_number;
+        uint8_t size;
+        unsigned overtaken; ///< Acks received for writes sent after this one
+    };
+    // Keyed by offset, which the server echoes in the ack.
+    std::map<uint32_t, WriteInFlight> _writes_in_flight{};
+    uint32_t _next_write_offset{0};
+    unsigned _max_write_window{16};
+    unsigned _write_window{1};
+    unsigned _write_window_acks{0};
+    // Losses of writes sent before this were already answered by a smaller window.
+    uint16_t _write_recovery_seq{0};
     std::vector<std::string> _curr_directory_list{};
     MavlinkFTP::result_callback_t _curr_op_result_callback{};
     MavlinkFTP::progress_callback_t _curr_op_progress_callback{};
     MavlinkFTP::directory_items_and_result_callback_t _curr_dir_items_result_callback{};
     MavlinkFTP::file_crc32_result_callback_t _current_crc32_result_callback{};
 
+    // Directory syncs use instances of their own, each with its own session.
+    unsigned _sync_sessions{4};
+    std::vector<std::unique_ptr<MavlinkFTPImpl>> _sync_workers{};
+    std::shared_ptr<DirectorySync> _sync{};
+    std::mutex _sync_mutex{};
+
     void _process_ack(PayloadHeader* payload);
     void _process_nak(PayloadHeader* payload);
-    void _process_nak(ServerResult result);
+    void _handle_nak(ServerResult result);
+    bool _is_reply_to_us(PayloadHeader* payload);
     static MavlinkFTP::Result _translate(ServerResult result);
     void _call_op_result_callback(ServerResult result);
     void _call_op_progress_callback(uint32_t bytes_read, uint32_t total_bytes);
@@ -188,12 +276,34 @@ private:
         const std::string& path,
         MavlinkFTP::result_callback_t callback);
     void _read();
+    bool _prepare_burst_read(uint8_t* raw_payload);
+    void _burst_read_next();
+    bool _burst_write(PayloadHeader* payload);
+    void _fall_back_to_read();
+    void _read_from_prefix();
+    void _start_download();
+    void _restart_download();
+    void _close_download();
+    bool _load_resume_checkpoint();
+    void _save_resume_checkpoint();
+    void _checkpoint_download();
+    void _plan_resume_checks();
+    void _check_resume_next();
+    void _check_resumed_chunk(PayloadHeader* payload);
+    void _session_terminated();
+    void _hash_resumed_download(uint32_t remote_crc32);
+    void _check_resumed_download(bool matches);
     void _write();
+    bool _send_write(uint32_t offset, uint8_t size);
+    void _write_acked(PayloadHeader* payload);
+    void _resend_writes();
     void _end_read_session();
     void _end_write_session();
     void _terminate_session();
     void _send_mavlink_ftp_message(uint8_t* raw_payload);
-    void _command_timeout();
+    void _pack_mavlink_ftp_message(uint8_t* raw_payload);
+    void _start_timer();
+    void _command_timeout(unsigned generation);
     void _reset_timer();
     void _stop_timer();
     void _list_directory(uint32_t offset);
@@ -205,9 +315,28 @@ private:
     // prepend a root directory to each file/dir access to avoid enumerating the full FS tree
     std::string _root_dir{"/"};
 
-    bool _last_reply_valid = false;
-    uint16_t _last_reply_seq = 0;
-    mavlink_message_t _last_reply{};
+    // Responses sent lately, clients can have several requests in flight.
+    struct SentReply {
+        bool valid{false};
+        uint16_t seq_number{0};
+        uint8_t system_id{0};
+        uint8_t component_id{0};
+        mavlink_message_t message{};
+    };
+    static constexpr size_t max_sent_replies = 16;
+    std::array<SentReply, max_sent_replies> _sent_replies{};
+    size_t _next_sent_reply{0};
+
+    // Burst reads are streamed from the system thread, paced to _burst_rate.
+    static constexpr float burst_interval_s = 0.01f;
+    void* _stream_cookie{nullptr};
+    uint32_t _burst_rate{100 * 1024};
+    double _burst_budget{0.0};
+    Time _time{};
+    dl_time_t _burst_last_time{};
+
+    SessionInfo* _find_session(uint8_t session, const mavlink_message_t& msg);
+    void _stream_chunk(uint8_t session);
 
     void process_mavlink_ftp_message(const mavlink_message_t& msg);
 
@@ -217,12 +346,12 @@ private:
     std::string _get_rel_path(const std::string& path);
 
     ServerResult _work_list(PayloadHeader* payload, bool list_hidden = false);
-    ServerResult _work_open(PayloadHeader* payload, int oflag);
-    ServerResult _work_read(PayloadHeader* payload);
-    ServerResult _work_burst(PayloadHeader* payload);
-    ServerResult _work_write(PayloadHeader* payload);
-    ServerResult _work_terminate(PayloadHeader* payload);
-    ServerResult _work_reset(PayloadHeader* payload);
+    ServerResult _work_open(PayloadHeader* payload, int oflag, const mavlink_message_t& msg);
+    ServerResult _work_read(PayloadHeader* payload, const mavlink_message_t& msg);
+    ServerResult _work_burst(PayloadHeader* payload, const mavlink_message_t& msg);
+    ServerResult _work_write(PayloadHeader* payload, const mavlink_message_t& msg);
+    ServerResult _work_terminate(PayloadHeader* payload, const mavlink_message_t& msg);
+    ServerResult _work_reset(PayloadHeader* payload, const mavlink_message_t& msg);
     ServerResult _work_remove_directory(PayloadHeader* payload);
     ServerResult _work_create_directory(PayloadHeader* payload);
     ServerResult _work_remove_file(PayloadHeader* payload);
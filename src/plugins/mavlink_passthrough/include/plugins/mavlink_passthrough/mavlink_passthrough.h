@@ -74,6 +74,9 @@ public:
      * callback to be called. To stop the subscription, call this method with
      * `nullptr` as the argument.
      *
+     * While subscribed, the message is requested at its default rate, so it is not
+     * turned off as unused (see `Telemetry::set_turn_off_unused_streams`).
+     *
      * @param message_id The MAVLink message ID.
      * @param callback Callback to be called for message subscription.
      */
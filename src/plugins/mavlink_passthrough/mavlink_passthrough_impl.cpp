@@ -21,6 +21,7 @@ void MavlinkPassthroughImpl::deinit()
 {
     _parent->intercept_incoming_messages(nullptr);
     _parent->intercept_outgoing_messages(nullptr);
+    _parent->unregister_all_msg_rate_requests(this);
 }
 
 void MavlinkPassthroughImpl::enable() {}
@@ -40,6 +41,7 @@ void MavlinkPassthroughImpl::subscribe_message_async(
 {
     if (callback == nullptr) {
         _parent->unregister_mavlink_message_handler(message_id, this);
+        _parent->unregister_msg_rate_request(message_id, this);
     } else {
         auto temp_callback = callback;
         _parent->register_mavlink_message_handler(
@@ -48,6 +50,8 @@ void MavlinkPassthroughImpl::subscribe_message_async(
                 _parent->call_user_callback([temp_callback, message]() { temp_callback(message); });
             },
             this);
+        // Make sure the message keeps coming even if unused streams are turned off.
+        _parent->register_msg_rate_request(message_id, 0.0, this);
     }
 }
 
@@ -137,6 +137,10 @@ void MissionImpl::process_mission_ack(const mavlink_message_t& message)
         return;
     }
 
+    if (process_download_mission_ack(mission_ack)) {
+        return;
+    }
+
     Mission::result_callback_t temp_callback;
     {
         std::lock_guard<std::recursive_mutex> lock(_mission_data.mutex);
@@ -191,6 +195,63 @@ void MissionImpl::process_mission_ack(const mavlink_message_t& message)
     }
 }
 
+bool MissionImpl::process_download_mission_ack(const mavlink_mission_ack_t& mission_ack)
+{
+    // We use these flags to make sure we only lock one mutex at a time, the
+    // requests and results are sent once both are released.
+    Activity::State state;
+    {
+        std::lock_guard<std::mutex> lock(_activity.mutex);
+        state = _activity.state;
+    }
+
+    if (state != Activity::State::GET_MISSION_LIST &&
+        state != Activity::State::GET_MISSION_REQUEST) {
+        return false;
+    }
+
+    if (mission_ack.type == MAV_MISSION_ACCEPTED) {
+        LogWarn() << "Mission ack ignored during download";
+        return true;
+    }
+
+    bool should_restart = false;
+    Mission::mission_items_and_result_callback_t temp_callback;
+    {
+        std::lock_guard<std::recursive_mutex> lock(_mission_data.mutex);
+        // PX4 only answers requests in order, a request after a lost one
+        // aborts the download. We start over, in order if it keeps happening.
+        should_restart = state == Activity::State::GET_MISSION_REQUEST &&
+                         mission_ack.type == MAV_MISSION_ERROR &&
+                         !_mission_data.download_in_order;
+        if (should_restart) {
+            restart_download_locked();
+        }
+        temp_callback = _mission_data.mission_items_and_result_callback;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_activity.mutex);
+        if (_activity.state != state) {
+            // Cancelled or timed out meanwhile.
+            return true;
+        }
+        _activity.state =
+            should_restart ? Activity::State::GET_MISSION_LIST : Activity::State::NONE;
+    }
+
+    if (should_restart) {
+        _parent->refresh_timeout_handler(_timeout_cookie);
+        request_list();
+        return true;
+    }
+
+    LogErr() << "Error: mission download failed: " << int(mission_ack.type);
+    _parent->unregister_timeout_handler(_timeout_cookie);
+    report_mission_items_and_result(temp_callback, Mission::Result::ERROR);
+    return true;
+}
+
 void MissionImpl::reset_mission_progress()
 {
     std::lock_guard<std::recursive_mutex> lock(_mission_data.mutex);
@@ -268,25 +329,19 @@ void MissionImpl::process_mission_count(const mavlink_message_t& message)
 
     {
         std::lock_guard<std::recursive_mutex> lock(_mission_data.mutex);
-        _mission_data.num_mission_items_to_download = mission_count.count;
-        _mission_data.next_mission_item_to_download = 0;
+        _mission_data.download_window.reset(
+            mission_count.count, _mission_data.download_in_order ? 1 : DOWNLOAD_WINDOW);
+        _mission_data.mavlink_mission_items_downloaded.assign(mission_count.count, nullptr);
         _mission_data.retries = 0;
     }
 
     _parent->refresh_timeout_handler(_timeout_cookie);
 
-    download_next_mission_item();
+    download_next_mission_items();
 }
 
 void MissionImpl::process_mission_item_int(const mavlink_message_t& message)
 {
-    {
-        std::lock_guard<std::mutex> lock(_activity.mutex);
-        if (_activity.state != Activity::State::GET_MISSION_REQUEST) {
-            return;
-        }
-    }
-
     auto mission_item_int_ptr = std::make_shared<mavlink_mission_item_int_t>();
     mavlink_msg_mission_item_int_decode(&message, mission_item_int_ptr.get());
 
@@ -294,14 +349,24 @@ void MissionImpl::process_mission_item_int(const mavlink_message_t& message)
 
     {
         std::lock_guard<std::recursive_mutex> lock(_mission_data.mutex);
-        if (mission_item_int_ptr->seq == _mission_data.next_mission_item_to_download) {
-            LogDebug() << "Received mission item " << _mission_data.next_mission_item_to_download;
+        {
+            // Checked with the mission data locked, so that a download restarting
+            // meanwhile can't get items meant for the one before.
+            std::lock_guard<std::mutex> activity_lock(_activity.mutex);
+            if (_activity.state != Activity::State::GET_MISSION_REQUEST) {
+                return;
+            }
+        }
+
+        const unsigned seq = mission_item_int_ptr->seq;
+        if (_mission_data.download_window.add_received(seq)) {
+            LogDebug() << "Received mission item " << seq;
 
-            _mission_data.mavlink_mission_items_downloaded.push_back(mission_item_int_ptr);
+            // Items can arrive in any order, they are put in place.
+            _mission_data.mavlink_mission_items_downloaded[seq] = mission_item_int_ptr;
             _mission_data.retries = 0;
 
-            if (_mission_data.next_mission_item_to_download + 1 ==
-                _mission_data.num_mission_items_to_download) {
+            if (_mission_data.download_window.done()) {
                 // Wrap things up if we're finished.
                 _parent->unregister_timeout_handler(_timeout_cookie);
 
@@ -320,22 +385,17 @@ void MissionImpl::process_mission_item_int(const mavlink_message_t& message)
                 assemble_mission_items();
 
             } else {
-                // Otherwise keep going.
-                ++_mission_data.next_mission_item_to_download;
+                // Otherwise keep the window full.
                 _parent->refresh_timeout_handler(_timeout_cookie);
-                download_next_mission_item();
+                download_next_mission_items();
             }
 
         } else {
-            LogDebug() << "Received mission item " << int(mission_item_int_ptr->seq)
-                       << " instead of " << _mission_data.next_mission_item_to_download
-                       << " (ignored)";
+            LogDebug() << "Received mission item " << seq << " again or not requested (ignored)";
 
-            // Refresh because we at least still seem to be active.
+            // Refresh because we at least still seem to be active, missing
+            // items are requested again on the timeout.
             _parent->refresh_timeout_handler(_timeout_cookie);
-
-            // And request it again in case our request got lost.
-            download_next_mission_item();
             return;
         }
     }
@@ -477,6 +537,8 @@ void MissionImpl::download_mission_async(
         // Clear our internal cache and re-populate it.
         _mission_data.mavlink_mission_items_downloaded.clear();
         _mission_data.retries = 0;
+        _mission_data.download_in_order = false;
+        _mission_data.download_failures = 0;
         _mission_data.mission_items_and_result_callback = callback;
     }
 
@@ -1006,22 +1068,55 @@ void MissionImpl::assemble_mission_items()
     }
 }
 
-void MissionImpl::download_next_mission_item()
+void MissionImpl::download_next_mission_items()
 {
-    mavlink_message_t message;
-    {
-        std::lock_guard<std::recursive_mutex> lock(_mission_data.mutex);
-        mavlink_msg_mission_request_int_pack(
-            _parent->get_own_system_id(),
-            _parent->get_own_component_id(),
-            &message,
-            _parent->get_system_id(),
-            _parent->get_autopilot_id(),
-            _mission_data.next_mission_item_to_download,
-            MAV_MISSION_TYPE_MISSION);
+    std::lock_guard<std::recursive_mutex> lock(_mission_data.mutex);
+    for (const unsigned seq : _mission_data.download_window.take_requests()) {
+        request_mission_item(seq);
+    }
+}
 
-        LogDebug() << "Requested mission item " << _mission_data.next_mission_item_to_download;
+void MissionImpl::download_missing_mission_items()
+{
+    std::lock_guard<std::recursive_mutex> lock(_mission_data.mutex);
+    for (const unsigned seq : _mission_data.download_window.missing()) {
+        request_mission_item(seq);
     }
+    download_next_mission_items();
+}
+
+void MissionImpl::restart_download_locked()
+{
+    // Requires _mission_data.mutex.
+
+    // The window is kept for the next try, a link losing a request now and then
+    // shouldn't slow down every download. Only if it keeps failing we assume an
+    // autopilot which answers requests in order only.
+    ++_mission_data.download_failures;
+    if (_mission_data.download_failures >= DOWNLOAD_IN_ORDER_FAILURES) {
+        LogWarn() << "Mission download aborted, downloading items in order";
+        _mission_data.download_in_order = true;
+    } else {
+        LogWarn() << "Mission download aborted, starting over";
+    }
+    _mission_data.retries = 0;
+    // Items still on their way for the download before are not taken.
+    _mission_data.download_window.reset(0, _mission_data.download_window.window());
+}
+
+void MissionImpl::request_mission_item(unsigned seq)
+{
+    mavlink_message_t message;
+    mavlink_msg_mission_request_int_pack(
+        _parent->get_own_system_id(),
+        _parent->get_own_component_id(),
+        &message,
+        _parent->get_system_id(),
+        _parent->get_autopilot_id(),
+        static_cast<uint16_t>(seq),
+        MAV_MISSION_TYPE_MISSION);
+
+    LogDebug() << "Requested mission item " << seq;
 
     _parent->send_message(message);
 }
@@ -1373,8 +1468,10 @@ void MissionImpl::subscribe_progress(Mission::progress_callback_t callback)
 void MissionImpl::process_timeout()
 {
     bool should_retry = false;
+    Activity::State state;
     {
         std::lock_guard<std::mutex> lock(_activity.mutex);
+        state = _activity.state;
 
         switch (_activity.state) {
             case Activity::State::NONE:
@@ -1429,29 +1526,48 @@ void MissionImpl::process_timeout()
             _mission_data.mutex.unlock();
 
         } else {
+            // Requests after a lost one are ignored by an autopilot which
+            // answers them in order only, so a stalled download starts over.
+            const bool should_restart = state == Activity::State::GET_MISSION_REQUEST &&
+                                        !_mission_data.download_in_order &&
+                                        _mission_data.retries >= DOWNLOAD_RESTART_RETRIES;
+            if (should_restart) {
+                restart_download_locked();
+            }
             _mission_data.mutex.unlock();
 
+            if (should_restart) {
+                std::lock_guard<std::mutex> lock(_activity.mutex);
+                if (_activity.state == Activity::State::GET_MISSION_REQUEST) {
+                    _activity.state = Activity::State::GET_MISSION_LIST;
+                }
+            }
+
             _parent->register_timeout_handler(
                 std::bind(&MissionImpl::process_timeout, this), RETRY_TIMEOUT_S, &_timeout_cookie);
 
+            // The requests take the mission data lock, so they are sent
+            // without holding the activity lock.
             {
                 std::lock_guard<std::mutex> lock(_activity.mutex);
-                if (_activity.state == Activity::State::GET_MISSION_LIST) {
-                    LogWarn() << "Retrying requesting mission list...";
-                    request_list();
-                } else if (_activity.state == Activity::State::GET_MISSION_REQUEST) {
-                    LogWarn() << "Retrying requesting mission item...";
-                    download_next_mission_item();
-                } else if (_activity.state == Activity::State::SET_MISSION_COUNT) {
-                    LogWarn() << "Retrying send mission count...";
-                    send_count();
-                } else if (_activity.state == Activity::State::SET_MISSION_ITEM) {
-                    LogWarn() << "Retrying send mission count...";
-                    upload_mission_item();
-                } else if (_activity.state == Activity::State::MISSION_CLEAR) {
-                    LogWarn() << "Retrying to clear mission...";
-                    clear_mission();
-                }
+                state = _activity.state;
+            }
+
+            if (state == Activity::State::GET_MISSION_LIST) {
+                LogWarn() << "Retrying requesting mission list...";
+                request_list();
+            } else if (state == Activity::State::GET_MISSION_REQUEST) {
+                LogWarn() << "Retrying requesting mission items...";
+                download_missing_mission_items();
+            } else if (state == Activity::State::SET_MISSION_COUNT) {
+                LogWarn() << "Retrying send mission count...";
+                send_count();
+            } else if (state == Activity::State::SET_MISSION_ITEM) {
+                LogWarn() << "Retrying send mission count...";
+                upload_mission_item();
+            } else if (state == Activity::State::MISSION_CLEAR) {
+                LogWarn() << "Retrying to clear mission...";
+                clear_mission();
             }
         }
     }
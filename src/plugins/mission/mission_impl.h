@@ -8,6 +8,7 @@
 #include "mavlink_include.h"
 #include "plugins/mission/mission.h"
 #include "plugin_impl_base.h"
+#include "request_window.h"
 #include "system.h"
 
 namespace mavsdk {
@@ -59,6 +60,7 @@ private:
     void process_mission_request(const mavlink_message_t& message);
     void process_mission_request_int(const mavlink_message_t& message);
     void process_mission_ack(const mavlink_message_t& message);
+    bool process_download_mission_ack(const mavlink_mission_ack_t& mission_ack);
     void process_mission_current(const mavlink_message_t& message);
     void process_mission_item_reached(const mavlink_message_t& message);
     void process_mission_count(const mavlink_message_t& message);
@@ -82,7 +84,10 @@ private:
     void receive_command_result(
         MAVLinkCommands::Result result, const Mission::result_callback_t callback);
 
-    void download_next_mission_item();
+    void download_next_mission_items();
+    void download_missing_mission_items();
+    void restart_download_locked();
+    void request_mission_item(unsigned seq);
     void request_list();
     void send_count();
 
@@ -122,8 +127,9 @@ private:
         std::vector<std::shared_ptr<MissionItem>> mission_items{};
         std::vector<std::shared_ptr<mavlink_message_t>> mavlink_mission_item_messages{};
         std::map<int, int> mavlink_mission_item_to_mission_item_indices{};
-        int num_mission_items_to_download{-1};
-        int next_mission_item_to_download{-1};
+        RequestWindow download_window{};
+        bool download_in_order{false};
+        unsigned download_failures{0};
         int last_mission_item_to_upload{-1};
         std::vector<std::shared_ptr<mavlink_mission_item_int_t>> mavlink_mission_items_downloaded{};
         Mission::result_callback_t result_callback{nullptr};
@@ -143,6 +149,13 @@ private:
 
     static constexpr unsigned MAX_RETRIES = 10;
 
+    // Mission items requested ahead while downloading.
+    static constexpr unsigned DOWNLOAD_WINDOW = 8;
+    // Timeouts without any item after which the download starts over.
+    static constexpr unsigned DOWNLOAD_RESTART_RETRIES = 2;
+    // Downloads started over after which the items are requested in order.
+    static constexpr unsigned DOWNLOAD_IN_ORDER_FAILURES = 2;
+
     static constexpr uint8_t VEHICLE_MODE_FLAG_CUSTOM_MODE_ENABLED = 1;
 
     // FIXME: these chould potentially change anytime
@@ -52,6 +52,27 @@ void MissionRawImpl::process_mission_ack(const mavlink_message_t& message)
     mavlink_msg_mission_ack_decode(&message, &mission_ack);
 
     if (mission_ack.type != MAV_MISSION_ACCEPTED) {
+        std::lock_guard<std::mutex> lock(_mission_download.mutex);
+        if (_mission_download.state != MissionDownload::State::REQUEST_ITEM) {
+            return;
+        }
+
+        if (mission_ack.type == MAV_MISSION_ERROR && !_mission_download.in_order) {
+            // PX4 only answers requests in order, a request after a lost one
+            // aborts the download.
+            restart_download();
+            return;
+        }
+
+        LogErr() << "Mission download failed: " << int(mission_ack.type);
+        _parent->unregister_timeout_handler(_timeout_cookie);
+        _mission_download.state = MissionDownload::State::NONE;
+        if (_mission_download.callback) {
+            std::vector<std::shared_ptr<MissionRaw::MavlinkMissionItemInt>> empty_vec{};
+            auto callback = _mission_download.callback;
+            _parent->call_user_callback(
+                [callback, empty_vec]() { callback(MissionRaw::Result::ERROR, empty_vec); });
+        }
         return;
     }
 
@@ -83,6 +104,8 @@ void MissionRawImpl::download_mission_async(
         _mission_download.retries = 0;
         _mission_download.mavlink_mission_items_downloaded.clear();
         _mission_download.callback = callback;
+        _mission_download.in_order = false;
+        _mission_download.failures = 0;
     }
 
     _parent->register_timeout_handler(
@@ -165,8 +188,9 @@ void MissionRawImpl::process_mission_count(const mavlink_message_t& message)
     mavlink_mission_count_t mission_count;
     mavlink_msg_mission_count_decode(&message, &mission_count);
 
-    _mission_download.num_mission_items_to_download = mission_count.count;
-    _mission_download.next_mission_item_to_download = 0;
+    _mission_download.window.reset(
+        mission_count.count, _mission_download.in_order ? 1 : DOWNLOAD_WINDOW);
+    _mission_download.mavlink_mission_items_downloaded.assign(mission_count.count, nullptr);
     _mission_download.retries = 0;
 
     // We can get rid of the timeout and schedule and do the next step straightaway.
@@ -200,20 +224,24 @@ void MissionRawImpl::request_item()
         return;
     }
 
-    // LogDebug() << "Requesting mission item " << _mission_download.next_mission_item_to_download
-    //            << " (" << _mission_download.retries << ")";
+    if (_mission_download.retries > 2 && !_mission_download.in_order) {
+        // Requests after a lost one are ignored by an autopilot which answers
+        // them in order only.
+        restart_download();
+        return;
+    }
 
-    mavlink_message_t message;
-    mavlink_msg_mission_request_int_pack(
-        _parent->get_own_system_id(),
-        _parent->get_own_component_id(),
-        &message,
-        _parent->get_system_id(),
-        _parent->get_autopilot_id(),
-        _mission_download.next_mission_item_to_download,
-        MAV_MISSION_TYPE_MISSION);
+    // Only the items missing are requested again, and new ones to fill the window.
+    std::vector<unsigned> seqs = _mission_download.window.missing();
+    const auto next_seqs = _mission_download.window.take_requests();
+    seqs.insert(seqs.end(), next_seqs.begin(), next_seqs.end());
 
-    if (!_parent->send_message(message)) {
+    bool sent = true;
+    for (const unsigned seq : seqs) {
+        sent = sent && send_item_request(seq);
+    }
+
+    if (!sent) {
         // This is a terrible and unexpected error. Therefore we don't even
         // retry but just give up.
         _mission_download.state = MissionDownload::State::NONE;
@@ -231,6 +259,48 @@ void MissionRawImpl::request_item()
         std::bind(&MissionRawImpl::do_download_step, this), RETRY_TIMEOUT_S, &_timeout_cookie);
 }
 
+bool MissionRawImpl::send_item_request(unsigned seq)
+{
+    // Requires _mission_download.mutex.
+
+    // LogDebug() << "Requesting mission item " << seq << " (" << _mission_download.retries << ")";
+
+    mavlink_message_t message;
+    mavlink_msg_mission_request_int_pack(
+        _parent->get_own_system_id(),
+        _parent->get_own_component_id(),
+        &message,
+        _parent->get_system_id(),
+        _parent->get_autopilot_id(),
+        static_cast<uint16_t>(seq),
+        MAV_MISSION_TYPE_MISSION);
+
+    return _parent->send_message(message);
+}
+
+void MissionRawImpl::restart_download()
+{
+    // Requires _mission_download.mutex.
+
+    // The download starts over with the same window, a link losing a request
+    // now and then shouldn't slow down every download. Only if it keeps failing
+    // one item is requested after the other.
+    if (++_mission_download.failures >= DOWNLOAD_IN_ORDER_FAILURES) {
+        LogWarn() << "Mission download aborted, downloading items in order";
+        _mission_download.in_order = true;
+    } else {
+        LogWarn() << "Mission download aborted, starting over";
+    }
+    _mission_download.retries = 0;
+    _mission_download.state = MissionDownload::State::REQUEST_LIST;
+    // Items still on their way for the download before are not taken.
+    _mission_download.window.reset(0, _mission_download.window.window());
+
+    _parent->unregister_timeout_handler(_timeout_cookie);
+    _parent->register_timeout_handler(
+        std::bind(&MissionRawImpl::do_download_step, this), 0.0, nullptr);
+}
+
 void MissionRawImpl::process_mission_item_int(const mavlink_message_t& message)
 {
     // LogDebug() << "Received mission item int";
@@ -243,9 +313,9 @@ void MissionRawImpl::process_mission_item_int(const mavlink_message_t& message)
     mavlink_mission_item_int_t mission_item_int;
     mavlink_msg_mission_item_int_decode(&message, &mission_item_int);
 
-    if (mission_item_int.seq != _mission_download.next_mission_item_to_download) {
-        LogWarn() << "Received mission item " << int(mission_item_int.seq) << " instead of "
-                  << _mission_download.next_mission_item_to_download << " (ignored)";
+    if (!_mission_download.window.add_received(mission_item_int.seq)) {
+        LogWarn() << "Received mission item " << int(mission_item_int.seq)
+                  << " again or not requested (ignored)";
 
         // The timeout will happen anyway and retry for this case.
         return;
@@ -269,19 +339,25 @@ void MissionRawImpl::process_mission_item_int(const mavlink_message_t& message)
     new_item->z = mission_item_int.z;
     new_item->mission_type = mission_item_int.mission_type;
 
-    _mission_download.mavlink_mission_items_downloaded.push_back(new_item);
-    ++_mission_download.next_mission_item_to_download;
+    // Items can arrive in any order, they are put in place.
+    _mission_download.mavlink_mission_items_downloaded[mission_item_int.seq] = new_item;
     _mission_download.retries = 0;
 
-    if (_mission_download.next_mission_item_to_download ==
-        _mission_download.num_mission_items_to_download) {
-        _mission_download.state = MissionDownload::State::SHOULD_ACK;
+    if (!_mission_download.window.done()) {
+        // Keep the window full, the items missing are requested again on the timeout.
+        for (const unsigned seq : _mission_download.window.take_requests()) {
+            send_item_request(seq);
+        }
+        _parent->refresh_timeout_handler(_timeout_cookie);
+        return;
     }
 
+    _mission_download.state = MissionDownload::State::SHOULD_ACK;
+
     // We can remove timeout.
     _parent->unregister_timeout_handler(_timeout_cookie);
 
-    // And schedule the next request.
+    // And schedule the ack.
     _parent->register_timeout_handler(
         std::bind(&MissionRawImpl::do_download_step, this), 0.0, nullptr);
 }
@@ -5,6 +5,7 @@
 #include "mavlink_include.h"
 #include "plugins/mission_raw/mission_raw.h"
 #include "plugin_impl_base.h"
+#include "request_window.h"
 #include "system.h"
 
 namespace mavsdk {
@@ -35,6 +36,8 @@ private:
     void do_download_step();
     void request_list();
     void request_item();
+    bool send_item_request(unsigned seq);
+    void restart_download();
     void send_ack();
 
     struct MissionChanged {
@@ -49,12 +52,18 @@ private:
         std::vector<std::shared_ptr<MissionRaw::MavlinkMissionItemInt>>
             mavlink_mission_items_downloaded{};
         MissionRaw::mission_items_and_result_callback_t callback{nullptr};
-        unsigned num_mission_items_to_download{0};
-        unsigned next_mission_item_to_download{0};
+        RequestWindow window{};
+        bool in_order{false};
+        unsigned failures{0};
     } _mission_download{};
 
     void* _timeout_cookie{nullptr};
     static constexpr double RETRY_TIMEOUT_S = 0.250;
+
+    // Mission items requested ahead while downloading.
+    static constexpr unsigned DOWNLOAD_WINDOW = 8;
+    // Downloads started over after which the items are requested in order.
+    static constexpr unsigned DOWNLOAD_IN_ORDER_FAILURES = 2;
 };
 
 } // namespace mavsdk
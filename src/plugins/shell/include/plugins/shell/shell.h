@@ -88,6 +88,31 @@ public:
      */
     Shell::Result shell_command_response_async(result_callback_t callback);
 
+    /**
+     * @brief Handle identifying a subscription added using subscribe_shell_command_response.
+     */
+    typedef uint64_t SubscriptionHandle;
+
+    /**
+     * @brief Add a subscriber for shell message responses (asynchronous).
+     *
+     * Unlike shell_command_response_async, this does not replace any other subscriber and can
+     * also be called while a transfer is in progress.
+     *
+     * @param callback Function to call with responses.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_shell_command_response(result_callback_t callback);
+
+    /**
+     * @brief Remove a subscription added using subscribe_shell_command_response.
+     *
+     * Responses which are already on their way can still arrive after this returns.
+     *
+     * @param handle Handle returned when subscribing.
+     */
+    void unsubscribe(SubscriptionHandle handle);
+
     /**
      * @brief Copy constructor (object is not copyable).
      */
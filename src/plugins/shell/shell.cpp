@@ -40,6 +40,16 @@ Shell::Result Shell::shell_command_response_async(result_callback_t callback)
     return _impl->shell_command_response_async(callback);
 }
 
+Shell::SubscriptionHandle Shell::subscribe_shell_command_response(result_callback_t callback)
+{
+    return _impl->subscribe_shell_command_response(callback);
+}
+
+void Shell::unsubscribe(SubscriptionHandle handle)
+{
+    _impl->unsubscribe(handle);
+}
+
 bool operator==(const Shell::ShellMessage& lhs, const Shell::ShellMessage& rhs)
 {
     return lhs.need_response == rhs.need_response && lhs.timeout == rhs.timeout &&
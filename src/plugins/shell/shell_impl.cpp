@@ -15,6 +15,7 @@ void ShellImpl::init()
 void ShellImpl::deinit()
 {
     _parent->unregister_all_mavlink_message_handlers(this);
+    _response_subscriptions.clear();
 }
 
 void ShellImpl::enable() {}
@@ -48,22 +49,45 @@ Shell::Result ShellImpl::shell_command_response_async(Shell::result_callback_t&
     if (is_transfer_in_progress()) {
         return Shell::Result::BUSY;
     }
-    _result_subscription = callback;
+    _response_subscriptions.set_single(to_response_callback(callback));
     return Shell::Result::SUCCESS;
 }
 
+uint64_t ShellImpl::subscribe_shell_command_response(const Shell::result_callback_t& callback)
+{
+    return _response_subscriptions.subscribe(to_response_callback(callback));
+}
+
+void ShellImpl::unsubscribe(uint64_t handle)
+{
+    _response_subscriptions.unsubscribe(handle);
+}
+
+SubscriptionList<ShellImpl::Response>::callback_t
+ShellImpl::to_response_callback(const Shell::result_callback_t& callback)
+{
+    if (!callback) {
+        return nullptr;
+    }
+
+    return [callback](Response response) { callback(response.first, response.second); };
+}
+
+void ShellImpl::notify_response(Shell::Result result, const Shell::ShellMessage& response)
+{
+    auto notification = _response_subscriptions.notification(std::make_pair(result, response));
+    if (notification) {
+        _parent->call_user_callback(notification);
+    }
+}
+
 void ShellImpl::finish_transfer(Shell::Result result, Shell::ShellMessage response_shell_message)
 {
     std::lock_guard<std::mutex> lock(_transfer_mutex);
     if (!is_transfer_in_progress()) {
         return;
     }
-    if (_result_subscription) {
-        auto callback = _result_subscription;
-        _parent->call_user_callback([callback, result, response_shell_message]() {
-            callback(result, response_shell_message);
-        });
-    }
+    notify_response(result, response_shell_message);
     _transfer_finished_promise.set_value();
 }
 
@@ -95,7 +119,7 @@ Shell::Result ShellImpl::shell_command(const Shell::ShellMessage& shell_message)
         return Shell::Result::CONNECTION_ERROR;
     }
 
-    if (!_result_subscription || !shell_message.need_response) {
+    if (_response_subscriptions.empty() || !shell_message.need_response) {
         finish_transfer(Shell::Result::SUCCESS, Shell::ShellMessage{});
         return Shell::Result::SUCCESS;
     }
@@ -121,11 +145,7 @@ void ShellImpl::receive_shell_message_timeout()
     if (!is_transfer_in_progress()) {
         return;
     }
-    if (_result_subscription) {
-        auto callback = _result_subscription;
-        Shell::ShellMessage response = _response;
-        _parent->call_user_callback([callback, result, response]() { callback(result, response); });
-    }
+    notify_response(result, _response);
     _transfer_finished_promise.set_value();
 
     _parent->unregister_timeout_handler(_shell_message_timeout_cookie);
@@ -202,12 +222,7 @@ void ShellImpl::process_shell_message(const mavlink_message_t& message)
 
         _response.data.erase(_response.data.begin() + escape_pos, _response.data.end());
 
-        if (_result_subscription) {
-            auto callback = _result_subscription;
-            Shell::ShellMessage arg = _response;
-            _parent->call_user_callback(
-                [callback, arg]() { callback(Shell::Result::SUCCESS, arg); });
-        }
+        notify_response(Shell::Result::SUCCESS, _response);
         _transfer_finished_promise.set_value();
     } else {
         if (_shell_message_timeout_cookie) {
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <mutex>
+#include <utility>
 
 #include "plugins/shell/shell.h"
 #include "mavlink_include.h"
 #include "plugin_impl_base.h"
+#include "subscription_list.h"
 #include "system.h"
 
 namespace mavsdk {
@@ -25,6 +27,9 @@ public:
     Shell::Result shell_command(const Shell::ShellMessage& shell_message);
 
     Shell::Result shell_command_response_async(Shell::result_callback_t& callback);
+    uint64_t subscribe_shell_command_response(const Shell::result_callback_t& callback);
+    void unsubscribe(uint64_t handle);
+
     ShellImpl(const ShellImpl&) = delete;
     ShellImpl& operator=(const ShellImpl&) = delete;
 
@@ -44,7 +49,12 @@ private:
 
     void* _shell_message_timeout_cookie{nullptr};
 
-    Shell::result_callback_t _result_subscription{nullptr};
+    typedef std::pair<Shell::Result, Shell::ShellMessage> Response;
+    SubscriptionList<Response> _response_subscriptions{};
+
+    static SubscriptionList<Response>::callback_t
+    to_response_callback(const Shell::result_callback_t& callback);
+    void notify_response(Shell::Result result, const Shell::ShellMessage& response);
 
     void finish_transfer(Shell::Result result, Shell::ShellMessage response_shell_message);
 
@@ -391,6 +391,112 @@ public:
         uint8_t reset_counter{}; /**< @brief Estimate reset counter. */
     };
 
+    /**
+     * @brief Values which can be part of a snapshot, combined with `|` to a field mask.
+     */
+    enum class SnapshotField : uint32_t {
+        NONE = 0, /**< @brief No values. */
+        POSITION = 1u << 0, /**< @brief Position. */
+        HOME_POSITION = 1u << 1, /**< @brief Home position. */
+        IN_AIR = 1u << 2, /**< @brief In-air state. */
+        ARMED = 1u << 3, /**< @brief Armed state. */
+        LANDED_STATE = 1u << 4, /**< @brief Landed state. */
+        FLIGHT_MODE = 1u << 5, /**< @brief Flight mode. */
+        ATTITUDE_EULER_ANGLE = 1u << 6, /**< @brief Attitude as Euler angles. */
+        GROUND_SPEED_NED = 1u << 7, /**< @brief Ground speed in NED. */
+        GPS_INFO = 1u << 8, /**< @brief GPS information. */
+        BATTERY = 1u << 9, /**< @brief Battery. */
+        HEALTH = 1u << 10, /**< @brief Health. */
+        RC_STATUS = 1u << 11, /**< @brief RC status. */
+        STATUS_TEXT = 1u << 12, /**< @brief Last status text. */
+        ATTITUDE_QUATERNION = 1u << 13, /**< @brief Attitude as quaternion. */
+        ATTITUDE_ANGULAR_VELOCITY_BODY = 1u << 14, /**< @brief Angular velocity. */
+        ALL = (1u << 15) - 1 /**< @brief All of the above. */
+    };
+
+    /**
+     * @brief Telemetry snapshot type.
+     *
+     * The latest values of the fields asked for, e.g. everything needed to show the state of a
+     * vehicle at a glance. Values not asked for are left default constructed.
+     *
+     * For the values which are used to control the vehicle, the time at which they were last
+     * received is included as well (0 if not received yet). All timestamps are in microseconds
+     * and use the same (monotonic) clock as `timestamp_us`.
+     */
+    struct Snapshot {
+        uint64_t timestamp_us{}; /**< @brief Time at which this snapshot was taken. */
+        SnapshotField fields{SnapshotField::NONE}; /**< @brief Fields which are set. */
+        Position position{}; /**< @see Position */
+        uint64_t position_timestamp_us{}; /**< @brief Time position was last received. */
+        Position home_position{}; /**< @see Position */
+        bool in_air{}; /**< @brief true if in air. */
+        bool armed{}; /**< @brief true if armed. */
+        LandedState landed_state{LandedState::UNKNOWN}; /**< @see LandedState */
+        FlightMode flight_mode{FlightMode::UNKNOWN}; /**< @see FlightMode */
+        uint64_t flight_mode_timestamp_us{}; /**< @brief Time flight mode was last received. */
+        EulerAngle attitude_euler_angle{}; /**< @see EulerAngle */
+        Quaternion attitude_quaternion{}; /**< @see Quaternion */
+        uint64_t attitude_timestamp_us{}; /**< @brief Time attitude was last received. */
+        AngularVelocityBody attitude_angular_velocity_body{}; /**< @see AngularVelocityBody */
+        uint64_t attitude_angular_velocity_body_timestamp_us{}; /**< @brief Time angular
+                                                                   velocity was last received. */
+        GroundSpeedNED ground_speed_ned{}; /**< @see GroundSpeedNED */
+        uint64_t ground_speed_ned_timestamp_us{}; /**< @brief Time ground speed was last
+                                                     received. */
+        GPSInfo gps_info{}; /**< @see GPSInfo */
+        Battery battery{}; /**< @see Battery */
+        uint64_t battery_timestamp_us{}; /**< @brief Time battery was last received. */
+        Health health{}; /**< @see Health */
+        uint64_t health_timestamp_us{}; /**< @brief Time health was last updated. */
+        RCStatus rc_status{}; /**< @see RCStatus */
+        StatusText status_text{}; /**< @see StatusText */
+    };
+
+    /**
+     * @brief Telemetry streams for which a history can be kept.
+     */
+    enum class HistoryStream {
+        POSITION, /**< @brief Position, see position_history(). */
+        ATTITUDE, /**< @brief Attitude, see attitude_history(). */
+        IMU_READING_NED /**< @brief IMU readings, see imu_reading_ned_history(). */
+    };
+
+    /**
+     * @brief Contiguous range of samples in a history buffer.
+     *
+     * The span points directly into the history buffer, nothing is copied. It is therefore
+     * only valid while the visitor it was passed to is running.
+     */
+    template<typename T> struct HistorySpan {
+        const uint64_t* timestamps_us; /**< @brief Receive time of each sample in microseconds
+                                          (std::chrono::steady_clock). */
+        const T* values; /**< @brief The samples. */
+        size_t size; /**< @brief Number of samples. */
+
+        /**
+         * @brief Iterator to the first sample.
+         */
+        const T* begin() const { return values; }
+
+        /**
+         * @brief Iterator past the last sample.
+         */
+        const T* end() const { return values + size; }
+    };
+
+    /**
+     * @brief Range of attitude samples in a history buffer.
+     *
+     * Attitude is stored as quaternion, the Euler angles are only calculated when asked for.
+     */
+    struct AttitudeHistorySpan : public HistorySpan<Quaternion> {
+        /**
+         * @brief Get sample at index as Euler angle.
+         */
+        EulerAngle euler_angle(size_t index) const;
+    };
+
     /**
      * @brief Results enum for telemetry requests.
      */
@@ -917,6 +1023,20 @@ public:
      */
     ActuatorOutputStatus actuator_output_status() const;
 
+    /**
+     * @brief Handle identifying a subscription added using one of the subscribe_* methods.
+     */
+    typedef uint64_t SubscriptionHandle;
+
+    /**
+     * @brief Remove a subscription added using one of the subscribe_* methods.
+     *
+     * Updates which are already on their way can still arrive after this returns.
+     *
+     * @param handle Handle returned when subscribing.
+     */
+    void unsubscribe(SubscriptionHandle handle);
+
     /**
      * @brief Callback type for kinematic (position and velocity) updates.
      */
@@ -929,6 +1049,16 @@ public:
      */
     void position_velocity_ned_async(position_velocity_ned_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for kinematic (position and velocity) updates (asynchronous).
+     *
+     * Unlike position_velocity_ned_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_position_velocity_ned(position_velocity_ned_callback_t callback);
+
     /**
      * @brief Callback type for position updates.
      */
@@ -941,6 +1071,16 @@ public:
      */
     void position_async(position_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for position updates (asynchronous).
+     *
+     * Unlike position_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_position(position_callback_t callback);
+
     /**
      * @brief Subscribe to home position updates (asynchronous).
      *
@@ -948,6 +1088,16 @@ public:
      */
     void home_position_async(position_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for home position updates (asynchronous).
+     *
+     * Unlike home_position_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_home_position(position_callback_t callback);
+
     /**
      * @brief Callback type for in-air updates.
      *
@@ -969,6 +1119,16 @@ public:
      */
     void in_air_async(in_air_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for in-air updates (asynchronous).
+     *
+     * Unlike in_air_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_in_air(in_air_callback_t callback);
+
     /**
      * @brief Subscribe to status text updates (asynchronous).
      *
@@ -976,6 +1136,16 @@ public:
      */
     void status_text_async(status_text_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for status text updates (asynchronous).
+     *
+     * Unlike status_text_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_status_text(status_text_callback_t callback);
+
     /**
      * @brief Callback type for armed updates (asynchronous).
      *
@@ -992,6 +1162,16 @@ public:
      */
     void armed_async(armed_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for armed updates (asynchronous).
+     *
+     * Unlike armed_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_armed(armed_callback_t callback);
+
     /**
      * @brief Callback type for attitude updates in quaternion.
      *
@@ -1006,6 +1186,16 @@ public:
      */
     void attitude_quaternion_async(attitude_quaternion_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for attitude updates in quaternion (asynchronous).
+     *
+     * Unlike attitude_quaternion_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_attitude_quaternion(attitude_quaternion_callback_t callback);
+
     /**
      * @brief Callback type for attitude updates in Euler angles.
      *
@@ -1020,6 +1210,16 @@ public:
      */
     void attitude_euler_angle_async(attitude_euler_angle_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for attitude updates in Euler angles (asynchronous).
+     *
+     * Unlike attitude_euler_angle_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_attitude_euler_angle(attitude_euler_angle_callback_t callback);
+
     /**
      * @brief Callback type for angular velocity updates in quaternion.
      *
@@ -1035,6 +1235,17 @@ public:
      */
     void attitude_angular_velocity_body_async(attitude_angular_velocity_body_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for attitude updates in angular velocity (asynchronous).
+     *
+     * Unlike attitude_angular_velocity_body_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle
+    subscribe_attitude_angular_velocity_body(attitude_angular_velocity_body_callback_t callback);
+
     /**
      * @brief Callback type for fixedwing_metrics updates.
      *
@@ -1049,6 +1260,16 @@ public:
      */
     void fixedwing_metrics_async(fixedwing_metrics_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for vfr hud updates in (asynchronous).
+     *
+     * Unlike fixedwing_metrics_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_fixedwing_metrics(fixedwing_metrics_callback_t callback);
+
     /**
      * @brief Callback type for ground truth updates.
      *
@@ -1063,6 +1284,16 @@ public:
      */
     void ground_truth_async(ground_truth_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for ground_truth updates in (asynchronous).
+     *
+     * Unlike ground_truth_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_ground_truth(ground_truth_callback_t callback);
+
     /**
      * @brief Subscribe to camera attitude updates in quaternion (asynchronous).
      *
@@ -1070,6 +1301,17 @@ public:
      */
     void camera_attitude_quaternion_async(attitude_quaternion_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for camera attitude updates in quaternion (asynchronous).
+     *
+     * Unlike camera_attitude_quaternion_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle
+    subscribe_camera_attitude_quaternion(attitude_quaternion_callback_t callback);
+
     /**
      * @brief Subscribe to camera attitude updates in Euler angles (asynchronous).
      *
@@ -1077,6 +1319,17 @@ public:
      */
     void camera_attitude_euler_angle_async(attitude_euler_angle_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for camera attitude updates in Euler angles (asynchronous).
+     *
+     * Unlike camera_attitude_euler_angle_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle
+    subscribe_camera_attitude_euler_angle(attitude_euler_angle_callback_t callback);
+
     /**
      * @brief Callback type for ground speed (NED) updates.
      *
@@ -1091,6 +1344,16 @@ public:
      */
     void ground_speed_ned_async(ground_speed_ned_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for ground speed (NED) updates (asynchronous).
+     *
+     * Unlike ground_speed_ned_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_ground_speed_ned(ground_speed_ned_callback_t callback);
+
     /**
      * @brief Callback type for IMU (NED) updates.
      *
@@ -1105,6 +1368,16 @@ public:
      */
     void imu_reading_ned_async(imu_reading_ned_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for IMU reading (NED) updates (asynchronous).
+     *
+     * Unlike imu_reading_ned_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_imu_reading_ned(imu_reading_ned_callback_t callback);
+
     /**
      * @brief Callback type for GPS information updates.
      *
@@ -1119,6 +1392,16 @@ public:
      */
     void gps_info_async(gps_info_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for GPS information updates (asynchronous).
+     *
+     * Unlike gps_info_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_gps_info(gps_info_callback_t callback);
+
     /**
      * @brief Callback type for battery status updates.
      *
@@ -1133,6 +1416,16 @@ public:
      */
     void battery_async(battery_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for battery status updates (asynchronous).
+     *
+     * Unlike battery_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_battery(battery_callback_t callback);
+
     /**
      * @brief Callback type for flight mode updates.
      *
@@ -1149,6 +1442,16 @@ public:
      */
     void flight_mode_async(flight_mode_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for flight mode updates (asynchronous).
+     *
+     * Unlike flight_mode_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_flight_mode(flight_mode_callback_t callback);
+
     /**
      * @brief Callback type for health status updates.
      *
@@ -1165,6 +1468,16 @@ public:
      */
     void health_async(health_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for health status updates (asynchronous).
+     *
+     * Unlike health_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_health(health_callback_t callback);
+
     /**
      * @brief Callback type for health status updates.
      *
@@ -1181,6 +1494,16 @@ public:
      */
     void health_all_ok_async(health_all_ok_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for overall health status updates (asynchronous).
+     *
+     * Unlike health_all_ok_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_health_all_ok(health_all_ok_callback_t callback);
+
     /**
      * @brief Callback type for landed state updates.
      *
@@ -1195,6 +1518,16 @@ public:
      */
     void landed_state_async(landed_state_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for Landed state updates (asynchronous).
+     *
+     * Unlike landed_state_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_landed_state(landed_state_callback_t callback);
+
     /**
      * @brief Callback type for RC status updates.
      *
@@ -1224,6 +1557,17 @@ public:
      */
     void actuator_control_target_async(actuator_control_target_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for actuator control target updates (asynchronous).
+     *
+     * Unlike actuator_control_target_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle
+    subscribe_actuator_control_target(actuator_control_target_callback_t callback);
+
     /**
      * @brief Callback type for actuator output status target updates (asynchronous).
      *
@@ -1246,6 +1590,16 @@ public:
      */
     void actuator_output_status_async(actuator_output_status_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for actuator output status target updates (asynchronous).
+     *
+     * Unlike actuator_output_status_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_actuator_output_status(actuator_output_status_callback_t callback);
+
     /**
      * @brief Subscribe to odometry updates (asynchronous).
      *
@@ -1253,6 +1607,137 @@ public:
      */
     void odometry_async(odometry_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for odometry updates (asynchronous).
+     *
+     * Unlike odometry_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_odometry(odometry_callback_t callback);
+
+    /**
+     * @brief Get the latest values of several telemetry streams at once (synchronous).
+     *
+     * The values are taken from the ones last received, nothing is requested from the vehicle.
+     *
+     * @param fields Values to include, combined SnapshotField values.
+     * @return The snapshot.
+     */
+    Snapshot snapshot(SnapshotField fields = SnapshotField::ALL) const;
+
+    /**
+     * @brief Callback type for snapshot updates.
+     */
+    typedef std::function<void(Snapshot snapshot)> snapshot_callback_t;
+
+    /**
+     * @brief Add a subscriber for snapshots at a fixed rate (asynchronous).
+     *
+     * Each subscriber gets its own fields and rate, e.g. a dashboard can get the values it
+     * shows with one callback instead of subscribing to every stream.
+     *
+     * Like snapshot(), this only uses the values received anyway, no message rates are
+     * requested from the vehicle. To get e.g. a new position and attitude with every
+     * snapshot, set their rates with set_rate_position() and set_rate_attitude().
+     *
+     * @param fields Values to include, combined SnapshotField values.
+     * @param rate_hz Rate in Hz at which snapshots are delivered.
+     * @param callback Function to call with snapshots.
+     * @return Handle to remove the subscription using unsubscribe(), 0 if the rate is not
+     * positive or the callback is empty.
+     */
+    SubscriptionHandle
+    subscribe_snapshot(SnapshotField fields, double rate_hz, snapshot_callback_t callback);
+
+    /**
+     * @brief Turn off message streams which are not needed anymore.
+     *
+     * The streams needed for subscriptions are requested from the vehicle as they are
+     * subscribed. With this enabled, streams nobody subscribes to (or set a rate for) are
+     * turned off on the vehicle to save link bandwidth. This applies to all users of the
+     * system, e.g. also to messages subscribed using MavlinkPassthrough.
+     *
+     * Only streams which have been subscribed to or had a rate set before are turned off.
+     * Other streams the vehicle sends by default keep streaming, since that would include
+     * messages such as HEARTBEAT which are needed to stay connected.
+     *
+     * Only enable this if the values are not polled without subscription or set rate.
+     *
+     * @param turn_off_unused true to turn off unused streams, false (default) to leave them.
+     */
+    void set_turn_off_unused_streams(bool turn_off_unused);
+
+    /**
+     * @brief Set how many samples of a telemetry stream are kept in history.
+     *
+     * History is disabled (depth 0) by default. Setting the depth clears the history of that
+     * stream. The samples are recorded as they are received, so the time covered depends on
+     * the rate of the stream.
+     *
+     * @param stream Stream to keep the history of.
+     * @param depth Number of samples to keep, 0 to disable.
+     * @return Result of request.
+     */
+    Result set_history_depth(HistoryStream stream, unsigned depth);
+
+    /**
+     * @brief Visitor type for position history lookups.
+     */
+    typedef std::function<void(const HistorySpan<Position>& span)> position_history_visitor_t;
+
+    /**
+     * @brief Visit the position samples received between two points in time (synchronous).
+     *
+     * The visitor is called with at most two spans, in chronological order. It runs with the
+     * history locked, so it should not block.
+     *
+     * @param start_us Start of range in microseconds (std::chrono::steady_clock), inclusive.
+     * @param end_us End of range in microseconds (std::chrono::steady_clock), inclusive.
+     * @param visitor Function to call with the samples.
+     * @return Number of samples visited.
+     */
+    size_t position_history(
+        uint64_t start_us, uint64_t end_us, const position_history_visitor_t& visitor) const;
+
+    /**
+     * @brief Visitor type for attitude history lookups.
+     */
+    typedef std::function<void(const AttitudeHistorySpan& span)> attitude_history_visitor_t;
+
+    /**
+     * @brief Visit the attitude samples received between two points in time (synchronous).
+     *
+     * @see position_history
+     *
+     * @param start_us Start of range in microseconds (std::chrono::steady_clock), inclusive.
+     * @param end_us End of range in microseconds (std::chrono::steady_clock), inclusive.
+     * @param visitor Function to call with the samples.
+     * @return Number of samples visited.
+     */
+    size_t attitude_history(
+        uint64_t start_us, uint64_t end_us, const attitude_history_visitor_t& visitor) const;
+
+    /**
+     * @brief Visitor type for IMU reading history lookups.
+     */
+    typedef std::function<void(const HistorySpan<IMUReadingNED>& span)>
+        imu_reading_ned_history_visitor_t;
+
+    /**
+     * @brief Visit the IMU readings received between two points in time (synchronous).
+     *
+     * @see position_history
+     *
+     * @param start_us Start of range in microseconds (std::chrono::steady_clock), inclusive.
+     * @param end_us End of range in microseconds (std::chrono::steady_clock), inclusive.
+     * @param visitor Function to call with the samples.
+     * @return Number of samples visited.
+     */
+    size_t imu_reading_ned_history(
+        uint64_t start_us, uint64_t end_us, const imu_reading_ned_history_visitor_t& visitor) const;
+
     /**
      * @brief Subscribe to RC status updates (asynchronous).
      *
@@ -1260,6 +1745,16 @@ public:
      */
     void rc_status_async(rc_status_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for RC status updates (asynchronous).
+     *
+     * Unlike rc_status_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_rc_status(rc_status_callback_t callback);
+
     /**
      * @brief Subscribe to Unix Epoch Time updates (asynchronous).
      *
@@ -1267,6 +1762,16 @@ public:
      */
     void unix_epoch_time_async(unix_epoch_time_callback_t callback);
 
+    /**
+     * @brief Add a subscriber for Unix Epoch Time updates (asynchronous).
+     *
+     * Unlike unix_epoch_time_async, this does not replace any other subscriber.
+     *
+     * @param callback Function to call with updates.
+     * @return Handle to remove the subscription using unsubscribe().
+     */
+    SubscriptionHandle subscribe_unix_epoch_time(unix_epoch_time_callback_t callback);
+
     /**
      * @brief Copy constructor (object is not copyable).
      */
@@ -1600,6 +2105,72 @@ bool operator==(const Telemetry::Odometry& lhs, const Telemetry::Odometry& rhs);
  */
 std::ostream& operator<<(std::ostream& str, Telemetry::Odometry const& odometry);
 
+/**
+ * @brief Combine two `Telemetry::SnapshotField` masks.
+ */
+inline Telemetry::SnapshotField
+operator|(Telemetry::SnapshotField lhs, Telemetry::SnapshotField rhs)
+{
+    return static_cast<Telemetry::SnapshotField>(
+        static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs));
+}
+
+/**
+ * @brief Intersect two `Telemetry::SnapshotField` masks.
+ */
+inline Telemetry::SnapshotField
+operator&(Telemetry::SnapshotField lhs, Telemetry::SnapshotField rhs)
+{
+    return static_cast<Telemetry::SnapshotField>(
+        static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs));
+}
+
+/**
+ * @brief Invert a `Telemetry::SnapshotField` mask, limited to the known fields.
+ */
+inline Telemetry::SnapshotField operator~(Telemetry::SnapshotField fields)
+{
+    return static_cast<Telemetry::SnapshotField>(
+        ~static_cast<uint32_t>(fields) & static_cast<uint32_t>(Telemetry::SnapshotField::ALL));
+}
+
+/**
+ * @brief Add the fields of `rhs` to the `Telemetry::SnapshotField` mask `lhs`.
+ */
+inline Telemetry::SnapshotField&
+operator|=(Telemetry::SnapshotField& lhs, Telemetry::SnapshotField rhs)
+{
+    return lhs = lhs | rhs;
+}
+
+/**
+ * @brief Keep only the fields of the `Telemetry::SnapshotField` mask `lhs` also in `rhs`.
+ */
+inline Telemetry::SnapshotField&
+operator&=(Telemetry::SnapshotField& lhs, Telemetry::SnapshotField rhs)
+{
+    return lhs = lhs & rhs;
+}
+
+/**
+ * @brief Check whether a `Telemetry::SnapshotField` mask contains any of the given fields.
+ *
+ * @returns true if `fields` and `field` have a field in common.
+ */
+inline bool has_snapshot_field(Telemetry::SnapshotField fields, Telemetry::SnapshotField field)
+{
+    return (fields & field) != Telemetry::SnapshotField::NONE;
+}
+
+/**
+ * @brief Stream operator to print information about a `Telemetry::Snapshot`.
+ *
+ * Only the fields which are set are printed.
+ *
+ * @returns A reference to the stream.
+ */
+std::ostream& operator<<(std::ostream& str, Telemetry::Snapshot const& snapshot);
+
 /**
  * @brief Stream operator to print information about a `Telemetry::FlightMode`.
  *
@@ -7,34 +7,61 @@ namespace testing {
 
 class MockTelemetry {
 public:
-    MOCK_CONST_METHOD1(position_async, void(Telemetry::position_callback_t)){};
-    MOCK_CONST_METHOD1(health_async, void(Telemetry::health_callback_t)){};
-    MOCK_CONST_METHOD1(home_position_async, void(Telemetry::position_callback_t)){};
-    MOCK_CONST_METHOD1(in_air_async, void(Telemetry::in_air_callback_t)){};
-    MOCK_CONST_METHOD1(status_text_async, void(Telemetry::status_text_callback_t)){};
-    MOCK_CONST_METHOD1(armed_async, void(Telemetry::armed_callback_t)){};
-    MOCK_CONST_METHOD1(gps_info_async, void(Telemetry::gps_info_callback_t)){};
-    MOCK_CONST_METHOD1(battery_async, void(Telemetry::battery_callback_t)){};
-    MOCK_CONST_METHOD1(flight_mode_async, void(Telemetry::flight_mode_callback_t)){};
-    MOCK_CONST_METHOD1(landed_state_async, void(Telemetry::landed_state_callback_t)){};
     MOCK_CONST_METHOD1(
-        attitude_quaternion_async, void(Telemetry::attitude_quaternion_callback_t)){};
+        subscribe_position, Telemetry::SubscriptionHandle(Telemetry::position_callback_t)){};
     MOCK_CONST_METHOD1(
-        attitude_angular_velocity_body_async,
-        void(Telemetry::attitude_angular_velocity_body_callback_t)){};
+        subscribe_health, Telemetry::SubscriptionHandle(Telemetry::health_callback_t)){};
     MOCK_CONST_METHOD1(
-        attitude_euler_angle_async, void(Telemetry::attitude_euler_angle_callback_t)){};
+        subscribe_home_position, Telemetry::SubscriptionHandle(Telemetry::position_callback_t)){};
     MOCK_CONST_METHOD1(
-        camera_attitude_quaternion_async, void(Telemetry::attitude_quaternion_callback_t)){};
+        subscribe_in_air, Telemetry::SubscriptionHandle(Telemetry::in_air_callback_t)){};
     MOCK_CONST_METHOD1(
-        camera_attitude_euler_angle_async, void(Telemetry::attitude_euler_angle_callback_t)){};
-    MOCK_CONST_METHOD1(ground_speed_ned_async, void(Telemetry::ground_speed_ned_callback_t)){};
-    MOCK_CONST_METHOD1(rc_status_async, void(Telemetry::rc_status_callback_t)){};
+        subscribe_status_text, Telemetry::SubscriptionHandle(Telemetry::status_text_callback_t)){};
     MOCK_CONST_METHOD1(
-        actuator_control_target_async, void(Telemetry::actuator_control_target_callback_t)){};
+        subscribe_armed, Telemetry::SubscriptionHandle(Telemetry::armed_callback_t)){};
     MOCK_CONST_METHOD1(
-        actuator_output_status_async, void(Telemetry::actuator_output_status_callback_t)){};
-    MOCK_CONST_METHOD1(odometry_async, void(Telemetry::odometry_callback_t)){};
+        subscribe_gps_info, Telemetry::SubscriptionHandle(Telemetry::gps_info_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_battery, Telemetry::SubscriptionHandle(Telemetry::battery_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_flight_mode, Telemetry::SubscriptionHandle(Telemetry::flight_mode_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_landed_state,
+        Telemetry::SubscriptionHandle(Telemetry::landed_state_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_attitude_quaternion,
+        Telemetry::SubscriptionHandle(Telemetry::attitude_quaternion_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_attitude_angular_velocity_body,
+        Telemetry::SubscriptionHandle(Telemetry::attitude_angular_velocity_body_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_attitude_euler_angle,
+        Telemetry::SubscriptionHandle(Telemetry::attitude_euler_angle_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_camera_attitude_quaternion,
+        Telemetry::SubscriptionHandle(Telemetry::attitude_quaternion_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_camera_attitude_euler_angle,
+        Telemetry::SubscriptionHandle(Telemetry::attitude_euler_angle_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_ground_speed_ned,
+        Telemetry::SubscriptionHandle(Telemetry::ground_speed_ned_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_rc_status, Telemetry::SubscriptionHandle(Telemetry::rc_status_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_actuator_control_target,
+        Telemetry::SubscriptionHandle(Telemetry::actuator_control_target_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_actuator_output_status,
+        Telemetry::SubscriptionHandle(Telemetry::actuator_output_status_callback_t)){};
+    MOCK_CONST_METHOD1(
+        subscribe_odometry, Telemetry::SubscriptionHandle(Telemetry::odometry_callback_t)){};
+    MOCK_CONST_METHOD1(snapshot, Telemetry::Snapshot(Telemetry::SnapshotField)){};
+    MOCK_CONST_METHOD3(
+        subscribe_snapshot,
+        Telemetry::SubscriptionHandle(
+            Telemetry::SnapshotField, double, Telemetry::snapshot_callback_t)){};
+    MOCK_CONST_METHOD1(unsubscribe, void(Telemetry::SubscriptionHandle)){};
 };
 
 } // namespace testing
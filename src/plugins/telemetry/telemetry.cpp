@@ -3,6 +3,7 @@
 
 #include "plugins/telemetry/telemetry.h"
 #include "telemetry_impl.h"
+#include "math_conversions.h"
 
 namespace mavsdk {
 
@@ -205,6 +206,11 @@ void Telemetry::landed_state_async(landed_state_callback_t callback)
     _impl->landed_state_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_landed_state(landed_state_callback_t callback)
+{
+    return _impl->subscribe_landed_state(callback);
+}
+
 std::string Telemetry::landed_state_str(LandedState landed_state)
 {
     switch (landed_state) {
@@ -317,112 +323,277 @@ Telemetry::ActuatorOutputStatus Telemetry::actuator_output_status() const
     return _impl->get_actuator_output_status();
 }
 
+void Telemetry::unsubscribe(SubscriptionHandle handle)
+{
+    _impl->unsubscribe(handle);
+}
+
 void Telemetry::position_velocity_ned_async(position_velocity_ned_callback_t callback)
 {
     return _impl->position_velocity_ned_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_position_velocity_ned(position_velocity_ned_callback_t callback)
+{
+    return _impl->subscribe_position_velocity_ned(callback);
+}
+
 void Telemetry::position_async(position_callback_t callback)
 {
     return _impl->position_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_position(position_callback_t callback)
+{
+    return _impl->subscribe_position(callback);
+}
+
 void Telemetry::home_position_async(position_callback_t callback)
 {
     return _impl->home_position_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_home_position(position_callback_t callback)
+{
+    return _impl->subscribe_home_position(callback);
+}
+
 void Telemetry::in_air_async(in_air_callback_t callback)
 {
     return _impl->in_air_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_in_air(in_air_callback_t callback)
+{
+    return _impl->subscribe_in_air(callback);
+}
+
 void Telemetry::status_text_async(status_text_callback_t callback)
 {
     return _impl->status_text_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_status_text(status_text_callback_t callback)
+{
+    return _impl->subscribe_status_text(callback);
+}
+
 void Telemetry::armed_async(armed_callback_t callback)
 {
     return _impl->armed_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_armed(armed_callback_t callback)
+{
+    return _impl->subscribe_armed(callback);
+}
+
 void Telemetry::attitude_quaternion_async(attitude_quaternion_callback_t callback)
 {
     return _impl->attitude_quaternion_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_attitude_quaternion(attitude_quaternion_callback_t callback)
+{
+    return _impl->subscribe_attitude_quaternion(callback);
+}
+
 void Telemetry::attitude_euler_angle_async(attitude_euler_angle_callback_t callback)
 {
     return _impl->attitude_euler_angle_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_attitude_euler_angle(attitude_euler_angle_callback_t callback)
+{
+    return _impl->subscribe_attitude_euler_angle(callback);
+}
+
 void Telemetry::attitude_angular_velocity_body_async(
     attitude_angular_velocity_body_callback_t callback)
 {
     return _impl->attitude_angular_velocity_body_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_attitude_angular_velocity_body(
+    attitude_angular_velocity_body_callback_t callback)
+{
+    return _impl->subscribe_attitude_angular_velocity_body(callback);
+}
+
 void Telemetry::fixedwing_metrics_async(fixedwing_metrics_callback_t callback)
 {
     return _impl->fixedwing_metrics_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_fixedwing_metrics(fixedwing_metrics_callback_t callback)
+{
+    return _impl->subscribe_fixedwing_metrics(callback);
+}
+
 void Telemetry::ground_truth_async(ground_truth_callback_t callback)
 {
     return _impl->ground_truth_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_ground_truth(ground_truth_callback_t callback)
+{
+    return _impl->subscribe_ground_truth(callback);
+}
+
 void Telemetry::camera_attitude_quaternion_async(attitude_quaternion_callback_t callback)
 {
     return _impl->camera_attitude_quaternion_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_camera_attitude_quaternion(attitude_quaternion_callback_t callback)
+{
+    return _impl->subscribe_camera_attitude_quaternion(callback);
+}
+
 void Telemetry::camera_attitude_euler_angle_async(attitude_euler_angle_callback_t callback)
 {
     return _impl->camera_attitude_euler_angle_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_camera_attitude_euler_angle(attitude_euler_angle_callback_t callback)
+{
+    return _impl->subscribe_camera_attitude_euler_angle(callback);
+}
+
 void Telemetry::ground_speed_ned_async(ground_speed_ned_callback_t callback)
 {
     return _impl->ground_speed_ned_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_ground_speed_ned(ground_speed_ned_callback_t callback)
+{
+    return _impl->subscribe_ground_speed_ned(callback);
+}
+
 void Telemetry::imu_reading_ned_async(imu_reading_ned_callback_t callback)
 {
     return _impl->imu_reading_ned_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_imu_reading_ned(imu_reading_ned_callback_t callback)
+{
+    return _impl->subscribe_imu_reading_ned(callback);
+}
+
 void Telemetry::gps_info_async(gps_info_callback_t callback)
 {
     return _impl->gps_info_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_gps_info(gps_info_callback_t callback)
+{
+    return _impl->subscribe_gps_info(callback);
+}
+
 void Telemetry::battery_async(battery_callback_t callback)
 {
     return _impl->battery_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_battery(battery_callback_t callback)
+{
+    return _impl->subscribe_battery(callback);
+}
+
 void Telemetry::flight_mode_async(flight_mode_callback_t callback)
 {
     return _impl->flight_mode_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_flight_mode(flight_mode_callback_t callback)
+{
+    return _impl->subscribe_flight_mode(callback);
+}
+
 void Telemetry::actuator_control_target_async(actuator_control_target_callback_t callback)
 {
     return _impl->actuator_control_target_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_actuator_control_target(actuator_control_target_callback_t callback)
+{
+    return _impl->subscribe_actuator_control_target(callback);
+}
+
 void Telemetry::actuator_output_status_async(actuator_output_status_callback_t callback)
 {
     return _impl->actuator_output_status_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_actuator_output_status(actuator_output_status_callback_t callback)
+{
+    return _impl->subscribe_actuator_output_status(callback);
+}
+
 void Telemetry::odometry_async(odometry_callback_t callback)
 {
     return _impl->odometry_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_odometry(odometry_callback_t callback)
+{
+    return _impl->subscribe_odometry(callback);
+}
+
+Telemetry::Snapshot Telemetry::snapshot(SnapshotField fields) const
+{
+    return _impl->snapshot(fields);
+}
+
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_snapshot(SnapshotField fields, double rate_hz, snapshot_callback_t callback)
+{
+    return _impl->subscribe_snapshot(fields, rate_hz, callback);
+}
+
+void Telemetry::set_turn_off_unused_streams(bool turn_off_unused)
+{
+    _impl->set_turn_off_unused_streams(turn_off_unused);
+}
+
+Telemetry::Result Telemetry::set_history_depth(HistoryStream stream, unsigned depth)
+{
+    return _impl->set_history_depth(stream, depth);
+}
+
+size_t Telemetry::position_history(
+    uint64_t start_us, uint64_t end_us, const position_history_visitor_t& visitor) const
+{
+    return _impl->position_history(start_us, end_us, visitor);
+}
+
+size_t Telemetry::attitude_history(
+    uint64_t start_us, uint64_t end_us, const attitude_history_visitor_t& visitor) const
+{
+    return _impl->attitude_history(start_us, end_us, visitor);
+}
+
+size_t Telemetry::imu_reading_ned_history(
+    uint64_t start_us, uint64_t end_us, const imu_reading_ned_history_visitor_t& visitor) const
+{
+    return _impl->imu_reading_ned_history(start_us, end_us, visitor);
+}
+
+Telemetry::EulerAngle Telemetry::AttitudeHistorySpan::euler_angle(size_t index) const
+{
+    return to_euler_angle_from_quaternion(values[index]);
+}
+
 std::string Telemetry::flight_mode_str(FlightMode flight_mode)
 {
     switch (flight_mode) {
@@ -466,21 +637,42 @@ void Telemetry::health_async(health_callback_t callback)
     return _impl->health_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_health(health_callback_t callback)
+{
+    return _impl->subscribe_health(callback);
+}
+
 void Telemetry::health_all_ok_async(health_all_ok_callback_t callback)
 {
     return _impl->health_all_ok_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_health_all_ok(health_all_ok_callback_t callback)
+{
+    return _impl->subscribe_health_all_ok(callback);
+}
+
 void Telemetry::rc_status_async(rc_status_callback_t callback)
 {
     return _impl->rc_status_async(callback);
 }
 
+Telemetry::SubscriptionHandle Telemetry::subscribe_rc_status(rc_status_callback_t callback)
+{
+    return _impl->subscribe_rc_status(callback);
+}
+
 void Telemetry::unix_epoch_time_async(unix_epoch_time_callback_t callback)
 {
     return _impl->unix_epoch_time_async(callback);
 }
 
+Telemetry::SubscriptionHandle
+Telemetry::subscribe_unix_epoch_time(unix_epoch_time_callback_t callback)
+{
+    return _impl->subscribe_unix_epoch_time(callback);
+}
+
 const char* Telemetry::result_str(Result result)
 {
     switch (result) {
@@ -932,6 +1124,58 @@ std::ostream& operator<<(std::ostream& str, Telemetry::Odometry const& odometry)
     return str;
 }
 
+std::ostream& operator<<(std::ostream& str, Telemetry::Snapshot const& snapshot)
+{
+    str << "[timestamp_us: " << snapshot.timestamp_us;
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::POSITION)) {
+        str << ", position: " << snapshot.position;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::HOME_POSITION)) {
+        str << ", home_position: " << snapshot.home_position;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::IN_AIR)) {
+        str << ", in_air: " << snapshot.in_air;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::ARMED)) {
+        str << ", armed: " << snapshot.armed;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::LANDED_STATE)) {
+        str << ", landed_state: " << snapshot.landed_state;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::FLIGHT_MODE)) {
+        str << ", flight_mode: " << snapshot.flight_mode;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::ATTITUDE_EULER_ANGLE)) {
+        str << ", attitude_euler_angle: " << snapshot.attitude_euler_angle;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::GROUND_SPEED_NED)) {
+        str << ", ground_speed_ned: " << snapshot.ground_speed_ned;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::GPS_INFO)) {
+        str << ", gps_info: " << snapshot.gps_info;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::BATTERY)) {
+        str << ", battery: " << snapshot.battery;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::HEALTH)) {
+        str << ", health: " << snapshot.health;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::RC_STATUS)) {
+        str << ", rc_status: " << snapshot.rc_status;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::STATUS_TEXT)) {
+        str << ", status_text: " << snapshot.status_text;
+    }
+    if (has_snapshot_field(snapshot.fields, Telemetry::SnapshotField::ATTITUDE_QUATERNION)) {
+        str << ", attitude_quaternion: " << snapshot.attitude_quaternion;
+    }
+    if (has_snapshot_field(
+            snapshot.fields, Telemetry::SnapshotField::ATTITUDE_ANGULAR_VELOCITY_BODY)) {
+        str << ", attitude_angular_velocity_body: " << snapshot.attitude_angular_velocity_body;
+    }
+    return str << "]";
+}
+
 std::ostream& operator<<(std::ostream& str, Telemetry::FlightMode const& flight_mode)
 {
     return str << Telemetry::flight_mode_str(flight_mode);
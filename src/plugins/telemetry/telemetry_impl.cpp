@@ -6,6 +6,7 @@
 #include <functional>
 #include <string>
 #include <array>
+#include <future>
 
 namespace mavsdk {
 
@@ -110,6 +111,14 @@ void TelemetryImpl::init()
 
 void TelemetryImpl::deinit()
 {
+    {
+        std::lock_guard<std::mutex> lock(_snapshot_mutex);
+        for (auto& subscription : _snapshot_subscriptions) {
+            _parent->remove_call_every(subscription.second.call_every_cookie);
+        }
+        _snapshot_subscriptions.clear();
+    }
+    _parent->unregister_all_msg_rate_requests(this);
     _parent->unregister_timeout_handler(_rc_channels_timeout_cookie);
     _parent->unregister_timeout_handler(_gps_raw_timeout_cookie);
     _parent->unregister_timeout_handler(_unix_epoch_timeout_cookie);
@@ -187,8 +196,7 @@ void TelemetryImpl::disable() {}
 
 Telemetry::Result TelemetryImpl::set_rate_position_velocity_ned(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_LOCAL_POSITION_NED, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_LOCAL_POSITION_NED, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_position(double rate_hz)
@@ -196,32 +204,27 @@ Telemetry::Result TelemetryImpl::set_rate_position(double rate_hz)
     _position_rate_hz = rate_hz;
     double max_rate_hz = std::max(_position_rate_hz, _ground_speed_ned_rate_hz);
 
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_GLOBAL_POSITION_INT, max_rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_GLOBAL_POSITION_INT, max_rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_home_position(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_HOME_POSITION, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_HOME_POSITION, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_in_air(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_EXTENDED_SYS_STATE, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_EXTENDED_SYS_STATE, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_attitude(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_ATTITUDE_QUATERNION, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_ATTITUDE_QUATERNION, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_camera_attitude(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_MOUNT_ORIENTATION, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_MOUNT_ORIENTATION, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_ground_speed_ned(double rate_hz)
@@ -229,71 +232,58 @@ Telemetry::Result TelemetryImpl::set_rate_ground_speed_ned(double rate_hz)
     _ground_speed_ned_rate_hz = rate_hz;
     double max_rate_hz = std::max(_position_rate_hz, _ground_speed_ned_rate_hz);
 
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_GLOBAL_POSITION_INT, max_rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_GLOBAL_POSITION_INT, max_rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_imu_reading_ned(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_HIGHRES_IMU, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_HIGHRES_IMU, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_fixedwing_metrics(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_VFR_HUD, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_VFR_HUD, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_ground_truth(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_HIL_STATE_QUATERNION, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_HIL_STATE_QUATERNION, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_gps_info(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_GPS_RAW_INT, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_GPS_RAW_INT, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_battery(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_SYS_STATUS, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_SYS_STATUS, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_rc_status(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_RC_CHANNELS, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_RC_CHANNELS, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_actuator_control_target(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_actuator_output_status(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS, rate_hz);
 }
 
 Telemetry::Result TelemetryImpl::set_rate_odometry(double rate_hz)
 {
-    return telemetry_result_from_command_result(
-        _parent->set_msg_rate(MAVLINK_MSG_ID_ODOMETRY, rate_hz));
+    return request_msg_rate(MAVLINK_MSG_ID_ODOMETRY, rate_hz);
 }
 
 void TelemetryImpl::set_rate_position_velocity_ned_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_LOCAL_POSITION_NED,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_LOCAL_POSITION_NED, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_position_async(double rate_hz, Telemetry::result_callback_t callback)
@@ -301,44 +291,29 @@ void TelemetryImpl::set_rate_position_async(double rate_hz, Telemetry::result_ca
     _position_rate_hz = rate_hz;
     double max_rate_hz = std::max(_position_rate_hz, _ground_speed_ned_rate_hz);
 
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_GLOBAL_POSITION_INT,
-        max_rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_GLOBAL_POSITION_INT, max_rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_home_position_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_HOME_POSITION,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_HOME_POSITION, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_in_air_async(double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_EXTENDED_SYS_STATE,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_EXTENDED_SYS_STATE, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_attitude_async(double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_ATTITUDE_QUATERNION,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_ATTITUDE_QUATERNION, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_camera_attitude_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_MOUNT_ORIENTATION,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_MOUNT_ORIENTATION, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_ground_speed_ned_async(
@@ -347,96 +322,63 @@ void TelemetryImpl::set_rate_ground_speed_ned_async(
     _ground_speed_ned_rate_hz = rate_hz;
     double max_rate_hz = std::max(_position_rate_hz, _ground_speed_ned_rate_hz);
 
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_GLOBAL_POSITION_INT,
-        max_rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_GLOBAL_POSITION_INT, max_rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_imu_reading_ned_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_HIGHRES_IMU,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_HIGHRES_IMU, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_fixedwing_metrics_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_VFR_HUD,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_VFR_HUD, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_ground_truth_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_HIL_STATE_QUATERNION,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_HIL_STATE_QUATERNION, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_gps_info_async(double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_GPS_RAW_INT,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_GPS_RAW_INT, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_battery_async(double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_SYS_STATUS,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_SYS_STATUS, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_rc_status_async(double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_RC_CHANNELS,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_RC_CHANNELS, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_unix_epoch_time_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_UTM_GLOBAL_POSITION,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_UTM_GLOBAL_POSITION, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_actuator_control_target_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_actuator_output_status_async(
     double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS, rate_hz, callback);
 }
 
 void TelemetryImpl::set_rate_odometry_async(double rate_hz, Telemetry::result_callback_t callback)
 {
-    _parent->set_msg_rate_async(
-        MAVLINK_MSG_ID_ODOMETRY,
-        rate_hz,
-        std::bind(&TelemetryImpl::command_result_callback, std::placeholders::_1, callback));
+    request_msg_rate_async(MAVLINK_MSG_ID_ODOMETRY, rate_hz, callback);
 }
 
 Telemetry::Result
@@ -479,10 +421,8 @@ void TelemetryImpl::process_position_velocity_ned(const mavlink_message_t& messa
                                                               local_position.vy,
                                                               local_position.vz}));
 
-    if (_position_velocity_ned_subscription) {
-        auto callback = _position_velocity_ned_subscription;
-        auto arg = get_position_velocity_ned();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_position_velocity_ned_subscriptions.empty()) {
+        notify(_position_velocity_ned_subscriptions, get_position_velocity_ned());
     }
 }
 
@@ -498,16 +438,12 @@ void TelemetryImpl::process_global_position_int(const mavlink_message_t& message
                           global_position_int.vy * 1e-2f,
                           global_position_int.vz * 1e-2f});
 
-    if (_position_subscription) {
-        auto callback = _position_subscription;
-        auto arg = get_position();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_position_subscriptions.empty()) {
+        notify(_position_subscriptions, get_position());
     }
 
-    if (_ground_speed_ned_subscription) {
-        auto callback = _ground_speed_ned_subscription;
-        auto arg = get_ground_speed_ned();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_ground_speed_ned_subscriptions.empty()) {
+        notify(_ground_speed_ned_subscriptions, get_ground_speed_ned());
     }
 }
 
@@ -523,10 +459,8 @@ void TelemetryImpl::process_home_position(const mavlink_message_t& message)
 
     set_health_home_position(true);
 
-    if (_home_position_subscription) {
-        auto callback = _home_position_subscription;
-        auto arg = get_home_position();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_home_position_subscriptions.empty()) {
+        notify(_home_position_subscriptions, get_home_position());
     }
 }
 
@@ -544,22 +478,16 @@ void TelemetryImpl::process_attitude(const mavlink_message_t& message)
     auto quaternion = mavsdk::to_quaternion_from_euler_angle(euler_angle);
     set_attitude_quaternion(quaternion);
 
-    if (_attitude_quaternion_subscription) {
-        auto callback = _attitude_quaternion_subscription;
-        auto arg = get_attitude_quaternion();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_attitude_quaternion_subscriptions.empty()) {
+        notify(_attitude_quaternion_subscriptions, get_attitude_quaternion());
     }
 
-    if (_attitude_euler_angle_subscription) {
-        auto callback = _attitude_euler_angle_subscription;
-        auto arg = get_attitude_euler_angle();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_attitude_euler_angle_subscriptions.empty()) {
+        notify(_attitude_euler_angle_subscriptions, get_attitude_euler_angle());
     }
 
-    if (_attitude_angular_velocity_body_subscription) {
-        auto callback = _attitude_angular_velocity_body_subscription;
-        auto arg = get_attitude_angular_velocity_body();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_attitude_angular_velocity_body_subscriptions.empty()) {
+        notify(_attitude_angular_velocity_body_subscriptions, get_attitude_angular_velocity_body());
     }
 }
 
@@ -581,22 +509,16 @@ void TelemetryImpl::process_attitude_quaternion(const mavlink_message_t& message
 
     set_attitude_angular_velocity_body(angular_velocity_body);
 
-    if (_attitude_quaternion_subscription) {
-        auto callback = _attitude_quaternion_subscription;
-        auto arg = get_attitude_quaternion();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_attitude_quaternion_subscriptions.empty()) {
+        notify(_attitude_quaternion_subscriptions, get_attitude_quaternion());
     }
 
-    if (_attitude_euler_angle_subscription) {
-        auto callback = _attitude_euler_angle_subscription;
-        auto arg = get_attitude_euler_angle();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_attitude_euler_angle_subscriptions.empty()) {
+        notify(_attitude_euler_angle_subscriptions, get_attitude_euler_angle());
     }
 
-    if (_attitude_angular_velocity_body_subscription) {
-        auto callback = _attitude_angular_velocity_body_subscription;
-        auto arg = get_attitude_angular_velocity_body();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_attitude_angular_velocity_body_subscriptions.empty()) {
+        notify(_attitude_angular_velocity_body_subscriptions, get_attitude_angular_velocity_body());
     }
 }
 
@@ -610,16 +532,12 @@ void TelemetryImpl::process_mount_orientation(const mavlink_message_t& message)
 
     set_camera_attitude_euler_angle(euler_angle);
 
-    if (_camera_attitude_quaternion_subscription) {
-        auto callback = _camera_attitude_quaternion_subscription;
-        auto arg = get_camera_attitude_quaternion();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_camera_attitude_quaternion_subscriptions.empty()) {
+        notify(_camera_attitude_quaternion_subscriptions, get_camera_attitude_quaternion());
     }
 
-    if (_camera_attitude_euler_angle_subscription) {
-        auto callback = _camera_attitude_euler_angle_subscription;
-        auto arg = get_camera_attitude_euler_angle();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_camera_attitude_euler_angle_subscriptions.empty()) {
+        notify(_camera_attitude_euler_angle_subscriptions, get_camera_attitude_euler_angle());
     }
 }
 
@@ -638,10 +556,8 @@ void TelemetryImpl::process_imu_reading_ned(const mavlink_message_t& message)
                                                   highres_imu.zmag,
                                                   highres_imu.temperature}));
 
-    if (_imu_reading_ned_subscription) {
-        auto callback = _imu_reading_ned_subscription;
-        auto arg = get_imu_reading_ned();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_imu_reading_ned_subscriptions.empty()) {
+        notify(_imu_reading_ned_subscriptions, get_imu_reading_ned());
     }
 }
 
@@ -660,10 +576,8 @@ void TelemetryImpl::process_gps_raw_int(const mavlink_message_t& message)
     // Local is not different from global for now until things like flow are in place.
     set_health_local_position(gps_ok);
 
-    if (_gps_info_subscription) {
-        auto callback = _gps_info_subscription;
-        auto arg = get_gps_info();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_gps_info_subscriptions.empty()) {
+        notify(_gps_info_subscriptions, get_gps_info());
     }
 
     _parent->refresh_timeout_handler(_gps_raw_timeout_cookie);
@@ -678,10 +592,8 @@ void TelemetryImpl::process_ground_truth(const mavlink_message_t& message)
                                              hil_state_quaternion.lon * 1e-7,
                                              hil_state_quaternion.alt * 1e-3f}));
 
-    if (_ground_truth_subscription) {
-        auto callback = _ground_truth_subscription;
-        auto arg = get_ground_truth();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_ground_truth_subscriptions.empty()) {
+        notify(_ground_truth_subscriptions, get_ground_truth());
     }
 }
 
@@ -693,10 +605,8 @@ void TelemetryImpl::process_extended_sys_state(const mavlink_message_t& message)
     Telemetry::LandedState landed_state = to_landed_state(extended_sys_state);
     set_landed_state(landed_state);
 
-    if (_landed_state_subscription) {
-        auto callback = _landed_state_subscription;
-        auto arg = get_landed_state();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_landed_state_subscriptions.empty()) {
+        notify(_landed_state_subscriptions, get_landed_state());
     }
 
     if (extended_sys_state.landed_state == MAV_LANDED_STATE_IN_AIR ||
@@ -708,10 +618,8 @@ void TelemetryImpl::process_extended_sys_state(const mavlink_message_t& message)
     }
     // If landed_state is undefined, we use what we have received last.
 
-    if (_in_air_subscription) {
-        auto callback = _in_air_subscription;
-        auto arg = in_air();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_in_air_subscriptions.empty()) {
+        notify(_in_air_subscriptions, in_air());
     }
 }
 void TelemetryImpl::process_fixedwing_metrics(const mavlink_message_t& message)
@@ -722,10 +630,8 @@ void TelemetryImpl::process_fixedwing_metrics(const mavlink_message_t& message)
     set_fixedwing_metrics(
         Telemetry::FixedwingMetrics({vfr_hud.airspeed, vfr_hud.throttle * 1e-2f, vfr_hud.climb}));
 
-    if (_fixedwing_metrics_subscription) {
-        auto callback = _fixedwing_metrics_subscription;
-        auto arg = get_fixedwing_metrics();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_fixedwing_metrics_subscriptions.empty()) {
+        notify(_fixedwing_metrics_subscriptions, get_fixedwing_metrics());
     }
 }
 
@@ -738,10 +644,8 @@ void TelemetryImpl::process_sys_status(const mavlink_message_t& message)
          // FIXME: it is strange calling it percent when the range goes from 0 to 1.
          sys_status.battery_remaining * 1e-2f}));
 
-    if (_battery_subscription) {
-        auto callback = _battery_subscription;
-        auto arg = get_battery();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_battery_subscriptions.empty()) {
+        notify(_battery_subscriptions, get_battery());
     }
 }
 
@@ -756,30 +660,27 @@ void TelemetryImpl::process_heartbeat(const mavlink_message_t& message)
 
     set_armed(((heartbeat.base_mode & MAV_MODE_FLAG_SAFETY_ARMED) ? true : false));
 
-    if (_armed_subscription) {
-        auto callback = _armed_subscription;
-        auto arg = armed();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    // The flight mode itself is parsed in SystemImpl, we only note when it was updated.
+    _flight_mode_timestamp_us = now_us();
+
+    if (!_armed_subscriptions.empty()) {
+        notify(_armed_subscriptions, armed());
     }
 
-    if (_flight_mode_subscription) {
-        auto callback = _flight_mode_subscription;
+    if (!_flight_mode_subscriptions.empty()) {
         // The flight mode is already parsed in SystemImpl, so we can take it
         // from there.  This assumes that SystemImpl gets called first because
         // it's earlier in the callback list.
-        auto arg = telemetry_flight_mode_from_flight_mode(_parent->get_flight_mode());
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+        notify(
+            _flight_mode_subscriptions,
+            telemetry_flight_mode_from_flight_mode(_parent->get_flight_mode()));
     }
 
-    if (_health_subscription) {
-        auto callback = _health_subscription;
-        auto arg = get_health();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_health_subscriptions.empty()) {
+        notify(_health_subscriptions, get_health());
     }
-    if (_health_all_ok_subscription) {
-        auto callback = _health_all_ok_subscription;
-        auto arg = get_health_all_ok();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_health_all_ok_subscriptions.empty()) {
+        notify(_health_all_ok_subscriptions, get_health_all_ok());
     }
 }
 
@@ -815,8 +716,8 @@ void TelemetryImpl::process_statustext(const mavlink_message_t& message)
 
     set_status_text({type, text});
 
-    if (_status_text_subscription) {
-        _status_text_subscription(get_status_text());
+    if (!_status_text_subscriptions.empty()) {
+        notify(_status_text_subscriptions, get_status_text());
     }
 }
 
@@ -828,10 +729,8 @@ void TelemetryImpl::process_rc_channels(const mavlink_message_t& message)
     bool rc_ok = (rc_channels.chancount > 0);
     set_rc_status(rc_ok, rc_channels.rssi);
 
-    if (_rc_status_subscription) {
-        auto callback = _rc_status_subscription;
-        auto arg = get_rc_status();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_rc_status_subscriptions.empty()) {
+        notify(_rc_status_subscriptions, get_rc_status());
     }
 
     _parent->refresh_timeout_handler(_rc_channels_timeout_cookie);
@@ -844,10 +743,8 @@ void TelemetryImpl::process_unix_epoch_time(const mavlink_message_t& message)
 
     set_unix_epoch_time_us(utm_global_position.time);
 
-    if (_unix_epoch_time_subscription) {
-        auto callback = _unix_epoch_time_subscription;
-        auto arg = get_unix_epoch_time_us();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_unix_epoch_time_subscriptions.empty()) {
+        notify(_unix_epoch_time_subscriptions, get_unix_epoch_time_us());
     }
 
     _parent->refresh_timeout_handler(_unix_epoch_timeout_cookie);
@@ -863,10 +760,8 @@ void TelemetryImpl::process_actuator_control_target(const mavlink_message_t& mes
 
     set_actuator_control_target(group, controls);
 
-    if (_actuator_control_target_subscription) {
-        auto callback = _actuator_control_target_subscription;
-        auto arg = get_actuator_control_target();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_actuator_control_target_subscriptions.empty()) {
+        notify(_actuator_control_target_subscriptions, get_actuator_control_target());
     }
 }
 
@@ -880,10 +775,8 @@ void TelemetryImpl::process_actuator_output_status(const mavlink_message_t& mess
 
     set_actuator_output_status(active, actuators);
 
-    if (_actuator_output_status_subscription) {
-        auto callback = _actuator_output_status_subscription;
-        auto arg = get_actuator_output_status();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_actuator_output_status_subscriptions.empty()) {
+        notify(_actuator_output_status_subscriptions, get_actuator_output_status());
     }
 }
 
@@ -923,10 +816,8 @@ void TelemetryImpl::process_odometry(const mavlink_message_t& message)
 
     set_odometry(odometry);
 
-    if (_odometry_subscription) {
-        auto callback = _odometry_subscription;
-        auto arg = get_odometry();
-        _parent->call_user_callback([callback, arg]() { callback(arg); });
+    if (!_odometry_subscriptions.empty()) {
+        notify(_odometry_subscriptions, get_odometry());
     }
 }
 
@@ -1071,38 +962,35 @@ void TelemetryImpl::receive_unix_epoch_timeout()
 
 Telemetry::PositionVelocityNED TelemetryImpl::get_position_velocity_ned() const
 {
-    std::lock_guard<std::mutex> lock(_position_velocity_ned_mutex);
-    return _position_velocity_ned;
+    return _position_velocity_ned.get();
 }
 
 void TelemetryImpl::set_position_velocity_ned(Telemetry::PositionVelocityNED position_velocity_ned)
 {
-    std::lock_guard<std::mutex> lock(_position_velocity_ned_mutex);
-    _position_velocity_ned = position_velocity_ned;
+    _position_velocity_ned.set(position_velocity_ned);
 }
 
 Telemetry::Position TelemetryImpl::get_position() const
 {
-    std::lock_guard<std::mutex> lock(_position_mutex);
-    return _position;
+    return _position.get();
 }
 
 void TelemetryImpl::set_position(Telemetry::Position position)
 {
-    std::lock_guard<std::mutex> lock(_position_mutex);
-    _position = position;
+    const uint64_t timestamp_us = now_us();
+    _position.set(position);
+    _position_timestamp_us = timestamp_us;
+    _position_history.push(timestamp_us, position);
 }
 
 Telemetry::Position TelemetryImpl::get_home_position() const
 {
-    std::lock_guard<std::mutex> lock(_home_position_mutex);
-    return _home_position;
+    return _home_position.get();
 }
 
 void TelemetryImpl::set_home_position(Telemetry::Position home_position)
 {
-    std::lock_guard<std::mutex> lock(_home_position_mutex);
-    _home_position = home_position;
+    _home_position.set(home_position);
 }
 
 bool TelemetryImpl::armed() const
@@ -1139,128 +1027,115 @@ void TelemetryImpl::set_armed(bool armed_new)
 
 Telemetry::Quaternion TelemetryImpl::get_attitude_quaternion() const
 {
-    std::lock_guard<std::mutex> lock(_attitude_quaternion_mutex);
-    return _attitude_quaternion;
+    return _attitude_quaternion.get();
 }
 
 Telemetry::AngularVelocityBody TelemetryImpl::get_attitude_angular_velocity_body() const
 {
-    std::lock_guard<std::mutex> lock(_attitude_angular_velocity_body_mutex);
-    return _attitude_angular_velocity_body;
+    return _attitude_angular_velocity_body.get();
 }
 
 Telemetry::GroundTruth TelemetryImpl::get_ground_truth() const
 {
-    std::lock_guard<std::mutex> lock(_ground_truth_mutex);
-    return _ground_truth;
+    return _ground_truth.get();
 }
 
 Telemetry::FixedwingMetrics TelemetryImpl::get_fixedwing_metrics() const
 {
-    std::lock_guard<std::mutex> lock(_fixedwing_metrics_mutex);
-    return _fixedwing_metrics;
+    return _fixedwing_metrics.get();
 }
 
 Telemetry::EulerAngle TelemetryImpl::get_attitude_euler_angle() const
 {
-    std::lock_guard<std::mutex> lock(_attitude_quaternion_mutex);
-    Telemetry::EulerAngle euler = to_euler_angle_from_quaternion(_attitude_quaternion);
+    Telemetry::EulerAngle euler = to_euler_angle_from_quaternion(_attitude_quaternion.get());
 
     return euler;
 }
 
 void TelemetryImpl::set_attitude_quaternion(Telemetry::Quaternion quaternion)
 {
-    std::lock_guard<std::mutex> lock(_attitude_quaternion_mutex);
-    _attitude_quaternion = quaternion;
+    const uint64_t timestamp_us = now_us();
+    _attitude_quaternion.set(quaternion);
+    _attitude_timestamp_us = timestamp_us;
+    _attitude_history.push(timestamp_us, quaternion);
 }
 
 void TelemetryImpl::set_attitude_angular_velocity_body(
     Telemetry::AngularVelocityBody angular_velocity_body)
 {
-    std::lock_guard<std::mutex> lock(_attitude_quaternion_mutex);
-    _attitude_angular_velocity_body = angular_velocity_body;
+    _attitude_angular_velocity_body.set(angular_velocity_body);
+    _angular_velocity_timestamp_us = now_us();
 }
 
 void TelemetryImpl::set_ground_truth(Telemetry::GroundTruth ground_truth)
 {
-    std::lock_guard<std::mutex> lock(_ground_truth_mutex);
-    _ground_truth = ground_truth;
+    _ground_truth.set(ground_truth);
 }
 
 void TelemetryImpl::set_fixedwing_metrics(Telemetry::FixedwingMetrics fixedwing_metrics)
 {
-    std::lock_guard<std::mutex> lock(_fixedwing_metrics_mutex);
-    _fixedwing_metrics = fixedwing_metrics;
+    _fixedwing_metrics.set(fixedwing_metrics);
 }
 
 Telemetry::Quaternion TelemetryImpl::get_camera_attitude_quaternion() const
 {
-    std::lock_guard<std::mutex> lock(_camera_attitude_euler_angle_mutex);
-    Telemetry::Quaternion quaternion = to_quaternion_from_euler_angle(_camera_attitude_euler_angle);
+    Telemetry::Quaternion quaternion =
+        to_quaternion_from_euler_angle(_camera_attitude_euler_angle.get());
 
     return quaternion;
 }
 
 Telemetry::EulerAngle TelemetryImpl::get_camera_attitude_euler_angle() const
 {
-    std::lock_guard<std::mutex> lock(_camera_attitude_euler_angle_mutex);
-
-    return _camera_attitude_euler_angle;
+    return _camera_attitude_euler_angle.get();
 }
 
 void TelemetryImpl::set_camera_attitude_euler_angle(Telemetry::EulerAngle euler_angle)
 {
-    std::lock_guard<std::mutex> lock(_camera_attitude_euler_angle_mutex);
-    _camera_attitude_euler_angle = euler_angle;
+    _camera_attitude_euler_angle.set(euler_angle);
 }
 
 Telemetry::GroundSpeedNED TelemetryImpl::get_ground_speed_ned() const
 {
-    std::lock_guard<std::mutex> lock(_ground_speed_ned_mutex);
-    return _ground_speed_ned;
+    return _ground_speed_ned.get();
 }
 
 void TelemetryImpl::set_ground_speed_ned(Telemetry::GroundSpeedNED ground_speed_ned)
 {
-    std::lock_guard<std::mutex> lock(_ground_speed_ned_mutex);
-    _ground_speed_ned = ground_speed_ned;
+    _ground_speed_ned.set(ground_speed_ned);
+    _velocity_timestamp_us = now_us();
 }
 
 Telemetry::IMUReadingNED TelemetryImpl::get_imu_reading_ned() const
 {
-    std::lock_guard<std::mutex> lock(_imu_reading_ned_mutex);
-    return _imu_reading_ned;
+    return _imu_reading_ned.get();
 }
 
 void TelemetryImpl::set_imu_reading_ned(Telemetry::IMUReadingNED imu_reading_ned)
 {
-    std::lock_guard<std::mutex> lock(_imu_reading_ned_mutex);
-    _imu_reading_ned = imu_reading_ned;
+    _imu_reading_ned.set(imu_reading_ned);
+    _imu_reading_ned_history.push(now_us(), imu_reading_ned);
 }
 
 Telemetry::GPSInfo TelemetryImpl::get_gps_info() const
 {
-    std::lock_guard<std::mutex> lock(_gps_info_mutex);
-    return _gps_info;
+    return _gps_info.get();
 }
 
 void TelemetryImpl::set_gps_info(Telemetry::GPSInfo gps_info)
 {
-    std::lock_guard<std::mutex> lock(_gps_info_mutex);
-    _gps_info = gps_info;
+    _gps_info.set(gps_info);
 }
 
 Telemetry::Battery TelemetryImpl::get_battery() const
 {
-    std::lock_guard<std::mutex> lock(_battery_mutex);
-    return _battery;
+    return _battery.get();
 }
 
 void TelemetryImpl::set_battery(Telemetry::Battery battery)
 {
-    std::lock_guard<std::mutex> lock(_battery_mutex);
-    _battery = battery;
+    _battery.set(battery);
+    _battery_timestamp_us = now_us();
 }
 
 Telemetry::FlightMode TelemetryImpl::get_flight_mode() const
@@ -1270,16 +1145,15 @@ Telemetry::FlightMode TelemetryImpl::get_flight_mode() const
 
 Telemetry::Health TelemetryImpl::get_health() const
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    return _health;
+    return _health.get();
 }
 
 bool TelemetryImpl::get_health_all_ok() const
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    if (_health.gyrometer_calibration_ok && _health.accelerometer_calibration_ok &&
-        _health.magnetometer_calibration_ok && _health.level_calibration_ok &&
-        _health.local_position_ok && _health.global_position_ok && _health.home_position_ok) {
+    const Telemetry::Health health = _health.get();
+    if (health.gyrometer_calibration_ok && health.accelerometer_calibration_ok &&
+        health.magnetometer_calibration_ok && health.level_calibration_ok &&
+        health.local_position_ok && health.global_position_ok && health.home_position_ok) {
         return true;
     } else {
         return false;
@@ -1288,263 +1162,823 @@ bool TelemetryImpl::get_health_all_ok() const
 
 Telemetry::RCStatus TelemetryImpl::get_rc_status() const
 {
-    std::lock_guard<std::mutex> lock(_rc_status_mutex);
-    return _rc_status;
+    return _rc_status.get();
 }
 
 uint64_t TelemetryImpl::get_unix_epoch_time_us() const
 {
-    std::lock_guard<std::mutex> lock(_unix_epoch_time_mutex);
     return _unix_epoch_time_us;
 }
 
 Telemetry::ActuatorControlTarget TelemetryImpl::get_actuator_control_target() const
 {
-    std::lock_guard<std::mutex> lock(_actuator_control_target_mutex);
-    return _actuator_control_target;
+    return _actuator_control_target.get();
 }
 
 Telemetry::ActuatorOutputStatus TelemetryImpl::get_actuator_output_status() const
 {
-    std::lock_guard<std::mutex> lock(_actuator_output_status_mutex);
-    return _actuator_output_status;
+    return _actuator_output_status.get();
 }
 
 Telemetry::Odometry TelemetryImpl::get_odometry() const
 {
-    std::lock_guard<std::mutex> lock(_odometry_mutex);
-    return _odometry;
+    return _odometry.get();
 }
 
 void TelemetryImpl::set_health_local_position(bool ok)
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    _health.local_position_ok = ok;
+    _health.update([&](Telemetry::Health& health) { health.local_position_ok = ok; });
+    _health_timestamp_us = now_us();
 }
 
 void TelemetryImpl::set_health_global_position(bool ok)
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    _health.global_position_ok = ok;
+    _health.update([&](Telemetry::Health& health) { health.global_position_ok = ok; });
+    _health_timestamp_us = now_us();
 }
 
 void TelemetryImpl::set_health_home_position(bool ok)
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    _health.home_position_ok = ok;
+    _health.update([&](Telemetry::Health& health) { health.home_position_ok = ok; });
+    _health_timestamp_us = now_us();
 }
 
 void TelemetryImpl::set_health_gyrometer_calibration(bool ok)
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    _health.gyrometer_calibration_ok = (ok || _hitl_enabled);
+    _health.update([&](Telemetry::Health& health) {
+        health.gyrometer_calibration_ok = (ok || _hitl_enabled);
+    });
+    _health_timestamp_us = now_us();
 }
 
 void TelemetryImpl::set_health_accelerometer_calibration(bool ok)
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    _health.accelerometer_calibration_ok = (ok || _hitl_enabled);
+    _health.update([&](Telemetry::Health& health) {
+        health.accelerometer_calibration_ok = (ok || _hitl_enabled);
+    });
+    _health_timestamp_us = now_us();
 }
 
 void TelemetryImpl::set_health_magnetometer_calibration(bool ok)
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    _health.magnetometer_calibration_ok = (ok || _hitl_enabled);
+    _health.update([&](Telemetry::Health& health) {
+        health.magnetometer_calibration_ok = (ok || _hitl_enabled);
+    });
+    _health_timestamp_us = now_us();
 }
 
 void TelemetryImpl::set_health_level_calibration(bool ok)
 {
-    std::lock_guard<std::mutex> lock(_health_mutex);
-    _health.level_calibration_ok = (ok || _hitl_enabled);
+    _health.update([&](Telemetry::Health& health) {
+        health.level_calibration_ok = (ok || _hitl_enabled);
+    });
+    _health_timestamp_us = now_us();
 }
 
 Telemetry::LandedState TelemetryImpl::get_landed_state() const
 {
-    std::lock_guard<std::mutex> lock(_landed_state_mutex);
-    return _landed_state;
+    return _landed_state.get();
 }
 
 void TelemetryImpl::set_landed_state(Telemetry::LandedState landed_state)
 {
-    std::lock_guard<std::mutex> lock(_landed_state_mutex);
-    _landed_state = landed_state;
+    _landed_state.set(landed_state);
 }
 
 void TelemetryImpl::set_rc_status(bool available, float signal_strength_percent)
 {
-    std::lock_guard<std::mutex> lock(_rc_status_mutex);
-
-    if (available) {
-        _rc_status.available_once = true;
-        _rc_status.signal_strength_percent = signal_strength_percent;
-    } else {
-        _rc_status.signal_strength_percent = 0.0f;
-    }
+    _rc_status.update([&](Telemetry::RCStatus& rc_status) {
+        if (available) {
+            rc_status.available_once = true;
+            rc_status.signal_strength_percent = signal_strength_percent;
+        } else {
+            rc_status.signal_strength_percent = 0.0f;
+        }
 
-    _rc_status.available = available;
+        rc_status.available = available;
+    });
 }
 
 void TelemetryImpl::set_unix_epoch_time_us(uint64_t time_us)
 {
-    std::lock_guard<std::mutex> lock(_unix_epoch_time_mutex);
     _unix_epoch_time_us = time_us;
 }
 
 void TelemetryImpl::set_actuator_control_target(uint8_t group, const std::array<float, 8>& controls)
 {
-    std::lock_guard<std::mutex> lock(_actuator_control_target_mutex);
-    _actuator_control_target.group = group;
-    std::copy(controls.begin(), controls.end(), _actuator_control_target.controls);
+    Telemetry::ActuatorControlTarget actuator_control_target{};
+    actuator_control_target.group = group;
+    std::copy(controls.begin(), controls.end(), actuator_control_target.controls);
+    _actuator_control_target.set(actuator_control_target);
 }
 
 void TelemetryImpl::set_actuator_output_status(
     uint32_t active, const std::array<float, 32>& actuators)
 {
-    std::lock_guard<std::mutex> lock(_actuator_output_status_mutex);
-    _actuator_output_status.active = active;
-    std::copy(actuators.begin(), actuators.end(), _actuator_output_status.actuator);
+    Telemetry::ActuatorOutputStatus actuator_output_status{};
+    actuator_output_status.active = active;
+    std::copy(actuators.begin(), actuators.end(), actuator_output_status.actuator);
+    _actuator_output_status.set(actuator_output_status);
 }
 
 void TelemetryImpl::set_odometry(Telemetry::Odometry& odometry)
 {
-    std::lock_guard<std::mutex> lock(_actuator_output_status_mutex);
-    _odometry = odometry;
+    _odometry.set(odometry);
 }
 
 void TelemetryImpl::position_velocity_ned_async(
     Telemetry::position_velocity_ned_callback_t& callback)
 {
-    _position_velocity_ned_subscription = callback;
+    _position_velocity_ned_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_LOCAL_POSITION_NED);
+}
+
+uint64_t TelemetryImpl::subscribe_position_velocity_ned(
+    const Telemetry::position_velocity_ned_callback_t& callback)
+{
+    const uint64_t handle = _position_velocity_ned_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_LOCAL_POSITION_NED);
+    return handle;
 }
 
 void TelemetryImpl::position_async(Telemetry::position_callback_t& callback)
 {
-    _position_subscription = callback;
+    _position_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_GLOBAL_POSITION_INT);
+}
+
+uint64_t TelemetryImpl::subscribe_position(const Telemetry::position_callback_t& callback)
+{
+    const uint64_t handle = _position_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_GLOBAL_POSITION_INT);
+    return handle;
 }
 
 void TelemetryImpl::home_position_async(Telemetry::position_callback_t& callback)
 {
-    _home_position_subscription = callback;
+    _home_position_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_HOME_POSITION);
+}
+
+uint64_t TelemetryImpl::subscribe_home_position(const Telemetry::position_callback_t& callback)
+{
+    const uint64_t handle = _home_position_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_HOME_POSITION);
+    return handle;
 }
 
 void TelemetryImpl::in_air_async(Telemetry::in_air_callback_t& callback)
 {
-    _in_air_subscription = callback;
+    _in_air_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_EXTENDED_SYS_STATE);
+}
+
+uint64_t TelemetryImpl::subscribe_in_air(const Telemetry::in_air_callback_t& callback)
+{
+    const uint64_t handle = _in_air_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_EXTENDED_SYS_STATE);
+    return handle;
 }
 
 void TelemetryImpl::status_text_async(Telemetry::status_text_callback_t& callback)
 {
-    _status_text_subscription = callback;
+    _status_text_subscriptions.set_single(callback);
+}
+
+uint64_t TelemetryImpl::subscribe_status_text(const Telemetry::status_text_callback_t& callback)
+{
+    return _status_text_subscriptions.subscribe(callback);
 }
 
 void TelemetryImpl::armed_async(Telemetry::armed_callback_t& callback)
 {
-    _armed_subscription = callback;
+    _armed_subscriptions.set_single(callback);
+}
+
+uint64_t TelemetryImpl::subscribe_armed(const Telemetry::armed_callback_t& callback)
+{
+    return _armed_subscriptions.subscribe(callback);
 }
 
 void TelemetryImpl::attitude_quaternion_async(Telemetry::attitude_quaternion_callback_t& callback)
 {
-    _attitude_quaternion_subscription = callback;
+    _attitude_quaternion_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+}
+
+uint64_t TelemetryImpl::subscribe_attitude_quaternion(
+    const Telemetry::attitude_quaternion_callback_t& callback)
+{
+    const uint64_t handle = _attitude_quaternion_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+    return handle;
 }
 
 void TelemetryImpl::attitude_euler_angle_async(Telemetry::attitude_euler_angle_callback_t& callback)
 {
-    _attitude_euler_angle_subscription = callback;
+    _attitude_euler_angle_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+}
+
+uint64_t TelemetryImpl::subscribe_attitude_euler_angle(
+    const Telemetry::attitude_euler_angle_callback_t& callback)
+{
+    const uint64_t handle = _attitude_euler_angle_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+    return handle;
 }
 
 void TelemetryImpl::attitude_angular_velocity_body_async(
     Telemetry::attitude_angular_velocity_body_callback_t& callback)
 {
-    _attitude_angular_velocity_body_subscription = callback;
+    _attitude_angular_velocity_body_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+}
+
+uint64_t TelemetryImpl::subscribe_attitude_angular_velocity_body(
+    const Telemetry::attitude_angular_velocity_body_callback_t& callback)
+{
+    const uint64_t handle = _attitude_angular_velocity_body_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+    return handle;
 }
 
 void TelemetryImpl::fixedwing_metrics_async(Telemetry::fixedwing_metrics_callback_t& callback)
 {
-    _fixedwing_metrics_subscription = callback;
+    _fixedwing_metrics_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_VFR_HUD);
+}
+
+uint64_t
+TelemetryImpl::subscribe_fixedwing_metrics(const Telemetry::fixedwing_metrics_callback_t& callback)
+{
+    const uint64_t handle = _fixedwing_metrics_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_VFR_HUD);
+    return handle;
 }
 
 void TelemetryImpl::ground_truth_async(Telemetry::ground_truth_callback_t& callback)
 {
-    _ground_truth_subscription = callback;
+    _ground_truth_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_HIL_STATE_QUATERNION);
+}
+
+uint64_t TelemetryImpl::subscribe_ground_truth(const Telemetry::ground_truth_callback_t& callback)
+{
+    const uint64_t handle = _ground_truth_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_HIL_STATE_QUATERNION);
+    return handle;
 }
 
 void TelemetryImpl::camera_attitude_quaternion_async(
     Telemetry::attitude_quaternion_callback_t& callback)
 {
-    _camera_attitude_quaternion_subscription = callback;
+    _camera_attitude_quaternion_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_MOUNT_ORIENTATION);
+}
+
+uint64_t TelemetryImpl::subscribe_camera_attitude_quaternion(
+    const Telemetry::attitude_quaternion_callback_t& callback)
+{
+    const uint64_t handle = _camera_attitude_quaternion_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_MOUNT_ORIENTATION);
+    return handle;
 }
 
 void TelemetryImpl::camera_attitude_euler_angle_async(
     Telemetry::attitude_euler_angle_callback_t& callback)
 {
-    _camera_attitude_euler_angle_subscription = callback;
+    _camera_attitude_euler_angle_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_MOUNT_ORIENTATION);
+}
+
+uint64_t TelemetryImpl::subscribe_camera_attitude_euler_angle(
+    const Telemetry::attitude_euler_angle_callback_t& callback)
+{
+    const uint64_t handle = _camera_attitude_euler_angle_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_MOUNT_ORIENTATION);
+    return handle;
 }
 
 void TelemetryImpl::ground_speed_ned_async(Telemetry::ground_speed_ned_callback_t& callback)
 {
-    _ground_speed_ned_subscription = callback;
+    _ground_speed_ned_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_GLOBAL_POSITION_INT);
+}
+
+uint64_t
+TelemetryImpl::subscribe_ground_speed_ned(const Telemetry::ground_speed_ned_callback_t& callback)
+{
+    const uint64_t handle = _ground_speed_ned_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_GLOBAL_POSITION_INT);
+    return handle;
 }
 
 void TelemetryImpl::imu_reading_ned_async(Telemetry::imu_reading_ned_callback_t& callback)
 {
-    _imu_reading_ned_subscription = callback;
+    _imu_reading_ned_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_HIGHRES_IMU);
+}
+
+uint64_t
+TelemetryImpl::subscribe_imu_reading_ned(const Telemetry::imu_reading_ned_callback_t& callback)
+{
+    const uint64_t handle = _imu_reading_ned_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_HIGHRES_IMU);
+    return handle;
 }
 
 void TelemetryImpl::gps_info_async(Telemetry::gps_info_callback_t& callback)
 {
-    _gps_info_subscription = callback;
+    _gps_info_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_GPS_RAW_INT);
+}
+
+uint64_t TelemetryImpl::subscribe_gps_info(const Telemetry::gps_info_callback_t& callback)
+{
+    const uint64_t handle = _gps_info_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_GPS_RAW_INT);
+    return handle;
 }
 
 void TelemetryImpl::battery_async(Telemetry::battery_callback_t& callback)
 {
-    _battery_subscription = callback;
+    _battery_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_SYS_STATUS);
+}
+
+uint64_t TelemetryImpl::subscribe_battery(const Telemetry::battery_callback_t& callback)
+{
+    const uint64_t handle = _battery_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_SYS_STATUS);
+    return handle;
 }
 
 void TelemetryImpl::flight_mode_async(Telemetry::flight_mode_callback_t& callback)
 {
-    _flight_mode_subscription = callback;
+    _flight_mode_subscriptions.set_single(callback);
+}
+
+uint64_t TelemetryImpl::subscribe_flight_mode(const Telemetry::flight_mode_callback_t& callback)
+{
+    return _flight_mode_subscriptions.subscribe(callback);
 }
 
 void TelemetryImpl::health_async(Telemetry::health_callback_t& callback)
 {
-    _health_subscription = callback;
+    _health_subscriptions.set_single(callback);
+}
+
+uint64_t TelemetryImpl::subscribe_health(const Telemetry::health_callback_t& callback)
+{
+    return _health_subscriptions.subscribe(callback);
 }
 
 void TelemetryImpl::health_all_ok_async(Telemetry::health_all_ok_callback_t& callback)
 {
-    _health_all_ok_subscription = callback;
+    _health_all_ok_subscriptions.set_single(callback);
+}
+
+uint64_t TelemetryImpl::subscribe_health_all_ok(const Telemetry::health_all_ok_callback_t& callback)
+{
+    return _health_all_ok_subscriptions.subscribe(callback);
 }
 
 void TelemetryImpl::landed_state_async(Telemetry::landed_state_callback_t& callback)
 {
-    _landed_state_subscription = callback;
+    _landed_state_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_EXTENDED_SYS_STATE);
+}
+
+uint64_t TelemetryImpl::subscribe_landed_state(const Telemetry::landed_state_callback_t& callback)
+{
+    const uint64_t handle = _landed_state_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_EXTENDED_SYS_STATE);
+    return handle;
 }
 
 void TelemetryImpl::rc_status_async(Telemetry::rc_status_callback_t& callback)
 {
-    _rc_status_subscription = callback;
+    _rc_status_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_RC_CHANNELS);
+}
+
+uint64_t TelemetryImpl::subscribe_rc_status(const Telemetry::rc_status_callback_t& callback)
+{
+    const uint64_t handle = _rc_status_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_RC_CHANNELS);
+    return handle;
 }
 
 void TelemetryImpl::unix_epoch_time_async(Telemetry::unix_epoch_time_callback_t& callback)
 {
-    _unix_epoch_time_subscription = callback;
+    _unix_epoch_time_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_UTM_GLOBAL_POSITION);
+}
+
+uint64_t
+TelemetryImpl::subscribe_unix_epoch_time(const Telemetry::unix_epoch_time_callback_t& callback)
+{
+    const uint64_t handle = _unix_epoch_time_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_UTM_GLOBAL_POSITION);
+    return handle;
 }
 
 void TelemetryImpl::actuator_control_target_async(
     Telemetry::actuator_control_target_callback_t& callback)
 {
-    _actuator_control_target_subscription = callback;
+    _actuator_control_target_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET);
+}
+
+uint64_t TelemetryImpl::subscribe_actuator_control_target(
+    const Telemetry::actuator_control_target_callback_t& callback)
+{
+    const uint64_t handle = _actuator_control_target_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET);
+    return handle;
 }
 
 void TelemetryImpl::actuator_output_status_async(
     Telemetry::actuator_output_status_callback_t& callback)
 {
-    _actuator_output_status_subscription = callback;
+    _actuator_output_status_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS);
+}
+
+uint64_t TelemetryImpl::subscribe_actuator_output_status(
+    const Telemetry::actuator_output_status_callback_t& callback)
+{
+    const uint64_t handle = _actuator_output_status_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS);
+    return handle;
 }
 
 void TelemetryImpl::odometry_async(Telemetry::odometry_callback_t& callback)
 {
-    _odometry_subscription = callback;
+    _odometry_subscriptions.set_single(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ODOMETRY);
+}
+
+uint64_t TelemetryImpl::subscribe_odometry(const Telemetry::odometry_callback_t& callback)
+{
+    const uint64_t handle = _odometry_subscriptions.subscribe(callback);
+    update_msg_rate_request(MAVLINK_MSG_ID_ODOMETRY);
+    return handle;
+}
+
+void TelemetryImpl::set_turn_off_unused_streams(bool turn_off_unused)
+{
+    _parent->set_turn_off_unused_msg_rates(turn_off_unused);
+}
+
+void TelemetryImpl::unsubscribe(uint64_t handle)
+{
+    if (unsubscribe_snapshot(handle)) {
+        return;
+    }
+
+    if (_position_velocity_ned_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_LOCAL_POSITION_NED);
+    } else if (_position_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_GLOBAL_POSITION_INT);
+    } else if (_home_position_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_HOME_POSITION);
+    } else if (_in_air_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_EXTENDED_SYS_STATE);
+    } else if (_attitude_quaternion_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+    } else if (_attitude_euler_angle_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+    } else if (_attitude_angular_velocity_body_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_ATTITUDE_QUATERNION);
+    } else if (_fixedwing_metrics_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_VFR_HUD);
+    } else if (_ground_truth_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_HIL_STATE_QUATERNION);
+    } else if (_camera_attitude_quaternion_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_MOUNT_ORIENTATION);
+    } else if (_camera_attitude_euler_angle_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_MOUNT_ORIENTATION);
+    } else if (_ground_speed_ned_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_GLOBAL_POSITION_INT);
+    } else if (_imu_reading_ned_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_HIGHRES_IMU);
+    } else if (_gps_info_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_GPS_RAW_INT);
+    } else if (_battery_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_SYS_STATUS);
+    } else if (_landed_state_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_EXTENDED_SYS_STATE);
+    } else if (_actuator_control_target_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET);
+    } else if (_actuator_output_status_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS);
+    } else if (_odometry_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_ODOMETRY);
+    } else if (_rc_status_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_RC_CHANNELS);
+    } else if (_unix_epoch_time_subscriptions.unsubscribe(handle)) {
+        update_msg_rate_request(MAVLINK_MSG_ID_UTM_GLOBAL_POSITION);
+    } else {
+        // These don't depend on a message rate we request.
+        _status_text_subscriptions.unsubscribe(handle);
+        _armed_subscriptions.unsubscribe(handle);
+        _flight_mode_subscriptions.unsubscribe(handle);
+        _health_subscriptions.unsubscribe(handle);
+        _health_all_ok_subscriptions.unsubscribe(handle);
+    }
+}
+
+Telemetry::Result TelemetryImpl::request_msg_rate(uint16_t message_id, double rate_hz)
+{
+    auto prom = std::promise<Telemetry::Result>();
+    auto fut = prom.get_future();
+
+    request_msg_rate_async(
+        message_id, rate_hz, [&prom](Telemetry::Result result) { prom.set_value(result); });
+
+    return fut.get();
+}
+
+void TelemetryImpl::request_msg_rate_async(
+    uint16_t message_id, double rate_hz, const Telemetry::result_callback_t& callback)
+{
+    {
+        std::lock_guard<std::mutex> lock(_msg_rates_mutex);
+        _msg_rates_hz[message_id] = rate_hz;
+    }
+
+    // Rates are only sent while connected, so the result would not arrive before the
+    // vehicle shows up. The rate is still kept and set once it is connected.
+    if (!_parent->is_connected()) {
+        update_msg_rate_request(message_id);
+        if (callback) {
+            _parent->call_user_callback([callback]() { callback(Telemetry::Result::NO_SYSTEM); });
+        }
+        return;
+    }
+
+    // The rate is only requested from the rate manager, which sets the maximum of what
+    // everyone needs, so we can't lower the rate for somebody else.
+    update_msg_rate_request(message_id, [callback](MAVLinkCommands::Result result) {
+        if (callback) {
+            command_result_callback(result, callback);
+        }
+    });
+}
+
+void TelemetryImpl::update_msg_rate_request(
+    uint16_t message_id, const MessageRateManager::result_callback_t& callback)
+{
+    bool rate_set = false;
+    double rate_hz = 0.0;
+    {
+        std::lock_guard<std::mutex> lock(_msg_rates_mutex);
+        auto it = _msg_rates_hz.find(message_id);
+        if (it != _msg_rates_hz.end()) {
+            rate_set = true;
+            rate_hz = it->second;
+        }
+    }
+
+    // A rate set explicitly counts as a request as well, the values might be
+    // polled using the getters. It also overrides the default rate for our own
+    // subscriptions, e.g. -1 to turn the message off unless somebody else needs it.
+    if (rate_set) {
+        _parent->register_msg_rate_request(message_id, rate_hz, this, callback);
+    } else if (has_subscription_for(message_id)) {
+        _parent->register_msg_rate_request(message_id, 0.0, this, callback);
+    } else {
+        _parent->unregister_msg_rate_request(message_id, this, callback);
+    }
+}
+
+bool TelemetryImpl::has_subscription_for(uint16_t message_id) const
+{
+    switch (message_id) {
+        case MAVLINK_MSG_ID_LOCAL_POSITION_NED:
+            return !_position_velocity_ned_subscriptions.empty();
+        case MAVLINK_MSG_ID_GLOBAL_POSITION_INT:
+            return !_position_subscriptions.empty() || !_ground_speed_ned_subscriptions.empty();
+        case MAVLINK_MSG_ID_HOME_POSITION:
+            return !_home_position_subscriptions.empty();
+        case MAVLINK_MSG_ID_EXTENDED_SYS_STATE:
+            return !_in_air_subscriptions.empty() || !_landed_state_subscriptions.empty();
+        case MAVLINK_MSG_ID_ATTITUDE_QUATERNION:
+            return !_attitude_quaternion_subscriptions.empty() ||
+                   !_attitude_euler_angle_subscriptions.empty() ||
+                   !_attitude_angular_velocity_body_subscriptions.empty();
+        case MAVLINK_MSG_ID_MOUNT_ORIENTATION:
+            return !_camera_attitude_quaternion_subscriptions.empty() ||
+                   !_camera_attitude_euler_angle_subscriptions.empty();
+        case MAVLINK_MSG_ID_VFR_HUD:
+            return !_fixedwing_metrics_subscriptions.empty();
+        case MAVLINK_MSG_ID_HIL_STATE_QUATERNION:
+            return !_ground_truth_subscriptions.empty();
+        case MAVLINK_MSG_ID_HIGHRES_IMU:
+            return !_imu_reading_ned_subscriptions.empty();
+        case MAVLINK_MSG_ID_GPS_RAW_INT:
+            return !_gps_info_subscriptions.empty();
+        case MAVLINK_MSG_ID_SYS_STATUS:
+            return !_battery_subscriptions.empty();
+        case MAVLINK_MSG_ID_RC_CHANNELS:
+            return !_rc_status_subscriptions.empty();
+        case MAVLINK_MSG_ID_UTM_GLOBAL_POSITION:
+            return !_unix_epoch_time_subscriptions.empty();
+        case MAVLINK_MSG_ID_ACTUATOR_CONTROL_TARGET:
+            return !_actuator_control_target_subscriptions.empty();
+        case MAVLINK_MSG_ID_ACTUATOR_OUTPUT_STATUS:
+            return !_actuator_output_status_subscriptions.empty();
+        case MAVLINK_MSG_ID_ODOMETRY:
+            return !_odometry_subscriptions.empty();
+        default:
+            return false;
+    }
+}
+
+Telemetry::Snapshot TelemetryImpl::snapshot(Telemetry::SnapshotField fields)
+{
+    Telemetry::Snapshot snapshot{};
+    snapshot.timestamp_us = now_us();
+    snapshot.fields = fields & Telemetry::SnapshotField::ALL;
+
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::POSITION)) {
+        snapshot.position = get_position();
+        snapshot.position_timestamp_us = _position_timestamp_us;
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::HOME_POSITION)) {
+        snapshot.home_position = get_home_position();
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::IN_AIR)) {
+        snapshot.in_air = in_air();
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::ARMED)) {
+        snapshot.armed = armed();
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::LANDED_STATE)) {
+        snapshot.landed_state = get_landed_state();
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::FLIGHT_MODE)) {
+        snapshot.flight_mode = get_flight_mode();
+        snapshot.flight_mode_timestamp_us = _flight_mode_timestamp_us;
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::ATTITUDE_EULER_ANGLE)) {
+        snapshot.attitude_euler_angle = get_attitude_euler_angle();
+        snapshot.attitude_timestamp_us = _attitude_timestamp_us;
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::GROUND_SPEED_NED)) {
+        snapshot.ground_speed_ned = get_ground_speed_ned();
+        snapshot.ground_speed_ned_timestamp_us = _velocity_timestamp_us;
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::GPS_INFO)) {
+        snapshot.gps_info = get_gps_info();
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::BATTERY)) {
+        snapshot.battery = get_battery();
+        snapshot.battery_timestamp_us = _battery_timestamp_us;
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::HEALTH)) {
+        snapshot.health = get_health();
+        snapshot.health_timestamp_us = _health_timestamp_us;
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::RC_STATUS)) {
+        snapshot.rc_status = get_rc_status();
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::STATUS_TEXT)) {
+        snapshot.status_text = get_status_text();
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::ATTITUDE_QUATERNION)) {
+        snapshot.attitude_quaternion = get_attitude_quaternion();
+        snapshot.attitude_timestamp_us = _attitude_timestamp_us;
+    }
+    if (has_snapshot_field(fields, Telemetry::SnapshotField::ATTITUDE_ANGULAR_VELOCITY_BODY)) {
+        snapshot.attitude_angular_velocity_body = get_attitude_angular_velocity_body();
+        snapshot.attitude_angular_velocity_body_timestamp_us = _angular_velocity_timestamp_us;
+    }
+
+    return snapshot;
+}
+
+uint64_t TelemetryImpl::subscribe_snapshot(
+    Telemetry::SnapshotField fields,
+    double rate_hz,
+    const Telemetry::snapshot_callback_t& callback)
+{
+    if (!callback || rate_hz <= 0.0) {
+        return 0;
+    }
+
+    const uint64_t handle = next_subscription_handle();
+
+    std::lock_guard<std::mutex> lock(_snapshot_mutex);
+    auto& subscription = _snapshot_subscriptions[handle];
+    subscription = SnapshotSubscription{fields, callback, nullptr};
+    _parent->add_call_every(
+        std::bind(&TelemetryImpl::send_snapshot, this, handle),
+        static_cast<float>(1.0 / rate_hz),
+        &subscription.call_every_cookie);
+
+    return handle;
+}
+
+bool TelemetryImpl::unsubscribe_snapshot(uint64_t handle)
+{
+    std::lock_guard<std::mutex> lock(_snapshot_mutex);
+
+    auto it = _snapshot_subscriptions.find(handle);
+    if (it == _snapshot_subscriptions.end()) {
+        return false;
+    }
+
+    _parent->remove_call_every(it->second.call_every_cookie);
+    _snapshot_subscriptions.erase(it);
+    return true;
+}
+
+void TelemetryImpl::send_snapshot(uint64_t handle)
+{
+    // This is called from the system thread, so the snapshot is assembled there and only
+    // the callback runs on the user thread, once per tick.
+    Telemetry::SnapshotField fields = Telemetry::SnapshotField::NONE;
+    Telemetry::snapshot_callback_t callback;
+    {
+        std::lock_guard<std::mutex> lock(_snapshot_mutex);
+        auto it = _snapshot_subscriptions.find(handle);
+        if (it == _snapshot_subscriptions.end()) {
+            return;
+        }
+        fields = it->second.fields;
+        callback = it->second.callback;
+    }
+
+    const auto sample = snapshot(fields);
+    _parent->call_user_callback([callback, sample]() { callback(sample); });
+}
+
+Telemetry::Result TelemetryImpl::set_history_depth(Telemetry::HistoryStream stream, unsigned depth)
+{
+    switch (stream) {
+        case Telemetry::HistoryStream::POSITION:
+            _position_history.set_depth(depth);
+            return Telemetry::Result::SUCCESS;
+        case Telemetry::HistoryStream::ATTITUDE:
+            _attitude_history.set_depth(depth);
+            return Telemetry::Result::SUCCESS;
+        case Telemetry::HistoryStream::IMU_READING_NED:
+            _imu_reading_ned_history.set_depth(depth);
+            return Telemetry::Result::SUCCESS;
+        default:
+            return Telemetry::Result::UNKNOWN;
+    }
+}
+
+size_t TelemetryImpl::position_history(
+    uint64_t start_us, uint64_t end_us, const Telemetry::position_history_visitor_t& visitor) const
+{
+    return _position_history.for_range(
+        start_us,
+        end_us,
+        [&visitor](const uint64_t* timestamps_us, const Telemetry::Position* values, size_t size) {
+            visitor(Telemetry::HistorySpan<Telemetry::Position>{timestamps_us, values, size});
+        });
+}
+
+size_t TelemetryImpl::attitude_history(
+    uint64_t start_us, uint64_t end_us, const Telemetry::attitude_history_visitor_t& visitor) const
+{
+    return _attitude_history.for_range(
+        start_us,
+        end_us,
+        [&visitor](
+            const uint64_t* timestamps_us, const Telemetry::Quaternion* values, size_t size) {
+            Telemetry::AttitudeHistorySpan span{};
+            span.timestamps_us = timestamps_us;
+            span.values = values;
+            span.size = size;
+            visitor(span);
+        });
+}
+
+size_t TelemetryImpl::imu_reading_ned_history(
+    uint64_t start_us,
+    uint64_t end_us,
+    const Telemetry::imu_reading_ned_history_visitor_t& visitor) const
+{
+    return _imu_reading_ned_history.for_range(
+        start_us,
+        end_us,
+        [&visitor](
+            const uint64_t* timestamps_us, const Telemetry::IMUReadingNED* values, size_t size) {
+            visitor(Telemetry::HistorySpan<Telemetry::IMUReadingNED>{timestamps_us, values, size});
+        });
+}
+
+uint64_t TelemetryImpl::now_us()
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                     _parent->get_time().steady_time().time_since_epoch())
+                                     .count());
 }
 
 void TelemetryImpl::process_parameter_update(const std::string& name)
@@ -1,11 +1,15 @@
 #pragma once
 
 #include <atomic>
+#include <map>
 #include <mutex>
 
 #include "plugins/telemetry/telemetry.h"
 #include "mavlink_include.h"
 #include "plugin_impl_base.h"
+#include "seqlock_data.h"
+#include "subscription_list.h"
+#include "time_series_buffer.h"
 #include "system.h"
 
 // Since not all vehicles support/require level calibration, this
@@ -120,6 +124,63 @@ public:
     void actuator_output_status_async(Telemetry::actuator_output_status_callback_t& callback);
     void odometry_async(Telemetry::odometry_callback_t& callback);
 
+    uint64_t
+    subscribe_position_velocity_ned(const Telemetry::position_velocity_ned_callback_t& callback);
+    uint64_t subscribe_position(const Telemetry::position_callback_t& callback);
+    uint64_t subscribe_home_position(const Telemetry::position_callback_t& callback);
+    uint64_t subscribe_in_air(const Telemetry::in_air_callback_t& callback);
+    uint64_t subscribe_status_text(const Telemetry::status_text_callback_t& callback);
+    uint64_t subscribe_armed(const Telemetry::armed_callback_t& callback);
+    uint64_t
+    subscribe_attitude_quaternion(const Telemetry::attitude_quaternion_callback_t& callback);
+    uint64_t
+    subscribe_attitude_euler_angle(const Telemetry::attitude_euler_angle_callback_t& callback);
+    uint64_t subscribe_attitude_angular_velocity_body(
+        const Telemetry::attitude_angular_velocity_body_callback_t& callback);
+    uint64_t subscribe_fixedwing_metrics(const Telemetry::fixedwing_metrics_callback_t& callback);
+    uint64_t subscribe_ground_truth(const Telemetry::ground_truth_callback_t& callback);
+    uint64_t
+    subscribe_camera_attitude_quaternion(const Telemetry::attitude_quaternion_callback_t& callback);
+    uint64_t subscribe_camera_attitude_euler_angle(
+        const Telemetry::attitude_euler_angle_callback_t& callback);
+    uint64_t subscribe_ground_speed_ned(const Telemetry::ground_speed_ned_callback_t& callback);
+    uint64_t subscribe_imu_reading_ned(const Telemetry::imu_reading_ned_callback_t& callback);
+    uint64_t subscribe_gps_info(const Telemetry::gps_info_callback_t& callback);
+    uint64_t subscribe_battery(const Telemetry::battery_callback_t& callback);
+    uint64_t subscribe_flight_mode(const Telemetry::flight_mode_callback_t& callback);
+    uint64_t subscribe_health(const Telemetry::health_callback_t& callback);
+    uint64_t subscribe_health_all_ok(const Telemetry::health_all_ok_callback_t& callback);
+    uint64_t subscribe_landed_state(const Telemetry::landed_state_callback_t& callback);
+    uint64_t subscribe_actuator_control_target(
+        const Telemetry::actuator_control_target_callback_t& callback);
+    uint64_t
+    subscribe_actuator_output_status(const Telemetry::actuator_output_status_callback_t& callback);
+    uint64_t subscribe_odometry(const Telemetry::odometry_callback_t& callback);
+    uint64_t subscribe_rc_status(const Telemetry::rc_status_callback_t& callback);
+    uint64_t subscribe_unix_epoch_time(const Telemetry::unix_epoch_time_callback_t& callback);
+    void unsubscribe(uint64_t handle);
+
+    Telemetry::Snapshot snapshot(Telemetry::SnapshotField fields);
+    uint64_t subscribe_snapshot(
+        Telemetry::SnapshotField fields,
+        double rate_hz,
+        const Telemetry::snapshot_callback_t& callback);
+    void set_turn_off_unused_streams(bool turn_off_unused);
+
+    Telemetry::Result set_history_depth(Telemetry::HistoryStream stream, unsigned depth);
+    size_t position_history(
+        uint64_t start_us,
+        uint64_t end_us,
+        const Telemetry::position_history_visitor_t& visitor) const;
+    size_t attitude_history(
+        uint64_t start_us,
+        uint64_t end_us,
+        const Telemetry::attitude_history_visitor_t& visitor) const;
+    size_t imu_reading_ned_history(
+        uint64_t start_us,
+        uint64_t end_us,
+        const Telemetry::imu_reading_ned_history_visitor_t& visitor) const;
+
     TelemetryImpl(const TelemetryImpl&) = delete;
     TelemetryImpl& operator=(const TelemetryImpl&) = delete;
 
@@ -186,6 +247,25 @@ private:
     void receive_gps_raw_timeout();
     void receive_unix_epoch_timeout();
 
+    void send_snapshot(uint64_t handle);
+    bool unsubscribe_snapshot(uint64_t handle);
+
+    template<class T> void notify(const SubscriptionList<T>& subscriptions, const T& value)
+    {
+        auto notification = subscriptions.notification(value);
+        if (notification) {
+            _parent->call_user_callback(notification);
+        }
+    }
+
+    Telemetry::Result request_msg_rate(uint16_t message_id, double rate_hz);
+    void request_msg_rate_async(
+        uint16_t message_id, double rate_hz, const Telemetry::result_callback_t& callback);
+    void update_msg_rate_request(
+        uint16_t message_id, const MessageRateManager::result_callback_t& callback = nullptr);
+    bool has_subscription_for(uint16_t message_id) const;
+    uint64_t now_us();
+
     static Telemetry::Result
     telemetry_result_from_command_result(MAVLinkCommands::Result command_result);
 
@@ -197,109 +277,119 @@ private:
     static Telemetry::FlightMode
     telemetry_flight_mode_from_flight_mode(SystemImpl::FlightMode flight_mode);
 
-    // Make all fields thread-safe using mutexs
-    // The mutexs are mutable so that the lock can get aqcuired in
-    // methods marked const.
-    mutable std::mutex _position_mutex{};
-    Telemetry::Position _position{double(NAN), double(NAN), NAN, NAN};
+    // Make all fields thread-safe. The values are written by the receive thread
+    // and can be polled from any number of threads, so we use seqlocks which
+    // never block the writer instead of a mutex per field.
+    SeqlockData<Telemetry::Position> _position{{double(NAN), double(NAN), NAN, NAN}};
 
-    mutable std::mutex _position_velocity_ned_mutex{};
-    Telemetry::PositionVelocityNED _position_velocity_ned{{NAN, NAN, NAN}, {NAN, NAN, NAN}};
+    SeqlockData<Telemetry::PositionVelocityNED> _position_velocity_ned{
+        {{NAN, NAN, NAN}, {NAN, NAN, NAN}}};
 
-    mutable std::mutex _home_position_mutex{};
-    Telemetry::Position _home_position{double(NAN), double(NAN), NAN, NAN};
+    SeqlockData<Telemetry::Position> _home_position{{double(NAN), double(NAN), NAN, NAN}};
 
     // If possible, just use atomic instead of a mutex.
     std::atomic_bool _in_air{false};
     std::atomic_bool _armed{false};
 
+    // The status text contains a std::string and can't be copied lock-free.
     mutable std::mutex _status_text_mutex{};
     Telemetry::StatusText _status_text{Telemetry::StatusText::StatusType::INFO, ""};
 
-    mutable std::mutex _attitude_quaternion_mutex{};
-    Telemetry::Quaternion _attitude_quaternion{NAN, NAN, NAN, NAN};
+    SeqlockData<Telemetry::Quaternion> _attitude_quaternion{{NAN, NAN, NAN, NAN}};
 
-    mutable std::mutex _camera_attitude_euler_angle_mutex{};
-    Telemetry::EulerAngle _camera_attitude_euler_angle{NAN, NAN, NAN};
+    SeqlockData<Telemetry::EulerAngle> _camera_attitude_euler_angle{{NAN, NAN, NAN}};
 
-    mutable std::mutex _attitude_angular_velocity_body_mutex{};
-    Telemetry::AngularVelocityBody _attitude_angular_velocity_body{NAN, NAN, NAN};
+    SeqlockData<Telemetry::AngularVelocityBody> _attitude_angular_velocity_body{{NAN, NAN, NAN}};
 
-    mutable std::mutex _ground_truth_mutex{};
-    Telemetry::GroundTruth _ground_truth{double(NAN), double(NAN), NAN};
+    SeqlockData<Telemetry::GroundTruth> _ground_truth{{double(NAN), double(NAN), NAN}};
 
-    mutable std::mutex _fixedwing_metrics_mutex{};
-    Telemetry::FixedwingMetrics _fixedwing_metrics{NAN, NAN, NAN};
+    SeqlockData<Telemetry::FixedwingMetrics> _fixedwing_metrics{{NAN, NAN, NAN}};
 
-    mutable std::mutex _ground_speed_ned_mutex{};
-    Telemetry::GroundSpeedNED _ground_speed_ned{NAN, NAN, NAN};
+    SeqlockData<Telemetry::GroundSpeedNED> _ground_speed_ned{{NAN, NAN, NAN}};
 
-    mutable std::mutex _imu_reading_ned_mutex{};
-    Telemetry::IMUReadingNED _imu_reading_ned{
-        {NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}, NAN};
+    SeqlockData<Telemetry::IMUReadingNED> _imu_reading_ned{
+        {{NAN, NAN, NAN}, {NAN, NAN, NAN}, {NAN, NAN, NAN}, NAN}};
 
-    mutable std::mutex _gps_info_mutex{};
-    Telemetry::GPSInfo _gps_info{0, 0};
+    SeqlockData<Telemetry::GPSInfo> _gps_info{{0, 0}};
 
-    mutable std::mutex _battery_mutex{};
-    Telemetry::Battery _battery{NAN, NAN};
+    SeqlockData<Telemetry::Battery> _battery{{NAN, NAN}};
 
-    mutable std::mutex _health_mutex{};
-    Telemetry::Health _health{false, false, false, false, false, false, false};
+    SeqlockData<Telemetry::Health> _health{{false, false, false, false, false, false, false}};
 
-    mutable std::mutex _landed_state_mutex{};
-    Telemetry::LandedState _landed_state{Telemetry::LandedState::UNKNOWN};
+    SeqlockData<Telemetry::LandedState> _landed_state{Telemetry::LandedState::UNKNOWN};
 
-    mutable std::mutex _rc_status_mutex{};
-    Telemetry::RCStatus _rc_status{false, false, 0.0f};
+    SeqlockData<Telemetry::RCStatus> _rc_status{{false, false, 0.0f}};
 
-    mutable std::mutex _unix_epoch_time_mutex{};
-    uint64_t _unix_epoch_time_us{};
+    std::atomic<uint64_t> _unix_epoch_time_us{0};
 
-    mutable std::mutex _actuator_control_target_mutex{};
-    Telemetry::ActuatorControlTarget _actuator_control_target{0, {0.0f}};
+    SeqlockData<Telemetry::ActuatorControlTarget> _actuator_control_target{{0, {0.0f}}};
 
-    mutable std::mutex _actuator_output_status_mutex{};
-    Telemetry::ActuatorOutputStatus _actuator_output_status{0, {0.0f}};
+    SeqlockData<Telemetry::ActuatorOutputStatus> _actuator_output_status{{0, {0.0f}}};
 
-    mutable std::mutex _odometry_mutex{};
-    Telemetry::Odometry _odometry{};
+    SeqlockData<Telemetry::Odometry> _odometry{Telemetry::Odometry{}};
 
     std::atomic<bool> _hitl_enabled{false};
 
-    Telemetry::position_velocity_ned_callback_t _position_velocity_ned_subscription{nullptr};
-    Telemetry::position_callback_t _position_subscription{nullptr};
-    Telemetry::position_callback_t _home_position_subscription{nullptr};
-    Telemetry::in_air_callback_t _in_air_subscription{nullptr};
-    Telemetry::status_text_callback_t _status_text_subscription{nullptr};
-    Telemetry::armed_callback_t _armed_subscription{nullptr};
-    Telemetry::attitude_quaternion_callback_t _attitude_quaternion_subscription{nullptr};
-    Telemetry::attitude_angular_velocity_body_callback_t
-        _attitude_angular_velocity_body_subscription{nullptr};
-    Telemetry::ground_truth_callback_t _ground_truth_subscription{nullptr};
-    Telemetry::fixedwing_metrics_callback_t _fixedwing_metrics_subscription{nullptr};
-    Telemetry::attitude_euler_angle_callback_t _attitude_euler_angle_subscription{nullptr};
-    Telemetry::attitude_quaternion_callback_t _camera_attitude_quaternion_subscription{nullptr};
-    Telemetry::attitude_euler_angle_callback_t _camera_attitude_euler_angle_subscription{nullptr};
-    Telemetry::ground_speed_ned_callback_t _ground_speed_ned_subscription{nullptr};
-    Telemetry::imu_reading_ned_callback_t _imu_reading_ned_subscription{nullptr};
-    Telemetry::gps_info_callback_t _gps_info_subscription{nullptr};
-    Telemetry::battery_callback_t _battery_subscription{nullptr};
-    Telemetry::flight_mode_callback_t _flight_mode_subscription{nullptr};
-    Telemetry::health_callback_t _health_subscription{nullptr};
-    Telemetry::health_all_ok_callback_t _health_all_ok_subscription{nullptr};
-    Telemetry::landed_state_callback_t _landed_state_subscription{nullptr};
-    Telemetry::rc_status_callback_t _rc_status_subscription{nullptr};
-    Telemetry::unix_epoch_time_callback_t _unix_epoch_time_subscription{nullptr};
-    Telemetry::actuator_control_target_callback_t _actuator_control_target_subscription{nullptr};
-    Telemetry::actuator_output_status_callback_t _actuator_output_status_subscription{nullptr};
-    Telemetry::odometry_callback_t _odometry_subscription{nullptr};
+    // Subscribers of each stream, updates are assembled once and handed to all of them.
+    SubscriptionList<Telemetry::PositionVelocityNED> _position_velocity_ned_subscriptions{};
+    SubscriptionList<Telemetry::Position> _position_subscriptions{};
+    SubscriptionList<Telemetry::Position> _home_position_subscriptions{};
+    SubscriptionList<bool> _in_air_subscriptions{};
+    SubscriptionList<Telemetry::StatusText> _status_text_subscriptions{};
+    SubscriptionList<bool> _armed_subscriptions{};
+    SubscriptionList<Telemetry::Quaternion> _attitude_quaternion_subscriptions{};
+    SubscriptionList<Telemetry::AngularVelocityBody>
+        _attitude_angular_velocity_body_subscriptions{};
+    SubscriptionList<Telemetry::GroundTruth> _ground_truth_subscriptions{};
+    SubscriptionList<Telemetry::FixedwingMetrics> _fixedwing_metrics_subscriptions{};
+    SubscriptionList<Telemetry::EulerAngle> _attitude_euler_angle_subscriptions{};
+    SubscriptionList<Telemetry::Quaternion> _camera_attitude_quaternion_subscriptions{};
+    SubscriptionList<Telemetry::EulerAngle> _camera_attitude_euler_angle_subscriptions{};
+    SubscriptionList<Telemetry::GroundSpeedNED> _ground_speed_ned_subscriptions{};
+    SubscriptionList<Telemetry::IMUReadingNED> _imu_reading_ned_subscriptions{};
+    SubscriptionList<Telemetry::GPSInfo> _gps_info_subscriptions{};
+    SubscriptionList<Telemetry::Battery> _battery_subscriptions{};
+    SubscriptionList<Telemetry::FlightMode> _flight_mode_subscriptions{};
+    SubscriptionList<Telemetry::Health> _health_subscriptions{};
+    SubscriptionList<bool> _health_all_ok_subscriptions{};
+    SubscriptionList<Telemetry::LandedState> _landed_state_subscriptions{};
+    SubscriptionList<Telemetry::RCStatus> _rc_status_subscriptions{};
+    SubscriptionList<uint64_t> _unix_epoch_time_subscriptions{};
+    SubscriptionList<Telemetry::ActuatorControlTarget> _actuator_control_target_subscriptions{};
+    SubscriptionList<Telemetry::ActuatorOutputStatus> _actuator_output_status_subscriptions{};
+    SubscriptionList<Telemetry::Odometry> _odometry_subscriptions{};
+
+    // Receive times of the values in snapshots, 0 if never received.
+    std::atomic<uint64_t> _position_timestamp_us{0};
+    std::atomic<uint64_t> _velocity_timestamp_us{0};
+    std::atomic<uint64_t> _attitude_timestamp_us{0};
+    std::atomic<uint64_t> _angular_velocity_timestamp_us{0};
+    std::atomic<uint64_t> _battery_timestamp_us{0};
+    std::atomic<uint64_t> _flight_mode_timestamp_us{0};
+    std::atomic<uint64_t> _health_timestamp_us{0};
+
+    // Optional history of some streams, disabled unless a depth is set.
+    TimeSeriesBuffer<Telemetry::Position> _position_history{};
+    TimeSeriesBuffer<Telemetry::Quaternion> _attitude_history{};
+    TimeSeriesBuffer<Telemetry::IMUReadingNED> _imu_reading_ned_history{};
+
+    struct SnapshotSubscription {
+        Telemetry::SnapshotField fields;
+        Telemetry::snapshot_callback_t callback;
+        void* call_every_cookie;
+    };
+    std::mutex _snapshot_mutex{};
+    std::map<uint64_t, SnapshotSubscription> _snapshot_subscriptions{};
 
     // The ground speed and position are coupled to the same message, therefore, we just use
     // the faster between the two.
     double _ground_speed_ned_rate_hz{0.0};
     double _position_rate_hz{-1.0};
 
+    // Rates set explicitly, used as the requested rate while somebody subscribes.
+    std::mutex _msg_rates_mutex{};
+    std::map<uint16_t, double> _msg_rates_hz{};
+
     void* _rc_channels_timeout_cookie{nullptr};
     void* _gps_raw_timeout_cookie{nullptr};
     void* _unix_epoch_timeout_cookie{nullptr};
@@ -0,0 +1,32 @@
+#include "mavsdk.h"
+#include "plugins/telemetry/telemetry.h"
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+TEST(Telemetry, SetRateWithoutSystem)
+{
+    Mavsdk mavsdk;
+    Telemetry telemetry(mavsdk.system());
+
+    EXPECT_EQ(telemetry.set_rate_position(10.0), Telemetry::Result::NO_SYSTEM);
+    EXPECT_EQ(telemetry.set_rate_battery(1.0), Telemetry::Result::NO_SYSTEM);
+}
+
+TEST(Telemetry, SetRateAsyncWithoutSystem)
+{
+    Mavsdk mavsdk;
+    Telemetry telemetry(mavsdk.system());
+
+    auto prom = std::make_shared<std::promise<Telemetry::Result>>();
+    auto fut = prom->get_future();
+    telemetry.set_rate_position_async(
+        10.0, [prom](Telemetry::Result result) { prom->set_value(result); });
+
+    ASSERT_EQ(fut.wait_for(std::chrono::seconds(1)), std::future_status::ready);
+    EXPECT_EQ(fut.get(), Telemetry::Result::NO_SYSTEM);
+}
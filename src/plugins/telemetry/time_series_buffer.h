@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace mavsdk {
+
+/*
+ * Ring buffer keeping the last N samples of one telemetry stream together with
+ * their timestamps.
+ *
+ * Timestamps and values are stored in separate arrays (columnar) so a range
+ * lookup can binary search the timestamps without touching the values and then
+ * hand out the values in place. Since the buffer wraps around, a range can be
+ * split into two contiguous spans which are passed to the visitor in order.
+ *
+ * Timestamps are expected to be monotonic. A depth of 0 disables the buffer,
+ * pushing is then just an atomic load.
+ */
+template<class T> class TimeSeriesBuffer {
+public:
+    TimeSeriesBuffer() = default;
+    ~TimeSeriesBuffer() = default;
+
+    void set_depth(size_t depth)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _timestamps_us.assign(depth, 0);
+        _values.assign(depth, T{});
+        _next = 0;
+        _size = 0;
+        _enabled = (depth > 0);
+    }
+
+    size_t depth() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _timestamps_us.size();
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _size;
+    }
+
+    void push(uint64_t timestamp_us, const T& value)
+    {
+        if (!_enabled) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        const size_t capacity = _timestamps_us.size();
+        if (capacity == 0) {
+            return;
+        }
+
+        _timestamps_us[_next] = timestamp_us;
+        _values[_next] = value;
+        _next = (_next + 1) % capacity;
+        if (_size < capacity) {
+            ++_size;
+        }
+    }
+
+    // Calls visitor(const uint64_t* timestamps_us, const T* values, size_t count) for
+    // the samples with start_us <= timestamp <= end_us, oldest first. The visitor is
+    // called at most twice and runs with the buffer locked, so it should not block.
+    // Returns the number of samples visited.
+    template<class Visitor>
+    size_t for_range(uint64_t start_us, uint64_t end_us, const Visitor& visitor) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (_size == 0 || start_us > end_us) {
+            return 0;
+        }
+
+        const size_t first = logical_lower_bound(start_us);
+        const size_t last = logical_upper_bound(end_us);
+        if (first >= last) {
+            return 0;
+        }
+
+        const size_t capacity = _timestamps_us.size();
+        const size_t physical_first = physical_index(first);
+        const size_t count = last - first;
+        const size_t count_until_wrap = std::min(count, capacity - physical_first);
+
+        visitor(&_timestamps_us[physical_first], &_values[physical_first], count_until_wrap);
+        if (count_until_wrap < count) {
+            visitor(&_timestamps_us[0], &_values[0], count - count_until_wrap);
+        }
+
+        return count;
+    }
+
+    // Non-copyable
+    TimeSeriesBuffer(const TimeSeriesBuffer&) = delete;
+    const TimeSeriesBuffer& operator=(const TimeSeriesBuffer&) = delete;
+
+private:
+    // Logical indices go from 0 (oldest) to _size - 1 (newest).
+    size_t physical_index(size_t logical_index) const
+    {
+        const size_t capacity = _timestamps_us.size();
+        return (_next + capacity - _size + logical_index) % capacity;
+    }
+
+    size_t logical_lower_bound(uint64_t timestamp_us) const
+    {
+        size_t low = 0;
+        size_t high = _size;
+        while (low < high) {
+            const size_t mid = low + (high - low) / 2;
+            if (_timestamps_us[physical_index(mid)] < timestamp_us) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    size_t logical_upper_bound(uint64_t timestamp_us) const
+    {
+        size_t low = 0;
+        size_t high = _size;
+        while (low < high) {
+            const size_t mid = low + (high - low) / 2;
+            if (_timestamps_us[physical_index(mid)] <= timestamp_us) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    mutable std::mutex _mutex{};
+    std::vector<uint64_t> _timestamps_us{};
+    std::vector<T> _values{};
+    size_t _next{0};
+    size_t _size{0};
+    std::atomic<bool> _enabled{false};
+};
+
+} // namespace mavsdk
@@ -0,0 +1,83 @@
+#include "time_series_buffer.h"
+
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace mavsdk;
+
+namespace {
+
+std::vector<int> collect(const TimeSeriesBuffer<int>& buffer, uint64_t start_us, uint64_t end_us)
+{
+    std::vector<int> result;
+    buffer.for_range(
+        start_us, end_us, [&result](const uint64_t* timestamps_us, const int* values, size_t count) {
+            for (size_t i = 0; i < count; ++i) {
+                EXPECT_EQ(timestamps_us[i], uint64_t(values[i]) * 10);
+                result.push_back(values[i]);
+            }
+        });
+    return result;
+}
+
+} // namespace
+
+TEST(TimeSeriesBuffer, DisabledByDefault)
+{
+    TimeSeriesBuffer<int> buffer;
+    buffer.push(10, 1);
+    EXPECT_EQ(buffer.size(), 0);
+    EXPECT_TRUE(collect(buffer, 0, 100).empty());
+}
+
+TEST(TimeSeriesBuffer, RangeWithoutWrap)
+{
+    TimeSeriesBuffer<int> buffer;
+    buffer.set_depth(10);
+
+    for (int i = 1; i <= 5; ++i) {
+        buffer.push(uint64_t(i) * 10, i);
+    }
+
+    EXPECT_EQ(buffer.size(), 5);
+    EXPECT_EQ(collect(buffer, 0, 1000), std::vector<int>({1, 2, 3, 4, 5}));
+    EXPECT_EQ(collect(buffer, 20, 40), std::vector<int>({2, 3, 4}));
+    EXPECT_EQ(collect(buffer, 21, 39), std::vector<int>({3}));
+    EXPECT_TRUE(collect(buffer, 51, 100).empty());
+    EXPECT_TRUE(collect(buffer, 40, 20).empty());
+}
+
+TEST(TimeSeriesBuffer, RangeAcrossWrap)
+{
+    TimeSeriesBuffer<int> buffer;
+    buffer.set_depth(4);
+
+    for (int i = 1; i <= 6; ++i) {
+        buffer.push(uint64_t(i) * 10, i);
+    }
+
+    EXPECT_EQ(buffer.size(), 4);
+    EXPECT_EQ(collect(buffer, 0, 1000), std::vector<int>({3, 4, 5, 6}));
+    EXPECT_EQ(collect(buffer, 40, 60), std::vector<int>({4, 5, 6}));
+
+    unsigned num_spans = 0;
+    buffer.for_range(0, 1000, [&num_spans](const uint64_t*, const int*, size_t) {
+        ++num_spans;
+    });
+    EXPECT_EQ(num_spans, 2);
+}
+
+TEST(TimeSeriesBuffer, ResetDepth)
+{
+    TimeSeriesBuffer<int> buffer;
+    buffer.set_depth(4);
+    buffer.push(10, 1);
+
+    buffer.set_depth(2);
+    EXPECT_EQ(buffer.depth(), 2);
+    EXPECT_EQ(buffer.size(), 0);
+
+    buffer.set_depth(0);
+    buffer.push(20, 2);
+    EXPECT_EQ(buffer.size(), 0);
+}